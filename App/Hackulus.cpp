@@ -64,6 +64,15 @@ public:
 
   void Render(const StereoEyeParams& stereo);
 
+  // Reads the predicted HMD orientation into ThePlayer's yaw, pitch and roll.
+  void UpdateSensorOrientation();
+  // Rebuilds View and FullView from ThePlayer's position and orientation.
+  void UpdateView();
+  Matrix4f GetEyeOrientation() const;
+  // Counts a finished frame, which made allocs heap allocations on this
+  // thread, toward the -checkallocs run.
+  void CheckFrameAllocs(UInt32 allocs);
+
   // Sets temporarily displayed message for adjustments
   void SetAdjustMessage(const char* format, ...);
   // Overrides current timeout, in seconds (not the future default value);
@@ -127,9 +136,31 @@ protected:
   Util::LatencyTest LatencyUtil;
 
   double LastUpdate;
+  // Smoothed time between frames, used to predict when a frame is displayed.
+  float FrameInterval;
+  // Time the frame being built is expected to reach the display; every sensor
+  // read for the frame predicts to it.
+  double FrameDisplayTime;
+  // Re-read the sensor right before each eye and before its distortion pass,
+  // re-projecting the eye buffer by whatever rotation happened since.
+  bool LateLatch;
+  // Defer distortion of both eyes to just before Present, warping them to
+  // the orientation at that point.
+  bool Timewarp;
+  // Orientation View was last built with.
+  Matrix4f RenderOrientation;
   int FPS;
   int FrameCounter;
+  // Per-frame scratch memory, reset after Present.
+  FrameArena FrameMemory;
   double NextFPSUpdate;
+  // Set by -checkallocs: number of steady-state frames to check for heap
+  // allocations before exiting, with status 1 if any frame made one.
+  int AllocCheckFrames;
+  int AllocCheckFrame;      // Frames since the scene finished loading.
+  int AllocCheckFailures;   // Checked frames that made heap allocations.
+  // This thread's allocation count at the end of the last frame.
+  UInt32 RenderThreadAllocCount;
 
   Array<Ptr<CollisionModel> > CollisionModels;
   Array<Ptr<CollisionModel> > GroundCollisionModels;
@@ -170,7 +201,8 @@ protected:
   float DistortionK2;
   float DistortionK3;
 
-  String AdjustMessage;
+  // Fixed storage, so that per-frame adjustments don't allocate.
+  char AdjustMessage[2048];
   double AdjustMessageTimeout;
 
   // Saved distortion state.
@@ -196,18 +228,8 @@ protected:
   };
   TextScreen TextScreen;
 
-  struct DeviceStatusNotificationDesc {
-    DeviceHandle Handle;
-    MessageType Action;
-
-    DeviceStatusNotificationDesc()
-        : Action(Message_None) {
-    }
-    DeviceStatusNotificationDesc(MessageType mt, const DeviceHandle& dev)
-        : Handle(dev), Action(mt) {
-    }
-  };
-  Array<DeviceStatusNotificationDesc> DeviceStatusNotificationsQueue;
+  // Filled on the device manager thread by OnMessage, drained in OnIdle.
+  DeviceStatusQueue DeviceStatusNotifications;
 
   Model* CreateModel(Vector3f pos, struct SlabModel* sm);
   Model* CreateBoundingModel(CollisionModel &cm);
@@ -221,7 +243,9 @@ protected:
 //-------------------------------------------------------------------------------------
 
 HackulusApp::HackulusApp()
-    : pRender(0), LastUpdate(0), LoadingState(LoadingState_Frame0),
+    : pRender(0), LastUpdate(0), FrameInterval(1.0f / 60.0f),
+    FrameDisplayTime(0), LateLatch(false), Timewarp(false),
+    LoadingState(LoadingState_Frame0),
     // Initial location
     SConfig(), PostProcess(PostProcess_Distortion),
     DistortionClearColor(0, 0, 0),
@@ -240,10 +264,18 @@ HackulusApp::HackulusApp()
   FrameCounter = 0;
   NextFPSUpdate = 0;
 
+  AllocCheckFrames = 0;
+  AllocCheckFrame = 0;
+  AllocCheckFailures = 0;
+  RenderThreadAllocCount = 0;
+
   ConsecutiveLowFPSFrames = 0;
   CurrentLODFileIndex = 0;
 
+  AdjustMessage[0] = 0;
   AdjustMessageTimeout = 0;
+
+  FrameArena::SetCurrent(&FrameMemory);
 }
 
 HackulusApp::~HackulusApp() {
@@ -268,7 +300,27 @@ int HackulusApp::OnStartup(int argc, const char** argv) {
   // Sensor object is created from the HMD, to ensure that it is on the
   // correct device.
 
-  pManager = *DeviceManager::Create();
+  // Sensor reports can be recorded with -capture and played back instead of
+  // live hardware with -replay; -replayfast replays without waiting.
+  // -rtprio, -sensorcpu and -mlock keep sensor timing stable under load.
+  DeviceManagerOptions managerOptions;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-capture") && i < argc - 1) {
+      managerOptions.CapturePath = argv[i + 1];
+    } else if (!strcmp(argv[i], "-replay") && i < argc - 1) {
+      managerOptions.ReplayPath = argv[i + 1];
+    } else if (!strcmp(argv[i], "-replayfast")) {
+      managerOptions.ReplayRealTime = false;
+    } else if (!strcmp(argv[i], "-rtprio") && i < argc - 1) {
+      managerOptions.ThreadRealTimePriority = atoi(argv[i + 1]);
+    } else if (!strcmp(argv[i], "-sensorcpu") && i < argc - 1) {
+      managerOptions.ThreadProcessor = atoi(argv[i + 1]);
+    } else if (!strcmp(argv[i], "-mlock")) {
+      managerOptions.LockMemory = true;
+    }
+  }
+
+  pManager = *DeviceManager::Create(managerOptions);
 
   // We'll handle it's messages in this case.
   pManager->SetMessageHandler(this);
@@ -352,6 +404,18 @@ int HackulusApp::OnStartup(int argc, const char** argv) {
     SFusion.SetDelegateMessageHandler(this);
 
     SFusion.SetPredictionEnabled(true);
+    // Prediction is aimed at the frame's display time; the prediction delta
+    // only covers the panel's own latency after the frame is presented.
+    SFusion.SetPrediction(0.015f);
+    for (int i = 1; i < argc; i++) {
+      if (!strcmp(argv[i], "-accelpredict")) {
+        SFusion.SetPredictor(SensorFusion::Predictor_ConstantAcceleration);
+      } else if (!strcmp(argv[i], "-latelatch")) {
+        LateLatch = true;
+      } else if (!strcmp(argv[i], "-timewarp")) {
+        Timewarp = true;
+      }
+    }
   }
 
   // *** Initialize Rendering
@@ -364,13 +428,22 @@ int HackulusApp::OnStartup(int argc, const char** argv) {
       graphics = argv[i + 1];
     } else if (!strcmp(argv[i], "-fs")) {
       RenderParams.Fullscreen = true;
+    } else if (!strcmp(argv[i], "-checkallocs") && i < argc - 1) {
+      AllocCheckFrames = atoi(argv[i + 1]);
     }
   }
+  if (AllocCheckFrames > 0 && !TrackingAllocator::GetTracker()) {
+    fprintf(stderr, "-checkallocs needs a build made with TRACK_ALLOCS=1.\n");
+    return 1;
+  }
 
   // Enable multi-sampling by default.
   RenderParams.Multisample = 4;
+  // Keep linked shader programs between runs.
+  RenderParams.ShaderCachePath = "Hackulus.shadercache";
   pRender = pPlatform->SetupGraphics(OVR_DEFAULT_RENDER_DEVICE_SET, graphics,
       RenderParams);
+  pRender->InitFont(&DejaVu);
 
   // *** Configure Stereo settings.
 
@@ -389,6 +462,7 @@ int HackulusApp::OnStartup(int argc, const char** argv) {
   }
 
   pRender->SetSceneRenderScale(SConfig.GetDistortionScale());
+  pRender->SetTimewarpEnabled(Timewarp);
   //pRender->SetSceneRenderScale(1.0f);
 
   SConfig.Set2DAreaFov(DegreeToRad(85.0f));
@@ -431,11 +505,7 @@ void HackulusApp::OnMessage(const Message& msg) {
       const MessageDeviceStatus& statusMsg =
           static_cast<const MessageDeviceStatus&>(msg);
 
-      { // limit the scope of the lock
-        Lock::Locker lock(pManager->GetHandlerLock());
-        DeviceStatusNotificationsQueue.PushBack(
-            DeviceStatusNotificationDesc(statusMsg.Type, statusMsg.Handle));
-      }
+      DeviceStatusNotifications.Push(statusMsg);
 
       switch (statusMsg.Type) {
         case OVR::Message_DeviceAdded:
@@ -1009,6 +1079,7 @@ void HackulusApp::OnIdle() {
   double curtime = pPlatform->GetAppTime();
   float dt = float(curtime - LastUpdate);
   LastUpdate = curtime;
+  FrameInterval += (Alg::Min(dt, 0.1f) - FrameInterval) * 0.1f;
 
   // Update gamepad.
   GamepadState gamepadState;
@@ -1020,33 +1091,19 @@ void HackulusApp::OnIdle() {
   if (LoadingState == LoadingState_DoLoad) {
     PopulateScene(MainFilePath.ToCStr());
     LoadingState = LoadingState_Finished;
+    if (TrackingAllocator* tracker = TrackingAllocator::GetTracker()) {
+      tracker->EndFrame();
+      tracker->LogStats();
+    }
     return;
   }
 
   // Check if any new devices were connected.
   {
-    bool queueIsEmpty = false;
-    while (!queueIsEmpty) {
-      DeviceStatusNotificationDesc desc;
-
-      {
-        Lock::Locker lock(pManager->GetHandlerLock());
-        if (DeviceStatusNotificationsQueue.GetSize() == 0)
-          break;
-        desc = DeviceStatusNotificationsQueue.Front();
-
-        // We can't call Clear under the lock since this may introduce a dead lock:
-        // this thread is locked by HandlerLock and the Clear might cause
-        // call of Device->Release, which will use Manager->DeviceLock. The bkg
-        // thread is most likely locked by opposite way:
-        // Manager->DeviceLock ==> HandlerLock, therefore - a dead lock.
-        // So, just grab the first element, save a copy of it and remove
-        // the element (Device->Release won't be called since we made a copy).
-
-        DeviceStatusNotificationsQueue.RemoveAt(0);
-        queueIsEmpty = (DeviceStatusNotificationsQueue.GetSize() == 0);
-      }
-
+    // The queue is lock-free, so releasing handles here can't deadlock against
+    // the manager thread holding DeviceLock while it calls OnMessage.
+    DeviceStatusQueue::Entry desc;
+    while (DeviceStatusNotifications.Pop(&desc)) {
       bool wasAlreadyCreated = desc.Handle.IsCreated();
 
       if (desc.Action == Message_DeviceAdded) {
@@ -1167,24 +1224,11 @@ void HackulusApp::OnIdle() {
   LatencyUtil.ProcessInputs();
 
   // Handle Sensor motion.
-  // We extract Yaw, Pitch, Roll instead of directly using the orientation
-  // to allow "additional" yaw manipulation with mouse/controller.
   if (pSensor) {
-    Quatf hmdOrient = SFusion.GetPredictedOrientation();
-
-    float yaw = 0.0f;
-    hmdOrient.GetEulerAngles<Axis_Y, Axis_X, Axis_Z>(&yaw, &ThePlayer.EyePitch,
-        &ThePlayer.EyeRoll);
-
-    ThePlayer.EyeYaw += (yaw - ThePlayer.LastSensorYaw);
-    ThePlayer.LastSensorYaw = yaw;
-
-    // NOTE: We can get a matrix from orientation as follows:
-    // Matrix4f hmdMat(hmdOrient);
-
-    // Test logic - assign quaternion result directly to view:
-    // Quatf hmdOrient = SFusion.GetOrientation();
-    // View = Matrix4f(hmdOrient.Inverted()) * Matrix4f::Translation(-EyePos);
+    // The frame built now is presented about one frame interval from now.
+    FrameDisplayTime = Timer::GetSeconds() + FrameInterval
+        + SFusion.GetPredictionDelta();
+    UpdateSensorOrientation();
   }
 
   if (curtime >= NextFPSUpdate) {
@@ -1222,11 +1266,113 @@ void HackulusApp::OnIdle() {
     }
   }
 
-  // Rotate and position View Camera, using YawPitchRoll in BodyFrame coordinates.
-  //
-  Matrix4 rollPitchYaw = Matrix4f::RotationY(ThePlayer.EyeYaw)
+  UpdateView();
+
+  switch (SConfig.GetStereoMode()) {
+    case Stereo_None:
+      Render(SConfig.GetEyeRenderParams(StereoEye_Center));
+      break;
+
+    case Stereo_LeftRight_Multipass:
+      //case Stereo_LeftDouble_Multipass:
+      Render(SConfig.GetEyeRenderParams(StereoEye_Left));
+      Render(SConfig.GetEyeRenderParams(StereoEye_Right));
+      break;
+
+  }
+
+  if (pRender->IsTimewarpEnabled()) {
+    // Present-time orientation: sampled now rather than at the start of the
+    // frame, so a frame that took longer than planned is still shown with
+    // the orientation of when it actually reaches the display.
+    Matrix4f displayOrientation = RenderOrientation;
+    if (pSensor) {
+      double presentTime = Timer::GetSeconds() + SFusion.GetPredictionDelta();
+      Quatf hmdOrient = SFusion.GetPredictedOrientationAt(presentTime);
+      float yaw = 0.0f, pitch = 0.0f, roll = 0.0f;
+      hmdOrient.GetEulerAngles<Axis_Y, Axis_X, Axis_Z>(&yaw, &pitch, &roll);
+      displayOrientation = Matrix4f::RotationY(
+          ThePlayer.EyeYaw + (yaw - ThePlayer.LastSensorYaw))
+          * Matrix4f::RotationX(pitch) * Matrix4f::RotationZ(roll);
+    }
+    pRender->FinishTimewarp(displayOrientation);
+  }
+
+  pRender->Present();
+  // Force GPU to flush the scene, resulting in the lowest possible latency.
+  pRender->ForceFlushGPU();
+  // Everything allocated from the frame arena this frame is dead by now.
+  FrameMemory.Reset();
+
+  if (TrackingAllocator* tracker = TrackingAllocator::GetTracker()) {
+    // Once the scene is loaded the frame loop shouldn't touch the heap.
+    UInt32 allocs = tracker->EndFrame();
+    if (allocs) {
+      LogText("Frame %d made %u heap allocations.\n", FrameCounter, allocs);
+    }
+    // The sensor and loader threads allocate on their own schedule, so the
+    // check counts only the frame loop's own allocations.
+    UInt32 threadAllocs = TrackingAllocator::GetThreadAllocCount();
+    if (AllocCheckFrames > 0 && LoadingState == LoadingState_Finished) {
+      CheckFrameAllocs(threadAllocs - RenderThreadAllocCount);
+    }
+    RenderThreadAllocCount = threadAllocs;
+  }
+}
+
+// Frames allowed after loading for caches, the frame arena and the text meshes
+// to reach their steady-state size.
+static const int AllocCheckWarmupFrames = 120;
+
+void HackulusApp::CheckFrameAllocs(UInt32 allocs) {
+  AllocCheckFrame++;
+  if (AllocCheckFrame <= AllocCheckWarmupFrames) {
+    return;
+  }
+  if (allocs) {
+    AllocCheckFailures++;
+  }
+  if (AllocCheckFrame == AllocCheckWarmupFrames + AllocCheckFrames) {
+    LogText("Allocation check: %d of %d frames made heap allocations.\n",
+        AllocCheckFailures, AllocCheckFrames);
+    pPlatform->Exit(AllocCheckFailures ? 1 : 0);
+  }
+}
+
+void HackulusApp::UpdateSensorOrientation() {
+  // We extract Yaw, Pitch, Roll instead of directly using the orientation
+  // to allow "additional" yaw manipulation with mouse/controller.
+
+  // Late re-reads predict to the same display time as the first one, so they
+  // only add fresher samples rather than looking further ahead.
+  Quatf hmdOrient = SFusion.GetPredictedOrientationAt(FrameDisplayTime);
+
+  float yaw = 0.0f;
+  hmdOrient.GetEulerAngles<Axis_Y, Axis_X, Axis_Z>(&yaw, &ThePlayer.EyePitch,
+      &ThePlayer.EyeRoll);
+
+  ThePlayer.EyeYaw += (yaw - ThePlayer.LastSensorYaw);
+  ThePlayer.LastSensorYaw = yaw;
+
+  // NOTE: We can get a matrix from orientation as follows:
+  // Matrix4f hmdMat(hmdOrient);
+
+  // Test logic - assign quaternion result directly to view:
+  // Quatf hmdOrient = SFusion.GetOrientation();
+  // View = Matrix4f(hmdOrient.Inverted()) * Matrix4f::Translation(-EyePos);
+}
+
+Matrix4f HackulusApp::GetEyeOrientation() const {
+  return Matrix4f::RotationY(ThePlayer.EyeYaw)
       * Matrix4f::RotationX(ThePlayer.EyePitch)
       * Matrix4f::RotationZ(ThePlayer.EyeRoll);
+}
+
+void HackulusApp::UpdateView() {
+  // Rotate and position View Camera, using YawPitchRoll in BodyFrame coordinates.
+  //
+  RenderOrientation = GetEyeOrientation();
+  Matrix4 rollPitchYaw = RenderOrientation;
   Vector4f up = rollPitchYaw.transform(Player::UpVector);
   Vector4f forward = rollPitchYaw.transform(Player::ForwardVector);
   Vector4f in = rollPitchYaw.transform(Player::InVector);
@@ -1257,26 +1403,17 @@ void HackulusApp::OnIdle() {
   //  View = (Matrix4f::RotationY(EyeYaw) * Matrix4f::RotationX(EyePitch) *
   //                                        Matrix4f::RotationZ(EyeRoll)).Transposed() *
   //         Matrix4f::Translation(-EyePos);
+}
 
-  switch (SConfig.GetStereoMode()) {
-    case Stereo_None:
-      Render(SConfig.GetEyeRenderParams(StereoEye_Center));
-      break;
-
-    case Stereo_LeftRight_Multipass:
-      //case Stereo_LeftDouble_Multipass:
-      Render(SConfig.GetEyeRenderParams(StereoEye_Left));
-      Render(SConfig.GetEyeRenderParams(StereoEye_Right));
-      break;
+void HackulusApp::Render(const StereoEyeParams& stereo) {
+  AllocSubsystemScope allocScope(AllocSubsystem_Render);
 
+  // Late latch: pick up head motion since the view was last built.
+  if (LateLatch && pSensor) {
+    UpdateSensorOrientation();
+    UpdateView();
   }
 
-  pRender->Present();
-  // Force GPU to flush the scene, resulting in the lowest possible latency.
-  pRender->ForceFlushGPU();
-}
-
-void HackulusApp::Render(const StereoEyeParams& stereo) {
   pRender->BeginScene(PostProcess);
 
   // *** 3D - Configures Viewport/Projection and Render
@@ -1313,6 +1450,8 @@ void HackulusApp::Render(const StereoEyeParams& stereo) {
   // to a readable FOV area centered at your eye and properly adjusted.
   pRender->ApplyStereoParams2D(stereo);
   pRender->SetDepthMode(false, false);
+  // Everything from here on is head-locked, so keep it out of the reprojection.
+  pRender->BeginOverlay();
 
   float unitPixel = SConfig.Get2DUnitPixel();
   float textHeight = unitPixel * 22;
@@ -1325,15 +1464,16 @@ void HackulusApp::Render(const StereoEyeParams& stereo) {
   // Display Loading screen-shot in frame 0.
   if (LoadingState != LoadingState_Finished) {
     LoadingScene.Render(pRender, Matrix4f(), NULL /* fullView */);
-    String loadMessage = String("Loading ") + MainFilePath;
+    FrameString loadMessage("Loading ");
+    loadMessage += MainFilePath.ToCStr();
     DrawTextBox(pRender, 0.0f, 0.0f, textHeight, loadMessage.ToCStr(),
         DrawText_HCenter);
     LoadingState = LoadingState_DoLoad;
   }
 
-  if (!AdjustMessage.IsEmpty()
+  if (AdjustMessage[0]
       && AdjustMessageTimeout > pPlatform->GetAppTime()) {
-    DrawTextBox(pRender, 0.0f, 0.4f, textHeight, AdjustMessage.ToCStr(),
+    DrawTextBox(pRender, 0.0f, 0.4f, textHeight, AdjustMessage,
         DrawText_HCenter);
   }
 
@@ -1356,6 +1496,11 @@ void HackulusApp::Render(const StereoEyeParams& stereo) {
         OVR_sprintf(gpustat, sizeof(gpustat), "\n GPU Tex: %u MB", texMemInMB);
         OVR_strcat(buf, sizeof(buf), gpustat);
       }
+      if (TrackingAllocator* tracker = TrackingAllocator::GetTracker()) {
+        OVR_sprintf(gpustat, sizeof(gpustat), "\n Allocs/Frame: %u",
+            tracker->GetLastFrameAllocCount());
+        OVR_strcat(buf, sizeof(buf), gpustat);
+      }
 
       DrawTextBox(pRender, 0.0f, -0.15f, textHeight, buf, DrawText_HCenter);
     } break;
@@ -1391,20 +1536,29 @@ void HackulusApp::Render(const StereoEyeParams& stereo) {
     pRender->FillRect(-0.4f, -0.4f, 0.4f, 0.4f, colorToDisplay);
   }
 
+  // Sample once more just before distortion, and rotate the eye buffer from
+  // the orientation it was rendered with to the current one.
+  // With timewarp the eye is instead re-projected at Present.
+  if (pRender->IsTimewarpEnabled()) {
+    pRender->SetTimewarpOrientation(stereo.Projection, RenderOrientation);
+  } else if (LateLatch && pSensor && (PostProcess == PostProcess_Distortion)) {
+    UpdateSensorOrientation();
+    pRender->SetReprojection(stereo.Projection,
+        RenderOrientation.Transposed() * GetEyeOrientation());
+  }
+
   pRender->FinishScene();
 }
 
 // Sets temporarily displayed message for adjustments
 void HackulusApp::SetAdjustMessage(const char* format, ...) {
   Lock::Locker lock(pManager->GetHandlerLock());
-  char textBuff[2048];
   va_list argList;
   va_start(argList, format);
-  OVR_vsprintf(textBuff, sizeof(textBuff), format, argList);
+  OVR_vsprintf(AdjustMessage, sizeof(AdjustMessage), format, argList);
   va_end(argList);
 
   // Message will time out in 4 seconds.
-  AdjustMessage = textBuff;
   AdjustMessageTimeout = pPlatform->GetAppTime() + 4.0f;
 }
 
@@ -1491,6 +1645,7 @@ void HackulusApp::AdjustEsd(float val) {
 
 // Loads the scene data
 void HackulusApp::PopulateScene(const char *fileName) {
+  AllocSubsystemScope allocScope(AllocSubsystem_Loader);
   XmlHandler xmlHandler;
   if (!xmlHandler.ReadFile(fileName, pRender, &MainScene, &CollisionModels,
       &GroundCollisionModels)) {
@@ -1544,7 +1699,7 @@ void HackulusApp::PopulateScene(const char *fileName) {
 //      pRender->LoadBuiltinShader(Shader_Fragment, FShader_Debug));
   testGreenBox->Fill = consistencyTestShader;
   MainScene.World.Add(testGreenBox);
-  MainScene.Models.PushBack(testGreenBox);
+  MainScene.Models.PushBack(Move(testGreenBox));
 
 
   typedef std::vector<Color> ColorList;
@@ -1588,7 +1743,7 @@ void HackulusApp::PopulateScene(const char *fileName) {
   tesseractModel->SetPosition(tesseractOrigin.asV3());
 
   MainScene.World.Add(tesseractModel);
-  MainScene.Models.PushBack(tesseractModel);
+  MainScene.Models.PushBack(Move(tesseractModel));
 }
 
 void HackulusApp::PopulatePreloadScene() {
@@ -1596,7 +1751,8 @@ void HackulusApp::PopulatePreloadScene() {
   String fileName = MainFilePath;
   fileName.StripExtension();
 
-  Ptr<File> imageFile = *new SysFile(fileName + "_LoadScreen.tga");
+  Ptr<File> imageFile = *new SysFile(fileName + "_LoadScreen.tga",
+                                     File::Open_Read | File::Open_Buffered | File::Open_Mapped);
   Ptr<Texture> imageTex;
   if (imageFile->IsValid())
     imageTex = *LoadTextureTga(pRender, imageFile);
@@ -1664,7 +1820,7 @@ void HackulusApp::PopulateLODFileNames() {
     }
     fclose(fp);
     OVR::String result = buffer;
-    LODFilePaths.PushBack(result);
+    LODFilePaths.PushBack(Move(result));
     LODIndex++;
   }
 }
@@ -1737,7 +1893,15 @@ void HackulusApp::GamepadStateChanged(const GamepadState& pad) {
 
 //-------------------------------------------------------------------------------------
 
-OVR_PLATFORM_APP(HackulusApp);
+#if defined(HACKULUS_TRACK_ALLOCS)
+// Profiling build: every allocation is recorded, heap use per frame is logged
+// and blocks still live at exit are reported.
+OVR_PLATFORM_APP_ARGS_ALLOC(HackulusApp, (),
+    OVR::TrackingAllocator::InitSystemSingleton(OVR::PoolAllocator::InitSystemSingleton()));
+#else
+// Small-object heavy phases (scene load, profile parsing) go through the pool allocator.
+OVR_PLATFORM_APP_ARGS_ALLOC(HackulusApp, (), OVR::PoolAllocator::InitSystemSingleton());
+#endif
 
 /************************************************************************************
  Modified from :
@@ -536,6 +536,8 @@ void RenderDevice::Present()
 
 void RenderDevice::Shutdown()
 {
+    GL::RenderDevice::Shutdown();
+
     if (Context)
     {
         glXMakeCurrent(Disp, 0, NULL);
@@ -509,6 +509,10 @@ void RenderDevice::Present()
 
 void RenderDevice::Shutdown()
 {
+    if (Context)
+    {
+        GL::RenderDevice::Shutdown();
+    }
     Context = NULL;
 }
 
@@ -85,16 +85,22 @@ KeyCode MapVKToKeyCode(unsigned vk);
 }}}
 
 
-// OVR_PLATFORM_APP_ARGS specifies the Application class to use for startup,
-// providing it with startup arguments.
-#define OVR_PLATFORM_APP_ARGS(AppClass, args)                                            \
+// OVR_PLATFORM_APP_ARGS_ALLOC specifies the Application class to use for startup,
+// providing it with startup arguments and the Allocator System::Init installs.
+#define OVR_PLATFORM_APP_ARGS_ALLOC(AppClass, args, palloc)                              \
     OVR::Platform::Application* OVR::Platform::Application::CreateApplication()          \
-    { OVR::System::Init(OVR::Log::ConfigureDefaultLog(OVR::LogMask_All));                \
+    { OVR::System::Init(OVR::AsyncLog::ConfigureAsyncLog(OVR::LogMask_All), palloc);     \
+      OVR::AsyncLog::GetAsyncLog()->Start();                                             \
       return new AppClass args; }                                                        \
     void OVR::Platform::Application::DestroyApplication(OVR::Platform::Application* app) \
     { OVR::Platform::PlatformCore* platform = app->pPlatform;                            \
       delete app; delete platform; OVR::System::Destroy(); };
 
+// OVR_PLATFORM_APP_ARGS specifies the Application class to use for startup,
+// providing it with startup arguments.
+#define OVR_PLATFORM_APP_ARGS(AppClass, args) \
+    OVR_PLATFORM_APP_ARGS_ALLOC(AppClass, args, OVR::DefaultAllocator::InitSystemSingleton())
+
 // OVR_PLATFORM_APP_ARGS specifies the Application startup class with no args.
 #define OVR_PLATFORM_APP(AppClass) OVR_PLATFORM_APP_ARGS(AppClass, ())
 
@@ -2,6 +2,10 @@
 #include "../Render/Render_Font.h"
 
 #include "Kernel/OVR_Log.h"
+#include "Kernel/OVR_FrameArena.h"
+#include "Kernel/OVR_Hash.h"
+#include "Kernel/OVR_List.h"
+#include "Kernel/OVR_UTF8Util.h"
 
 namespace OVR {
 namespace Render {
@@ -20,6 +24,33 @@ void Container::Render(const Matrix4f& ltw, RenderDevice* ren, const ViewMatrice
   }
 }
 
+void Container::SortByFill() {
+  // Stable grouping: each node goes after the last one with the same key.
+  // Models are keyed by Fill; anything else is its own group.
+  Hash<const void*, UPInt> groups;
+  Array<Array<Ptr<Node> > > grouped;
+  for (UPInt i = 0; i < Nodes.GetSize(); i++) {
+    const void* key = Nodes[i].GetPtr();
+    if (Nodes[i]->GetType() == Node_Model) {
+      key = ((Model*) Nodes[i].GetPtr())->Fill.GetPtr();
+    }
+    UPInt* group = groups.Get(key);
+    if (!group) {
+      groups.Add(key, grouped.GetSize());
+      grouped.PushBack(Array<Ptr<Node> >());
+      group = groups.Get(key);
+    }
+    grouped[*group].PushBack(Nodes[i]);
+  }
+
+  UPInt n = 0;
+  for (UPInt g = 0; g < grouped.GetSize(); g++) {
+    for (UPInt i = 0; i < grouped[g].GetSize(); i++) {
+      Nodes[n++] = grouped[g][i];
+    }
+  }
+}
+
 Matrix4f SceneView::GetViewMatrix() const {
   Matrix4f view = Matrix4f(GetOrientation().Conj())
       * Matrix4f::Translation(GetPosition());
@@ -432,12 +463,19 @@ void ShaderFill::Set(PrimitiveType prim) const {
 //-------------------------------------------------------------------------------------
 // ***** Rendering
 
+// Initial size of the immediate-mode vertex ring; enough for several screens of HUD
+// text per frame. It grows if a single request doesn't fit.
+static const size_t DynamicVertexRingSize = 1024 * 1024;
+
 RenderDevice::RenderDevice()
-    : CurPostProcess(PostProcess_None), SceneColorTexW(0), SceneColorTexH(0), SceneRenderScale(
-        1),
+    : DynamicVertexCapacity(DynamicVertexRingSize), DynamicVertexOffset(0),
+    pTextCache(NULL),
+    CurPostProcess(PostProcess_None), OverlaySupported(false), OverlayActive(
+        false), SceneColorTexW(0), SceneColorTexH(0), SceneRenderScale(1),
 
     Distortion(1.0f, 0.18f, 0.115f), DistortionClearColor(0, 0, 0), PostProcessShaderActive(
-        PostProcessShader_DistortionAndChromAb), TotalTextureMemoryUsage(0) {
+        PostProcessShader_DistortionAndChromAb), TotalTextureMemoryUsage(0),
+    ReprojectionEnabled(false), TimewarpEnabled(false), TimewarpEyeCount(0) {
   PostProcessShaderRequested = PostProcessShaderActive;
 }
 
@@ -467,16 +505,29 @@ void RenderDevice::SetLighting(const LightingParams* lt) {
   SetCommonUniformBuffer(1, LightingBuffer);
 }
 
-float RenderDevice::MeasureText(const Font* font, const char* str, float size,
-    float* strsize) {
-  UPInt length = strlen(str);
+//-------------------------------------------------------------------------------------
+// ***** Text
+
+// Walks a UTF-8 string in font units, calling emit(ch, x, y) for every glyph.
+// Returns the width of the widest line and stores the number of lines.
+template<class Emit>
+static float layoutText(const Font* font, const char* str, Emit& emit,
+    int* lineCount) {
   float w = 0;
   float xp = 0;
-  float yp = 0;
+  float yp = (float) font->ascent;
+  int lines = 1;
+  const char* p = str;
+
+  for (;;) {
+    UInt32 code = UTF8Util::DecodeNextChar(&p);
+    if (code == 0) {
+      break;
+    }
 
-  for (UPInt i = 0; i < length; i++) {
-    if (str[i] == '\n') {
+    if (code == '\n') {
       yp += font->lineheight;
+      lines++;
       if (xp > w) {
         w = xp;
       }
@@ -485,145 +536,434 @@ float RenderDevice::MeasureText(const Font* font, const char* str, float size,
     }
 
     // Tab followed by a numbers sets position to specified offset.
-    if (str[i] == '\t') {
-      char *p = 0;
-      float tabPixels = (float) OVR_strtoq(str + i + 1, &p, 10);
-      i += p - (str + i + 1);
-      xp = tabPixels;
-    } else {
-      const Font::Char* ch = &font->chars[str[i]];
-      xp += ch->advance;
+    if (code == '\t') {
+      char *end = 0;
+      xp = (float) OVR_strtoq(p, &end, 10);
+      p = end;
+      continue;
     }
+
+    if (code >= Font::CharCount) {
+      code = '?';
+    }
+    const Font::Char* ch = &font->chars[code];
+    emit(ch, xp, yp);
+    xp += ch->advance;
   }
 
   if (xp > w) {
     w = xp;
   }
+  *lineCount = lines;
+  return w;
+}
 
-  if (strsize) {
-    strsize[0] = (size / font->lineheight) * w;
-    strsize[1] = (size / font->lineheight) * (yp + font->lineheight);
+struct MeasureGlyphs {
+  int Count;
+
+  MeasureGlyphs()
+      : Count(0) {
   }
-  return (size / font->lineheight) * w;
-}
+  void operator()(const Font::Char*, float, float) {
+    Count++;
+  }
+};
 
-void RenderDevice::RenderText(const Font* font, const char* str, float x,
-    float y, float size, Color c) {
-  if (!pTextVertexBuffer) {
-    pTextVertexBuffer = *CreateBuffer();
-    if (!pTextVertexBuffer) {
-      return;
-    }
+struct EmitGlyphVertices {
+  const Font* pFont;
+  GlyphVertex* Vertices;
+  Color C;
+
+  static UInt16 uv(float t) {
+    return (UInt16) (t * 65535.0f + 0.5f);
   }
 
-  if (!font->fill) {
-    font->fill = CreateTextureFill(
-        Ptr<Texture>(
-            *CreateTexture(Texture_R, font->twidth, font->theight, font->tex)),
-        true);
+  void operator()(const Font::Char* ch, float xp, float yp) {
+    float x = xp + ch->x;
+    float y = yp - ch->y;
+    float x2 = x + pFont->twidth * pFont->tscale * (ch->u2 - ch->u1);
+    float y2 = y + pFont->theight * pFont->tscale * (ch->v2 - ch->v1);
+    GlyphVertex corners[4] = {
+      { x, y, uv(ch->u1), uv(ch->v1), C },
+      { x2, y, uv(ch->u2), uv(ch->v1), C },
+      { x2, y2, uv(ch->u2), uv(ch->v2), C },
+      { x, y2, uv(ch->u1), uv(ch->v2), C } };
+    Vertices[0] = corners[0];
+    Vertices[1] = corners[1];
+    Vertices[2] = corners[2];
+    Vertices[3] = corners[0];
+    Vertices[4] = corners[2];
+    Vertices[5] = corners[3];
+    Vertices += 6;
   }
+};
 
-  UPInt length = strlen(str);
+struct EmitVertices {
+  const Font* pFont;
+  Vertex* Vertices;
+  Color C;
 
-  pTextVertexBuffer->Data(Buffer_Vertex, NULL, length * 6 * sizeof(Vertex));
-  Vertex* vertices = (Vertex*) pTextVertexBuffer->Map(0,
-      length * 6 * sizeof(Vertex), Map_Discard);
-  if (!vertices) {
-    return;
+  void operator()(const Font::Char* ch, float xp, float yp) {
+    float x = xp + ch->x;
+    float y = yp - ch->y;
+    float cx = pFont->twidth * pFont->tscale * (ch->u2 - ch->u1);
+    float cy = pFont->theight * pFont->tscale * (ch->v2 - ch->v1);
+    Vertices[0] = Vertex(Vector3f(x, y, 0), C, ch->u1, ch->v1);
+    Vertices[1] = Vertex(Vector3f(x + cx, y, 0), C, ch->u2, ch->v1);
+    Vertices[2] = Vertex(Vector3f(x + cx, cy + y, 0), C, ch->u2, ch->v2);
+    Vertices[3] = Vertex(Vector3f(x, y, 0), C, ch->u1, ch->v1);
+    Vertices[4] = Vertex(Vector3f(x + cx, cy + y, 0), C, ch->u2, ch->v2);
+    Vertices[5] = Vertex(Vector3f(x, y + cy, 0), C, ch->u1, ch->v2);
+    Vertices += 6;
   }
+};
+
+// Strings drawn at least this many times get a retained mesh. Below that they go
+// through the vertex ring, so text that changes every frame (drawn once per eye)
+// doesn't churn buffers.
+static const int TextMeshMinUses = 4;
+
+// Retained glyph meshes keyed by font, string and color. Size and position are
+// applied through the transform, so one mesh serves every place a string is drawn.
+// Each entry also keeps the string's layout, which doesn't depend on color, so
+// MeasureText can answer from any entry for the same font and string.
+//
+// Strings are only counted by hash until they have been drawn TextMeshMinUses
+// times; only then is the string copied into an entry. All storage is fixed when
+// the cache is created, and the least recently drawn entry is reused when it is
+// full, so drawing text never touches the heap apart from building a new mesh.
+class TextLayoutCache: public NewOverrideBase {
+public:
+  enum {
+    MaxEntries = 64,
+    BucketCount = 128, // Entry chains, indexed by hash.
+    CandidateSets = 128 // Pairs of use counters for strings without an entry.
+  };
 
-  Matrix4f m = Matrix4f(size / font->lineheight, 0, 0, 0, 0,
-      size / font->lineheight, 0, 0, 0, 0, 0, 0, x, y, 0, 1).Transposed();
+  struct Lookup {
+    const Font* pFont;
+    const char* pText;
+    UPInt Length;
+    Color C;
+  };
 
-  float xp = 0, yp = (float) font->ascent;
-  int ivertex = 0;
+  struct Entry: public ListNode<Entry> {
+    const Font* pFont;
+    String Text;
+    Color C;
+    UPInt HashValue;
+    Entry* pNextInBucket;
+    Ptr<Buffer> VertexBuffer; // NULL until a mesh has been built.
+    int VertexCount;
+    // Layout in font units, as returned by layoutText.
+    float Width;
+    int Lines;
+    int GlyphCount;
+
+    bool MatchesText(const Font* font, const char* text, UPInt length,
+        UPInt hashValue) const {
+      return HashValue == hashValue && pFont == font
+          && Text.GetSize() == length && !memcmp(Text.ToCStr(), text, length);
+    }
+    bool Matches(const Lookup& l, UPInt hashValue) const {
+      return C == l.C && MatchesText(l.pFont, l.pText, l.Length, hashValue);
+    }
+  };
 
-  for (UPInt i = 0; i < length; i++) {
-    if (str[i] == '\n') {
-      yp += font->lineheight;
-      xp = 0;
-      continue;
+  TextLayoutCache()
+      : UsedEntries(0) {
+    memset(Buckets, 0, sizeof(Buckets));
+    memset(Candidates, 0, sizeof(Candidates));
+  }
+
+  // Returns the entry for l and marks it most recently used. Returns NULL
+  // while l has been drawn fewer than TextMeshMinUses times; the call that
+  // reaches that count creates the entry, laid out but with no mesh yet.
+  Entry* Use(const Lookup& l) {
+    UPInt h = hash(l.pFont, l.pText, l.Length);
+    Entry** bucket = &Buckets[h % BucketCount];
+    for (Entry* e = *bucket; e; e = e->pNextInBucket) {
+      if (e->Matches(l, h)) {
+        Recent.BringToFront(e);
+        return e;
+      }
     }
-    // Tab followed by a numbers sets position to specified offset.
-    if (str[i] == '\t') {
-      char *p = 0;
-      float tabPixels = (float) OVR_strtoq(str + i + 1, &p, 10);
-      i += p - (str + i + 1);
-      xp = tabPixels;
-      continue;
+
+    // Each set holds two counters; a new string takes over the one touched
+    // less recently.
+    CandidateSet& set = Candidates[h % CandidateSets];
+    int way = (set.Ways[0].HashValue == h) ? 0
+        : (set.Ways[1].HashValue == h) ? 1 : (1 - set.Recent);
+    Candidate& c = set.Ways[way];
+    set.Recent = way;
+    if (c.HashValue != h) {
+      c.HashValue = h;
+      c.Uses = 0;
+    }
+    if (++c.Uses < TextMeshMinUses) {
+      return NULL;
     }
+    c.HashValue = 0;
+    c.Uses = 0;
 
-    const Font::Char* ch = &font->chars[str[i]];
-    Vertex* chv = &vertices[ivertex];
-    for (int j = 0; j < 6; j++) {
-      chv[j].C = c;
+    Entry* e;
+    if (UsedEntries < MaxEntries) {
+      e = &Entries[UsedEntries++];
+    } else {
+      e = Recent.GetLast();
+      unlinkFromBucket(e);
+      Recent.Remove(e);
     }
-    float x = xp + ch->x;
-    float y = yp - ch->y;
-    float cx = font->twidth * (ch->u2 - ch->u1);
-    float cy = font->theight * (ch->v2 - ch->v1);
-    chv[0] = Vertex(Vector3f(x, y, 0), c, ch->u1, ch->v1);
-    chv[1] = Vertex(Vector3f(x + cx, y, 0), c, ch->u2, ch->v1);
-    chv[2] = Vertex(Vector3f(x + cx, cy + y, 0), c, ch->u2, ch->v2);
-    chv[3] = Vertex(Vector3f(x, y, 0), c, ch->u1, ch->v1);
-    chv[4] = Vertex(Vector3f(x + cx, cy + y, 0), c, ch->u2, ch->v2);
-    chv[5] = Vertex(Vector3f(x, y + cy, 0), c, ch->u1, ch->v2);
-    ivertex += 6;
+    e->pFont = l.pFont;
+    e->Text.AssignString(l.pText, l.Length);
+    e->C = l.C;
+    e->HashValue = h;
+    e->VertexBuffer.Clear();
+    e->VertexCount = 0;
+    MeasureGlyphs measure;
+    e->Width = layoutText(l.pFont, e->Text.ToCStr(), measure, &e->Lines);
+    e->GlyphCount = measure.Count;
+    e->pNextInBucket = *bucket;
+    *bucket = e;
+    Recent.PushFront(e);
+    return e;
+  }
 
-    xp += ch->advance;
+  // Returns an entry for text in font, in any color, or NULL if there is none.
+  // Doesn't count as a use.
+  const Entry* FindLayout(const Font* font, const char* text,
+      UPInt length) const {
+    UPInt h = hash(font, text, length);
+    for (const Entry* e = Buckets[h % BucketCount]; e; e = e->pNextInBucket) {
+      if (e->MatchesText(font, text, length, h)) {
+        return e;
+      }
+    }
+    return NULL;
   }
 
-  pTextVertexBuffer->Unmap(vertices);
+private:
+  struct Candidate {
+    UPInt HashValue;
+    int Uses;
+  };
+  struct CandidateSet {
+    Candidate Ways[2];
+    int Recent; // Index of the way used last.
+  };
+
+  // Leaves out the color, so that FindLayout can look a string up without one.
+  static UPInt hash(const Font* font, const char* text, UPInt length) {
+    return String::BernsteinHashFunction(text, length, (UPInt) font);
+  }
+
+  void unlinkFromBucket(Entry* e) {
+    Entry** link = &Buckets[e->HashValue % BucketCount];
+    while (*link != e) {
+      link = &(*link)->pNextInBucket;
+    }
+    *link = e->pNextInBucket;
+  }
 
-  Render(font->fill, pTextVertexBuffer, NULL, m, 0, ivertex, Prim_Triangles, NULL /* fullView */);
+  Entry Entries[MaxEntries];
+  int UsedEntries;
+  Entry* Buckets[BucketCount];
+  // Most recently drawn first.
+  List<Entry> Recent;
+  CandidateSet Candidates[CandidateSets];
+};
+
+RenderDevice::~RenderDevice() {
+  Shutdown();
+  delete pTextCache;
 }
 
-void RenderDevice::FillRect(float left, float top, float right, float bottom,
-    Color c) {
-  if (!pTextVertexBuffer) {
-    pTextVertexBuffer = *CreateBuffer();
-    if (!pTextVertexBuffer) {
-      return;
+void RenderDevice::InitFont(const Font* font) {
+  if (font->fill) {
+    return;
+  }
+
+  Ptr<Texture> tex = *CreateTexture(Texture_R, font->twidth, font->theight,
+      font->tex);
+  if (!tex) {
+    return;
+  }
+  Shader* distanceShader = LoadBuiltinShader(Shader_Fragment,
+      FShader_DistanceFieldTexture);
+  if (font->spread && distanceShader) {
+    tex->SetSampleMode(Sample_Linear | Sample_Clamp);
+    ShaderSet* shaders = CreateShaderSet();
+    shaders->SetShader(LoadBuiltinShader(Shader_Vertex, VShader_MVP));
+    shaders->SetShader(distanceShader);
+    font->fill = new ShaderFill(*shaders);
+    font->fill->SetTexture(0, tex);
+  } else {
+    // Without the shader a distance field still reads as coverage, only with
+    // softer edges.
+    font->fill = CreateTextureFill(tex, true);
+  }
+}
+
+float RenderDevice::MeasureText(const Font* font, const char* str, float size,
+    float* strsize) {
+  float w;
+  int lines;
+  const TextLayoutCache::Entry* entry = pTextCache
+      ? pTextCache->FindLayout(font, str, strlen(str)) : NULL;
+  if (entry) {
+    w = entry->Width;
+    lines = entry->Lines;
+  } else {
+    MeasureGlyphs measure;
+    w = layoutText(font, str, measure, &lines);
+  }
+
+  if (strsize) {
+    strsize[0] = (size / font->lineheight) * w;
+    strsize[1] = (size / font->lineheight) * (lines * font->lineheight);
+  }
+  return (size / font->lineheight) * w;
+}
+
+void* RenderDevice::MapDynamicVertices(size_t size, Buffer** buffer,
+    int* byteOffset) {
+  int flags = Map_Unsynchronized;
+
+  if (!pDynamicVertexBuffer) {
+    pDynamicVertexBuffer = *CreateBuffer();
+    if (!pDynamicVertexBuffer) {
+      return NULL;
     }
+    // Force the storage to be allocated below.
+    DynamicVertexOffset = DynamicVertexCapacity + 1;
   }
 
-  // Get!!
-  Fill* fill = CreateSimpleFill();
+  if (DynamicVertexOffset + size > DynamicVertexCapacity) {
+    // Wrapped: orphan the storage so that draws still in flight keep the old copy,
+    // and restart at the beginning of the ring.
+    while (size > DynamicVertexCapacity) {
+      DynamicVertexCapacity *= 2;
+    }
+    pDynamicVertexBuffer->Data(Buffer_Vertex, NULL, DynamicVertexCapacity);
+    DynamicVertexOffset = 0;
+    flags = Map_Discard;
+  }
 
-  pTextVertexBuffer->Data(Buffer_Vertex, NULL, 6 * sizeof(Vertex));
-  Vertex* vertices = (Vertex*) pTextVertexBuffer->Map(0, 6 * sizeof(Vertex),
-      Map_Discard);
+  void* vertices = pDynamicVertexBuffer->Map(DynamicVertexOffset,
+      size, flags);
   if (!vertices) {
+    return NULL;
+  }
+
+  *buffer = pDynamicVertexBuffer;
+  *byteOffset = (int) DynamicVertexOffset;
+  DynamicVertexOffset += size;
+  return vertices;
+}
+
+void RenderDevice::UnmapDynamicVertices(void* vertices) {
+  pDynamicVertexBuffer->Unmap(vertices);
+}
+
+void RenderDevice::RenderText(const Font* font, const char* str, float x,
+    float y, float size, Color c) {
+  // InitFont creates the fill when the font is set up.
+  OVR_ASSERT(font->fill);
+  if (!font->fill) {
     return;
   }
 
-  vertices[0] = Vertex(Vector3f(left, top, 0.0f), c);
-  vertices[1] = Vertex(Vector3f(right, top, 0), c);
-  vertices[2] = Vertex(Vector3f(left, bottom, 0), c);
-  vertices[3] = Vertex(Vector3f(left, bottom, 0), c);
-  vertices[4] = Vertex(Vector3f(right, top, 0), c);
-  vertices[5] = Vertex(Vector3f(right, bottom, 0), c);
+  Matrix4f m = Matrix4f(size / font->lineheight, 0, 0, 0, 0,
+      size / font->lineheight, 0, 0, 0, 0, 0, 0, x, y, 0, 1).Transposed();
 
-  pTextVertexBuffer->Unmap(vertices);
+  TextLayoutCache::Entry* entry = NULL;
+  bool glyphVertices = (GetCaps() & Cap_GlyphVertices) != 0;
+  if (glyphVertices) {
+    if (!pTextCache) {
+      pTextCache = new TextLayoutCache;
+    }
+    TextLayoutCache::Lookup key = { font, str, strlen(str), c };
+    entry = pTextCache->Use(key);
+    if (entry && entry->VertexBuffer) {
+      RenderGlyphs(font->fill, entry->VertexBuffer, m, 0, entry->VertexCount);
+      return;
+    }
+  }
 
-  Render(fill, pTextVertexBuffer, NULL, Matrix4f(), 0, 6, Prim_Triangles, NULL /* fullView */);
-}
+  int lines;
+  int glyphCount;
+  if (entry) {
+    glyphCount = entry->GlyphCount;
+  } else {
+    MeasureGlyphs measure;
+    layoutText(font, str, measure, &lines);
+    glyphCount = measure.Count;
+  }
+  if (glyphCount == 0) {
+    return;
+  }
+  int count = glyphCount * 6;
 
-void RenderDevice::FillGradientRect(float left, float top, float right,
-    float bottom, Color col_top, Color col_btm) {
-  if (!pTextVertexBuffer) {
-    pTextVertexBuffer = *CreateBuffer();
-    if (!pTextVertexBuffer) {
+  Buffer* vertexBuffer = NULL;
+  int vertexOffset = 0;
+
+  if (!glyphVertices) {
+    EmitVertices emit = { font, NULL, c };
+    emit.Vertices = (Vertex*) MapDynamicVertices(count * sizeof(Vertex),
+        &vertexBuffer, &vertexOffset);
+    if (!emit.Vertices) {
+      return;
+    }
+    Vertex* vertices = emit.Vertices;
+    layoutText(font, str, emit, &lines);
+    UnmapDynamicVertices(vertices);
+
+    Render(font->fill, vertexBuffer, NULL, m, vertexOffset, count,
+        Prim_Triangles, NULL /* fullView */);
+    return;
+  }
+
+  if (entry) {
+    // Staging only until the buffer is filled, so it comes from the frame arena.
+    FrameArray<GlyphVertex> vertices;
+    vertices.Resize(count);
+    EmitGlyphVertices emit = { font, &vertices[0], c };
+    layoutText(font, str, emit, &lines);
+
+    Ptr<Buffer> vb = *CreateBuffer();
+    if (vb && vb->Data(Buffer_Vertex, &vertices[0],
+        count * sizeof(GlyphVertex))) {
+      entry->VertexBuffer = vb;
+      entry->VertexCount = count;
+      RenderGlyphs(font->fill, vb, m, 0, count);
       return;
     }
   }
 
-  // Get!!
-  Fill* fill = CreateSimpleFill();
+  EmitGlyphVertices emit = { font, NULL, c };
+  emit.Vertices = (GlyphVertex*) MapDynamicVertices(count * sizeof(GlyphVertex),
+      &vertexBuffer, &vertexOffset);
+  if (!emit.Vertices) {
+    return;
+  }
+  GlyphVertex* vertices = emit.Vertices;
+  layoutText(font, str, emit, &lines);
+  UnmapDynamicVertices(vertices);
+
+  RenderGlyphs(font->fill, vertexBuffer, m, vertexOffset, count);
+}
 
-  pTextVertexBuffer->Data(Buffer_Vertex, NULL, 6 * sizeof(Vertex));
-  Vertex* vertices = (Vertex*) pTextVertexBuffer->Map(0, 6 * sizeof(Vertex),
-      Map_Discard);
+void RenderDevice::FillRect(float left, float top, float right, float bottom,
+    Color c) {
+  FillGradientRect(left, top, right, bottom, c, c);
+}
+
+void RenderDevice::FillGradientRect(float left, float top, float right,
+    float bottom, Color col_top, Color col_btm) {
+  Buffer* vertexBuffer = NULL;
+  int vertexOffset = 0;
+  Vertex* vertices = (Vertex*) MapDynamicVertices(6 * sizeof(Vertex),
+      &vertexBuffer, &vertexOffset);
   if (!vertices) {
     return;
   }
@@ -635,53 +975,34 @@ void RenderDevice::FillGradientRect(float left, float top, float right,
   vertices[4] = Vertex(Vector3f(right, top, 0), col_top);
   vertices[5] = Vertex(Vector3f(right, bottom, 0), col_btm);
 
-  pTextVertexBuffer->Unmap(vertices);
+  UnmapDynamicVertices(vertices);
 
-  Render(fill, pTextVertexBuffer, NULL, Matrix4f(), 0, 6, Prim_Triangles, NULL /* fullView */);
+  Render(CreateSimpleFill(), vertexBuffer, NULL, Matrix4f(), vertexOffset, 6,
+      Prim_Triangles, NULL /* fullView */);
 }
 
 void RenderDevice::RenderImage(float left, float top, float right, float bottom,
     ShaderFill* image, unsigned char alpha) {
-  /*
-   if(!pTextVertexBuffer)
-   {
-   pTextVertexBuffer = *CreateBuffer();
-   if(!pTextVertexBuffer)
-   {
-   return;
-   }
-   }
-
-   pTextVertexBuffer->Data(Buffer_Vertex, NULL, 6 * sizeof(Vertex));
-   Vertex* vertices = (Vertex*)pTextVertexBuffer->Map(0, 6 * sizeof(Vertex), Map_Discard);
-   if(!vertices)
-   {
-   return;
-   }
-
-   vertices[0] = Vertex(Vector3f(left,  top, 0.0f), Color(255, 255, 255, 255));
-   vertices[1] = Vertex(Vector3f(right, top, 0), Color(255, 255, 255, 255));
-   vertices[2] = Vertex(Vector3f(left,  bottom, 0), Color(255, 255, 255, 255));
-   vertices[3] = Vertex(Vector3f(left,  bottom, 0), Color(255, 255, 255, 255));
-   vertices[4] = Vertex(Vector3f(right, top, 0), Color(255, 255, 255, 255));
-   vertices[5] = Vertex(Vector3f(right, bottom, 0), Color(255, 255, 255, 255));
-
-   pTextVertexBuffer->Unmap(vertices);
-
-   Render(image, pTextVertexBuffer, NULL, Matrix4f(), 0, 6, Prim_Triangles);
-   */
+  Buffer* vertexBuffer = NULL;
+  int vertexOffset = 0;
+  Vertex* vertices = (Vertex*) MapDynamicVertices(6 * sizeof(Vertex),
+      &vertexBuffer, &vertexOffset);
+  if (!vertices) {
+    return;
+  }
 
   Color c = Color(255, 255, 255, alpha);
-  Ptr<Model> m = *new Model(Prim_Triangles);
-  m->AddVertex(left, bottom, 0.0f, c, 0.0f, 0.0f);
-  m->AddVertex(right, bottom, 0.0f, c, 1.0f, 0.0f);
-  m->AddVertex(right, top, 0.0f, c, 1.0f, 1.0f);
-  m->AddVertex(left, top, 0.0f, c, 0.0f, 1.0f);
-  m->AddTriangle(2, 1, 0);
-  m->AddTriangle(0, 3, 2);
-  m->Fill = image;
+  vertices[0] = Vertex(Vector3f(right, top, 0), c, 1.0f, 1.0f);
+  vertices[1] = Vertex(Vector3f(right, bottom, 0), c, 1.0f, 0.0f);
+  vertices[2] = Vertex(Vector3f(left, bottom, 0), c, 0.0f, 0.0f);
+  vertices[3] = Vertex(Vector3f(left, bottom, 0), c, 0.0f, 0.0f);
+  vertices[4] = Vertex(Vector3f(left, top, 0), c, 0.0f, 1.0f);
+  vertices[5] = Vertex(Vector3f(right, top, 0), c, 1.0f, 1.0f);
 
-  Render(Matrix4f(), m, NULL /* fullView */);
+  UnmapDynamicVertices(vertices);
+
+  Render(image, vertexBuffer, NULL, Matrix4f(), vertexOffset, 6, Prim_Triangles,
+      NULL /* fullView */);
 }
 
 /*
@@ -699,6 +1020,7 @@ void RenderDevice::RenderImage(float left, float top, float right, float bottom,
 void RenderDevice::SetSceneRenderScale(float ss) {
   SceneRenderScale = ss;
   pSceneColorTex = NULL;
+  pOverlayColorTex = NULL;
 }
 
 void RenderDevice::SetViewport(const Viewport& vp) {
@@ -763,6 +1085,15 @@ bool RenderDevice::initPostProcessSupport(PostProcessType pptype) {
   SceneColorTexH = texh;
   pSceneColorTex->SetSampleMode(Sample_ClampBorder | Sample_Linear);
 
+  if (OverlaySupported) {
+    pOverlayColorTex = *CreateTexture(
+        Texture_RGBA | Texture_RenderTarget | Params.Multisample, texw, texh,
+        NULL);
+    if (pOverlayColorTex) {
+      pOverlayColorTex->SetSampleMode(Sample_ClampBorder | Sample_Linear);
+    }
+  }
+
   if (!pFullScreenVertexBuffer) {
     pFullScreenVertexBuffer = *CreateBuffer();
     const Render::Vertex QuadVertices[] = { Vertex(Vector3f(0, 1, 0),
@@ -800,17 +1131,73 @@ void RenderDevice::BeginScene(PostProcessType pptype) {
   SetExtraShaders(NULL);
 }
 
+void RenderDevice::BeginOverlay() {
+  if ((CurPostProcess != PostProcess_Distortion) || !pOverlayColorTex) {
+    return;
+  }
+
+  // Alpha starts at 1 as in the scene, so overlays blend the same way and the
+  // distortion pass adds the layer's color to the scene's.
+  SetRenderTarget(pOverlayColorTex);
+  SetViewport(VP);
+  Clear(0, 0, 0, 1);
+  OverlayActive = true;
+}
+
 void RenderDevice::FinishScene() {
   SetExtraShaders(0);
   if (CurPostProcess == PostProcess_None) {
     return;
   }
 
+  if (TimewarpEnabled && (TimewarpEyeCount < MaxTimewarpEyes)) {
+    TimewarpEye& eye = TimewarpEyes[TimewarpEyeCount++];
+    eye.VP = VP;
+    eye.Distortion = Distortion;
+    eye.Projection = TimewarpProj;
+    eye.RenderOrientation = TimewarpRenderOrientation;
+    eye.Overlay = OverlayActive;
+    CurPostProcess = PostProcess_None;
+    ReprojectionEnabled = false;
+    OverlayActive = false;
+    return;
+  }
+
   SetRenderTarget(0);
   SetRealViewport(VP);
   FinishScene1();
 
   CurPostProcess = PostProcess_None;
+  ReprojectionEnabled = false;
+  OverlayActive = false;
+}
+
+void RenderDevice::FinishTimewarp(const Matrix4f& displayOrientation) {
+  if (!TimewarpEyeCount) {
+    return;
+  }
+
+  // Eyes share pSceneColorTex and pOverlayColorTex, each in its own viewport.
+  Viewport vp = VP;
+  DistortionConfig distortion = Distortion;
+
+  SetRenderTarget(0);
+  for (int i = 0; i < TimewarpEyeCount; i++) {
+    const TimewarpEye& eye = TimewarpEyes[i];
+    VP = eye.VP;
+    Distortion = eye.Distortion;
+    SetRealViewport(VP);
+    SetReprojection(eye.Projection,
+        eye.RenderOrientation.Transposed() * displayOrientation);
+    OverlayActive = eye.Overlay;
+    FinishScene1();
+  }
+
+  VP = vp;
+  Distortion = distortion;
+  ReprojectionEnabled = false;
+  OverlayActive = false;
+  TimewarpEyeCount = 0;
 }
 
 void RenderDevice::FinishScene1() {
@@ -850,10 +1237,33 @@ void RenderDevice::FinishScene1() {
   Matrix4f texm(w, 0, 0, x, 0, h, 0, y, 0, 0, 0, 0, 0, 0, 0, 1);
   pPostProcessShader->SetUniform4x4f("Texm", texm);
 
+  // Homography taking post-process texture coordinates seen from the display
+  // orientation to the eye buffer rendered with the older one: K * R * K^-1,
+  // where K maps eye space directions to this eye's texture coordinates
+  // (the post-process vertex shader flips v).
+  Matrix4f reproject;
+  if (ReprojectionEnabled) {
+    const Matrix4f& p = ReprojectionProj;
+    float ox = x + w * 0.5f, oy = 1.0f - y - h * 0.5f;
+    Matrix4f k;
+    for (int j = 0; j < 3; j++) {
+      k.M[0][j] = 0.5f * w * p.M[0][j] + ox * p.M[3][j];
+      k.M[1][j] = 0.5f * h * p.M[1][j] + oy * p.M[3][j];
+      k.M[2][j] = p.M[3][j];
+    }
+    reproject = k * ReprojectionRotation * k.Inverted();
+  }
+  pPostProcessShader->SetUniform4x4f("Reproject", reproject);
+
   Matrix4f view(2, 0, 0, -1, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1);
 
   ShaderFill fill(pPostProcessShader);
   fill.SetTexture(0, pSceneColorTex);
+  if (pOverlayColorTex) {
+    pPostProcessShader->SetUniform1f("OverlayWeight",
+        OverlayActive ? 1.0f : 0.0f);
+    fill.SetTexture(1, pOverlayColorTex);
+  }
   RenderWithAlpha(&fill, pFullScreenVertexBuffer, NULL, view, 0, 4,
       Prim_TriangleStrip);
 }
@@ -17,6 +17,7 @@ namespace Render {
 using namespace OVR::Util::Render;
 
 class RenderDevice;
+class TextLayoutCache;
 struct Font;
 
 //-----------------------------------------------------------------------------------
@@ -78,7 +79,8 @@ enum BuiltinShaders {
   FShader_LitTexture = 7,
   FShader_MultiTexture = 8,
   FShader_Debug = 9,
-  FShader_Count = 10,
+  FShader_DistanceFieldTexture = 10,
+  FShader_Count = 11,
 };
 
 enum MapFlags {
@@ -669,6 +671,9 @@ public:
   void RemoveLast() {
     Nodes.PopBack();
   }
+  // Groups models that share a Fill so they are drawn consecutively, keeping
+  // the order of first appearance otherwise.
+  void SortByFill();
   void Clear() {
     Nodes.Clear();
   }
@@ -722,8 +727,17 @@ public:
 
 //-----------------------------------------------------------------------------------
 
+// Compact vertex used for text: position in font units, normalized 16-bit texture
+// coordinates and color. 16 bytes, against 52 for a full Vertex.
+struct GlyphVertex {
+  float X, Y;
+  UInt16 U, V;
+  Color C;
+};
+
 enum RenderCaps {
   Cap_VertexBuffer = 1,
+  Cap_GlyphVertices = 2, // Implements RenderGlyphs.
 };
 
 // Post-processing type to apply to scene after rendering. PostProcess_Distortion
@@ -768,6 +782,9 @@ struct RendererParams {
   int Multisample;
   int Fullscreen;
   DisplayId Display;
+  // File where devices that support it keep compiled shader programs between
+  // runs; empty to disable.
+  String ShaderCachePath;
 
   RendererParams(int ms = 1)
       : Multisample(ms), Fullscreen(0) {
@@ -789,11 +806,24 @@ protected:
   Viewport VP;
 
   Matrix4f Proj;
-  Ptr<Buffer> pTextVertexBuffer;
+
+  // Streaming vertex ring shared by the immediate-mode helpers (RenderText,
+  // FillRect, FillGradientRect, RenderImage). Vertices are appended with
+  // unsynchronized maps and the storage is only orphaned when the ring wraps.
+  Ptr<Buffer> pDynamicVertexBuffer;
+  size_t DynamicVertexCapacity;
+  size_t DynamicVertexOffset;
+
+  // Retained glyph meshes for strings that are drawn repeatedly; see RenderText.
+  TextLayoutCache* pTextCache;
 
   // For rendering with lens warping
   PostProcessType CurPostProcess;
   Ptr<Texture> pSceneColorTex;
+  // Head-locked layer added after reprojection; see BeginOverlay.
+  Ptr<Texture> pOverlayColorTex;
+  bool OverlaySupported;
+  bool OverlayActive;
   int SceneColorTexW;
   int SceneColorTexH;
   Ptr<ShaderSet> pPostProcessShader;
@@ -803,19 +833,44 @@ protected:
   Color DistortionClearColor;
   UPInt TotalTextureMemoryUsage;
 
+  // Rotational reprojection applied by the distortion pass; see SetReprojection.
+  bool ReprojectionEnabled;
+  Matrix4f ReprojectionProj;
+  Matrix4f ReprojectionRotation;
+
+  // Eyes whose distortion pass is deferred to FinishTimewarp.
+  struct TimewarpEye {
+    Viewport VP;
+    DistortionConfig Distortion;
+    Matrix4f Projection;
+    Matrix4f RenderOrientation;
+    bool Overlay;
+  };
+  enum {
+    MaxTimewarpEyes = 2
+  };
+  bool TimewarpEnabled;
+  TimewarpEye TimewarpEyes[MaxTimewarpEyes];
+  int TimewarpEyeCount;
+  Matrix4f TimewarpProj;
+  Matrix4f TimewarpRenderOrientation;
+
   // For lighting on platforms with uniform buffers
   Ptr<Buffer> LightingBuffer;
 
   void FinishScene1();
 
+  // Returns write-only space for size bytes of vertices, valid until UnmapDynamicVertices.
+  // buffer and byteOffset receive what must be passed to Render for drawing them.
+  virtual void* MapDynamicVertices(size_t size, Buffer** buffer, int* byteOffset);
+  virtual void UnmapDynamicVertices(void* vertices);
+
 public:
   enum CompareFunc {
     Compare_Always = 0, Compare_Less = 1, Compare_Greater = 2, Compare_Count
   };
   RenderDevice();
-  virtual ~RenderDevice() {
-    Shutdown();
-  }
+  virtual ~RenderDevice();
 
   // This static function is implemented in each derived class
   // to support a specific renderer type.
@@ -837,6 +892,11 @@ public:
     OVR_sprintf(str, destSize, "");
   }
 
+  // Returns a combination of RenderCaps flags.
+  virtual int GetCaps() const {
+    return Cap_VertexBuffer;
+  }
+
   // StereoParams apply Viewport, Projection and Distortion simultaneously,
   // doing full configuration for one eye.
   void ApplyStereoParams(const StereoEyeParams& params) {
@@ -916,6 +976,11 @@ public:
   virtual void BeginScene(PostProcessType pp = PostProcess_None); //StereoDisplay disp = Stereo_Center);
   // Postprocess the scene and return to the screen render target.
   virtual void FinishScene();
+  // Sends the rest of the scene's drawing to an overlay layer, cleared over the
+  // current viewport, that the distortion pass adds without reprojection, so
+  // head-locked text and HUD stay put under late latch and timewarp. Drawing
+  // stays in the scene on devices whose distortion pass doesn't reproject.
+  void BeginOverlay();
 
   // Texture must have been created with Texture_RenderTarget. Use NULL for the default render target.
   // NULL depth buffer means use an internal, temporary one.
@@ -952,7 +1017,15 @@ public:
   virtual void RenderWithAlpha(const Fill* fill, Render::Buffer* vertices,
       Render::Buffer* indices, const Matrix4f& matrix, int offset, int count,
       PrimitiveType prim = Prim_Triangles, const ViewMatrices* fullView = NULL) = 0;
+  // Draws count GlyphVertex vertices as triangles; only called with Cap_GlyphVertices.
+  virtual void RenderGlyphs(const Fill* fill, Buffer* vertices,
+      const Matrix4f& matrix, int offset, int count) {
+    OVR_UNUSED5(fill, vertices, matrix, offset, count);
+  }
 
+  // Creates the texture and fill a font is drawn with, which the font keeps until
+  // it is released. Call once for each font before drawing text with it.
+  void InitFont(const Font* font);
   // Returns width of text in same units as drawing. If strsize is not null, stores width and height.
   float MeasureText(const Font* font, const char* str, float size,
       float* strsize = NULL);
@@ -984,6 +1057,39 @@ public:
     DistortionClearColor = clearColor;
   }
 
+  // Re-projects the eye buffer of the current scene in the distortion pass.
+  // rotation takes view directions of the orientation the eye is displayed with
+  // into the view the scene was rendered with (renderView^-1 * displayView);
+  // projection is the eye projection used for the scene. Only applies to the
+  // next FinishScene.
+  void SetReprojection(const Matrix4f& projection, const Matrix4f& rotation) {
+    ReprojectionEnabled = true;
+    ReprojectionProj = projection;
+    ReprojectionRotation = rotation;
+  }
+
+  // Timewarp: FinishScene leaves each eye's image, still undistorted, in the
+  // scene buffer and only records its viewport and orientation. FinishTimewarp
+  // later runs all of their distortion passes at once, each rotated from the
+  // orientation it was rendered with to the one passed in.
+  // Calling it right before Present makes the image follow head motion up to
+  // then, including on frames that ran over budget.
+  void SetTimewarpEnabled(bool enabled) {
+    TimewarpEnabled = enabled;
+    TimewarpEyeCount = 0;
+  }
+  bool IsTimewarpEnabled() const {
+    return TimewarpEnabled;
+  }
+  // Eye projection and orientation (eye to world rotation) the current scene
+  // is rendered with; recorded by the next FinishScene.
+  void SetTimewarpOrientation(const Matrix4f& projection,
+      const Matrix4f& renderOrientation) {
+    TimewarpProj = projection;
+    TimewarpRenderOrientation = renderOrientation;
+  }
+  void FinishTimewarp(const Matrix4f& displayOrientation);
+
   // Don't call these directly, use App/Platform instead
   virtual bool SetFullscreen(DisplayMode fullscreen) {
     OVR_UNUSED(fullscreen);
@@ -30,6 +30,9 @@ class Fill;
 
 struct Font
 {
+    // Glyph tables cover the 7-bit ASCII range; other code points draw as '?'.
+    enum { CharCount = 128 };
+
     struct Char
     {
         short x, y;       // offset
@@ -40,7 +43,11 @@ struct Font
     int            lineheight, ascent, descent;
     const Char*    chars;
     const short**  kerning;
-    int            twidth, theight;
+    int            twidth, theight;  // Atlas size in texels.
+    int            tscale;           // Font units per atlas texel.
+    // Atlas texels store 0.5 + d / (2 * spread), d being the distance from the
+    // glyph edge in font units, positive inside.
+    int            spread;
     const
     unsigned char* tex;
     mutable Fill*  fill;
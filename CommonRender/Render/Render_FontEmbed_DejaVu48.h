@@ -1,3 +1,6 @@
+// Generated by CommonRender/Tools/FontDistanceField from the DejaVu
+// coverage bitmap; see the notes there before editing.
+
 #include "Render_Font.h"
 
 namespace OVR { namespace Render {
@@ -36,9428 +39,2374 @@ const Font::Char DejaVu_chars[] = {
     /*   30   */ { 0, 0,  0, 0.0000000000f, 0.0000000000f, 0.0000000000f, 0.0000000000f},
     /*   31   */ { 0, 0,  0, 0.0000000000f, 0.0000000000f, 0.0000000000f, 0.0000000000f},
     /*   32   */ { 0, 0, 15, 0.0000000000f, 0.0000000000f, 0.0000000000f, 0.0000000000f},
-    /*   33 ! */ { 7,35, 19, 0.0009842520f, 0.0000000000f, 0.0059055118f, 0.2482269555f},
-    /*   34 " */ { 5,35, 22, 0.0068897638f, 0.0000000000f, 0.0196850393f, 0.0921985805f},
-    /*   35 # */ { 4,35, 40, 0.0206692908f, 0.0000000000f, 0.0531496070f, 0.2482269555f},
-    /*   36 $ */ { 4,37, 31, 0.0541338585f, 0.0000000000f, 0.0757874027f, 0.3120567501f},
-    /*   37 % */ { 3,36, 46, 0.0767716542f, 0.0000000000f, 0.1161417291f, 0.2624113560f},
-    /*   38 & */ { 3,36, 37, 0.1171259806f, 0.0000000000f, 0.1496063024f, 0.2624113560f},
-    /*   39 ' */ { 5,35, 13, 0.1505905539f, 0.0000000000f, 0.1545275599f, 0.0921985805f},
-    /*   40 ( */ { 4,36, 19, 0.1555118114f, 0.0000000000f, 0.1663385779f, 0.3049645424f},
-    /*   41 ) */ { 4,36, 19, 0.1673228294f, 0.0000000000f, 0.1781496108f, 0.3049645424f},
-    /*   42 * */ { 2,36, 24, 0.1791338623f, 0.0000000000f, 0.1998031437f, 0.1560283750f},
-    /*   43 + */ { 5,30, 40, 0.2007873952f, 0.0000000000f, 0.2303149551f, 0.2127659619f},
-    /*   44 , */ { 4, 6, 15, 0.2312992066f, 0.0000000000f, 0.2372047305f, 0.0851063803f},
-    /*   45 - */ { 2,15, 17, 0.2381889820f, 0.0000000000f, 0.2509842515f, 0.0283687934f},
-    /*   46 . */ { 6, 6, 15, 0.2519685030f, 0.0000000000f, 0.2559055090f, 0.0425531901f},
-    /*   47 / */ { 0,35, 16, 0.2568897605f, 0.0000000000f, 0.2726377845f, 0.2765957415f},
-    /*   48 0 */ { 3,36, 31, 0.2736220360f, 0.0000000000f, 0.2972441018f, 0.2624113560f},
-    /*   49 1 */ { 6,35, 31, 0.2982283533f, 0.0000000000f, 0.3179133832f, 0.2482269555f},
-    /*   50 2 */ { 4,36, 31, 0.3188976347f, 0.0000000000f, 0.3415354192f, 0.2553191483f},
-    /*   51 3 */ { 4,36, 31, 0.3425196707f, 0.0000000000f, 0.3651574850f, 0.2624113560f},
-    /*   52 4 */ { 2,35, 31, 0.3661417365f, 0.0000000000f, 0.3917322755f, 0.2482269555f},
-    /*   53 5 */ { 4,35, 31, 0.3927165270f, 0.0000000000f, 0.4153543413f, 0.2553191483f},
-    /*   54 6 */ { 3,36, 31, 0.4163385928f, 0.0000000000f, 0.4399606287f, 0.2624113560f},
-    /*   55 7 */ { 4,35, 31, 0.4409448802f, 0.0000000000f, 0.4635826647f, 0.2482269555f},
-    /*   56 8 */ { 3,36, 31, 0.4645669162f, 0.0000000000f, 0.4881889820f, 0.2624113560f},
-    /*   57 9 */ { 3,36, 31, 0.4891732335f, 0.0000000000f, 0.5127952695f, 0.2624113560f},
-    /*   58 : */ { 6,25, 16, 0.5137795210f, 0.0000000000f, 0.5187007785f, 0.1773049682f},
-    /*   59 ; */ { 4,25, 16, 0.5196850300f, 0.0000000000f, 0.5255905390f, 0.2198581547f},
-    /*   60 < */ { 5,28, 40, 0.5265747905f, 0.0000000000f, 0.5561023355f, 0.1843971610f},
-    /*   61 = */ { 5,22, 40, 0.5570865870f, 0.0000000000f, 0.5866141915f, 0.0992907807f},
-    /*   62 > */ { 5,28, 40, 0.5875984430f, 0.0000000000f, 0.6171259880f, 0.1843971610f},
-    /*   63 ? */ { 3,36, 25, 0.6181102395f, 0.0000000000f, 0.6368110180f, 0.2553191483f},
-    /*   64 @ */ { 3,34, 48, 0.6377952695f, 0.0000000000f, 0.6791338325f, 0.2978723347f},
-    /*   65 A */ { 0,35, 33, 0.6801180840f, 0.0000000000f, 0.7116141915f, 0.2482269555f},
-    /*   66 B */ { 5,35, 33, 0.7125984430f, 0.0000000000f, 0.7372047305f, 0.2482269555f},
-    /*   67 C */ { 3,36, 34, 0.7381889820f, 0.0000000000f, 0.7657480240f, 0.2624113560f},
-    /*   68 D */ { 5,35, 37, 0.7667322755f, 0.0000000000f, 0.7952755690f, 0.2482269555f},
-    /*   69 E */ { 5,35, 30, 0.7962598205f, 0.0000000000f, 0.8188976645f, 0.2482269555f},
-    /*   70 F */ { 5,35, 28, 0.8198819160f, 0.0000000000f, 0.8395669460f, 0.2482269555f},
-    /*   71 G */ { 3,36, 37, 0.8405511975f, 0.0000000000f, 0.8710629940f, 0.2624113560f},
-    /*   72 H */ { 5,35, 36, 0.8720472455f, 0.0000000000f, 0.8986220360f, 0.2482269555f},
-    /*   73 I */ { 5,35, 14, 0.8996062875f, 0.0000000000f, 0.9035432935f, 0.2482269555f},
-    /*   74 J */ {-2,35, 14, 0.9045275450f, 0.0000000000f, 0.9153543115f, 0.3191489279f},
-    /*   75 K */ { 5,35, 31, 0.9163385630f, 0.0000000000f, 0.9438976645f, 0.2482269555f},
-    /*   76 L */ { 5,35, 27, 0.9448819160f, 0.0000000000f, 0.9665354490f, 0.2482269555f},
-    /*   77 M */ { 5,35, 41, 0.9675197005f, 0.0000000000f, 0.9990157485f, 0.2482269555f},
-    /*   78 N */ { 5,35, 36, 0.0000000000f, 0.3262411356f, 0.0255905520f, 0.5744680762f},
-    /*   79 O */ { 3,36, 38, 0.0265748035f, 0.3262411356f, 0.0580708645f, 0.5886524916f},
-    /*   80 P */ { 5,35, 29, 0.0590551198f, 0.3262411356f, 0.0816929117f, 0.5744680762f},
-    /*   81 Q */ { 3,36, 38, 0.0826771632f, 0.3262411356f, 0.1141732261f, 0.6241135001f},
-    /*   82 R */ { 5,35, 33, 0.1151574776f, 0.3262411356f, 0.1427165419f, 0.5744680762f},
-    /*   83 S */ { 3,36, 30, 0.1437007934f, 0.3262411356f, 0.1692913324f, 0.5886524916f},
-    /*   84 T */ { 0,35, 29, 0.1702755839f, 0.3262411356f, 0.1978346407f, 0.5744680762f},
-    /*   85 U */ { 5,35, 35, 0.1988188922f, 0.3262411356f, 0.2253936976f, 0.5815602541f},
-    /*   86 V */ { 0,35, 33, 0.2263779491f, 0.3262411356f, 0.2578740120f, 0.5744680762f},
-    /*   87 W */ { 2,35, 47, 0.2588582635f, 0.3262411356f, 0.3021653593f, 0.5744680762f},
-    /*   88 X */ { 1,35, 33, 0.3031496108f, 0.3262411356f, 0.3326771557f, 0.5744680762f},
-    /*   89 Y */ { 0,35, 29, 0.3336614072f, 0.3262411356f, 0.3612204790f, 0.5744680762f},
-    /*   90 Z */ { 2,35, 33, 0.3622047305f, 0.3262411356f, 0.3907480240f, 0.5744680762f},
-    /*   91 [ */ { 4,36, 19, 0.3917322755f, 0.3262411356f, 0.4015747905f, 0.6312056780f},
-    /*   92 \ */ { 0,35, 16, 0.4025590420f, 0.3262411356f, 0.4183070958f, 0.6028369069f},
-    /*   93 ] */ { 5,36, 19, 0.4192913473f, 0.3262411356f, 0.4291338623f, 0.6312056780f},
-    /*   94 ^ */ { 5,35, 40, 0.4301181138f, 0.3262411356f, 0.4596456587f, 0.4184397161f},
-    /*   95 _ */ { 0,-7, 24, 0.4606299102f, 0.3262411356f, 0.4842519760f, 0.3546099365f},
-    /*   96 ` */ { 4,38, 24, 0.4852362275f, 0.3262411356f, 0.4960629940f, 0.3900709152f},
-    /*   97 a */ { 3,27, 29, 0.4970472455f, 0.3262411356f, 0.5187007785f, 0.5248227119f},
-    /*   98 b */ { 4,36, 30, 0.5196850300f, 0.3262411356f, 0.5423228145f, 0.5886524916f},
-    /*   99 c */ { 3,27, 26, 0.5433070660f, 0.3262411356f, 0.5639764071f, 0.5248227119f},
-    /*  100 d */ { 3,36, 30, 0.5649606586f, 0.3262411356f, 0.5875984430f, 0.5886524916f},
-    /*  101 e */ { 3,27, 30, 0.5885826945f, 0.3262411356f, 0.6122047305f, 0.5248227119f},
-    /*  102 f */ { 1,36, 17, 0.6131889820f, 0.3262411356f, 0.6289370060f, 0.5815602541f},
-    /*  103 g */ { 3,27, 30, 0.6299212575f, 0.3262411356f, 0.6525590420f, 0.5886524916f},
-    /*  104 h */ { 4,36, 30, 0.6535432935f, 0.3262411356f, 0.6751968265f, 0.5815602541f},
-    /*  105 i */ { 4,36, 13, 0.6761810780f, 0.3262411356f, 0.6801180840f, 0.5815602541f},
-    /*  106 j */ {-1,36, 13, 0.6811023355f, 0.3262411356f, 0.6899606586f, 0.6524822712f},
-    /*  107 k */ { 4,36, 28, 0.6909449100f, 0.3262411356f, 0.7135826945f, 0.5815602541f},
-    /*  108 l */ { 4,36, 13, 0.7145669460f, 0.3262411356f, 0.7185039520f, 0.5815602541f},
-    /*  109 m */ { 4,27, 47, 0.7194882035f, 0.3262411356f, 0.7568897605f, 0.5177304745f},
-    /*  110 n */ { 4,27, 30, 0.7578740120f, 0.3262411356f, 0.7795275450f, 0.5177304745f},
-    /*  111 o */ { 3,27, 29, 0.7805117965f, 0.3262411356f, 0.8041338325f, 0.5248227119f},
-    /*  112 p */ { 4,27, 30, 0.8051180840f, 0.3262411356f, 0.8277559280f, 0.5886524916f},
-    /*  113 q */ { 3,27, 30, 0.8287401795f, 0.3262411356f, 0.8513779640f, 0.5886524916f},
-    /*  114 r */ { 4,27, 20, 0.8523622155f, 0.3262411356f, 0.8671259880f, 0.5177304745f},
-    /*  115 s */ { 3,27, 25, 0.8681102395f, 0.3262411356f, 0.8877952695f, 0.5248227119f},
-    /*  116 t */ { 1,33, 19, 0.8887795210f, 0.3262411356f, 0.9045275450f, 0.5602836609f},
-    /*  117 u */ { 4,27, 30, 0.9055117965f, 0.3262411356f, 0.9271653295f, 0.5248227119f},
-    /*  118 v */ { 1,26, 28, 0.9281495810f, 0.3262411356f, 0.9537401795f, 0.5106382966f},
-    /*  119 w */ { 2,26, 39, 0.9547244310f, 0.3262411356f, 0.9891732335f, 0.5106382966f},
-    /*  120 x */ { 1,26, 28, 0.0000000000f, 0.6595744491f, 0.0246062987f, 0.8439716101f},
-    /*  121 y */ { 1,26, 28, 0.0255905520f, 0.6595744491f, 0.0511811040f, 0.9148936272f},
-    /*  122 z */ { 2,26, 25, 0.0521653555f, 0.6595744491f, 0.0728346482f, 0.8439716101f},
-    /*  123 { */ { 6,36, 31, 0.0738188997f, 0.6595744491f, 0.0915354341f, 0.9716312289f},
-    /*  124 | */ { 6,36, 16, 0.0925196856f, 0.6595744491f, 0.0964566916f, 1.0000000000f},
-    /*  125 } */ { 6,36, 31, 0.0974409431f, 0.6595744491f, 0.1151574776f, 0.9716312289f},
-    /*  126 ~ */ { 5,20, 40, 0.1161417291f, 0.6595744491f, 0.1456692964f, 0.7234042287f},
-    /*  127   */ { 0, 0,  0, 0.0000000000f, 0.0000000000f, 0.0000000000f, 0.0000000000f}}
-;
+    /*   33 ! */ { 7,35, 19, 0.3457031250f, 0.3586956561f, 0.3505859375f, 0.5489130616f},
+    /*   34 " */ { 5,35, 22, 0.0058593750f, 0.8913043737f, 0.0185546875f, 0.9619565010f},
+    /*   35 # */ { 4,35, 40, 0.3632812500f, 0.3586956561f, 0.3955078125f, 0.5489130616f},
+    /*   36 $ */ { 4,37, 31, 0.0664062500f, 0.0326086953f, 0.0878906250f, 0.2717391253f},
+    /*   37 % */ { 3,36, 46, 0.3984375000f, 0.0326086953f, 0.4375000000f, 0.2336956561f},
+    /*   38 & */ { 3,36, 37, 0.4492187500f, 0.0326086953f, 0.4814453125f, 0.2336956561f},
+    /*   39 ' */ { 5,35, 13, 0.0312500000f, 0.8913043737f, 0.0351562500f, 0.9619565010f},
+    /*   40 ( */ { 4,36, 19, 0.1582031250f, 0.0326086953f, 0.1689453125f, 0.2663043439f},
+    /*   41 ) */ { 4,36, 19, 0.1816406250f, 0.0326086953f, 0.1923828125f, 0.2663043439f},
+    /*   42 * */ { 2,36, 24, 0.9140625000f, 0.6304348111f, 0.9345703125f, 0.7500000000f},
+    /*   43 + */ { 5,30, 40, 0.3085937500f, 0.6304348111f, 0.3378906250f, 0.7934782505f},
+    /*   44 , */ { 4, 6, 15, 0.0878906250f, 0.8913043737f, 0.0937500000f, 0.9565217495f},
+    /*   45 - */ { 2,15, 17, 0.1855468750f, 0.8913043737f, 0.1982421875f, 0.9130434990f},
+    /*   46 . */ { 6, 6, 15, 0.1699218750f, 0.8913043737f, 0.1738281250f, 0.9239130616f},
+    /*   47 / */ { 0,35, 16, 0.3437500000f, 0.0326086953f, 0.3593750000f, 0.2445652187f},
+    /*   48 0 */ { 3,36, 31, 0.4941406250f, 0.0326086953f, 0.5175781250f, 0.2336956561f},
+    /*   49 1 */ { 6,35, 31, 0.4082031250f, 0.3586956561f, 0.4277343750f, 0.5489130616f},
+    /*   50 2 */ { 4,36, 31, 0.0410156250f, 0.3586956561f, 0.0634765625f, 0.5543478131f},
+    /*   51 3 */ { 4,36, 31, 0.5292968750f, 0.0326086953f, 0.5517578125f, 0.2336956561f},
+    /*   52 4 */ { 2,35, 31, 0.4394531250f, 0.3586956561f, 0.4648437500f, 0.5489130616f},
+    /*   53 5 */ { 4,35, 31, 0.0761718750f, 0.3586956561f, 0.0986328125f, 0.5543478131f},
+    /*   54 6 */ { 3,36, 31, 0.5644531250f, 0.0326086953f, 0.5878906250f, 0.2336956561f},
+    /*   55 7 */ { 4,35, 31, 0.4765625000f, 0.3586956561f, 0.4990234375f, 0.5489130616f},
+    /*   56 8 */ { 3,36, 31, 0.5996093750f, 0.0326086953f, 0.6230468750f, 0.2336956561f},
+    /*   57 9 */ { 3,36, 31, 0.6347656250f, 0.0326086953f, 0.6582031250f, 0.2336956561f},
+    /*   58 : */ { 6,25, 16, 0.8964843750f, 0.6304348111f, 0.9013671875f, 0.7663043737f},
+    /*   59 ; */ { 4,25, 16, 0.2910156250f, 0.6304348111f, 0.2968750000f, 0.7989130616f},
+    /*   60 < */ { 5,28, 40, 0.6601562500f, 0.6304348111f, 0.6894531250f, 0.7717391253f},
+    /*   61 = */ { 5,22, 40, 0.9472656250f, 0.6304348111f, 0.9765625000f, 0.7065217495f},
+    /*   62 > */ { 5,28, 40, 0.7011718750f, 0.6304348111f, 0.7304687500f, 0.7717391253f},
+    /*   63 ? */ { 3,36, 25, 0.1113281250f, 0.3586956561f, 0.1298828125f, 0.5543478131f},
+    /*   64 @ */ { 3,34, 48, 0.2480468750f, 0.0326086953f, 0.2890625000f, 0.2608695626f},
+    /*   65 A */ { 0,35, 33, 0.5117187500f, 0.3586956561f, 0.5429687500f, 0.5489130616f},
+    /*   66 B */ { 5,35, 33, 0.5546875000f, 0.3586956561f, 0.5791015625f, 0.5489130616f},
+    /*   67 C */ { 3,36, 34, 0.6699218750f, 0.0326086953f, 0.6972656250f, 0.2336956561f},
+    /*   68 D */ { 5,35, 37, 0.5917968750f, 0.3586956561f, 0.6201171875f, 0.5489130616f},
+    /*   69 E */ { 5,35, 30, 0.6328125000f, 0.3586956561f, 0.6552734375f, 0.5489130616f},
+    /*   70 F */ { 5,35, 28, 0.6679687500f, 0.3586956561f, 0.6875000000f, 0.5489130616f},
+    /*   71 G */ { 3,36, 37, 0.7089843750f, 0.0326086953f, 0.7392578125f, 0.2336956561f},
+    /*   72 H */ { 5,35, 36, 0.6992187500f, 0.3586956561f, 0.7255859375f, 0.5489130616f},
+    /*   73 I */ { 5,35, 14, 0.7382812500f, 0.3586956561f, 0.7421875000f, 0.5489130616f},
+    /*   74 J */ {-2,35, 14, 0.0429687500f, 0.0326086953f, 0.0537109375f, 0.2771739066f},
+    /*   75 K */ { 5,35, 31, 0.7539062500f, 0.3586956561f, 0.7812500000f, 0.5489130616f},
+    /*   76 L */ { 5,35, 27, 0.7929687500f, 0.3586956561f, 0.8144531250f, 0.5489130616f},
+    /*   77 M */ { 5,35, 41, 0.8261718750f, 0.3586956561f, 0.8574218750f, 0.5489130616f},
+    /*   78 N */ { 5,35, 36, 0.8691406250f, 0.3586956561f, 0.8945312500f, 0.5489130616f},
+    /*   79 O */ { 3,36, 38, 0.7519531250f, 0.0326086953f, 0.7832031250f, 0.2336956561f},
+    /*   80 P */ { 5,35, 29, 0.9062500000f, 0.3586956561f, 0.9287109375f, 0.5489130616f},
+    /*   81 Q */ { 3,36, 38, 0.3007812500f, 0.0326086953f, 0.3320312500f, 0.2608695626f},
+    /*   82 R */ { 5,35, 33, 0.9414062500f, 0.3586956561f, 0.9687500000f, 0.5489130616f},
+    /*   83 S */ { 3,36, 30, 0.7949218750f, 0.0326086953f, 0.8203125000f, 0.2336956561f},
+    /*   84 T */ { 0,35, 29, 0.0058593750f, 0.6304348111f, 0.0332031250f, 0.8206521869f},
+    /*   85 U */ { 5,35, 35, 0.1425781250f, 0.3586956561f, 0.1689453125f, 0.5543478131f},
+    /*   86 V */ { 0,35, 33, 0.0449218750f, 0.6304348111f, 0.0761718750f, 0.8206521869f},
+    /*   87 W */ { 2,35, 47, 0.0878906250f, 0.6304348111f, 0.1308593750f, 0.8206521869f},
+    /*   88 X */ { 1,35, 33, 0.1425781250f, 0.6304348111f, 0.1718750000f, 0.8206521869f},
+    /*   89 Y */ { 0,35, 29, 0.1835937500f, 0.6304348111f, 0.2109375000f, 0.8206521869f},
+    /*   90 Z */ { 2,35, 33, 0.2226562500f, 0.6304348111f, 0.2509765625f, 0.8206521869f},
+    /*   91 [ */ { 4,36, 19, 0.2050781250f, 0.0326086953f, 0.2148437500f, 0.2663043439f},
+    /*   92 \ */ { 0,35, 16, 0.3710937500f, 0.0326086953f, 0.3867187500f, 0.2445652187f},
+    /*   93 ] */ { 5,36, 19, 0.2265625000f, 0.0326086953f, 0.2363281250f, 0.2663043439f},
+    /*   94 ^ */ { 5,35, 40, 0.0468750000f, 0.8913043737f, 0.0761718750f, 0.9619565010f},
+    /*   95 _ */ { 0,-7, 24, 0.2109375000f, 0.8913043737f, 0.2343750000f, 0.9130434990f},
+    /*   96 ` */ { 4,38, 24, 0.1054687500f, 0.8913043737f, 0.1162109375f, 0.9402173758f},
+    /*   97 a */ { 3,27, 29, 0.3496093750f, 0.6304348111f, 0.3710937500f, 0.7826086879f},
+    /*   98 b */ { 4,36, 30, 0.8320312500f, 0.0326086953f, 0.8544921875f, 0.2336956561f},
+    /*   99 c */ { 3,27, 26, 0.3828125000f, 0.6304348111f, 0.4033203125f, 0.7826086879f},
+    /*  100 d */ { 3,36, 30, 0.8671875000f, 0.0326086953f, 0.8896484375f, 0.2336956561f},
+    /*  101 e */ { 3,27, 30, 0.4160156250f, 0.6304348111f, 0.4394531250f, 0.7826086879f},
+    /*  102 f */ { 1,36, 17, 0.1816406250f, 0.3586956561f, 0.1972656250f, 0.5543478131f},
+    /*  103 g */ { 3,27, 30, 0.9023437500f, 0.0326086953f, 0.9248046875f, 0.2336956561f},
+    /*  104 h */ { 4,36, 30, 0.2089843750f, 0.3586956561f, 0.2304687500f, 0.5543478131f},
+    /*  105 i */ { 4,36, 13, 0.2421875000f, 0.3586956561f, 0.2460937500f, 0.5543478131f},
+    /*  106 j */ {-1,36, 13, 0.0214843750f, 0.0326086953f, 0.0302734375f, 0.2826086879f},
+    /*  107 k */ { 4,36, 28, 0.2578125000f, 0.3586956561f, 0.2802734375f, 0.5543478131f},
+    /*  108 l */ { 4,36, 13, 0.2929687500f, 0.3586956561f, 0.2968750000f, 0.5543478131f},
+    /*  109 m */ { 4,27, 47, 0.5507812500f, 0.6304348111f, 0.5878906250f, 0.7771739364f},
+    /*  110 n */ { 4,27, 30, 0.5996093750f, 0.6304348111f, 0.6210937500f, 0.7771739364f},
+    /*  111 o */ { 3,27, 29, 0.4511718750f, 0.6304348111f, 0.4746093750f, 0.7826086879f},
+    /*  112 p */ { 4,27, 30, 0.9375000000f, 0.0326086953f, 0.9599609375f, 0.2336956561f},
+    /*  113 q */ { 3,27, 30, 0.0058593750f, 0.3586956561f, 0.0283203125f, 0.5597826242f},
+    /*  114 r */ { 4,27, 20, 0.6328125000f, 0.6304348111f, 0.6474609375f, 0.7771739364f},
+    /*  115 s */ { 3,27, 25, 0.4863281250f, 0.6304348111f, 0.5058593750f, 0.7826086879f},
+    /*  116 t */ { 1,33, 19, 0.2636718750f, 0.6304348111f, 0.2792968750f, 0.8097826242f},
+    /*  117 u */ { 4,27, 30, 0.5175781250f, 0.6304348111f, 0.5390625000f, 0.7826086879f},
+    /*  118 v */ { 1,26, 28, 0.7421875000f, 0.6304348111f, 0.7675781250f, 0.7717391253f},
+    /*  119 w */ { 2,26, 39, 0.7792968750f, 0.6304348111f, 0.8134765625f, 0.7717391253f},
+    /*  120 x */ { 1,26, 28, 0.8261718750f, 0.6304348111f, 0.8505859375f, 0.7717391253f},
+    /*  121 y */ { 1,26, 28, 0.3085937500f, 0.3586956561f, 0.3339843750f, 0.5543478131f},
+    /*  122 z */ { 2,26, 25, 0.8632812500f, 0.6304348111f, 0.8837890625f, 0.7717391253f},
+    /*  123 { */ { 6,36, 31, 0.0996093750f, 0.0326086953f, 0.1171875000f, 0.2717391253f},
+    /*  124 | */ { 6,36, 16, 0.0058593750f, 0.0326086953f, 0.0097656250f, 0.2934782505f},
+    /*  125 } */ { 6,36, 31, 0.1289062500f, 0.0326086953f, 0.1464843750f, 0.2717391253f},
+    /*  126 ~ */ { 5,20, 40, 0.1289062500f, 0.8913043737f, 0.1582031250f, 0.9402173758f},
+    /*  127   */ { 0, 0,  0, 0.0000000000f, 0.0000000000f, 0.0000000000f, 0.0000000000f}};
 
 const short DejaVu_kern45[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0, -1, -2,  0,  0,  0,  0,  2,  0,  0,  3,  0,  0,  0,  0,  1, 
-       0,  2,  0,  0, -4,  0, -3, -2, -2, -6,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1, 
-       0,  0,  0,  0,  0,  0, -1,  0,  0, -1,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, -1, -2,  0,  0,  0,  0,  2,  0,  0,  3,  0,  0,  0,  0,  1,
+      0,  2,  0,  0, -4,  0, -3, -2, -2, -6,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+      0,  0,  0,  0,  0,  0, -1,  0,  0, -1,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern65[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -1,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0, 
-       0,  1,  0, -1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0, -1, 
-       0, -1,  0,  0, -4,  0, -3, -3,  0, -4,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0, -1, -1, -1, -2,  0,  0,  0,  0,  0,  0,  0,  0, -1, 
-       0, -1,  0,  0, -1,  0, -3, -2,  0, -3,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -1,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,
+      0,  1,  0, -1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0, -1,
+      0, -1,  0,  0, -4,  0, -3, -3,  0, -4,  0,  0,  0,  0,  0,  0,
+      0,  0,  0, -1, -1, -1, -2,  0,  0,  0,  0,  0,  0,  0,  0, -1,
+      0, -1,  0,  0, -1,  0, -3, -2,  0, -3,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern66[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0, -1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0, -1, 
-       0,  0,  0, -1,  0,  0, -1, -2,  0, -3,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0, -1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0, -1,
+      0,  0,  0, -1,  0,  0, -1, -2,  0, -3,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern67[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern68[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0, -1,  0,  0, -3,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0, -1,  0,  0, -3,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern70[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -8,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  0,  0,  0,  0,  0, 
-       0, -4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0, -1, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0, -4,  0,  0,  0, -3,  0,  0,  0, -3,  0,  0,  0,  0,  0, -2, 
-       0,  0, -3,  0,  0, -3,  0,  0,  0, -4,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -8,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  0,  0,  0,  0,  0,
+      0, -4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0, -1, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, -4,  0,  0,  0, -3,  0,  0,  0, -3,  0,  0,  0,  0,  0, -2,
+      0,  0, -3,  0,  0, -3,  0,  0,  0, -4,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern71[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0, -2,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0, -2,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern72[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern74[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern75[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -5,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0, -1,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3, 
-       0,  0,  0,  0, -4, -1,  0, -2,  0, -2,  0,  0,  0,  0,  0,  0, 
-       0, -1,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, 
-       0,  0,  0,  0,  0, -2,  0,  0,  0, -3,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -5,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, -1,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,
+      0,  0,  0,  0, -4, -1,  0, -2,  0, -2,  0,  0,  0,  0,  0,  0,
+      0, -1,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,
+      0,  0,  0,  0,  0, -2,  0,  0,  0, -3,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern76[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, 
-       0,  0,  0,  0, -7, -2, -5, -4,  0, -6,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, 
-       0,  0,  0,  0,  0, -1,  0,  0,  0, -4,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,
+      0,  0,  0,  0, -7, -2, -5, -4,  0, -6,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,
+      0,  0,  0,  0,  0, -1,  0,  0,  0, -4,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern79[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1, -2,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0, 
-       0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0, -1,  0, -3, -3,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1, -2,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,
+      0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0, -1,  0, -3, -3,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern80[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -7,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0, 
-       0, -2,  0,  0,  0, -2,  0,  0,  0, -1,  0,  0,  0,  0, -1, -2, 
-       0,  0, -1, -1,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -7,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,
+      0, -2,  0,  0,  0, -2,  0,  0,  0, -1,  0,  0,  0,  0, -1, -2,
+      0,  0, -1, -1,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern81[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern82[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, -2,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0, 
-       0, -2,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0, -3,  0, -3, -2,  0, -3,  0,  0,  0,  0,  0,  0, 
-       0, -1,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, 
-       0,  0,  0,  0,  0, -2,  0,  0,  0, -3,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, -2,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,
+      0, -2,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0, -3,  0, -3, -2,  0, -3,  0,  0,  0,  0,  0,  0,
+      0, -1,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,
+      0,  0,  0,  0,  0, -2,  0,  0,  0, -3,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern83[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern84[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4, -6,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -5,  0,  0,  0,  0,  0, 
-       0, -4,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0, -8,  0, -8,  0, -8,  0,  0,  0, -1,  0,  0,  0,  0,  0, -8, 
-       0,  0, -7, -8,  0, -7,  0, -8,  0, -7,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4, -6,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -5,  0,  0,  0,  0,  0,
+      0, -4,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, -8,  0, -8,  0, -8,  0,  0,  0, -1,  0,  0,  0,  0,  0, -8,
+      0,  0, -7, -8,  0, -7,  0, -8,  0, -7,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern85[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern86[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3, -6,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  0,  0,  0,  0,  0, 
-       0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0, -4,  0,  0,  0, -4,  0,  0,  0, -1,  0,  0,  0,  0,  0, -4, 
-       0,  0,  0,  0,  0, -3,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3, -6,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  0,  0,  0,  0,  0,
+      0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, -4,  0,  0,  0, -4,  0,  0,  0, -1,  0,  0,  0,  0,  0, -4,
+      0,  0,  0,  0,  0, -3,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern87[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, -6,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0, 
-       0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0, -3,  0,  0,  0, -3,  0,  0,  0, -1,  0,  0,  0,  0,  0, -3, 
-       0,  0, -2,  0,  0, -2,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, -6,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0,
+      0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, -3,  0,  0,  0, -3,  0,  0,  0, -1,  0,  0,  0,  0,  0, -3,
+      0,  0, -2,  0,  0, -2,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern88[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3, 
-       0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,
+      0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern89[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -6, -10,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -6,  0,  0,  0,  0,  0, 
-       0, -4,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0, -7,  0,  0,  0, -6,  0,  0,  0, -2,  0,  0,  0,  0,  0, -6, 
-       0,  0,  0,  0,  0, -6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -6,-10,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -6,  0,  0,  0,  0,  0,
+      0, -4,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, -7,  0,  0,  0, -6,  0,  0,  0, -2,  0,  0,  0,  0,  0, -6,
+      0,  0,  0,  0,  0, -6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern90[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern101[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern102[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3, -3,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0, -1,  0,  0, -1,  0, -1,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3, -3,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0, -1,  0,  0, -1,  0, -1,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern107[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0, -1,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, 
-       0,  0,  0,  0,  0, -1,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, -1,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,
+      0,  0,  0,  0,  0, -1,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern111[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1, -1,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1, -1,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern114[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3, -4,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0, -1, -1, -1,  0, -1, -1,  0,  0,  0,  0, -1, -1, -1, 
-       0, -1, -1,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3, -4,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0, -1, -1, -1,  0, -1, -1,  0,  0,  0,  0, -1, -1, -1,
+      0, -1, -1,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern118[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -4,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -4,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern119[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern120[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0, -1,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0, -1,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
 const short DejaVu_kern121[] = {
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -7,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 
-       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} ;
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -7,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
+
 const short* DejaVu_kern[] = {
-     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, DejaVu_kern45, 0, 0, 
-     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-     0, DejaVu_kern65, DejaVu_kern66, DejaVu_kern67, DejaVu_kern68, 0, DejaVu_kern70, DejaVu_kern71, DejaVu_kern72, 0, DejaVu_kern74, DejaVu_kern75, DejaVu_kern76, 0, 0, DejaVu_kern79, 
-     DejaVu_kern80, DejaVu_kern81, DejaVu_kern82, DejaVu_kern83, DejaVu_kern84, DejaVu_kern85, DejaVu_kern86, DejaVu_kern87, DejaVu_kern88, DejaVu_kern89, DejaVu_kern90, 0, 0, 0, 0, 0, 
-     0, 0, 0, 0, 0, DejaVu_kern101, DejaVu_kern102, 0, 0, 0, 0, DejaVu_kern107, 0, 0, 0, DejaVu_kern111, 
-     0, 0, DejaVu_kern114, 0, 0, 0, DejaVu_kern118, DejaVu_kern119, DejaVu_kern120, DejaVu_kern121, 0, 0, 0, 0, 0, 0};
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, DejaVu_kern45, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, DejaVu_kern65, DejaVu_kern66, DejaVu_kern67, DejaVu_kern68, 0, DejaVu_kern70, DejaVu_kern71,
+    DejaVu_kern72, 0, DejaVu_kern74, DejaVu_kern75, DejaVu_kern76, 0, 0, DejaVu_kern79,
+    DejaVu_kern80, DejaVu_kern81, DejaVu_kern82, DejaVu_kern83, DejaVu_kern84, DejaVu_kern85, DejaVu_kern86, DejaVu_kern87,
+    DejaVu_kern88, DejaVu_kern89, DejaVu_kern90, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, DejaVu_kern101, DejaVu_kern102, 0,
+    0, 0, 0, DejaVu_kern107, 0, 0, 0, DejaVu_kern111,
+    0, 0, DejaVu_kern114, 0, 0, 0, DejaVu_kern118, DejaVu_kern119,
+    DejaVu_kern120, DejaVu_kern121, 0, 0, 0, 0, 0, 0};
 
 const unsigned char DejaVu_tex[] = {
-       0, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 135, 255, 255, 255,  72,   0,   0,   0,   0,   0,   0, 208, 255, 255, 
-     241,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  59, 154, 218, 244, 243, 217, 152,  55,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  32, 247, 255, 255, 100,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, 
-      97, 166, 218, 239, 250, 236, 209, 160,  97,  18,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0, 138, 255, 255, 255, 177,   0, 178, 255, 255, 255, 137,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      87, 255, 255, 255, 217,   0,   0,   0,   0,   0,   0,   0,   0,  31, 122, 189, 
-     230, 249, 249, 230, 189, 122,  30,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  44, 111, 178, 241, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  12,  69, 126, 169, 210, 233, 248, 246, 229, 
-     209, 159, 102,  22,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      28,  94, 149, 191, 225, 241, 251, 238, 223, 187, 134,  67,   1,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 109, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      29, 111, 175, 216, 241, 252, 247, 235, 209, 178, 135,  86,  28,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,  15, 100, 
-     159, 209, 231, 247, 247, 231, 209, 159, 101,  16,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  14,  89, 159, 210, 232, 250, 243, 218, 172, 
-     100,  13,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  24, 114, 208,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0, 208, 114,  24,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  55, 123, 184, 220, 240, 250, 233, 207, 
-     151,  77,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  37,  99, 155, 192, 225, 240, 251, 246, 233, 
-     213, 174, 132,  68,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     219, 255, 255, 255, 255, 222,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     253, 241, 228, 200, 155, 100,  19,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   6,  72, 134, 184, 217, 240, 251, 247, 
-     231, 215, 180, 130,  79,  12,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 254, 247, 240, 222, 200, 170, 130,  83,  23,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-       0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  41, 108, 162, 199, 229, 244, 252, 243, 229, 214, 185, 140,  94,  38,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   2, 145, 255, 255, 255, 255, 254, 114,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 210,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     211, 255, 255, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 197, 255, 255, 252,  13,   0,   0,   0,   0,   0,  18, 254, 255, 255, 
-     183,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       7, 160, 255, 255, 255, 255, 255, 255, 255, 254, 156,   5,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 175, 255, 255, 202,   1,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  94, 234, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 172,  57,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,  36, 249, 255, 255, 245,  31,   0,  32, 246, 255, 255, 248,  34, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     165, 255, 255, 255, 139,   0,   0,   0,   0,   0,   0,  15, 152, 251, 255, 255, 
-     255, 255, 255, 255, 255, 255, 251, 151,  15,   0,   0,   0,   0,   0,   0,  33, 
-      99, 166, 232, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  39, 118, 197, 251, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 249, 165,  34,   0,   0,   0,   0,   0,   0,   0,  43, 129, 214, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 221, 102,   1,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  34, 245, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  39, 173, 
-     253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,  15, 148, 245, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 245, 149,  14,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   8, 118, 237, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 241, 118,   4,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   9, 
-      88, 182, 252, 255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0, 255, 255, 252, 182,  88,   8,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   6, 106, 212, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 219,  69,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  24, 125, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 246, 166,  65,   1,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  62, 
-     255, 255, 255, 255, 255, 255,  65,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 250, 167,  31,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  31, 146, 239, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 245, 168,  73,   0,   0,   0, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 123,  25, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-       0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, 111, 
-     215, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 216, 
-     136,  45,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   7, 171, 255, 255, 255, 255, 249,  87,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,  57,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  58, 
-     255, 255, 255, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   8, 249, 255, 255, 202,   0,   0,   0,   0,   0,   0,  79, 255, 255, 255, 
-     121,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, 
-     183, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 179,   2,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  70, 255, 255, 254,  54,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 148, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0, 176, 255, 255, 255, 120,   0,   0,   0, 122, 255, 255, 255, 173, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, 
-     238, 255, 255, 255,  61,   0,   0,   0,   0,   0,  35, 217, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 216,  34,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 243, 101,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 194,  21, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       1, 192, 255, 255, 254, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 115, 249, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 204,   0,   0,   0,   0,  51, 227, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 227,  51,   0,   0,   0, 
-       0,   0,   0,   0,  24, 201, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 191,  17,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  62, 156, 241, 
-     255, 255, 255, 255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0, 255, 255, 255, 255, 255, 241, 155,  61,   1,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  75, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 254, 123,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  27, 155, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 205,  70,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 160, 
-     255, 255, 255, 255, 255, 255, 163,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 246,  88,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   7, 131, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 199,  66,   0, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 
-     155,  22,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-       0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,  97, 232, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 180,  60,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  17, 194, 255, 255, 255, 255, 240,  64,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 159,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 160, 
-     255, 255, 255, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  64, 255, 255, 255, 139,   0,   0,   0,   0,   0,   0, 143, 255, 255, 255, 
-      59,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 120, 
-     255, 255, 255, 241,  98,  15,  17, 102, 243, 255, 255, 255, 116,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   5, 216, 255, 255, 157,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 119, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,  55, 255, 255, 255, 226,   7,   0,   0,   0,   9, 228, 255, 255, 255, 
-      52,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  64, 
-     255, 255, 255, 236,   3,   0,   0,   0,   0,  24, 224, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 223,  23,   0,   0,   0,   0, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 114,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 
-      22,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     109, 255, 255, 255, 148, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   2, 156, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255,  97,   0,   0,   0,  44, 237, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 237,  44,   0,   0, 
-       0,   0,   0,  23, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 201,  10,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  36, 129, 222, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 222, 129,  35, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 102,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       2, 119, 244, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 176,  22,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, 244, 
-     255, 255, 255, 255, 255, 255, 245,  14,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 253,  86,   0,   0,   0,   0,   0, 
-       0,   0,   0,  28, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 240,  85,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-       0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,  15, 175, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  30, 213, 255, 255, 255, 255, 228,  45,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 245,  15, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16, 246, 
-     255, 255, 255, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 125, 255, 255, 255,  77,   0,   0,   0,   0,   0,   0, 206, 255, 255, 246, 
-       6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  14, 243, 
-     255, 255, 254,  65,   0,   0,   0,   0,  72, 255, 255, 255, 241,  12,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 117, 255, 255, 240,  22,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  28, 246, 255, 255, 255, 
-     255, 177,  76,  22,   5,  18,  47, 101, 168, 243, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0, 184, 255, 255, 255,  97,   0,   0,   0,   0,   0, 101, 255, 255, 255, 
-     180,   0,   0,   0,   0,   0,  12, 194,  66,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,  67, 194,  12,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  21, 255, 255, 255, 
-     223,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 141, 
-     255, 255, 255, 162,   0,   0,   0,   0,   0, 187, 255, 255, 255, 255, 228, 124, 
-      46,  15,  16,  47, 126, 229, 255, 255, 255, 255, 186,   0,   0,   0,   0, 255, 
-     255, 255, 255, 224, 160,  96,  32, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 201, 140,  84,  41,  21,   5,  18, 
-      52, 117, 219, 255, 255, 255, 255, 255,  78,   0,   0,   0,   0, 255, 255, 255, 
-     224, 157, 103,  61,  27,  12,   4,  17,  45,  94, 176, 253, 255, 255, 255, 255, 
-     173,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  34, 
-     244, 255, 255, 224,  12, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 148, 255, 255, 255, 255, 
-     254, 185, 106,  46,  23,   3,   9,  22,  48,  82, 132, 182, 231,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  93, 255, 255, 255, 237,   9,   0,   0,   2, 204, 255, 255, 255, 255, 240, 
-     146,  70,  26,   7,   8,  27,  72, 150, 243, 255, 255, 255, 255, 203,   2,   0, 
-       0,   0,   4, 192, 255, 255, 255, 255, 218, 108,  40,  11,  11,  40, 108, 219, 
-     255, 255, 255, 255, 255, 158,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  16, 103, 197, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 209, 115,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 115, 209, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     197, 103,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 218, 143,  76,  35,  11,   9,  35,  95, 
-     200, 255, 255, 255, 255, 241,  23,   0,   0,   0,   0,   0,   0,   0,   0,  27, 
-     193, 255, 255, 255, 255, 255, 255, 251, 187, 131,  77,  40,  23,   6,   9,  21, 
-      51,  89, 149, 217, 255, 255, 255, 255, 255, 255, 234,  66,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  99, 255, 
-     255, 255, 224, 225, 255, 255, 255, 101,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       4,  15,  40,  80, 148, 238, 255, 255, 255, 255, 237,  22,   0,   0,   0,   0, 
-       0,   0,  33, 224, 255, 255, 255, 255, 255, 227, 156,  86,  47,  27,   7,  15, 
-      36,  57, 108, 174, 238, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   3,  10,  25,  48,  85, 130, 191, 251, 255, 255, 255, 
-     255, 255, 255, 124,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  21, 206, 255, 255, 255, 255, 
-     255, 241, 179, 116,  60,  39,  20,   4,  10,  24,  53,  95, 147, 217, 255, 255, 
-     255, 255, 255, 255,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  46, 229, 255, 255, 255, 255, 212,  28,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 225, 255, 255, 255, 108, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 109, 255, 
-     255, 255, 224, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 187, 255, 255, 253,  16,   0,   0,   0,   0,   0,  16, 253, 255, 255, 191, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 104, 255, 
-     255, 255, 178,   0,   0,   0,   0,   0,   0, 183, 255, 255, 255, 103,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  25, 242, 255, 255, 110,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 128, 255, 255, 255, 252, 
-      93,   0,   0,   0,   0,   0,   0,   0,   0,   8,  92, 201,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,  54, 255, 255, 255, 218,   3,   0,   0,   0,   0,   0,   3, 220, 255, 255, 
-     255,  51,   0,   0,   0,   0, 133, 255, 255, 160,  19,   0,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,   0,  19, 161, 255, 255, 132,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  86, 255, 255, 255, 
-     126,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 218, 
-     255, 255, 255,  85,   0,   0,   0,   0,  91, 255, 255, 255, 255, 183,  15,   0, 
-       0,   0,   0,   0,   0,  16, 185, 255, 255, 255, 255,  89,   0,   0,   0, 224, 
-     160,  96,  32,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 216, 120,  32,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   3, 124, 253, 255, 255, 255, 223,   9,   0,   0,   0, 212, 125,  39, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  46, 214, 255, 255, 255, 
-     255,  63,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 192, 
-     255, 255, 255,  71,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  88, 255, 255, 255, 255, 207, 
-      56,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 200, 255, 255, 255, 141,   0,   0,   0,  84, 255, 255, 255, 255, 191,  24, 
-       0,   0,   0,   0,   0,   0,   0,   0,  27, 195, 255, 255, 255, 255,  84,   0, 
-       0,   0, 108, 255, 255, 255, 255, 149,   5,   0,   0,   0,   0,   0,   0,   6, 
-     152, 255, 255, 255, 255, 255,  66,   0,   0,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   4,  77, 171, 248, 255, 255, 255, 255, 255, 255, 255, 255, 
-     231, 142,  47,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  48, 142, 231, 255, 255, 255, 255, 255, 255, 
-     255, 255, 248, 170,  76,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 254, 173,  66,   0,   0,   0,   0,   0,   0,   0,   0, 
-       1, 120, 255, 255, 255, 255, 124,   0,   0,   0,   0,   0,   0,   0,  45, 227, 
-     255, 255, 255, 255, 255, 220, 113,  22,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  54, 157, 251, 255, 255, 255, 255, 249,  91,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 196, 255, 
-     255, 255, 129, 130, 255, 255, 255, 199,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  14, 161, 255, 255, 255, 255, 118,   0,   0,   0,   0, 
-       0,  16, 218, 255, 255, 255, 255, 224,  95,   2,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   3,  80, 194, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  19, 112, 226, 255, 
-     255, 255, 255, 255, 109,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  10, 204, 255, 255, 255, 255, 235, 
-     121,  13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  45, 150, 
-     242, 255, 255, 255,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  65, 240, 255, 255, 255, 255, 193,  16,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 125, 255, 255, 255, 209, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 210, 255, 
-     255, 255, 124, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       4, 244, 255, 255, 207,   0,   0,   0,   0,   0,   0,  78, 255, 255, 255, 129, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27, 101, 166, 207, 
-     239, 255, 255, 255, 243, 222, 200, 168, 120,  72,  24,   0,   0,   0, 170, 255, 
-     255, 255,  90,   0,   0,   0,   0,   0,   0,  93, 255, 255, 255, 168,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 164, 255, 255, 210,   4,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 200, 255, 255, 255, 140, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0, 167, 255, 255, 255, 104,   0,   0,   0,   0,   0,   0,   0, 108, 255, 255, 
-     255, 162,   0,   0,   0,   0, 155, 254, 255, 255, 235,  93,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,  93, 235, 255, 255, 254, 155,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 152, 255, 255, 253, 
-      30,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40, 255, 
-     255, 255, 249,  13,   0,   0,   0,   2, 219, 255, 255, 255, 199,   4,   0,   0, 
-       0,   0,   0,   0,   0,   0,   4, 200, 255, 255, 255, 218,   2,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 197,  80,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 104, 255, 255, 255, 255,  89,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  20, 230, 255, 255, 
-     255, 152,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 108, 255, 
-     255, 255, 159,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  17, 233, 255, 255, 255, 190,   9, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      49, 255, 255, 255, 254,  36,   0,   0,   0, 168, 255, 255, 255, 217,  10,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  11, 220, 255, 255, 255, 167,   0, 
-       0,   6, 226, 255, 255, 255, 163,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 166, 255, 255, 255, 255, 201,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  50, 144, 234, 255, 255, 255, 255, 255, 255, 255, 255, 247, 168,  74, 
-       3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  74, 168, 247, 255, 255, 255, 
-     255, 255, 255, 255, 255, 233, 144,  50,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 187,  50,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 156, 255, 255, 255, 198,   0,   0,   0,   0,   0,   0,  48, 240, 255, 
-     255, 255, 255, 236, 111,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  34, 180, 255, 255, 255, 255, 253,  85,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  38, 255, 255, 
-     255, 254,  33,  34, 254, 255, 255, 255,  40,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   1, 183, 255, 255, 255, 197,   0,   0,   0,   0, 
-       0, 176, 255, 255, 255, 255, 167,   7,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  73, 222, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  10, 141, 
-     255, 255, 255, 255, 250,  53,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 162, 255, 255, 255, 255, 183,  15, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      12, 123, 246, 255,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      89, 249, 255, 255, 255, 255, 170,   7,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,  26, 252, 255, 255, 255, 
-      56,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  57, 255, 255, 
-     255, 251,  26, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      54, 255, 255, 255, 144,   0,   0,   0,   0,   0,   0, 141, 255, 255, 255,  67, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  34, 167, 251, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 219, 255, 
-     255, 255,  39,   0,   0,   0,   0,   0,   0,  41, 255, 255, 255, 218,   0,   0, 
-       0,   0,   0,   0,   0,   0,  60, 255, 255, 255,  64,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 235, 255, 255, 255,  38, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-      26, 250, 255, 255, 235,   9,   0,   0,   0,   0,   0,   0,   0,  11, 238, 255, 
-     255, 248,  22,   0,   0,   0,   0,  55, 198, 255, 255, 255, 186,  34,   0, 255, 
-     255, 255,   0,  35, 187, 255, 255, 255, 197,  54,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 217, 255, 255, 186, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 118, 255, 
-     255, 255, 186,   0,   0,   0,   0,  77, 255, 255, 255, 248,  35,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  35, 248, 255, 255, 255,  75,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 184, 255, 255, 255, 169,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 104, 255, 255, 
-     255, 214,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33, 244, 255, 
-     255, 231,  17,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 155, 255, 255, 255, 214,  10,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     156, 255, 255, 255, 184,   0,   0,   0,   0, 220, 255, 255, 255,  93,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  95, 255, 255, 255, 220,   0, 
-       0,  77, 255, 255, 255, 239,  14,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  16, 240, 255, 255, 255, 255,  61,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  26, 
-     118, 212, 255, 255, 255, 255, 255, 255, 255, 255, 254, 195, 100,  14,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  14, 100, 194, 254, 
-     255, 255, 255, 255, 255, 255, 255, 255, 212, 117,  26,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  46, 255, 255, 255, 233,   0,   0,   0,   0,   0,  34, 233, 255, 255, 
-     255, 255, 186,  24,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  99, 249, 255, 255, 255, 248,  61,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 135, 255, 255, 
-     255, 190,   0,   0, 191, 255, 255, 255, 137,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  62, 255, 255, 255, 231,   0,   0,   0,   0, 
-      87, 255, 255, 255, 255, 145,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  11, 160,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     101, 255, 255, 255, 255, 202,   1,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  77, 255, 255, 255, 255, 151,   3,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  32, 178,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 116, 
-     254, 255, 255, 255, 255, 144,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 177, 255, 255, 255, 
-     158,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 159, 255, 255, 
-     255, 176,   0, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     116, 255, 255, 255,  81,   0,   0,   0,   0,   0,   0, 205, 255, 255, 250,  10, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  89, 243, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 240, 255, 
-     255, 255,  11,   0,   0,   0,   0,   0,   0,  12, 255, 255, 255, 238,   0,   0, 
-       0,   0,   0,   0,   0,   3, 207, 255, 255, 168,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 252, 255, 255, 255,   7, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-     124, 255, 255, 255, 138,   0,   0,   0,   0,   0,   0,   0,   0,   0, 143, 255, 
-     255, 255, 119,   0,   0,   0,   0,   0,   0,  87, 224, 255, 255, 246, 120, 255, 
-     255, 255, 120, 246, 255, 255, 223,  87,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27, 255, 255, 255,  87, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 195, 255, 
-     255, 255, 108,   0,   0,   0,   0, 168, 255, 255, 255, 159,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 160, 255, 255, 255, 166,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  78, 255, 255, 255, 217,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  30, 255, 255, 
-     255, 240,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 191, 255, 255, 
-     255,  81,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  22, 250, 255, 255, 255,  63,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16, 
-     245, 255, 255, 255,  78,   0,   0,   0,   0, 244, 255, 255, 255,  25,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27, 255, 255, 255, 244,   0, 
-       0, 144, 255, 255, 255, 142,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 144, 255, 255, 255, 255, 155,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  10,  91, 186, 253, 
-     255, 255, 255, 255, 255, 255, 255, 255, 220, 127,  33,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33, 
-     127, 219, 255, 255, 255, 255, 255, 255, 255, 255, 253, 185,  91,  10,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   8, 255, 255, 255, 249,   0,   0,   0,   0,   7, 206, 255, 255, 255, 
-     255, 143,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  60, 241, 255, 255, 255, 224,  13, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, 229, 255, 255, 
-     255,  92,   0,   0,  94, 255, 255, 255, 230,   3,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  14, 255, 255, 255, 250,   0,   0,   0,   4, 
-     221, 255, 255, 255, 192,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 137, 255, 255, 255, 255,  79,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   3, 216, 255, 255, 255, 195,   3,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   1, 144, 255, 
-     255, 255, 255, 254, 116,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,  75, 255, 255, 255, 
-     245,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15, 246, 255, 255, 
-     255,  74,   0, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     177, 255, 255, 254,  20,   0,   0,   0,   0,   0,  15, 253, 255, 255, 199,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  81, 252, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 252, 255, 
-     255, 255,   2,   0,   0,   0,   0,   0,   0,   3, 255, 255, 255, 251,   0,   0, 
-       0,   0,   0,   0,   0, 106, 255, 255, 244,  28,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 249, 255, 255, 255,  35, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-     214, 255, 255, 255,  44,   0,   0,   0,   0,   0,   0,   0,   0,   0,  49, 255, 
-     255, 255, 210,   0,   0,   0,   0,   0,   0,   0,   8, 121, 242, 255, 255, 255, 
-     255, 255, 255, 255, 242, 121,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  92, 255, 255, 237,   7, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  20, 252, 255, 
-     255, 255,  31,   0,   0,   0,   3, 241, 255, 255, 255,  52,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  53, 255, 255, 255, 239,   3,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  22, 255, 255, 255, 241,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, 255, 255, 
-     255, 248,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 107, 255, 255, 255, 
-     170,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 117, 255, 255, 255, 180,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 112, 
-     255, 255, 255, 224,   2,   0,   0,   0,   0, 248, 255, 255, 255,   5,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, 255, 255, 255, 246,   0, 
-       0, 202, 255, 255, 255,  72,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  74, 255, 255, 255, 255, 232,   1,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  65, 159, 242, 255, 255, 255, 
-     255, 255, 255, 255, 255, 239, 153,  59,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  59, 153, 239, 255, 255, 255, 255, 255, 255, 255, 255, 242, 159,  65, 
-       1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  33, 255, 255, 255, 228,   0,   0,   0,   0, 142, 255, 255, 255, 255, 
-     133,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  61, 247, 255, 255, 255, 155, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  74, 255, 255, 255, 
-     241,   9,   0,   0,  10, 242, 255, 255, 255,  76,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  13, 255, 255, 255, 239,   0,   0,   0,  90, 
-     255, 255, 255, 242,  31,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   1, 211, 255, 255, 255, 187,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  85, 255, 255, 255, 242,  30,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   7, 170, 255, 255, 
-     255, 255, 249,  89,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   2, 225, 255, 255, 
-     255, 107,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 108, 255, 255, 255, 
-     225,   2,   0, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,  80, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255,   0,  16, 235, 255, 255, 255, 255, 217, 121,  56, 
-      14, 255, 255,   9,  28,  46,  65,  94, 141, 187, 233,   0,   0,   0, 240, 255, 
-     255, 255,  10,   0,   0,   0,   0,   0,   0,  12, 255, 255, 255, 238,   0,   0, 
-       0,   0,   0,   0,  19, 237, 255, 255, 121,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 212, 255, 255, 255, 125, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,  48, 
-     255, 255, 255, 206,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 211, 
-     255, 255, 255,  44,   0,   0,   0,   0,   0,   0,   0,   0,  23, 154, 253, 255, 
-     255, 255, 253, 154,  23,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 158, 255, 255, 147,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  94, 255, 255, 
-     255, 209,   0,   0,   0,   0,  53, 255, 255, 255, 233,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 234, 255, 255, 255,  52,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   8, 255, 255, 255, 246,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  24, 255, 255, 
-     255, 227,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33, 244, 255, 255, 236, 
-      22,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 216, 255, 255, 255,  81,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 216, 
-     255, 255, 255, 121,   0,   0,   0,   0,   0, 224, 255, 255, 255,  25,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  26, 255, 255, 255, 222,   0, 
-       0, 227, 255, 255, 255,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  27, 255, 255, 255, 255, 255,  45,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  39, 133, 225, 255, 255, 255, 255, 255, 255, 
-     255, 255, 251, 180,  86,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   7,  85, 179, 251, 255, 255, 255, 255, 255, 255, 255, 255, 
-     225, 133,  39,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 125, 255, 255, 255, 184,   0,   0,   0,  47, 252, 255, 255, 255, 169, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 107, 255, 255, 255, 254, 
-      41,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 172, 255, 255, 255, 
-     153,   0,   0,   0,   0, 155, 255, 255, 255, 174,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  62, 255, 255, 255, 205,   0,   0,   0, 190, 
-     255, 255, 255, 144,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  89, 255, 255, 255, 252,  18,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 187, 255, 255, 255, 144,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,  16, 193, 255, 255, 255, 
-     255, 241,  66,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 126, 255, 255, 
-     255, 208,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 209, 255, 255, 255, 
-     125,   0,   0, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,  80, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255,   0, 117, 255, 255, 255, 254, 120,   3,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 219, 255, 
-     255, 255,  38,   0,   0,   0,   0,   0,   0,  41, 255, 255, 255, 218,   0,   0, 
-       0,   0,   0,   0, 153, 255, 255, 218,   6,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 139, 255, 255, 255, 241, 
-      32,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 127, 
-     255, 255, 255, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 132, 
-     255, 255, 255, 122,   0,   0,   0,   0,   0,   0,   0,   0,  22, 153, 252, 255, 
-     255, 255, 252, 153,  22,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 223, 255, 255,  49,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 172, 255, 255, 
-     255, 132,   0,   0,   0,   0, 105, 255, 255, 255, 170,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 171, 255, 255, 255, 103,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  39, 255, 255, 255, 224,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  90, 255, 255, 
-     255, 175,   0,   0,   0,   0,   0,   0,   0,   0,   1, 190, 255, 255, 255,  92, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  34, 255, 255, 255, 239,   5,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  68, 255, 
-     255, 255, 249,  21,   0,   0,   0,   0,   0, 169, 255, 255, 255,  93,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  95, 255, 255, 255, 167,   0, 
-       0, 246, 255, 255, 255,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   9, 255, 255, 255, 255, 255,  98,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     206, 112,  22,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  21, 111, 205, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  45, 245, 255, 255, 255, 103,   0,   0,   0, 184, 255, 255, 255, 222,  10, 
-       0,   0,   0,   0,   0,   0,   0,   5,  94, 176, 224, 248, 244, 212, 146,  42, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 185, 255, 255, 255, 
-     157,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  19, 249, 255, 255, 255, 
-      55,   0,   0,   0,   0,  58, 255, 255, 255, 250,  21,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 181, 255, 255, 255, 145,   0,   0,  19, 253, 
-     255, 255, 254,  39,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   2, 228, 255, 255, 255,  87,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  17, 252, 255, 255, 254,  37,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,  29, 212, 255, 255, 255, 255, 
-     229,  46,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,  27, 252, 255, 
-     255, 255,  55,   0,   0,   0,   0,   0,   0,   0,   0,  56, 255, 255, 255, 252, 
-      26,   0,   0, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,  80, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255,   0, 193, 255, 255, 255, 139,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 170, 255, 
-     255, 255,  88,   0,   0,   0,   0,   0,   0,  91, 255, 255, 255, 169,   0,   0, 
-       0,   0,   0,  50, 253, 255, 255,  74,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33, 252, 255, 255, 255, 
-     209,  13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 198, 
-     255, 255, 255,  55,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  59, 
-     255, 255, 255, 193,   0,   0,   0,   0,   0,   0,   7, 119, 242, 255, 255, 255, 
-     255, 255, 255, 255, 241, 118,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, 242, 255, 255, 
-     255,  54,   0,   0,   0,   0, 149, 255, 255, 255, 117,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 117, 255, 255, 255, 147,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  98, 255, 255, 255, 188,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   9, 216, 255, 255, 
-     255,  89,   0,   0,   0,   0,   0,   0,   0,   0, 107, 255, 255, 255, 181,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 106, 168, 216, 237, 250, 236, 219, 193, 138,  79,  12,   0, 
-       0,   0,   0,   0,   0,   0,   0,  87, 255, 255, 255, 183,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 174, 255, 
-     255, 255, 164,   0,   0,   0,   0,   0,   0,  79, 255, 255, 255, 217,   9,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  11, 220, 255, 255, 255,  76,   0, 
-       0, 247, 255, 255, 255,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   9, 255, 255, 255, 255, 255, 144,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 229, 139,  44, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  43, 137, 228, 255, 255, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      41, 227, 255, 255, 255, 235,  13,   0,   0,  50, 255, 255, 255, 255,  71,   0, 
-       0,   0,   0,   0,   0,   0,  56, 215, 255, 255, 255, 255, 255, 255, 255, 253, 
-     141,   4,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,  56, 255, 255, 255, 
-     248,  18,   0,   0,   0,   0,   0,   0,   0,   0,   0, 111, 255, 255, 255, 213, 
-       0,   0,   0,   0,   0,   0, 216, 255, 255, 255, 112,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  12, 157, 255, 255, 255, 253,  46,   0,   0,  86, 255, 
-     255, 255, 201,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 164, 255, 255, 255, 139,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  85, 255, 255, 255, 200,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,  44, 228, 255, 255, 255, 255, 213, 
-      30,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 177, 255, 
-     255, 255, 158,   0,   0,   0,   0,   0,   0,   0,   0, 159, 255, 255, 255, 176, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  80, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255,   0, 232, 255, 255, 255,  33,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 106, 255, 
-     255, 255, 172,   0,   0,   0,   0,   0,   0, 179, 255, 255, 255, 105,   0,   0, 
-       0,   0,   1, 198, 255, 255, 179,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 144, 255, 255, 255, 
-     255, 190,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  14, 252, 
-     255, 255, 240,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, 
-     242, 255, 255, 250,  11,   0,   0,   0,   0,  84, 222, 255, 255, 246, 121, 255, 
-     255, 255, 121, 246, 255, 255, 222,  84,   0,   0,   0,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  71, 255, 255, 255, 
-     231,   1,   0,   0,   0,   0, 183, 255, 255, 255,  84,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  85, 255, 255, 255, 180,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 199, 255, 255, 255, 119,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  28, 194, 255, 255, 255, 
-     209,   4,   0,   0,   0,   0,   0,   0,   0,  32, 243, 255, 255, 241,  28,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 240, 140, 
-      28,   0,   0,   0,   0,   0,   0, 140, 255, 255, 255, 127,   0,   0,   0,  67, 
-     155, 212, 243, 249, 231, 210, 160,  92,  16,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27, 251, 255, 
-     255, 255,  58,   0,   0,   0,   0,   0,   0,   2, 199, 255, 255, 255, 190,  24, 
-       0,   0,   0,   0,   0,   0,   0,   0,  27, 195, 255, 255, 255, 196,   1,   0, 
-       0, 228, 255, 255, 255,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  27, 255, 255, 255, 255, 255, 179,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 229, 138,  44, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  42, 136, 228, 255, 255, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  73, 
-     237, 255, 255, 255, 255,  97,   0,   0,   0, 155, 255, 255, 255, 190,   0,   0, 
-       0,   0,   0,   0,   0,  70, 245, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 176,   3, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 198, 255, 255, 
-     255,  84,   0,   0,   0,   0,   0,   0,   0,   0,   0, 208, 255, 255, 255, 116, 
-       0,   0,   0,   0,   0,   0, 119, 255, 255, 255, 209,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       4,  14,  38,  79, 146, 236, 255, 255, 255, 255, 141,   0,   0,   0, 139, 255, 
-     255, 255, 144,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 102, 255, 255, 255, 184,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 138, 255, 255, 255, 144,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,  64, 240, 255, 255, 255, 255, 195,  17, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,  75, 255, 
-     255, 255, 245,  14,   0,   0,   0,   0,   0,   0,  15, 245, 255, 255, 255,  74, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 223, 
-     255, 255, 237,   2,   0,   0,   0,   0,   0,  51, 255, 255, 255, 152,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 250, 255, 255, 255,   6,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16, 245, 
-     255, 255, 253,  60,   0,   0,   0,   0,  67, 255, 255, 255, 243,  14,   0,   0, 
-       0,   0,  95, 255, 255, 248,  35,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  83, 255, 255, 255, 
-     255, 255, 183,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  64, 255, 
-     255, 255, 189,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     193, 255, 255, 255,  60,   0,   0,  52, 195, 255, 255, 255, 187,  35,   0, 255, 
-     255, 255,   0,  35, 188, 255, 255, 255, 194,  51,   0,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 149, 255, 255, 255, 
-     155,   0,   0,   0,   0,   0, 211, 255, 255, 255,  51,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  52, 255, 255, 255, 209,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  74, 255, 255, 255, 254,  38,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   1,  12,  36,  82, 158, 245, 255, 255, 255, 237, 
-      41,   0,   0,   0,   0,   0,   0,   0,   1, 190, 255, 255, 255, 103,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     241,  92,   0,   0,   0,   0,   0, 188, 255, 255, 255,  78,   0,  48, 201, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 240, 127,  11,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 130, 255, 255, 
-     255, 208,   0,   0,   0,   0,   0,   0,   0,   0,  33, 231, 255, 255, 255, 240, 
-     144,  69,  24,   6,   7,  25,  71, 148, 242, 255, 255, 255, 229,  30,   0,   0, 
-       0, 206, 255, 255, 255,  72,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  74, 255, 255, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     205, 111,  22,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  21, 110, 204, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, 142, 254, 
-     255, 255, 255, 255, 171,   0,   0,   0,   7, 240, 255, 255, 255,  72,   0,   0, 
-       0,   0,   0,   0,  32, 240, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 140, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 124, 255, 255, 
-     255, 151,   0,   0,   0,   0,   0,   0,   0,   0,  50, 255, 255, 255, 251,  23, 
-       0,   0,   0,   0,   0,   0,  26, 252, 255, 255, 255,  51,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 254, 143,   2,   0,   0,   0, 183, 255, 
-     255, 255,  89,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  53, 255, 255, 255, 213,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0,   0,   0, 183, 255, 255, 255,  88,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,  87, 249, 255, 255, 255, 255, 173,   8,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   2, 226, 
-     255, 255, 255, 106,   0,   0,   0,   0,   0,   0, 107, 255, 255, 255, 225,   2, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 254, 255, 255, 255, 254,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40, 255, 
-     255, 255, 168,   0,   0,   0,   0,   0,   0, 122, 255, 255, 255,  81,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 235, 255, 255, 255,  41,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 125, 
-     255, 255, 255, 238,  94,  15,  16,  98, 241, 255, 255, 255, 122,   0,   0,   0, 
-       0,  14, 231, 255, 255, 132,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 102, 252, 255, 255, 255, 
-     255, 255, 255, 179,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 114, 255, 
-     255, 255, 138,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     141, 255, 255, 255, 111,   0, 152, 254, 255, 255, 235,  94,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,  94, 235, 255, 255, 254, 151,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 225, 255, 255, 255, 
-      77,   0,   0,   0,   0,   0, 230, 255, 255, 255,  28,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  28, 255, 255, 255, 228,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  17, 227, 255, 255, 255, 172,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 209,  40, 
-       0,   0,   0,   0,   0,   0,   0,   0, 106, 255, 255, 255, 191,   1,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 145,   0,   0,   0,   0, 209, 255, 255, 255,  51,  87, 247, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 210,  32,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, 230, 255, 255, 
-     255, 101,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33, 202, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 200,  31,   0,   0,   0, 
-       0, 152, 255, 255, 255, 141,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 143, 255, 255, 255, 255, 255, 227,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  39, 134, 225, 255, 255, 255, 255, 255, 255, 
-     255, 255, 251, 179,  85,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   7,  84, 178, 251, 255, 255, 255, 255, 255, 255, 255, 255, 
-     225, 134,  39,   0,   0,   0,   0,   0,   0,   0,   0,   0,  21, 206, 255, 255, 
-     255, 255, 255, 207,  12,   0,   0,   0,  67, 255, 255, 255, 231,   2,   0,   0, 
-       0,   0,   0,   0, 182, 255, 255, 255, 255, 226, 112,  40,   9,  11,  42, 116, 
-     230, 255, 254, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,  60, 255, 255, 
-     255, 202,   0,   0,   0,   0,   0,   0,   0,   0, 147, 255, 255, 255, 177,   0, 
-       0,   0,   0,   0,   0,   0,   0, 181, 255, 255, 255, 148,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 247, 144,  43,   0,   0,   0,   0,   0, 213, 255, 
-     255, 255,  47,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  35, 255, 255, 255, 236,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0,   0,   0, 213, 255, 255, 255,  48,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255, 254, 255, 255, 255, 255, 146,   2,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 127, 
-     255, 255, 255, 208,   0,   0,   0,   0,   0,   0, 209, 255, 255, 255, 126,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 241, 255, 255, 255, 240,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 112, 255, 
-     255, 255,  96,   0,   0,   0,   0,   0,   0, 192, 255, 255, 251,  14,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 197, 255, 255, 255, 157,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, 
-     189, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 185,   3,   0,   0,   0, 
-       0, 141, 255, 255, 226,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 103, 254, 255, 255, 245, 214, 
-     255, 255, 255, 255, 175,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 158, 255, 
-     255, 255,  96,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      98, 255, 255, 255, 156,   0, 134, 255, 255, 161,  19,   0,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,   0,  20, 162, 255, 255, 133,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 246, 
-       9,   0,   0,   0,   0,   0, 244, 255, 255, 255,  18,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  19, 255, 255, 255, 243,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   2, 181, 255, 255, 255, 246,  35,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207,  91,   2,   0, 
-       0,   0,   0,   0,   0,   0,   0,  32, 243, 255, 255, 246,  35,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 245, 179, 112,  67,  29,  13,   4,  19,  40,  91, 157, 244, 255, 255, 
-     255, 255, 255, 125,   0,   0,   0, 225, 255, 255, 255,  97, 251, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 234,  31,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  86, 255, 255, 255, 
-     240,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  86, 196, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 196,  85,   1,   0,   0,   0,   0, 
-       0,  87, 255, 255, 255, 238,  13,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  15, 240, 255, 255, 255, 255, 255, 242,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  66, 160, 243, 255, 255, 255, 
-     255, 255, 255, 255, 255, 239, 152,  58,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  58, 152, 238, 255, 255, 255, 255, 255, 255, 255, 255, 243, 160,  66, 
-       1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, 196, 255, 255, 255, 
-     255, 255, 209,  19,   0,   0,   0,   0, 130, 255, 255, 255, 153,   0,   0,   0, 
-       0,   0,   0,  44, 255, 255, 255, 255, 185,  14,   0,   0,   0,   0,   0,   0, 
-      18, 193, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,  29, 255, 255, 
-     255, 225,   0,   0,   0,   0,   0,   0,   0,   7, 237, 255, 255, 255,  80,   0, 
-       0,   0,   0,   0,   0,   0,   0,  83, 255, 255, 255, 238,   7,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 239, 135,  14,   0,   0,   0,   0, 237, 255, 
-     255, 255,  31,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  18, 255, 255, 255, 246,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0,   0,   0, 237, 255, 255, 255,  32,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 230,  18,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,  28, 
-     252, 255, 255, 255,  55,   0,   0,   0,   0,  56, 255, 255, 255, 252,  27,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 226, 255, 255, 255, 225,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 184, 255, 
-     255, 255,  25,   0,   0,   0,   0,   0,  12, 250, 255, 255, 195,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 119, 255, 255, 255, 255, 152,  16,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       9, 166, 255, 255, 255, 255, 255, 255, 255, 255, 162,   7,   0,   0,   0,   0, 
-      41, 250, 255, 255,  85,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  68, 252, 255, 255, 255, 114,  22, 
-     213, 255, 255, 255, 255, 170,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  22, 255, 255, 255, 236,   0,   0,   0,   0,   0,   0,   0,   0, 189, 255, 
-     255, 255,  65,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      67, 255, 255, 255, 187,   0,  13, 195,  67,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,  67, 195,  12,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 125, 255, 255, 255, 178, 
-       0,   0,   0,   0,   0,   0, 251, 255, 255, 255,   9,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  10, 255, 255, 255, 249,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 143, 255, 255, 255, 255, 111,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 195,  78,   0, 
-       0,   0,   0,   0,   0,   0,   1, 189, 255, 255, 255, 114,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-     202,  95,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  14, 142, 253, 
-     255, 255, 255, 255,  57,   0,   0, 240, 255, 255, 255, 239, 255, 255, 255, 255, 
-     218, 107,  39,  11,  11,  40, 108, 218, 255, 255, 255, 255, 205,   8,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 192, 255, 255, 255, 
-     145,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51, 174, 248, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 174,  51,   0,   0,   0,   0, 
-       0,  12, 237, 255, 255, 255, 160,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 163, 255, 255, 255, 255, 255, 255, 249,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  10,  92, 187, 253, 
-     255, 255, 255, 255, 255, 255, 255, 255, 219, 126,  33,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33, 
-     126, 219, 255, 255, 255, 255, 255, 255, 255, 255, 253, 186,  92,  10,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 131, 255, 255, 255, 255, 
-     255, 206,  20,   0,   0,   0,   0,   0, 178, 255, 255, 255,  95,   0,   0,   0, 
-       0,   0,   0, 131, 255, 255, 255, 225,  13,   0,   0,   0,   0,   0,   0,   0, 
-       0,  17, 229, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   8, 255, 255, 
-     255, 246,   0,   0,   0,   0,   0,   0,   0,  86, 255, 255, 255, 233,   4,   0, 
-       0,   0,   0,   0,   0,   0,   0,   6, 236, 255, 255, 255,  87,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 219,  38,   0,   0,   0, 247, 255, 
-     255, 255,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   4, 255, 255, 255, 253,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0,   0,   0, 248, 255, 255, 255,  16,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255, 201, 255, 255, 255, 255, 208,  21,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-     178, 255, 255, 255, 157,   0,   0,   0,   0, 158, 255, 255, 255, 177,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 210, 255, 255, 255, 210,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   9, 247, 255, 
-     255, 208,   0,   0,   0,   0,   0,   0,  77, 255, 255, 255, 124,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  14, 233, 255, 255, 255, 255, 244, 162,  90, 
-      37, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  62, 157, 219, 244, 244, 219, 155,  58,   0,   0,   0,   0,   0,   0, 
-     188, 255, 255, 189,   0,   0,   0,   0,   0,   0,  57, 153, 218, 243, 244, 218, 
-     154,  58,   0,   0,   0,   0,   0,   0,  17, 233, 255, 255, 255, 201,   2,   0, 
-      23, 214, 255, 255, 255, 255, 166,   2,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  67, 255, 255, 255, 196,   0,   0,   0,   0,   0,   0,   0,   0, 219, 255, 
-     255, 255,  35,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      36, 255, 255, 255, 218,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 203, 255, 255, 255, 101, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   2,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 255, 255, 255, 254,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 117, 255, 255, 255, 255, 176,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 174, 
-      14,   0,   0,   0,   0,   0, 105, 255, 255, 255, 200,   2,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  75, 
-     249, 255, 255, 255, 198,   0,   0, 253, 255, 255, 255, 255, 255, 255, 255, 146, 
-       5,   0,   0,   0,   0,   0,   0,   5, 150, 255, 255, 255, 255, 119,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  42, 255, 255, 255, 254, 
-      39,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, 140, 254, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 141,   4,   0,   0, 
-       0,   0, 127, 255, 255, 255, 255, 146,   5,   0,   0,   0,   0,   0,   0,   5, 
-     149, 255, 255, 255, 255, 255, 255, 255, 253,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27, 
-     119, 212, 255, 255, 255, 255, 255, 255, 255, 255, 254, 194,  99,  14,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  14,  99, 193, 254, 
-     255, 255, 255, 255, 255, 255, 255, 255, 212, 118,  26,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  32, 249, 255, 255, 255, 255, 
-     149,   7,   0,   0,   0,   0,   0,   0, 215, 255, 255, 255,  48,   0,   0,   0, 
-       0,   0,   0, 192, 255, 255, 255, 110,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 114, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,  10, 255, 255, 
-     255, 242,   0,   0,   0,   0,   0,   0,   0, 184, 255, 255, 255, 141,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 145, 255, 255, 255, 185,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  10,  24,  61, 113, 200, 255, 255, 255, 255, 223,  20,   0,   0, 254, 255, 
-     255, 255,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  19, 255, 255, 255, 246,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 254, 255, 255, 255,   4,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,  14, 196, 255, 255, 255, 255, 213,  24,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-      76, 255, 255, 255, 244,  14,   0,   0,  15, 245, 255, 255, 255,  75,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 194, 255, 255, 255, 195,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  72, 255, 255, 
-     255, 136,   0,   0,   0,   0,   0,   0, 147, 255, 255, 255,  53,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  65, 248, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 120,  64,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  84, 
-     255, 255, 251,  42,   0,   0,   0,   0,   6, 159, 255, 255, 255, 255, 255, 255, 
-     255, 255, 160,   6,   0,   0,   0,   0, 147, 255, 255, 255, 251,  47,   0,   0, 
-       0,  24, 216, 255, 255, 255, 255, 161,   2,   0,   0,   0,   0,   0,   0,   0, 
-       0, 113, 255, 255, 255, 157,   0,   0,   0,   0,   0,   0,   0,   0, 237, 255, 
-     255, 255,  19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      21, 255, 255, 255, 235,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  25, 254, 255, 255, 254,  25, 
-       0,   0,   0,   0,   0,   0, 251, 255, 255, 255,   8,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   9, 255, 255, 255, 250,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     106, 255, 255, 255, 255, 205,  13,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   4,  19,  45,  95, 173, 250, 255, 255, 255, 255, 
-     194,   8,   0,   0,   0,  32, 243, 255, 255, 249,  43,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      97, 255, 255, 255, 255,  55,   0, 251, 255, 255, 255, 255, 255, 255, 160,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 164, 255, 255, 255, 233,   9,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 148, 255, 255, 255, 188, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 165, 255, 255, 255, 255, 237, 
-     140,  72,  26,   8,   9,  27,  73, 141, 238, 255, 255, 255, 255, 165,   1,   0, 
-       0,   0,  11, 212, 255, 255, 255, 255, 217, 107,  38,  11,  11,  39, 107, 218, 
-     255, 255, 255, 255, 236, 255, 255, 255, 240,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  51, 145, 234, 255, 255, 255, 255, 255, 255, 255, 255, 246, 167,  73, 
-       3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  73, 167, 246, 255, 255, 255, 
-     255, 255, 255, 255, 255, 234, 145,  51,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 126, 255, 255, 255, 255, 105, 
-       0,   0,   0,   0,   0,   0,   0,   0, 239, 255, 255, 255,  21,   0,   0,   0, 
-       0,   0,   0, 228, 255, 255, 255,  39,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  41, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,  28, 255, 255, 
-     255, 220,   0,   0,   0,   0,   0,   0,  28, 253, 255, 255, 255,  43,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  47, 255, 255, 255, 253,  28,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  76, 237, 255, 255, 255, 162,   0,   0, 248, 255, 
-     255, 255,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  36, 255, 255, 255, 236,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 248, 255, 255, 255,  16,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,  11, 190, 255, 255, 255, 255, 218,  28, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       3, 226, 255, 255, 255, 106,   0,   0, 107, 255, 255, 255, 226,   2,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 179, 255, 255, 255, 180,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 144, 255, 255, 
-     255,  64,   0,   0,   0,   0,   0,   0, 217, 255, 255, 236,   2,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  59, 221, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 248, 180,  91,   4,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   9, 225, 
-     255, 255, 142,   0,   0,   0,   0,   3, 183, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 183,   3,   0,   0,  20, 246, 255, 255, 255, 141,   0,   0,   0, 
-       0,   0,  25, 217, 255, 255, 255, 255, 157,   1,   0,   0,   0,   0,   0,   0, 
-       0, 186, 255, 255, 255, 103,   0,   0,   0,   0,   0,   0,   0,   0, 247, 255, 
-     255, 255,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      10, 255, 255, 255, 245,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 102, 255, 255, 255, 202,   0, 
-       0,   0,   0,   0,   0,   0, 244, 255, 255, 255,  18,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  19, 255, 255, 255, 243,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 102, 
-     254, 255, 255, 255, 214,  21,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  32, 184, 255, 255, 255, 
-     255, 139,   0,   0,   1, 188, 255, 255, 255, 125,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 198, 255, 255, 255, 130,   0, 244, 255, 255, 255, 255, 255, 238,  14,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  15, 240, 255, 255, 255,  83,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, 242, 255, 255, 255,  81, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 112, 255, 255, 255, 255, 157,  12, 
-       0,   0,   0,   0,   0,   0,   0,   0,  13, 160, 255, 255, 255, 255, 111,   0, 
-       0,   0,   0,  38, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 249,  84, 255, 255, 255, 224,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   4,  78, 172, 248, 255, 255, 255, 255, 255, 255, 255, 255, 
-     231, 141,  47,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  47, 141, 231, 255, 255, 255, 255, 255, 255, 
-     255, 255, 248, 171,  77,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 189, 255, 255, 255, 150,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 250, 255, 255, 255,   6,   0,   0,   0, 
-       0,   0,   0, 247, 255, 255, 255,   8,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  10, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,  72, 255, 255, 
-     255, 196,   0,   0,   0,   0,   0,   0, 123, 255, 255, 255, 202,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 206, 255, 255, 255, 123,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  51, 250, 255, 255, 254,  38,   0, 237, 255, 
-     255, 255,  31,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  55, 255, 255, 255, 212,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 238, 255, 255, 255,  32,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   9, 184, 255, 255, 255, 255, 223, 
-      33,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0, 127, 255, 255, 255, 207,   0,   0, 208, 255, 255, 255, 126,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 163, 255, 255, 255, 165,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,  76,   0,   0,   0,   0,   0,   0,  10, 108, 218, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 225,  89,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 130, 255, 
-     255, 232,  14,   0,   0,   0,   0, 119, 255, 255, 255, 240,  99,  17,  16,  99, 
-     242, 255, 255, 255, 118,   0,   0, 105, 255, 255, 255, 243,  17,   0,   0,   0, 
-       0,   0,   0,  26, 219, 255, 255, 255, 255, 152,   1,   0,   0,   0,   0,   0, 
-      13, 249, 255, 255, 255,  28,   0,   0,   0,   0,   0,   0,   0,   0, 253, 255, 
-     255, 255,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       2, 255, 255, 255, 253,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 179, 255, 255, 255, 124,   0, 
-       0,   0,   0,   0,   0,   0, 230, 255, 255, 255,  27,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  28, 255, 255, 255, 228,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 102, 254, 
-     255, 255, 255, 220,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 160, 255, 255, 
-     255, 251,  30,   0, 104, 255, 255, 255, 209,   5,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 102, 255, 255, 255, 195,   0, 229, 255, 255, 255, 255, 255, 141,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 143, 255, 255, 255, 148,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 105, 255, 255, 255, 227,   3, 
-       0,   0,   0,   0,   0,   0,   0,   0,  17, 242, 255, 255, 255, 142,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 146, 255, 255, 255, 242,  16, 
-       0,   0,   0,   0,  39, 216, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 244,  84,  52, 255, 255, 255, 208,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  17, 104, 198, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 209, 115,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 115, 209, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     198, 104,  17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 228, 255, 255, 255,  57,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 250, 255, 255, 255,   6,   0,   0,   0, 
-       0,   0,   0, 247, 255, 255, 255,   9,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  10, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 136, 255, 255, 
-     255, 136,   0,   0,   0,   0,   0,   0, 219, 255, 255, 255, 104,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 109, 255, 255, 255, 219,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 149, 255, 255, 255, 129,   0, 214, 255, 
-     255, 255,  47,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 105, 255, 255, 255, 183,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 214, 255, 255, 255,  49,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   7, 178, 255, 255, 255, 255, 
-     227,  37,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,  28, 252, 255, 255, 255,  54,  55, 255, 255, 255, 252,  27,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 148, 255, 255, 255, 150,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,  76,   0,   0,   0,   0,   0,   0,   0,   0,   0,  46, 122, 179, 
-     230, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159,   2,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  34, 247, 255, 
-     255,  95,   0,   0,   0,   0,  14, 243, 255, 255, 254,  63,   0,   0,   0,   0, 
-      69, 255, 255, 255, 242,  13,   0, 175, 255, 255, 255, 143,   0,   0,   0,   0, 
-       0,   0,   0,   0,  28, 220, 255, 255, 255, 255, 147,   0,   0,   0,   0,   0, 
-     100, 255, 255, 255, 208,   0,   0,   0,   0,   0,   0,   0,   0,   0, 246, 255, 
-     255, 255,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      11, 255, 255, 255, 245,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  10, 246, 255, 255, 255,  47,   0, 
-       0,   0,   0,   0,   0,   0, 211, 255, 255, 255,  50,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  51, 255, 255, 255, 209,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 103, 254, 255, 
-     255, 255, 225,  31,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, 218, 255, 
-     255, 255, 127,   0, 243, 255, 255, 252,  51,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  38, 255, 255, 255, 221,   0, 209, 255, 255, 255, 255, 255,  72,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  74, 255, 255, 255, 204,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 210, 255, 255, 255, 125,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 109, 255, 255, 255, 215,   4,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, 217, 255, 255, 255, 109, 
-       0,   0,   0,   0,   0,  14, 133, 242, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 203,  38,   0,  79, 255, 255, 255, 187,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  36, 130, 222, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 222, 130,  36, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 244, 255, 255, 255,  13,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 239, 255, 255, 255,  18,   0,   0,   0, 
-       0,   0,   0, 229, 255, 255, 255,  39,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  40, 255, 255, 255, 255,   0,   0,   0,   0,   0,   4, 230, 255, 255, 
-     255,  59,   0,   0,   0,   0,   0,  62, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  62,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  64, 255, 255, 255, 190,   0, 184, 255, 
-     255, 255,  88,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 166, 255, 255, 255, 137,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 183, 255, 255, 255,  91,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   5, 171, 255, 255, 255, 
-     255, 230,  42,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0, 179, 255, 255, 255, 156, 157, 255, 255, 255, 178,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 132, 255, 255, 255, 135,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,  76,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 151, 208, 255, 255, 255, 255, 255, 255, 146,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 177, 255, 255, 
-     198,   1,   0,   0,   0,   0, 103, 255, 255, 255, 176,   0,   0,   0,   0,   0, 
-       0, 181, 255, 255, 255, 103,   0, 222, 255, 255, 255,  67,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  29, 222, 255, 255, 255, 255, 143,   0,   0,   0,   0, 
-     212, 255, 255, 255, 122,   0,   0,   0,   0,   0,   0,   0,   0,   0, 236, 255, 
-     255, 255,  20,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      21, 255, 255, 255, 235,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  78, 255, 255, 255, 225,   0,   0, 
-       0,   0,   0,   0,   0,   0, 184, 255, 255, 255,  83,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  84, 255, 255, 255, 181,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 106, 254, 255, 255, 
-     255, 228,  35,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 106, 255, 
-     255, 255, 191,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  12, 255, 255, 255, 244,   0, 180, 255, 255, 255, 255, 255,  26,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27, 255, 255, 255, 226,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  61, 255, 255, 255, 250,  24,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 181, 255, 255, 255, 105,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 106, 255, 255, 255, 180, 
-       0,   0,   0,   0,   0,   0,   0,  18,  94, 162, 212, 233, 250, 244, 214, 158, 
-      72,   1,   0,   0, 128, 255, 255, 255, 139,   0, 255, 255, 255, 255, 255,   0, 
-       0,  21, 255, 255, 255, 223,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  63, 157, 241, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 241, 156,  62,   1,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   2,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 219, 255, 255, 255,  48,   0,   0,   0, 
-       0,   0,   0, 194, 255, 255, 255, 110,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 111, 255, 255, 255, 255,   0,   0,   0,   0,   0, 119, 255, 255, 255, 
-     219,   3,   0,   0,   0,   0,   0, 159, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  21, 255, 255, 255, 231,   0, 140, 255, 
-     255, 255, 143,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   3, 230, 255, 255, 255,  84,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 139, 255, 255, 255, 149,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   3, 164, 255, 255, 
-     255, 255, 234,  47,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,  77, 255, 255, 255, 244, 244, 255, 255, 255,  76,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,  76,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,  29, 135, 247, 255, 255, 255, 254,  52,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  72, 255, 255, 253, 
-      51,   0,   0,   0,   0,   0, 169, 255, 255, 255,  89,   0,   0,   0,   0,   0, 
-       0,  93, 255, 255, 255, 168,   0, 245, 255, 255, 255,  18,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  30, 223, 255, 255, 255, 255, 137,   0,   0,  77, 
-     255, 255, 255, 246,  19,   0,   0,   0,   0,   0,   0,   0,   0,   0, 218, 255, 
-     255, 255,  36,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      38, 255, 255, 255, 217,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 156, 255, 255, 255, 148,   0,   0, 
-       0,   0,   0,   0,   0,   0, 150, 255, 255, 255, 116,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 117, 255, 255, 255, 148,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 109, 255, 255, 255, 255, 
-     231,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  36, 255, 
-     255, 255, 233,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  12, 255, 255, 255, 245,   0, 146, 255, 255, 255, 255, 255,   8,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   9, 255, 255, 255, 246,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 167, 255, 255, 255, 168,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 227, 255, 255, 255,  38,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  39, 255, 255, 255, 227, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 184, 255, 255, 255,  86,   0, 255, 255, 255, 255, 255,   0, 
-       0,  86, 255, 255, 255, 126,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   9, 
-      89, 183, 252, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 252, 183,  89,   9,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 184, 255, 255, 255,  89,   0,   0,   0, 
-       0,   0,   0, 133, 255, 255, 255, 223,  12,   0,   0,   0,   0,   0,   0,   0, 
-       0,  13, 224, 255, 255, 255, 255,   0,   0,   0,   0,  63, 247, 255, 255, 255, 
-      80,   0,   0,   0,   0,   0,  12, 244, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 244,  12, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   5, 255, 255, 255, 248,   0,  87, 255, 
-     255, 255, 200,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  92, 255, 255, 255, 251,  16,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  86, 255, 255, 255, 209,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   2, 156, 255, 
-     255, 255, 255, 238,  53,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   3, 227, 255, 255, 255, 255, 255, 255, 226,   3,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 179, 255, 255, 254, 
-      18,   0,   0,   0,   0,   0,  12, 251, 255, 255, 192,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,  46, 236, 255, 255, 255, 151,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, 217, 255, 255, 153, 
-       0,   0,   0,   0,   0,   0, 219, 255, 255, 255,  39,   0,   0,   0,   0,   0, 
-       0,  41, 255, 255, 255, 217,   0, 248, 255, 255, 255,  15,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  31, 224, 255, 255, 255, 255, 132,   7, 219, 
-     255, 255, 255, 152,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 188, 255, 
-     255, 255,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      68, 255, 255, 255, 186,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   1, 231, 255, 255, 255,  70,   0,   0, 
-       0,   0,   0,   0,   0,   0, 106, 255, 255, 255, 169,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 170, 255, 255, 255, 104,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 113, 255, 255, 255, 255, 233, 
-      41,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   9, 255, 
-     255, 255, 249,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  37, 255, 255, 255, 223,   0, 100, 255, 255, 255, 255, 255,   8,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   9, 255, 255, 255, 246,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  23, 249, 255, 255, 255,  62,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 247, 255, 255, 255,  11,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, 255, 255, 255, 246, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   5, 239, 255, 255, 255,  33,   0,   0,   0,   0,   0,   0,   0, 
-       0, 152, 255, 255, 253,  30,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  24, 115, 209,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 209, 115,  24,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 141, 255, 255, 255, 150,   0,   0,   0, 
-       0,   0,   0,  47, 255, 255, 255, 255, 182,  12,   0,   0,   0,   0,   0,   0, 
-      12, 182, 255, 255, 255, 255, 255,   0,   0,   0,  91, 243, 255, 255, 255, 180, 
-       0,   0,   0,   0,   0,   0,  98, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  98, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  22, 255, 255, 255, 244,   0,  19, 253, 
-     255, 255, 254,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   2, 213, 255, 255, 255, 184,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  18, 252, 255, 255, 255,  47,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   1, 149, 
-     255, 255, 255, 255, 241,  58,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0, 128, 255, 255, 255, 255, 255, 255, 127,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 239, 255, 255, 211, 
-       0,   0,   0,   0,   0,   0,  70, 255, 255, 255, 130,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0, 101, 255, 255, 255, 217,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 119, 255, 255, 238,  20, 
-       0,   0,   0,   0,   0,   0, 240, 255, 255, 255,  11,   0,   0,   0,   0,   0, 
-       0,  13, 255, 255, 255, 238,   0, 226, 255, 255, 255,  44,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  33, 226, 255, 255, 255, 255, 202, 255, 
-     255, 255, 249,  36,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156, 255, 
-     255, 255,  98,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      99, 255, 255, 255, 155,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  55, 255, 255, 255, 242,   6,   0,   0, 
-       0,   0,   0,   0,   0,   0,  54, 255, 255, 255, 232,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 233, 255, 255, 255,  53,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 117, 255, 255, 255, 255, 234,  43, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16, 255, 
-     255, 255, 239,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  99, 255, 255, 255, 199,   0,  47, 255, 255, 255, 255, 255,  26,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27, 255, 255, 255, 226,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 123, 255, 255, 255, 211,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 246, 255, 255, 255,  10,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, 255, 255, 255, 246, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  83, 255, 255, 255, 216,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 217, 255, 255, 186,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  81, 255, 255, 255, 223,   1,   0,   0, 
-       0,   0,   0,   0, 186, 255, 255, 255, 255, 224, 110,  39,   9,   8,  38, 109, 
-     223, 255, 254, 255, 255, 255, 255,  29,  92, 196, 255, 255, 255, 255, 199,  11, 
-       0,   0,   0,   0,   0,   0, 196, 255, 255, 255, 131,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 131, 255, 255, 255, 196, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  67, 255, 255, 255, 222,   0,   0, 190, 
-     255, 255, 255, 142,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 139, 255, 255, 255, 255,  76,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 188, 255, 255, 255, 161,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     141, 255, 255, 255, 255, 244,  64,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,  29, 252, 255, 255, 255, 255, 252,  28,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  49, 255, 255, 255, 149, 
-       0,   0,   0,   0,   0,   0, 132, 255, 255, 255,  67,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,  21, 255, 255, 255, 244,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  26, 243, 255, 255, 106,   0, 
-       0,   0,   0,   0,   0,   0, 252, 255, 255, 255,   2,   0,   0,   0,   0,   0, 
-       0,   3, 255, 255, 255, 251,   0, 200, 255, 255, 255, 115,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  35, 227, 255, 255, 255, 255, 255, 
-     255, 255, 135,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 113, 255, 
-     255, 255, 141,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     143, 255, 255, 255, 110,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 133, 255, 255, 255, 171,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   4, 242, 255, 255, 255,  52,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  52, 255, 255, 255, 240,   3,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 121, 255, 255, 255, 255, 235,  45,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  46, 255, 
-     255, 255, 217,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 192, 255, 255, 255, 139,   0,   1, 234, 255, 255, 255, 255,  72,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  74, 255, 255, 255, 202,   0, 
-       0,   0,   0,   0,   0,   0,   0,   3, 225, 255, 255, 255, 105,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 227, 255, 255, 255,  37,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  39, 255, 255, 255, 226, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 181, 255, 255, 255, 116,   0,   0,   0,   0,   0,   0,   0,   0, 
-      27, 255, 255, 255,  87,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  17, 250, 255, 255, 255,  62,   0,   0, 
-       0,   0,   0,   0,  35, 243, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 138, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 187,  17,   0, 
-       0,   0,   0,   0,   0,  37, 255, 255, 255, 254,  34,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35, 255, 255, 255, 255, 
-      37,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 154, 255, 255, 255, 185,   0,   0,  91, 
-     255, 255, 255, 241,  29,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     101, 255, 255, 255, 255, 200,   1,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  87, 255, 255, 255, 249,  44,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 132, 255, 255, 255, 255, 246,  70,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 179, 255, 255, 255, 255, 179,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 112, 255, 255, 255,  87, 
-       0,   0,   0,   0,   0,   0, 195, 255, 255, 250,  10,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,   8, 255, 255, 255, 244,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 166, 255, 255, 208,   3,   0, 
-       0,   0,   0,   0,   0,   0, 240, 255, 255, 255,  11,   0,   0,   0,   0,   0, 
-       0,  12, 255, 255, 255, 238,   0, 137, 255, 255, 255, 218,   5,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  36, 228, 255, 255, 255, 255, 
-     255, 227,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  63, 255, 
-     255, 255, 192,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     194, 255, 255, 255,  60,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 210, 255, 255, 255,  93,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 169, 255, 255, 255, 159,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 160, 255, 255, 255, 167,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 124, 255, 255, 255, 255, 237,  47,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 120, 255, 
-     255, 255, 182,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      86, 255, 255, 255, 255,  66,   0,   0, 157, 255, 255, 255, 255, 142,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 144, 255, 255, 255, 144,   0, 
-       0,   0,   0,   0,   0,   0,   0,  79, 255, 255, 255, 242,  12,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 202, 255, 255, 255, 104,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 107, 255, 255, 255, 200, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  65, 255, 255, 255, 250,  21,   0,   0,   0,   0,   0,   0,   0,   0, 
-      92, 255, 255, 237,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 181, 255, 255, 255, 178,   0,   0, 
-       0,   0,   0,   0,   0,  76, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 178,   3, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113,   1,   0,   0, 
-       0,   0,   0,   0,   0, 135, 255, 255, 255, 192,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 193, 255, 255, 255, 
-     134,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  55, 251, 255, 255, 255, 112,   0,   0,   5, 
-     222, 255, 255, 255, 189,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  10, 140, 
-     255, 255, 255, 255, 249,  51,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   4, 217, 255, 255, 255, 215,  12,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 125, 255, 255, 255, 255, 248,  77,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 175, 255, 255, 255,  25, 
-       0,   0,   0,   0,   0,   8, 248, 255, 255, 199,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   0,  54, 255, 255, 255, 221,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  62, 255, 255, 255,  60,   0,   0, 
-       0,   0,   0,   0,   0,   0, 220, 255, 255, 255,  39,   0,   0,   0,   0,   0, 
-       0,  41, 255, 255, 255, 218,   0,  60, 255, 255, 255, 255, 124,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  37, 235, 255, 255, 255, 
-     255, 169,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  13, 252, 
-     255, 255, 242,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, 
-     243, 255, 255, 250,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  32, 255, 255, 255, 252,  19,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  78, 255, 255, 255, 248,  35,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  35, 248, 255, 255, 255,  76,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 127, 255, 255, 255, 255, 238,  49,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  14, 230, 255, 
-     255, 255, 107,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 181, 
-      37,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  61, 
-     245, 255, 255, 255, 216,   4,   0,   0,  62, 255, 255, 255, 255, 238,  14,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  15, 240, 255, 255, 255,  78,   0, 
-       0,   0,   0,   0,   0,   0,   0, 185, 255, 255, 255, 148,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 140, 255, 255, 255, 214,   3,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, 218, 255, 255, 255, 139, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  10, 215, 255, 255, 255, 154,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     158, 255, 255, 147,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  82, 255, 255, 255, 255,  58,   0, 
-       0,   0,   0,   0,   0,   0,  61, 219, 255, 255, 255, 255, 255, 255, 255, 254, 
-     146,   4,   0, 255, 255, 255, 255, 255, 255, 230, 125,  21,   0,   0,   0,   0, 
-       0,   0,   0,   0,   3, 229, 255, 255, 255,  95,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  95, 255, 255, 255, 
-     228,   3,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  78, 238, 255, 255, 255, 246,  26,   0,   0,   0, 
-      88, 255, 255, 255, 255, 141,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  10, 159,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  18, 111, 226, 255, 
-     255, 255, 255, 255, 106,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  79, 255, 255, 255, 255, 180,  12,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 116, 255, 255, 255, 255, 250,  84,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 236, 255, 255, 219,   0, 
-       0,   0,   0,   0,   0,  63, 255, 255, 255, 136,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,   0,   1, 177, 255, 255, 255, 168,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   3, 209, 255, 255, 164,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 171, 255, 255, 255,  90,   0,   0,   0,   0,   0, 
-       0,  92, 255, 255, 255, 169,   0,   1, 201, 255, 255, 255, 254,  95,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, 144, 254, 255, 255, 255, 
-     255, 255, 140,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 198, 
-     255, 255, 255,  58,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  60, 
-     255, 255, 255, 193,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 109, 255, 255, 255, 194,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   2, 221, 255, 255, 255, 199,   4,   0,   0, 
-       0,   0,   0,   0,   0,   0,   4, 200, 255, 255, 255, 220,   2,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 128, 255, 255, 255, 255, 238,  50,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 177,  31,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, 178, 255, 255, 
-     255, 250,  28,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 
-     249, 151,  47,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, 122, 250, 
-     255, 255, 255, 255,  80,   0,   0,   0,   0, 205, 255, 255, 255, 255, 160,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 164, 255, 255, 255, 227,   6,   0, 
-       0,   0,   0,   0,   0,   0,  36, 254, 255, 255, 255,  42,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  69, 255, 255, 255, 255, 139,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 148, 255, 255, 255, 255,  68, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      10, 190, 255, 255, 255, 232,  17,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     223, 255, 255,  49,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 217, 255, 255, 255, 211,   7, 
-       0,   0,   0,   0,   0,   0,   0,   6,  97, 179, 226, 248, 235, 206, 139,  38, 
-       0,   0,   0, 245, 224, 203, 172, 114,  53,   4,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  74, 255, 255, 255, 242,  10,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, 243, 255, 255, 
-     255,  73,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   9,  23,  60, 113, 200, 255, 255, 255, 255, 255, 129,   0,   0,   0,   0, 
-       0, 177, 255, 255, 255, 255, 163,   6,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  72, 221, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   2,   9,  24,  48,  84, 129, 190, 250, 255, 255, 255, 
-     255, 255, 255, 121,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 165, 255, 255, 255, 255, 212,  36, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 108, 254, 255, 255, 255, 252,  91,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  44, 255, 255, 255, 157,   0, 
-       0,   0,   0,   0,   0, 126, 255, 255, 255,  74,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 208, 112,  23,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255,   0,   0,   0,  13, 161, 255, 255, 255, 255,  88,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 108, 255, 255, 242,  25,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 106, 255, 255, 255, 177,   0,   0,   0,   0,   0, 
-       0, 181, 255, 255, 255, 104,   0,   0,  61, 255, 255, 255, 255, 255, 145,  13, 
-       0,   0,   0,   0,   0,   0,   0,   0,   2,  87, 214, 255, 255, 255, 255, 255, 
-     255, 255, 255, 138,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 127, 
-     255, 255, 255, 131,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 133, 
-     255, 255, 255, 122,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 187, 255, 255, 255, 117,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  93, 255, 255, 255, 255, 182,  15,   0, 
-       0,   0,   0,   0,   0,  16, 184, 255, 255, 255, 255,  91,   0,   0,   0, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0, 128, 255, 255, 255, 255, 239,  51,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 245, 140,  37, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  50, 200, 255, 255, 255, 
-     255, 141,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255, 203, 137,  80,  39,  21,   4,  13,  32,  79, 142, 235, 255, 255, 
-     255, 255, 255, 160,   0,   0,   0,   0,   0,  69, 255, 255, 255, 255, 255, 146, 
-       5,   0,   0,   0,   0,   0,   0,   5, 149, 255, 255, 255, 255, 110,   0,   0, 
-       0,   0,   0,   0,   0,   0, 141, 255, 255, 255, 192,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   1, 208, 255, 255, 255, 255, 153,  11, 
-       0,   0,   0,   0,   0,   0,   0,   0,  15, 163, 255, 255, 255, 255, 206,   1, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  56, 
-     207, 255, 255, 255, 255,  87,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  85, 255, 255, 255, 255, 153, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 171, 255, 255, 255, 156,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 157, 255, 255, 
-     255, 170,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 181,   5,   0,   0,   0,   0, 
-       0,  17, 218, 255, 255, 255, 255, 222,  92,   2,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   2,  76, 191, 255, 255, 255,   0, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 239,  83,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  11, 206, 255, 255, 255, 255, 248, 
-     152,  36,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  32, 
-     138, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 101, 253, 255, 255, 255, 253,  98,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 107, 255, 255, 255,  95,   0, 
-       0,   0,   0,   0,   0, 188, 255, 255, 252,  14,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 254, 206, 138,  86,  45,   9,   0, 
-       0, 255, 255,  21,  70, 143, 237, 255, 255, 255, 255, 211,   3,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  20, 238, 255, 255, 117,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  15, 244, 255, 255, 254,  65,   0,   0,   0,   0, 
-      69, 255, 255, 255, 243,  14,   0,   0,   0, 128, 255, 255, 255, 255, 255, 238, 
-     141,  70,  26,   6,  14,  37,  75, 143, 221, 255, 255, 255, 255, 255, 249, 231, 
-     255, 255, 255, 255, 135,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  48, 
-     255, 255, 255, 210,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 210, 
-     255, 255, 255,  44,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  14, 250, 255, 255, 255,  39,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   1, 190, 255, 255, 255, 255, 228, 123, 
-      46,  14,  15,  47, 125, 229, 255, 255, 255, 255, 189,   1,   0,   0,   0, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  48,   0, 255, 255, 255, 254, 
-     195, 132,  74,  37,  19,   4,  12,  27,  65, 114, 196, 254, 255, 255, 255, 255, 
-     219,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 181,   4,   0,   0,   0,   0,   0,   0, 161, 255, 255, 255, 255, 255, 
-     217, 107,  38,  11,  11,  39, 107, 218, 255, 255, 255, 255, 194,   4,   0,   0, 
-       0,   0,   0,   0,   0,   9, 237, 255, 255, 255,  85,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  72, 254, 255, 255, 255, 255, 236, 
-     139,  70,  25,   7,   8,  26,  73, 143, 239, 255, 255, 255, 255, 254,  70,   0, 
-       0,   0,   0, 230, 179, 128,  78,  45,  21,   8,   3,  21,  45, 104, 184, 254, 
-     255, 255, 255, 255, 149,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 185, 255, 255, 255, 255, 
-     119,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  19, 249, 255, 255, 255,  59,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  59, 255, 255, 
-     255, 248,  18,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 166,   9,   0,   0,   0,   0,   0, 
-       0,   0,  33, 224, 255, 255, 255, 255, 255, 226, 154,  84,  46,  25,   6,  14, 
-      35,  56, 105, 170, 235, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 
-     153,  21,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  23, 209, 255, 255, 255, 255, 
-     255, 253, 200, 139,  79,  46,  28,  11,   3,  13,  24,  51,  86, 135, 203, 253, 
-     255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  93, 252, 255, 255, 255, 254, 106,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 170, 255, 255, 255,  33,   0, 
-       0,   0,   0,   0,   5, 245, 255, 255, 205,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 249, 
-     235, 255, 255, 255, 255, 255, 255, 255, 255, 255, 241,  47,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 154, 255, 255, 216,   5,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 123, 255, 255, 255, 240,  98,  16,  15,  98, 
-     241, 255, 255, 255, 119,   0,   0,   0,   0,   0, 152, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 225,  56,  35, 
-     229, 255, 255, 255, 255, 133,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     215, 255, 255, 255,  47,   0,   0,   0,   0,   0,   0,   0,   0,   0,  48, 255, 
-     255, 255, 210,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  86, 255, 255, 255, 218,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  26, 226, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 225,  25,   0,   0,   0,   0, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  48,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 224, 
-      30,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     251, 126,   3,   0,   0,   0,   0,   0,   0,   0,  11, 204, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 226,  24,   0,   0,   0, 
-       0,   0,   0,   0,   0,  97, 255, 255, 255, 230,   4,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 121, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 120,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 159,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  28, 235, 255, 255, 255, 
-     255, 123,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 110, 255, 255, 255, 217,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 218, 255, 
-     255, 255, 109,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 205,  79,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  29, 203, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 207, 122,  24, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16, 178, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 213,  65,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   6, 255, 255, 
-     255, 248,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  86, 251, 255, 255, 255, 255, 114,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 232, 255, 255, 227,   0,   0, 
-       0,   0,   0,   0,  57, 255, 255, 255, 143,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 227,  58,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  52, 253, 255, 255,  70,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   3, 186, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 183,   3,   0,   0,   0,   0,   0,   0, 106, 248, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 148,  13,   0,   0, 
-      40, 233, 255, 255, 255, 255, 130,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     123, 255, 255, 255, 140,   0,   0,   0,   0,   0,   0,   0,   0,   0, 142, 255, 
-     255, 255, 119,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 163, 255, 255, 255, 140,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  37, 219, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 218,  36,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  48,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 176,  25, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,  46, 
-     139, 226, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 162, 
-      47,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  18, 193, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 203,  26,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 203, 255, 255, 255, 129,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 115, 249, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 115,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 250, 119,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  69, 251, 255, 255, 
-     255, 255, 161,  12,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  69, 192,  11,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 207, 255, 255, 255, 120,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 121, 255, 
-     255, 255, 207,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 249, 234, 217, 175, 122,  50,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   7, 132, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 198,  66,   0, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 254, 249, 241, 224, 202, 170, 131,  83,  22,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 100, 234, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 234, 116,   5,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,  15, 255, 255, 
-     255, 236,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  79, 249, 255, 255, 255, 255, 123,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  44, 132, 216, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 242, 141,  18,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   1, 199, 255, 255, 174,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   8, 163, 255, 255, 255, 255, 255, 255, 
-     255, 255, 159,   6,   0,   0,   0,   0,   0,   0,   0,   0,  40, 163, 251, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 158,  39,   0,   0,   0,   0, 
-       0,  46, 237, 255, 255, 255, 255, 129,   0,   0,   0,   0,   0,   0,   0,   0, 
-      25, 250, 255, 255, 236,   9,   0,   0,   0,   0,   0,   0,   0,  10, 237, 255, 
-     255, 249,  23,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   3, 237, 255, 255, 255,  63,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16, 154, 252, 255, 255, 
-     255, 255, 255, 255, 255, 255, 252, 153,  16,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  48,   0,  46, 138, 225, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 189,  80,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  41, 107, 158, 199, 229, 244, 251, 238, 221, 198, 146,  90,  20,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, 120, 241, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 238, 122,   9,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  49, 179, 253, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 179,  49,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 
-     176,  42,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  89, 253, 255, 
-     255, 255, 255, 220,  76,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  19, 150, 254, 255, 150,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  32, 147, 240, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 244, 165,  70,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  13, 112, 
-     215, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 187, 
-      86,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  38, 255, 255, 
-     255, 223,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  26,  89, 139, 178, 213, 233, 
-     248, 255, 255, 227, 194, 150,  83,  14,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  96, 255, 255, 247,  32,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  59, 155, 219, 244, 244, 219, 
-     155,  57,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  28, 102, 
-     167, 212, 232, 250, 248, 232, 200, 152,  88,  13,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 166, 255, 255, 255, 106,   0,   0,   0,   0,   0,   0,   0, 107, 255, 255, 
-     255, 163,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  62, 255, 255, 255, 237,   3,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  32, 123, 191, 
-     232, 250, 250, 231, 190, 123,  31,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40, 
-     106, 157, 199, 229, 244, 251, 239, 224, 202, 154, 102,  33,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  13, 101, 
-     173, 219, 245, 251, 233, 212, 162,  92,  15,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  34, 110, 
-     167, 213, 231, 248, 248, 231, 213, 167, 110,  34,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  29,  86, 136, 178, 210, 235, 248, 253, 243, 219, 177, 114,  32, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  87, 249, 
-     255, 255, 255, 255, 255, 196,  83,   6,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  32, 146, 245, 255, 255, 255, 254,  67,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   7,  75, 136, 185, 219, 241, 251, 248, 
-     232, 215, 179, 128,  76,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  42, 110, 163, 201, 230, 245, 253, 249, 239, 215, 185, 141,  87,  21,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  72, 255, 255, 
-     255, 192,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       7, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  53, 255, 255, 255, 219,   3,   0,   0,   0,   0,   0,   3, 220, 255, 255, 
-     255,  52,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 140, 255, 255, 255, 164,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  61, 
-     229, 255, 255, 255, 255, 255, 255, 240, 167, 107,  60,  27,  10,   2,  10,  33, 
-      71, 125, 196, 253, 255, 255, 255, 255, 255, 205,  34,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 133, 255, 255, 
-     255, 150,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       6, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 183, 255, 255, 255,  99,   0,   0,   0,   0,   0, 100, 255, 255, 255, 
-     181,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 217, 255, 255, 255,  86,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      20, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 250, 133,   7,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, 220, 255, 255, 
-     255, 100,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       5, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  55, 255, 255, 255, 226,   7,   0,   0,   0,   8, 227, 255, 255, 255, 
-      53,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  67, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 175,  41,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 132, 255, 255, 255, 
-     252,  22,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       4, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 176, 255, 255, 255, 119,   0,   0,   0, 120, 255, 255, 255, 175, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  63, 166, 243, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 237, 151,  43,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   3,  21,  73, 179, 255, 255, 255, 255, 
-     181,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       3, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  36, 249, 255, 255, 244,  30,   0,  31, 245, 255, 255, 249,  35, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   9,  70, 130, 178, 213, 237, 249, 252, 241, 217, 
-     181, 129,  66,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 252, 
-      44,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       2, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 138, 255, 255, 255, 177,   0, 178, 255, 255, 255, 137,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 107, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       1, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 233,  92,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 241, 221, 175, 103,  14,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 251,  37,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  32, 107, 168, 208, 237, 249, 250, 237, 209, 169, 109, 
-      33,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 247, 231, 214, 172, 119,  49,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  32, 107, 
-     168, 208, 237, 249, 250, 237, 209, 169, 109,  33,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     248, 233, 218, 181, 132,  70,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  10,  85, 142, 195, 222, 238, 252, 243, 
-     230, 207, 170, 132,  76,  17,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0, 207, 255, 255, 255, 120,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 121, 255, 255, 255, 207,   0, 224, 255, 255, 255,  63,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  27, 255, 255, 255, 255, 255, 255, 
-      34,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  64, 255, 
-     255, 255, 224,   0,   0,   0, 171, 255, 255, 255, 249,  43,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  46, 249, 255, 255, 255, 
-     167,   0,   0, 172, 255, 255, 255, 245,  34,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  34, 245, 255, 255, 255, 172,   0, 
-       0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255,   0, 217, 255, 255, 255,  86,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       9, 191, 255, 255, 255, 255, 190,   9,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 150, 255, 255, 
-     255, 216,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  53, 122, 
-     170, 213, 235, 250, 243, 225, 200, 142,  78,   4,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, 
-      64, 133, 193, 218, 238, 251, 237, 213, 166, 107,  26,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,  16,  87, 162, 
-     206, 229, 249, 238, 216, 176, 104,  26,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  25, 124, 186, 228, 245, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,  33, 120, 194, 225, 249, 243, 214, 159,  71,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  60, 150, 208, 241, 251, 236, 193, 117,  18,   0,   0,   0,   0, 
-       0,   0,   0,   0,  57, 148, 207, 240, 250, 230, 195, 116,  21,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  37, 132, 198, 237, 251, 237, 
-     215, 160,  84,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 
-      56, 132, 196, 221, 244, 244, 221, 195, 131,  55,   1,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  74, 160, 215, 243, 248, 223, 
-     190, 110,  23,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      23, 111, 191, 223, 248, 243, 214, 160,  73,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  54, 142, 200, 236, 251, 255, 
-     252,   0,   0,   0,   0,   0,   4,  77, 147, 195, 228, 243, 252, 240, 226, 191, 
-     149,  89,  17,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 207, 
-     255, 255, 255, 121,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 121, 255, 255, 255, 206,   0, 222, 255, 255, 255,  69,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 134, 255, 255, 255, 255, 255, 141,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  70, 255, 255, 255, 222,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 169,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  65, 189, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     254, 192,  68,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 202,  77,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  65, 189, 254, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 192,  68,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 229, 119,   4,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  21, 145, 240, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 254, 205, 123,  41,   0,   0,   0,   0, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0, 110, 255, 255, 255, 216,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 217, 255, 255, 255, 109,   0, 161, 255, 255, 255, 127,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  90, 255, 255, 255, 255, 255, 255, 
-      96,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 128, 255, 
-     255, 255, 160,   0,   0,   0,  22, 235, 255, 255, 255, 201,   3,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, 210, 255, 255, 255, 229, 
-      17,   0,   0,  23, 237, 255, 255, 255, 189,   1,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   1, 190, 255, 255, 255, 237,  23,   0, 
-       0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255,   0, 140, 255, 255, 255, 164,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, 
-     187, 255, 255, 255, 255, 255, 255, 186,   8,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   4, 188, 255, 
-     255, 255, 156,   0,   0,   0,   0,   0,   0,   0,   0,  48, 145, 234, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 222,  98,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, 102, 226, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 182,  61,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,  12, 130, 245, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 248, 139,  16,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 112, 249, 255, 255, 255, 255, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,  10, 140, 252, 255, 255, 255, 255, 255, 255, 255, 255, 199, 
-      38,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,  28, 186, 255, 255, 255, 255, 255, 255, 255, 255, 235,  81,   0,   0,   0, 
-       0,   0,  28, 184, 255, 255, 255, 255, 255, 255, 255, 255, 237,  88,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,  13, 152, 252, 255, 255, 255, 255, 255, 
-     255, 255, 255, 211,  57,   0,   0,   0,   0,   0,   0,   0,   0,   0,  59, 202, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 200,  56,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,  41, 202, 255, 255, 255, 255, 255, 255, 
-     255, 255, 246, 114,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 115, 
-     247, 255, 255, 255, 255, 255, 255, 255, 255, 202,  40,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,  31, 184, 255, 255, 255, 255, 255, 255, 
-     253,   0,   0,   0,   1, 100, 232, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 251, 175,  58,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 108, 
-     255, 255, 255, 218,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 219, 255, 255, 255, 107,   0, 155, 255, 255, 255, 136,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 202, 255, 255, 255, 255, 255, 208,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 137, 255, 255, 255, 154,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 254,  51,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,  22, 172, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 174,  23,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 
-       7,   0,   0,   0,   0,   0,   0,   0,   0,   0,  22, 172, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 174,  23,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 209,  31,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  81, 234, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,  19, 249, 255, 255, 255,  59,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      59, 255, 255, 255, 249,  19,   0,  97, 255, 255, 255, 191,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 152, 255, 255, 255, 255, 255, 255, 
-     158,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 192, 255, 
-     255, 255,  96,   0,   0,   0,   0,  88, 255, 255, 255, 255, 119,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 138, 255, 255, 255, 255,  70, 
-       0,   0,   0,   0,  93, 255, 255, 255, 255, 103,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 104, 255, 255, 255, 255,  92,   0,   0, 
-       0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255,   0,  62, 255, 255, 255, 237,   3,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, 182, 
-     255, 255, 255, 255, 255, 255, 255, 255, 182,   6,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,  17, 218, 
-     255, 255, 255,  83,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 161,   7,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33, 211, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,  47, 228, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 217,  33,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 111, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 
-       0,   0,   0,  19, 210, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     239,  56,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-      43, 230, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253,  94,   0,   0, 
-       0,  48, 235, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254,  94,   0, 
-       0,   0, 255, 255, 255, 255,   0,  27, 211, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 246,  71,   0,   0,   0,   0,   0,   0,   0, 128, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 124,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,  57, 241, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 181,   6,   0,   0,   0,   0,   0,   0,   0,   6, 182, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 240,  57,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,  50, 234, 255, 255, 255, 255, 255, 255, 255, 
-     254,   0,   0,   6, 176, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,  17, 
-     248, 255, 255, 255,  62,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  63, 255, 255, 255, 247,  17,   0,  88, 255, 255, 255, 203,   0, 
-       0,   0,   0,   0,   0,   0,   0,  16, 252, 255, 255, 255, 255, 255, 254,  20, 
-       0,   0,   0,   0,   0,   0,   0,   0, 204, 255, 255, 255,  87,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 187,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-      48, 226, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 227,  48,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     171,   2,   0,   0,   0,   0,   0,   0,   0,  48, 226, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 227,  48,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 219,  23,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  94, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0, 171, 255, 255, 255, 156,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     156, 255, 255, 255, 170,   0,   0,  34, 255, 255, 255, 247,   7,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 214, 255, 255, 255, 255, 255, 255, 
-     220,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, 248, 255, 
-     255, 255,  32,   0,   0,   0,   0,   0, 175, 255, 255, 255, 247,  40,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  61, 253, 255, 255, 255, 149,   0, 
-       0,   0,   0,   0,   0, 181, 255, 255, 255, 241,  28,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  29, 242, 255, 255, 255, 180,   0,   0,   0, 
-       0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 239,   0,   0, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255,   0,   3, 237, 255, 255, 255,  63,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, 178, 255, 
-     255, 255, 255, 249, 249, 255, 255, 255, 255, 177,   5,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,  39, 
-     239, 255, 255, 238,  29,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 157,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  57, 235, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,  63, 241, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 232,  30,   0,   0,   0,   0, 
-       0,   0,   0,  22, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 
-       0,   0,  13, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 234,  28, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,  22, 
-     225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248,  43,   0, 
-      31, 235, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248,  36, 
-       0,   0, 255, 255, 255, 255,  15, 212, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 239,  25,   0,   0,   0,   0,   0, 144, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 139,   0,   0, 
-       0,   0, 255, 255, 255, 255,  29, 234, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 172,   2,   0,   0,   0,   0,   0,   2, 173, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 234,  28, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,  26, 231, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255,   0,   0, 160, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-     167, 255, 255, 255, 160,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 161, 255, 255, 255, 166,   0,   0,  22, 254, 255, 255, 253,  17, 
-       0,   0,   0,   0,   0,   0,   0,  81, 255, 255, 255, 255, 255, 255, 255,  86, 
-       0,   0,   0,   0,   0,   0,   0,  17, 253, 255, 255, 254,  21,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255,  69,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,  49, 
-     239, 255, 255, 255, 255, 255, 215, 136,  65,  37,  13,  11,  36,  63, 132, 212, 
-     255, 255, 255, 255, 255, 239,  49,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   9,  25,  66, 126, 222, 255, 255, 255, 255, 
-     255, 115,   0,   0,   0,   0,   0,   0,  49, 239, 255, 255, 255, 255, 255, 215, 
-     136,  65,  37,  13,  11,  36,  63, 132, 212, 255, 255, 255, 255, 255, 239,  49, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       8,  21,  56, 107, 192, 255, 255, 255, 255, 255, 167,   0,   0,   0,   0,   0, 
-       0,   0,   0,  63, 252, 255, 255, 255, 255, 227, 140,  78,  35,  15,   4,  18, 
-      38,  74, 131, 191, 252, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,  74, 255, 255, 255, 242,  11,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, 
-     242, 255, 255, 255,  73,   0,   0,   0, 225, 255, 255, 255,  62,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  21, 255, 255, 255, 252, 250, 255, 255, 
-     255,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  64, 255, 255, 
-     255, 224,   0,   0,   0,   0,   0,   0,  23, 237, 255, 255, 255, 198,   2,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  13, 222, 255, 255, 255, 218,  10,   0, 
-       0,   0,   0,   0,   0,  28, 241, 255, 255, 255, 181,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 182, 255, 255, 255, 241,  28,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   9, 204, 255, 255, 255, 252,  71,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 163, 255, 255, 255, 140,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   4, 173, 255, 255, 
-     255, 255, 240,  65,  65, 241, 255, 255, 255, 255, 172,   4,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      70, 252, 255, 255, 193,   2,   0,   0,   0,   0,   0, 255, 255, 243, 175, 111, 
-      67,  30,  15,   3,  14,  39,  88, 170, 251, 255, 255, 255, 255,  82,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27, 234, 255, 255, 255, 255, 
-     249, 161,  89,  36,  16,   5,  21,  46,  96, 157, 236, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,  29, 239, 255, 255, 255, 255, 205, 111, 
-      52,  20,   5,  17,  49, 116, 223, 255, 255, 255, 255, 196,   3,   0,   0,   0, 
-       0,   0,   0, 118, 255, 255, 255, 249, 124,  38,   7,   0,   0,   0,   0,   0, 
-       0,   0, 151, 255, 255, 255, 255, 250, 151,  66,  24,   6,  25,  68, 152, 250, 
-     255, 255, 178, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255, 173, 
-     255, 255, 241, 136,  58,  20,   6,  26,  88, 207, 255, 255, 255, 255, 182,   2, 
-     199, 255, 255, 241, 136,  59,  21,   5,  25,  87, 207, 255, 255, 255, 255, 176, 
-       0,   0, 255, 255, 255, 255, 166, 255, 255, 252, 162,  81,  29,   8,  13,  45, 
-     121, 236, 255, 255, 255, 255, 166,   0,   0,   0,   0,  90, 255, 255, 255, 255, 
-     255, 203, 106,  39,  13,  12,  39, 106, 204, 255, 255, 255, 255, 255,  84,   0, 
-       0,   0, 255, 255, 255, 255, 179, 255, 255, 254, 165,  73,  26,   6,  26,  73, 
-     165, 254, 255, 255, 255, 255, 109,   0,   0,   0,   0,   0, 111, 255, 255, 255, 
-     255, 254, 165,  73,  26,   6,  27,  75, 167, 254, 255, 255, 178, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255, 177, 255, 255, 246, 144,  65,  24,   3,   0,   0, 
-       0,   0,  60, 255, 255, 255, 255, 250, 163,  85,  39,  13,   3,  11,  26,  59, 
-     105, 166, 240, 255, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-      68, 255, 255, 255, 245,  14,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  14, 245, 255, 255, 255,  67,   0,   0,   0, 210, 255, 255, 255,  81, 
-       0,   0,   0,   0,   0,   0,   0, 148, 255, 255, 255, 249, 255, 255, 255, 154, 
-       0,   0,   0,   0,   0,   0,   0,  83, 255, 255, 255, 209,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 185, 255, 255, 255, 205,   1,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,  25, 231, 
-     255, 255, 255, 255, 223,  81,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      75, 221, 255, 255, 255, 255, 231,  25,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, 117, 251, 255, 255, 
-     255, 237,  15,   0,   0,   0,   0,  25, 231, 255, 255, 255, 255, 223,  81,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  75, 221, 255, 255, 255, 255, 231, 
-      25,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  65, 229, 255, 255, 255, 254,  46,   0,   0,   0,   0, 
-       0,   0,   4, 211, 255, 255, 255, 249, 112,   5,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  24, 111, 209, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   3, 229, 255, 255, 255,  95,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  95, 
-     255, 255, 255, 228,   3,   0,   0,   0, 162, 255, 255, 255, 126,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  83, 255, 255, 255, 205, 198, 255, 255, 
-     255,  88,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 128, 255, 255, 
-     255, 160,   0,   0,   0,   0,   0,   0,   0,  91, 255, 255, 255, 255, 115,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 157, 255, 255, 255, 252,  56,   0,   0, 
-       0,   0,   0,   0,   0,   0, 102, 255, 255, 255, 255,  94,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  95, 255, 255, 255, 255, 101,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 168, 255, 255, 255, 255, 114,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,  86, 255, 255, 255, 217,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   3, 168, 255, 255, 255, 
-     255, 229,  46,   0,   0,  47, 230, 255, 255, 255, 255, 167,   3,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 109, 255, 255, 255, 124,   0,   0,   0,   0,   0, 200,  89,   7,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  43, 213, 255, 255, 255, 206,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 196, 255, 255, 255, 255, 179, 
-      31,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  81, 198,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   2, 193, 255, 255, 255, 234,  82,   0,   0, 
-       0,   0,   0,   0,   0,   0,   5, 142, 255, 255, 255, 255, 106,   0,   0,   0, 
-       0,   0,   0, 182, 255, 255, 255, 120,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  58, 254, 255, 255, 255, 219,  40,   0,   0,   0,   0,   0,   0,   0,  42, 
-     221, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255, 255, 
-     255, 192,  21,   0,   0,   0,   0,   0,   0,   4, 172, 255, 255, 255, 254, 141, 
-     255, 255, 191,  21,   0,   0,   0,   0,   0,   0,   4, 175, 255, 255, 255, 252, 
-      25,   0, 255, 255, 255, 255, 255, 255, 213,  40,   0,   0,   0,   0,   0,   0, 
-       0,  23, 211, 255, 255, 255, 250,  21,   0,   0,  24, 238, 255, 255, 255, 252, 
-     107,   1,   0,   0,   0,   0,   0,   0,   2, 112, 253, 255, 255, 255, 236,  22, 
-       0,   0, 255, 255, 255, 255, 255, 255, 237,  62,   0,   0,   0,   0,   0,   0, 
-       0,  63, 237, 255, 255, 255, 241,  27,   0,   0,   0,  27, 242, 255, 255, 255, 
-     236,  62,   0,   0,   0,   0,   0,   0,   0,  65, 239, 255, 255, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255, 255, 255, 206,  31,   0,   0,   0,   0,   0,   0, 
-       0,   0, 156, 255, 255, 255, 231,  46,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   5,  84, 199,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       1, 224, 255, 255, 255, 102,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 103, 255, 255, 255, 223,   1,   0,   0,   0, 142, 255, 255, 255, 148, 
-       0,   0,   0,   0,   0,   0,   0, 216, 255, 255, 255, 146, 255, 255, 255, 221, 
-       0,   0,   0,   0,   0,   0,   0, 150, 255, 255, 255, 141,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,  49, 254, 255, 255, 255,  88,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   1, 191, 255, 
-     255, 255, 255, 173,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   8, 169, 255, 255, 255, 255, 190,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  89, 255, 255, 
-     255, 255,  97,   0,   0,   0,   1, 191, 255, 255, 255, 255, 173,   9,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, 169, 255, 255, 255, 255, 
-     190,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  36, 243, 255, 255, 255, 128,   0,   0,   0,   0, 
-       0,   0,  78, 255, 255, 255, 253,  69,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  75, 196,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0, 135, 255, 255, 255, 193,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 192, 
-     255, 255, 255, 134,   0,   0,   0,   0,  99, 255, 255, 255, 189,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 145, 255, 255, 255, 143, 136, 255, 255, 
-     255, 149,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 191, 255, 255, 
-     255,  96,   0,   0,   0,   0,   0,   0,   0,   0, 178, 255, 255, 255, 246,  37, 
-       0,   0,   0,   0,   0,   0,   0,  78, 255, 255, 255, 255, 132,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   1, 189, 255, 255, 255, 237,  24,   0,   0,   0, 
-       0,   0,   0,   0,   0,  24, 238, 255, 255, 255, 189,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 124, 255, 255, 255, 255, 159,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,  14, 250, 255, 255, 255,  39, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   2, 163, 255, 255, 255, 255, 
-     215,  31,   0,   0,   0,   0,  31, 215, 255, 255, 255, 255, 162,   2,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 152, 255, 255, 251,  56,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  21, 231, 255, 255, 255,  56,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  85, 255, 255, 255, 255, 150,   2, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,  84, 255, 255, 255, 233,  41,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 139, 255, 255, 255, 219,   2,   0,   0, 
-       0,   0,   0, 226, 255, 255, 255,  34,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 173, 255, 255, 255, 231,  27,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      30, 233, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255, 255, 
-     202,   7,   0,   0,   0,   0,   0,   0,   0,   0,  15, 234, 255, 255, 255, 255, 
-     255, 199,   6,   0,   0,   0,   0,   0,   0,   0,   0,  16, 236, 255, 255, 255, 
-     108,   0, 255, 255, 255, 255, 255, 216,  15,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  38, 248, 255, 255, 255, 105,   0,   0, 133, 255, 255, 255, 255,  89, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  96, 255, 255, 255, 255, 130, 
-       0,   0, 255, 255, 255, 255, 255, 247,  54,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  54, 247, 255, 255, 255, 139,   0,   0,   0, 141, 255, 255, 255, 247, 
-      53,   0,   0,   0,   0,   0,   0,   0,   0,   0,  57, 249, 255, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255, 255, 219,  17,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 219, 255, 255, 255,  86,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0, 127, 255, 255, 255, 200,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 201, 255, 255, 255, 126,   0,   0,   0,   0,  75, 255, 255, 255, 215, 
-       0,   0,   0,   0,   0,   0,  27, 255, 255, 255, 251,  23, 248, 255, 255, 255, 
-      32,   0,   0,   0,   0,   0,   0, 217, 255, 255, 255,  74,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0, 166, 255, 255, 255, 220,   5,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,  98, 255, 255, 
-     255, 255, 167,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   3, 164, 255, 255, 255, 255,  96,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 174, 255, 
-     255, 255, 167,   0,   0,   0,  98, 255, 255, 255, 255, 167,   4,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, 164, 255, 255, 255, 
-     255,  97,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 127, 255, 255, 255, 195,   0,   0,   0,   0, 
-       0,   0, 158, 255, 255, 255, 149,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,  38, 255, 255, 255, 254,  35,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  34, 254, 
-     255, 255, 255,  38,   0,   0,   0,   0,  35, 255, 255, 255, 246,   6,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 207, 255, 255, 255,  80,  75, 255, 255, 
-     255, 211,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, 247, 255, 255, 
-     255,  32,   0,   0,   0,   0,   0,   0,   0,   0,  25, 238, 255, 255, 255, 195, 
-       2,   0,   0,   0,   0,   0,  21, 233, 255, 255, 255, 206,   5,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  34, 245, 255, 255, 255, 173,   0,   0,   0, 
-       0,   0,   0,   0,   0, 174, 255, 255, 255, 244,  33,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  80, 254, 255, 255, 255, 198,   6,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 187, 255, 255, 255, 117, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   1, 158, 255, 255, 255, 255, 197, 
-      18,   0,   0,   0,   0,   0,   0,  19, 198, 255, 255, 255, 255, 158,   1,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   5, 190, 255, 255, 221,  14,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 106, 255, 255, 255, 123,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 204, 255, 255, 255, 195,   3,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0, 196, 255, 255, 255,  79,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   4, 219, 255, 255, 255,  68,   0,   0, 
-       0,   0,   0, 243, 255, 255, 255,   5,   0,   0,   0,   0,   0,   0,   0,   0, 
-      23, 250, 255, 255, 255,  87,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  91, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255, 251, 
-      37,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 142, 255, 255, 255, 255, 
-     251,  35,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 144, 255, 255, 255, 
-     161,   0, 255, 255, 255, 255, 254,  47,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 163, 255, 255, 255, 159,   0,   6, 233, 255, 255, 255, 158,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 165, 255, 255, 255, 231, 
-       5,   0, 255, 255, 255, 255, 255, 128,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 129, 255, 255, 255, 233,   5,   0,   5, 234, 255, 255, 255, 128, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 132, 255, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255, 255,  65,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 244, 255, 255, 255,  14,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,  31, 253, 255, 255, 255,  43,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  44, 255, 255, 255, 253,  30,   0,   0,   0,   0,  13, 251, 255, 255, 255, 
-      26,   0,   0,   0,   0,   0,  95, 255, 255, 255, 197,   0, 191, 255, 255, 255, 
-      99,   0,   0,   0,   0,   0,  28, 255, 255, 255, 250,  12,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,  34, 250, 255, 255, 255, 106,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   6, 227, 255, 255, 
-     255, 211,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   5, 209, 255, 255, 255, 225,   5,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  76, 255, 
-     255, 255, 215,   0,   0,   6, 227, 255, 255, 255, 211,   6,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, 209, 255, 255, 
-     255, 226,   6,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  45, 255, 255, 255, 225,   0,   0,   0,   0, 
-       0,   0, 212, 255, 255, 255,  53,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0, 196, 255, 255, 255, 132,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 131, 255, 
-     255, 255, 196,   0,   0,   0,   0,   0,   0, 227, 255, 255, 255,  61,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  15, 253, 255, 255, 254,  19,  15, 253, 255, 
-     255, 254,  18,   0,   0,   0,   0,   0,   0,   0,   0,   0,  63, 255, 255, 255, 
-     224,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  95, 255, 255, 255, 255, 
-     111,   0,   0,   0,   0,   0, 176, 255, 255, 255, 248,  43,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 112, 255, 255, 255, 255,  85,   0,   0, 
-       0,   0,   0,   0,  86, 255, 255, 255, 255, 111,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  46, 243, 255, 255, 255, 227,  23,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 109, 255, 255, 255, 194, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   1, 153, 255, 255, 255, 255, 176,   9, 
-       0,   0,   0,   0,   0,   0,   0,   0,   9, 177, 255, 255, 255, 255, 152,   1, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  18, 219, 255, 255, 164,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  32, 255, 255, 255, 178,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  47, 255, 255, 255, 255,  44,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,  41, 255, 255, 255, 201,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 110, 255, 255, 255, 131,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      96, 255, 255, 255, 220,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   1, 223, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255, 169, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  72, 255, 255, 255, 255, 
-     167,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  73, 255, 255, 255, 
-     207,   0, 255, 255, 255, 255, 176,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  82, 255, 255, 255, 207,   0,  71, 255, 255, 255, 250,  23,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  26, 251, 255, 255, 255, 
-      70,   0, 255, 255, 255, 255, 242,  10,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  10, 243, 255, 255, 255,  72,   0,  72, 255, 255, 255, 242,  10, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, 244, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255, 205,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 247, 255, 255, 255,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0, 186, 255, 255, 255, 142,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 143, 255, 255, 255, 185,   0,   0,   0,   0,   0,   0, 197, 255, 255, 255, 
-      94,   0,   0,   0,   0,   0, 162, 255, 255, 255, 129,   0, 123, 255, 255, 255, 
-     166,   0,   0,   0,   0,   0,  95, 255, 255, 255, 196,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0, 147, 255, 255, 255, 232,  11,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,  96, 255, 255, 255, 
-     251,  51,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  49, 251, 255, 255, 255,  93,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  23, 255, 
-     255, 255, 235,   0,   0,  96, 255, 255, 255, 251,  51,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  49, 251, 255, 
-     255, 255,  95,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  11, 255, 255, 255, 246,   0,   0,   0,   0, 
-       0,   0, 236, 255, 255, 255,  13,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,  98, 255, 255, 255, 226,   2,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 226, 255, 
-     255, 255,  98,   0,   0,   0,   0,   0,   0, 164, 255, 255, 255, 125,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  76, 255, 255, 255, 212,   0,   0, 207, 255, 
-     255, 255,  79,   0,   0,   0,   0,   0,   0,   0,   0,   0, 127, 255, 255, 255, 
-     161,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 181, 255, 255, 255, 
-     245,  35,   0,   0,   0,  97, 255, 255, 255, 255, 114,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   2, 197, 255, 255, 255, 233,  19,   0, 
-       0,   0,   0,  19, 233, 255, 255, 255, 197,   2,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  21, 224, 255, 255, 255, 246,  50,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,  32, 255, 255, 255, 252, 
-      19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0, 148, 255, 255, 255, 255, 153,   3,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   3, 153, 255, 255, 255, 255, 147, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, 255, 255, 255, 217,   0, 
-     255, 255, 255, 255,   0,   0,   0,   1,  74, 160, 215, 243, 248, 223, 190, 110, 
-      23,   0,   0,   0,   0,   0,   0,   0, 111, 255, 255, 255, 187,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  23, 111, 191, 223, 248, 243, 214, 160,  73,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0, 105, 255, 255, 255, 112,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  43, 255, 255, 255, 189,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     151, 255, 255, 255, 131,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 132, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-      37, 132, 198, 237, 251, 237, 215, 160,  84,   3,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,  89, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  30, 255, 255, 255, 255, 
-      88,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  30, 255, 255, 255, 
-     230,   0, 255, 255, 255, 255,  93,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  35, 255, 255, 255, 229,   0, 128, 255, 255, 255, 172,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 176, 255, 255, 255, 
-     126,   0, 255, 255, 255, 255, 159,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 160, 255, 255, 255, 127,   0, 129, 255, 255, 255, 159,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 161, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255, 118,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 222, 255, 255, 255, 109,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,  87, 255, 255, 255, 234,   5,   0,   0,   0,   0,   0,   0,   0,   0, 
-       6, 235, 255, 255, 255,  86,   0,   0,   0,   0,   0,   0, 129, 255, 255, 255, 
-     161,   0,   0,   0,   0,   0, 229, 255, 255, 255,  61,   0,  56, 255, 255, 255, 
-     232,   1,   0,   0,   0,   0, 163, 255, 255, 255, 128,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,  22, 242, 255, 255, 255, 125,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 193, 255, 255, 255, 
-     162,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 161, 255, 255, 255, 191,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, 255, 
-     255, 255, 250,   0,   0, 193, 255, 255, 255, 162,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 161, 255, 
-     255, 255, 193,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  13, 255, 255, 255, 248,   0,   0,   0,   0, 
-       0,   0, 250, 255, 255, 255,  12,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,  12, 244, 255, 255, 255,  71,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  69, 255, 255, 
-     255, 244,  12,   0,   0,   0,   0,   0,   0, 100, 255, 255, 255, 188,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 138, 255, 255, 255, 149,   0,   0, 145, 255, 
-     255, 255, 141,   0,   0,   0,   0,   0,   0,   0,   0,   0, 191, 255, 255, 255, 
-      97,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27, 240, 255, 255, 
-     255, 192,   1,   0,  31, 241, 255, 255, 255, 192,   1,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  40, 248, 255, 255, 255, 165,   0, 
-       0,   0,   0, 166, 255, 255, 255, 247,  39,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       5, 194, 255, 255, 255, 255,  87,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 210, 255, 255, 255, 
-      93,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0, 142, 255, 255, 255, 255, 126,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 127, 255, 255, 255, 255, 
-     141,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11,  90, 
-     146, 194, 224, 238, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 233,   0, 
-     255, 255, 255, 255,   0,   0,  41, 202, 255, 255, 255, 255, 255, 255, 255, 255, 
-     246, 114,   2,   0,   0,   0,   0,   0, 173, 255, 255, 255, 112,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   2, 115, 247, 255, 255, 255, 255, 255, 255, 255, 255, 202,  40,   0, 
-       0, 255, 255, 255, 255,   0, 165, 255, 255, 255,  59,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  13, 255, 255, 255, 220,   0, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 
-     201, 255, 255, 255,  75,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  77, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,  13, 152, 
-     252, 255, 255, 255, 255, 255, 255, 255, 255, 211,  57,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 142, 255, 255, 
-     255, 255, 254, 114,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,  36, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, 255, 255, 255, 255, 
-      35,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, 255, 255, 255, 
-     244,   0, 255, 255, 255, 255,  36,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  14, 255, 255, 255, 244,   0, 183, 255, 255, 255, 102,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 105, 255, 255, 255, 
-     181,   0, 255, 255, 255, 255,  94,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  95, 255, 255, 255, 180,   0, 182, 255, 255, 255,  94,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  96, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,  64,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 161, 255, 255, 255, 250, 116,   8,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   7, 237, 255, 255, 255,  83,   0,   0,   0,   0,   0,   0,   0,   0, 
-      84, 255, 255, 255, 237,   7,   0,   0,   0,   0,   0,   0,  62, 255, 255, 255, 
-     228,   0,   0,   0,   0,  41, 255, 255, 255, 244,   5,   0,   3, 241, 255, 255, 
-     255,  45,   0,   0,   0,   0, 229, 255, 255, 255,  61,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0, 127, 255, 255, 255, 241,  20,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,  20, 253, 255, 255, 255, 
-      57,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  56, 255, 255, 255, 253,  19,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  23, 255, 
-     255, 255, 235,   0,  20, 253, 255, 255, 255,  57,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  56, 255, 
-     255, 255, 253,  19,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  47, 255, 255, 255, 230,   0,   0,   0,   0, 
-       0,   0, 234, 255, 255, 255,  63,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 159, 255, 255, 255, 168,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 166, 255, 255, 
-     255, 159,   0,   0,   0,   0,   0,   0,   0,  36, 255, 255, 255, 245,   6,   0, 
-       0,   0,   0,   0,   0,   0,   0, 200, 255, 255, 255,  87,   0,   0,  83, 255, 
-     255, 255, 203,   0,   0,   0,   0,   0,   0,   0,   0,   7, 247, 255, 255, 255, 
-      33,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  98, 255, 255, 
-     255, 255, 108,   2, 192, 255, 255, 255, 241,  31,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 121, 255, 255, 255, 255,  76, 
-       0,   0,  77, 255, 255, 255, 255, 120,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     155, 255, 255, 255, 255, 132,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 133, 255, 255, 255, 
-     171,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0, 136, 255, 255, 255, 252,  99,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 100, 252, 255, 255, 
-     255, 135,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  18, 151, 244, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249,   0, 
-     255, 255, 255, 255,   0,  57, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 181,   6,   0,   0,   0,   0, 210, 255, 255, 255,  54,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   6, 182, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 240,  57, 
-       0, 255, 255, 255, 255,   0, 208, 255, 255, 255, 252, 252, 252, 252, 252, 253, 
-     253, 253, 253, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 238,   0, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 
-     225, 255, 255, 255,  31,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  32, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,  27, 211, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246,  71,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, 168, 255, 255, 255, 
-     255, 249,  88,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,  13, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 255, 255, 255, 255, 
-      13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,  14,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   1, 255, 255, 255, 255,   0, 215, 255, 255, 255,  50,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  52, 255, 255, 255, 
-     213,   0, 255, 255, 255, 255,  46,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  47, 255, 255, 255, 215,   0, 216, 255, 255, 255,  46,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  57, 255, 255, 255, 255, 255, 237, 153,  76,  14,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0, 146, 255, 255, 255, 182,   0,   0,   0,   0,   0,   0,   0,   0, 
-     183, 255, 255, 255, 145,   0,   0,   0,   0,   0,   0,   0,   6, 245, 255, 255, 
-     255,  39,   0,   0,   0, 109, 255, 255, 255, 182,   0,   0,   0, 177, 255, 255, 
-     255, 112,   0,   0,   0,  41, 255, 255, 255, 244,   5,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,  12, 233, 255, 255, 255, 143,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,  87, 255, 255, 255, 214, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 213, 255, 255, 255,  85,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  77, 255, 
-     255, 255, 215,   0,  87, 255, 255, 255, 214,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 213, 
-     255, 255, 255,  86,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 131, 255, 255, 255, 189,   0,   0,   0,   0, 
-       0,   0, 204, 255, 255, 255, 186,   1,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,  62, 255, 255, 255, 248,  17, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16, 247, 255, 255, 
-     255,  62,   0,   0,   0,   0,   0,   0,   0,   0, 228, 255, 255, 255,  60,   0, 
-       0,   0,   0,   0,   0,   0,  11, 251, 255, 255, 255,  25,   0,   0,  21, 255, 
-     255, 255, 252,  12,   0,   0,   0,   0,   0,   0,   0,  62, 255, 255, 255, 224, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 184, 255, 
-     255, 255, 244, 144, 255, 255, 255, 255,  97,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, 205, 255, 255, 255, 228, 
-      15,  15, 229, 255, 255, 255, 204,   3,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 110, 
-     255, 255, 255, 255, 176,   1,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  55, 255, 255, 255, 
-     242,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0, 131, 255, 255, 255, 245,  76,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  77, 245, 255, 
-     255, 255, 130,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  62, 235, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255,  29, 234, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 172,   2,   0,   0,   0, 229, 255, 255, 255,  24,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       2, 173, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 234, 
-      28, 255, 255, 255, 255,   0, 226, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253,   0, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 
-     240, 255, 255, 255,  14,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  15, 255, 255, 255, 255,   0, 255, 255, 255, 255,  15, 212, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 239,  25,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,  15, 191, 255, 255, 255, 255, 
-     241,  65,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0, 232, 255, 255, 255,  22,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  25, 255, 255, 255, 
-     230,   0, 255, 255, 255, 255,  21,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  22, 255, 255, 255, 231,   0, 233, 255, 255, 255,  21,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  22, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 148, 255, 255, 255, 255, 255, 255, 255, 252, 206, 149,  87,  23, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,  47, 255, 255, 255, 252,  27,   0,   0,   0,   0,   0,   0,  28, 
-     253, 255, 255, 255,  47,   0,   0,   0,   0,   0,   0,   0,   0, 184, 255, 255, 
-     255, 106,   0,   0,   0, 176, 255, 255, 255, 114,   0,   0,   0, 110, 255, 255, 
-     255, 179,   0,   0,   0, 108, 255, 255, 255, 183,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0, 108, 255, 255, 255, 248,  31,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 140, 255, 255, 255, 152, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 153, 255, 255, 255, 137,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 174, 255, 
-     255, 255, 167,   0, 140, 255, 255, 255, 152,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 153, 
-     255, 255, 255, 138,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  39, 245, 255, 255, 255, 123,   0,   0,   0,   0, 
-       0,   0, 141, 255, 255, 255, 255, 170,  21,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 219, 255, 255, 255, 107, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 105, 255, 255, 255, 
-     220,   1,   0,   0,   0,   0,   0,   0,   0,   0, 165, 255, 255, 255, 123,   0, 
-       0,   0,   0,   0,   0,   0,  69, 255, 255, 255, 219,   0,   0,   0,   0, 215, 
-     255, 255, 255,  70,   0,   0,   0,   0,   0,   0,   0, 126, 255, 255, 255, 161, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  29, 241, 
-     255, 255, 255, 255, 255, 255, 255, 176,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  47, 250, 255, 255, 255, 
-     156, 157, 255, 255, 255, 250,  46,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  69, 252, 
-     255, 255, 255, 210,  12,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 231, 255, 255, 
-     255,  70,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  52, 243, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255, 179, 255, 255, 254, 165,  73,  26,   6,  26,  73, 165, 254, 
-     255, 255, 255, 255, 109,   0,   0,   0, 247, 255, 255, 255,   8,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     111, 255, 255, 255, 255, 254, 165,  73,  26,   6,  27,  75, 167, 254, 255, 255, 
-     178, 255, 255, 255, 255,   0, 243, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 
-     252, 255, 255, 255,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   4, 255, 255, 255, 255,   0, 255, 255, 255, 255, 166, 255, 255, 252, 
-     162,  81,  29,   8,  13,  45, 121, 236, 255, 255, 255, 255, 166,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,  27, 210, 255, 255, 255, 255, 229, 
-      46,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0, 248, 255, 255, 255,   7,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, 255, 255, 255, 
-     247,   0, 255, 255, 255, 255,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   7, 255, 255, 255, 247,   0, 248, 255, 255, 255,   7,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   2, 138, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 
-     194,  99,   5,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0, 205, 255, 255, 255, 123,   0,   0,   0,   0,   0,   0, 124, 
-     255, 255, 255, 204,   0,   0,   0,   0,   0,   0,   0,   0,   0, 116, 255, 255, 
-     255, 173,   0,   0,   3, 240, 255, 255, 255,  46,   0,   0,   0,  42, 255, 255, 
-     255, 242,   4,   0,   0, 176, 255, 255, 255, 116,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   5, 220, 255, 255, 255, 162,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 184, 255, 255, 255,  97, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  98, 255, 255, 255, 182,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  87, 255, 255, 
-     255, 255,  97,   0, 184, 255, 255, 255,  97,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  98, 
-     255, 255, 255, 183,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  67, 231, 255, 255, 255, 250,  31,   0,   0,   0,   0, 
-       0,   0,  49, 255, 255, 255, 255, 255, 243, 156,  71,   8,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 123, 255, 255, 255, 205, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 202, 255, 255, 255, 
-     123,   0,   0,   0,   0,   0,   0,   0,   0,   0, 101, 255, 255, 255, 187,   0, 
-       0,   0,   0,   0,   0,   0, 131, 255, 255, 255, 156,   0,   0,   0,   0, 153, 
-     255, 255, 255, 132,   0,   0,   0,   0,   0,   0,   0, 190, 255, 255, 255,  97, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 101, 
-     255, 255, 255, 255, 255, 255, 234,  22,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 130, 255, 255, 255, 
-     255, 255, 255, 255, 255, 129,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  37, 238, 255, 
-     255, 255, 235,  33,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156, 255, 255, 
-     255, 148,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 208, 255, 255, 255, 255, 242, 
-     161, 102,  61,  34,  15,   8,   1,   0,   0,   0,   0, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255, 255, 255, 237,  62,   0,   0,   0,   0,   0,   0,   0,  63, 
-     237, 255, 255, 255, 241,  27,   0,   0, 247, 255, 255, 255,   8,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27, 
-     242, 255, 255, 255, 236,  62,   0,   0,   0,   0,   0,   0,   0,  65, 239, 255, 
-     255, 255, 255, 255, 255,   0, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     241, 255, 255, 255,  14,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  15, 255, 255, 255, 255,   0, 255, 255, 255, 255, 255, 255, 213,  40, 
-       0,   0,   0,   0,   0,   0,   0,  23, 211, 255, 255, 255, 250,  21,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,  43, 226, 255, 255, 255, 255, 214,  30, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0, 248, 255, 255, 255,   7,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, 255, 255, 255, 
-     247,   0, 255, 255, 255, 255,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   7, 255, 255, 255, 247,   0, 248, 255, 255, 255,   7,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  48, 171, 249, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 224,  70,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0, 106, 255, 255, 255, 220,   1,   0,   0,   0,   0,   1, 221, 
-     255, 255, 255, 105,   0,   0,   0,   0,   0,   0,   0,   0,   0,  49, 255, 255, 
-     255, 238,   2,   0,  55, 255, 255, 255, 233,   1,   0,   0,   0,   0, 230, 255, 
-     255, 255,  58,   0,   3, 240, 255, 255, 255,  48,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,  89, 255, 255, 255, 253,  45,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 214, 255, 255, 255,  51, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  51, 255, 255, 255, 212,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 112, 250, 255, 255, 
-     255, 238,  16,   0, 214, 255, 255, 255,  51,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51, 
-     255, 255, 255, 212,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       6,  20,  55, 107, 193, 255, 255, 255, 255, 255, 141,   0,   0,   0,   0,   0, 
-       0,   0,   0, 172, 255, 255, 255, 255, 255, 255, 255, 247, 198, 144,  98,  54, 
-      11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,  28, 253, 255, 255, 255, 
-      46,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  43, 255, 255, 255, 253, 
-      29,   0,   0,   0,   0,   0,   0,   0,   0,   0,  38, 255, 255, 255, 245,   5, 
-       0,   0,   0,   0,   0,   0, 193, 255, 255, 255,  94,   0,   0,   0,   0,  91, 
-     255, 255, 255, 194,   0,   0,   0,   0,   0,   0,   7, 246, 255, 255, 255,  33, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     186, 255, 255, 255, 255, 255,  79,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, 212, 255, 255, 
-     255, 255, 255, 255, 211,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15, 215, 255, 255, 
-     255, 250,  64,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  78, 255, 255, 
-     255, 225,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  82, 255, 255, 255, 255, 157,  13, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255, 255, 247,  54,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      54, 247, 255, 255, 255, 139,   0,   0, 229, 255, 255, 255,  24,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 141, 
-     255, 255, 255, 247,  53,   0,   0,   0,   0,   0,   0,   0,   0,   0,  57, 249, 
-     255, 255, 255, 255, 255,   0, 232, 255, 255, 255,  16,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     225, 255, 255, 255,  31,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  32, 255, 255, 255, 255,   0, 255, 255, 255, 255, 255, 216,  15,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  38, 248, 255, 255, 255, 105,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,  62, 239, 255, 255, 255, 255, 196,  17,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0, 232, 255, 255, 255,  22,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  24, 255, 255, 255, 
-     230,   0, 255, 255, 255, 255,  21,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  22, 255, 255, 255, 231,   0, 233, 255, 255, 255,  21,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  22, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  19,  89, 155, 215, 254, 255, 255, 255, 255, 
-     255, 255, 255, 254,  95,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,  16, 247, 255, 255, 255,  64,   0,   0,   0,   0,  65, 255, 
-     255, 255, 247,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 236, 255, 
-     255, 255,  51,   0, 123, 255, 255, 255, 167,   0,   0,   0,   0,   0, 164, 255, 
-     255, 255, 125,   0,  54, 255, 255, 255, 235,   1,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   1, 205, 255, 255, 255, 181,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 237, 255, 255, 255,  32, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  33, 255, 255, 255, 236,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   7,  23,  64, 125, 219, 255, 255, 255, 255, 
-     255, 118,   0,   0, 237, 255, 255, 255,  32,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33, 
-     255, 255, 255, 236,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 188,   6,   0,   0,   0,   0,   0, 
-       0,   0,   0,  16, 217, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     254, 210, 147,  76,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 184, 255, 255, 255, 
-     144,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 140, 255, 255, 255, 185, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 229, 255, 255, 255,  58, 
-       0,   0,   0,   0,   0,   7, 247, 255, 255, 255,  32,   0,   0,   0,   0,  29, 
-     255, 255, 255, 248,   7,   0,   0,   0,   0,   0,  62, 255, 255, 255, 224,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      81, 255, 255, 255, 255, 218,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  54, 252, 255, 
-     255, 255, 255, 252,  53,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, 183, 255, 255, 255, 
-     255, 105,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  10, 246, 255, 
-     255, 255,  47,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 160, 255, 255, 255, 180,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  29, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255, 255, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 129, 255, 255, 255, 233,   5,   0, 210, 255, 255, 255,  54,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, 234, 
-     255, 255, 255, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 132, 
-     255, 255, 255, 255, 255,   0, 213, 255, 255, 255,  50,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     202, 255, 255, 255,  74,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  76, 255, 255, 255, 255,   0, 255, 255, 255, 255, 254,  47,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 163, 255, 255, 255, 159,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,  84, 248, 255, 255, 255, 255, 174,   8,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0, 215, 255, 255, 255,  49,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  52, 255, 255, 255, 
-     213,   0, 255, 255, 255, 255,  46,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  47, 255, 255, 255, 215,   0, 216, 255, 255, 255,  46,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  48, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,  70, 129, 198, 254, 
-     255, 255, 255, 255, 249,  33,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   1,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  14, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0, 165, 255, 255, 255, 163,   0,   0,   0,   0, 164, 255, 
-     255, 255, 164,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 171, 255, 
-     255, 255, 118,   0, 190, 255, 255, 255,  99,   0,   0,   0,   0,   0,  96, 255, 
-     255, 255, 192,   0, 121, 255, 255, 255, 170,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,  69, 255, 255, 255, 255,  62, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 248, 255, 255, 255,  16, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  17, 255, 255, 255, 246,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     175,   3,   0,   0, 248, 255, 255, 255,  16,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  17, 
-     255, 255, 255, 246,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 249, 137,   7,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  20, 189, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 232, 130,  12,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,  86, 255, 255, 255, 
-     235,   5,   0,   0,   0,   0,   0,   0,   0,   0,   4, 232, 255, 255, 255,  87, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 166, 255, 255, 255, 122, 
-       0,   0,   0,   0,   0,  62, 255, 255, 255, 225,   0,   0,   0,   0,   0,   0, 
-     224, 255, 255, 255,  62,   0,   0,   0,   0,   0, 126, 255, 255, 255, 161,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, 
-     220, 255, 255, 255, 255, 255, 105,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 139, 255, 
-     255, 255, 255, 138,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 141, 255, 255, 255, 255, 
-     150,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 179, 255, 
-     255, 255, 124,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 216, 255, 255, 255,  64,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  74, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255, 242,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  10, 243, 255, 255, 255,  72,   0, 171, 255, 255, 255, 112,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  72, 255, 
-     255, 255, 242,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, 
-     244, 255, 255, 255, 255,   0, 181, 255, 255, 255, 103,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     151, 255, 255, 255, 130,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 131, 255, 255, 255, 255,   0, 255, 255, 255, 255, 176,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  82, 255, 255, 255, 207,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0, 110, 253, 255, 255, 255, 255, 148,   2,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0, 182, 255, 255, 255, 101,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 104, 255, 255, 255, 
-     181,   0, 255, 255, 255, 255,  94,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  95, 255, 255, 255, 180,   0, 182, 255, 255, 255,  94,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  96, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  30, 
-     151, 255, 255, 255, 255, 145,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 245, 255, 255, 255,  12,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  37, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,  66, 255, 255, 255, 246,  15,   0,   0,  15, 246, 255, 
-     255, 255,  65,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 104, 255, 
-     255, 255, 186,   9, 248, 255, 255, 255,  31,   0,   0,   0,   0,   0,  29, 255, 
-     255, 255, 249,  10, 188, 255, 255, 255, 103,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 188, 255, 255, 255, 198, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 254, 255, 255, 255,   3, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   4, 255, 255, 255, 253,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 164, 
-       8,   0,   0,   0, 254, 255, 255, 255,   3,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, 
-     255, 255, 255, 253,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 252,  93,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   1,  91, 220, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 230,  73,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   7, 237, 255, 255, 
-     255,  83,   0,   0,   0,   0,   0,   0,   0,   0,  79, 255, 255, 255, 238,   7, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 103, 255, 255, 255, 186, 
-       0,   0,   0,   0,   0, 124, 255, 255, 255, 163,   0,   0,   0,   0,   0,   0, 
-     162, 255, 255, 255, 124,   0,   0,   0,   0,   0, 189, 255, 255, 255,  98,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 153, 
-     255, 255, 255, 255, 255, 255, 243,  31,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   9, 255, 
-     255, 255, 255,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  96, 255, 255, 255, 255, 191, 
-       4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 102, 255, 
-     255, 255, 202,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 239, 255, 255, 255,  15,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 139, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255, 159,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 160, 255, 255, 255, 127,   0, 109, 255, 255, 255, 187,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 129, 255, 
-     255, 255, 159,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     161, 255, 255, 255, 255,   0, 117, 255, 255, 255, 180,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      97, 255, 255, 255, 219,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   1, 222, 255, 255, 255, 255,   0, 255, 255, 255, 255,  93,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  35, 255, 255, 255, 229,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   1, 138, 255, 255, 255, 255, 255, 122,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0, 127, 255, 255, 255, 171,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 175, 255, 255, 255, 
-     125,   0, 255, 255, 255, 255, 159,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 159, 255, 255, 255, 127,   0, 129, 255, 255, 255, 159,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 161, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 133, 255, 255, 255, 212,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 230, 255, 255, 255,  34,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  94, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   1, 222, 255, 255, 255, 104,   0,   0, 105, 255, 255, 
-     255, 221,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  36, 255, 
-     255, 255, 246,  76, 255, 255, 255, 220,   0,   0,   0,   0,   0,   0,   0, 218, 
-     255, 255, 255,  79, 247, 255, 255, 255,  35,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,  51, 254, 255, 255, 255, 
-      81,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 248, 255, 255, 255,  15, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  16, 255, 255, 255, 246,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 205,  80,   0, 
-       0,   0,   0,   0, 248, 255, 255, 255,  15,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16, 
-     255, 255, 255, 243,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 254, 114,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   1,  66, 158, 227, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 252,  98,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 147, 255, 255, 
-     255, 180,   0,   0,   0,   0,   0,   0,   0,   0, 176, 255, 255, 255, 148,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  39, 255, 255, 255, 244, 
-       5,   0,   0,   0,   0, 186, 255, 255, 255, 101,   0,   0,   0,   0,   0,   0, 
-     100, 255, 255, 255, 186,   0,   0,   0,   0,   6, 246, 255, 255, 255,  34,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  74, 255, 
-     255, 255, 255, 255, 255, 255, 255, 186,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  58, 249, 255, 255, 255, 222,  19, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  25, 254, 
-     255, 255, 254,  24,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 250, 255, 255, 255,   8,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   9, 234, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255,  94,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  95, 255, 255, 255, 180,   0,  45, 255, 255, 255, 255,  44,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 182, 255, 
-     255, 255,  94,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      96, 255, 255, 255, 255,   0,  52, 255, 255, 255, 252,  40,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      24, 251, 255, 255, 255,  85,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  88, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,  36,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  14, 255, 255, 255, 244,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   5, 164, 255, 255, 255, 255, 251,  95,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,  71, 255, 255, 255, 249,  21,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  25, 251, 255, 255, 255, 
-      69,   0, 255, 255, 255, 255, 242,  10,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  10, 242, 255, 255, 255,  72,   0,  73, 255, 255, 255, 242,  10, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, 243, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  26, 255, 255, 255, 242,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 207, 255, 255, 255,  82,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 177, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0, 125, 255, 255, 255, 203,   0,   0, 204, 255, 255, 
-     255, 124,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 225, 
-     255, 255, 255, 200, 255, 255, 255, 152,   0,   0,   0,   0,   0,   0,   0, 150, 
-     255, 255, 255, 204, 255, 255, 255, 224,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 168, 255, 255, 255, 
-     214,   3,   0,   0,   0,   0, 255, 255, 255, 255,   0, 238, 255, 255, 255,  32, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  33, 255, 255, 255, 236,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 248, 233, 216, 174, 121,  50,   0,   0,   0, 
-       0,   0,   0,   0, 238, 255, 255, 255,  32,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33, 
-     255, 255, 255, 231,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   5, 
-      20,  57, 120, 215, 255, 255, 255, 255, 254,  78,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  36,  90, 134, 178, 224, 
-     255, 255, 255, 255, 255, 255, 255, 255, 251,  59,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,  50, 255, 255, 
-     255, 252,  25,   0,   0,   0,   0,   0,   0,  22, 251, 255, 255, 255,  51,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 231, 255, 255, 255, 
-      57,   0,   0,   0,   4, 243, 255, 255, 255,  39,   0,   0,   0,   0,   0,   0, 
-      38, 255, 255, 255, 243,   3,   0,   0,   0,  61, 255, 255, 255, 225,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  19, 231, 255, 
-     255, 255, 210, 117, 255, 255, 255, 255, 101,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  29, 232, 255, 255, 255, 243,  44,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 203, 
-     255, 255, 255, 101,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 233, 255, 255, 255,  49,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 128, 255, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255,  46,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  47, 255, 255, 255, 215,   0,   0, 200, 255, 255, 255, 195,   3,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 216, 255, 
-     255, 255,  46,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      48, 255, 255, 255, 255,   0,   1, 209, 255, 255, 255, 182,   1,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 174, 255, 255, 255, 230,  25,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      28, 232, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,  14,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255, 188, 255, 255, 255, 255, 243,  72,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   6, 232, 255, 255, 255, 155,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 163, 255, 255, 255, 230, 
-       5,   0, 255, 255, 255, 255, 255, 126,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 127, 255, 255, 255, 233,   5,   0,   5, 234, 255, 255, 255, 126, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 131, 255, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   9, 255, 255, 255, 245,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 159, 255, 255, 255, 161,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  49, 254, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,  29, 253, 255, 255, 255,  46,  46, 255, 255, 255, 
-     253,  28,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 158, 
-     255, 255, 255, 255, 255, 255, 255,  84,   0,   0,   0,   0,   0,   0,   0,  83, 
-     255, 255, 255, 255, 255, 255, 255, 157,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,  36, 250, 255, 255, 
-     255,  99,   0,   0,   0,   0, 255, 255, 255, 255,   0, 215, 255, 255, 255,  50, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  51, 255, 255, 255, 212,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 214, 255, 255, 255,  50,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51, 
-     255, 255, 255, 215,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   2, 122, 254, 255, 255, 255, 233,  18,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      22,  84, 162, 245, 255, 255, 255, 255, 255, 214,   1,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   2,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       2, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 208, 255, 
-     255, 255, 119,   0,   0,   0,   0,   0,   0, 115, 255, 255, 255, 209,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 168, 255, 255, 255, 
-     121,   0,   0,   0,  55, 255, 255, 255, 232,   0,   0,   0,   0,   0,   0,   0, 
-       0, 231, 255, 255, 255,  53,   0,   0,   0, 125, 255, 255, 255, 162,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 172, 255, 255, 
-     255, 249,  47,   2, 195, 255, 255, 255, 241,  29,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  10, 206, 255, 255, 255, 254,  78,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 125, 
-     255, 255, 255, 178,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 196, 255, 255, 255, 154,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  72, 252, 255, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255,  21,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  22, 255, 255, 255, 231,   0,   0,  82, 255, 255, 255, 255, 150,   2, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 233, 255, 
-     255, 255,  21,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      22, 255, 255, 255, 255,   0,   0,  88, 255, 255, 255, 255, 140,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  59, 254, 255, 255, 255, 217,  38,   0,   0,   0,   0,   0,   0,   0,  40, 
-     219, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255, 255, 255, 255, 255, 233,  51,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 132, 255, 255, 255, 254,  85, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  92, 255, 255, 255, 255, 128, 
-       0,   0, 255, 255, 255, 255, 255, 246,  51,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  51, 247, 255, 255, 255, 139,   0,   0,   0, 141, 255, 255, 255, 246, 
-      51,   0,   0,   0,   0,   0,   0,   0,   0,   0,  54, 248, 255, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  73, 255, 255, 255, 217,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 104, 255, 255, 255, 247,  36,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  16, 218, 255, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 184, 255, 255, 255, 144, 145, 255, 255, 255, 
-     183,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  91, 
-     255, 255, 255, 255, 255, 255, 253,  18,   0,   0,   0,   0,   0,   0,   0,  17, 
-     253, 255, 255, 255, 255, 255, 255,  90,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 149, 255, 255, 
-     255, 227,   8,   0,   0,   0, 255, 255, 255, 255,   0, 185, 255, 255, 255,  96, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  97, 255, 255, 255, 183,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 184, 255, 255, 255,  96,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  97, 
-     255, 255, 255, 178,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 116, 255, 255, 255, 255, 144,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  18, 139, 252, 255, 255, 255, 255,  77,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 247, 255, 255, 255,  14,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      16, 255, 255, 255, 246,   0,   0,   0,   0,   0,   0,   0,   0,   0, 111, 255, 
-     255, 255, 216,   0,   0,   0,   0,   0,   0, 212, 255, 255, 255, 112,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 104, 255, 255, 255, 
-     185,   0,   0,   0, 117, 255, 255, 255, 170,   0,   0,   0,   0,   0,   0,   0, 
-       0, 170, 255, 255, 255, 115,   0,   0,   0, 189, 255, 255, 255,  98,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  93, 255, 255, 255, 
-     255, 121,   0,   0,  37, 246, 255, 255, 255, 183,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   1, 171, 255, 255, 255, 255, 123,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  48, 
-     255, 255, 255, 246,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 128, 255, 255, 255, 254, 105,   0, 
-       0,   0,   0,   0,   0,   0,   1, 102, 250, 255, 255, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   7, 255, 255, 255, 247,   0,   0,   2, 191, 255, 255, 255, 255, 179, 
-      30,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  81, 197,   0, 248, 255, 
-     255, 255,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       7, 255, 255, 255, 255,   0,   0,   2, 198, 255, 255, 255, 255, 176,  26,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  22, 111, 207,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 154, 255, 255, 255, 255, 249, 150,  65,  22,   5,  23,  66, 151, 250, 
-     255, 255, 178, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255, 255, 255, 255, 255, 182,   6,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,  23, 237, 255, 255, 255, 251, 
-     102,   1,   0,   0,   0,   0,   0,   0,   2, 109, 252, 255, 255, 255, 235,  22, 
-       0,   0, 255, 255, 255, 255, 255, 255, 235,  60,   0,   0,   0,   0,   0,   0, 
-       0,  60, 235, 255, 255, 255, 242,  27,   0,   0,   0,  28, 242, 255, 255, 255, 
-     235,  60,   0,   0,   0,   0,   0,   0,   0,  63, 237, 255, 255, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 209, 117,  29,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      41, 225, 255, 255, 255, 149,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  21, 250, 255, 255, 255, 208,  21,   0, 
-       0,   0,   0,   0,   0,   0,  41, 215, 255, 255, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  85, 255, 255, 255, 236, 236, 255, 255, 255, 
-      84,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  24, 
-     255, 255, 255, 255, 255, 255, 205,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     204, 255, 255, 255, 255, 255, 255,  23,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,  23, 244, 255, 
-     255, 255, 118,   0,   0,   0, 255, 255, 255, 255,   0, 141, 255, 255, 255, 151, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 152, 255, 255, 255, 138,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 139, 255, 255, 255, 151,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 152, 
-     255, 255, 255, 139,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 179, 255, 255, 255, 248,  27,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  80, 252, 255, 255, 255, 153,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 231, 255, 255, 255,  27,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      29, 255, 255, 255, 229,   0,   0,   0,   0,   0,   0,   0,   0,   0,  19, 249, 
-     255, 255, 255,  58,   0,   0,   0,   0,  53, 255, 255, 255, 250,  21,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40, 255, 255, 255, 
-     243,   4,   0,   0, 179, 255, 255, 255, 108,   0,   0,   0,   0,   0,   0,   0, 
-       0, 108, 255, 255, 255, 177,   0,   0,   6, 246, 255, 255, 255,  34,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  29, 240, 255, 255, 255, 
-     197,   3,   0,   0,   0, 114, 255, 255, 255, 255,  98,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 127, 255, 255, 255, 255, 168,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     225, 255, 255, 255,  77,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  30, 249, 255, 255, 255, 255, 185, 
-      82,  26,   5,  15,  42, 108, 206, 255, 255, 255, 171, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   7, 255, 255, 255, 247,   0,   0,   0,  25, 233, 255, 255, 255, 255, 
-     249, 161,  88,  36,  15,   5,  20,  46,  95, 156, 235, 255, 255,   0, 248, 255, 
-     255, 255,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       7, 255, 255, 255, 255,   0,   0,   0,  27, 233, 255, 255, 255, 255, 249, 164, 
-      92,  38,  16,   3,  12,  25,  54,  94, 140, 207, 254, 255, 255,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  15, 209, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 235,  29, 255, 255, 255, 253,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255, 230, 255, 255, 255, 255, 184,  10,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,  89, 255, 255, 255, 255, 
-     255, 201, 103,  37,  12,  11,  38, 104, 203, 255, 255, 255, 255, 255,  84,   0, 
-       0,   0, 255, 255, 255, 255, 179, 255, 255, 254, 164,  72,  25,   6,  25,  72, 
-     164, 254, 255, 255, 255, 255, 110,   0,   0,   0,   0,   0, 111, 255, 255, 255, 
-     255, 254, 163,  71,  24,   6,  25,  73, 166, 254, 255, 255, 178, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 216, 150, 100,  59,  27,  13,   2,   9,  33,  79, 158, 
-     248, 255, 255, 255, 252,  47,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 164, 255, 255, 255, 255, 234, 119, 
-      43,  11,   8,  29,  81, 163, 252, 255, 255, 166, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   6, 236, 255, 255, 255, 255, 255, 255, 235, 
-       6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     212, 255, 255, 255, 255, 255, 137,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     137, 255, 255, 255, 255, 255, 211,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 130, 255, 
-     255, 255, 238,  16,   0,   0, 255, 255, 255, 255,   0,  89, 255, 255, 255, 213, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 212, 255, 255, 255,  86,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  86, 255, 255, 255, 213,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 212, 
-     255, 255, 255,  91,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  27, 246, 255, 255, 255, 137,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 149, 255, 255, 255, 211,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 214, 255, 255, 255,  58,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      60, 255, 255, 255, 212,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 172, 
-     255, 255, 255, 156,   0,   0,   0,   0, 150, 255, 255, 255, 174,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 232, 255, 255, 
-     255,  56,   0,   2, 239, 255, 255, 255,  45,   0,   0,   0,   0,   0,   0,   0, 
-       0,  46, 255, 255, 255, 237,   1,   0,  60, 255, 255, 255, 225,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 189, 255, 255, 255, 244, 
-      35,   0,   0,   0,   0,   2, 198, 255, 255, 255, 240,  27,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  83, 254, 255, 255, 255, 204,   9,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     149, 255, 255, 255, 155,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 134, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 222,  20, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255,  21,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  22, 255, 255, 255, 231,   0,   0,   0,   0,  55, 235, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 233, 255, 
-     255, 255,  21,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      22, 255, 255, 255, 255,   0,   0,   0,   0,  54, 233, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  21, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     240,  57,   4, 255, 255, 255, 239,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,  35, 223, 255, 255, 255, 255, 195,  14,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 144, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 139,   0,   0, 
-       0,   0, 255, 255, 255, 255,  29, 235, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 173,   2,   0,   0,   0,   0,   0,   2, 173, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 234,  29, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 128,   0,   0,   0,   0,   0, 253, 255, 255, 255,   2,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  24, 238, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 212,  15, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 144, 255, 255, 255, 255, 255, 255, 143, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     145, 255, 255, 255, 255, 255,  69,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      69, 255, 255, 255, 255, 255, 144,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  13, 234, 
-     255, 255, 255, 136,   0,   0, 255, 255, 255, 255,   0,  22, 254, 255, 255, 255, 
-      55,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  55, 255, 255, 255, 253,  20,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  19, 253, 255, 255, 255,  55,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  55, 255, 
-     255, 255, 254,  21,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 134, 255, 255, 255, 239,  16,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  51, 255, 255, 255, 235,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 185, 255, 255, 255, 107,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     109, 255, 255, 255, 183,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  74, 
-     255, 255, 255, 242,  10,   0,   0,   8, 239, 255, 255, 255,  76,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 169, 255, 255, 
-     255, 120,   0,  48, 255, 255, 255, 237,   1,   0,   0,   0,   0,   0,   0,   0, 
-       0,   1, 238, 255, 255, 255,  45,   0, 124, 255, 255, 255, 162,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 111, 255, 255, 255, 255, 103, 
-       0,   0,   0,   0,   0,   0,  39, 247, 255, 255, 255, 180,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  48, 244, 255, 255, 255, 231,  28,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      71, 255, 255, 255, 231,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 175, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 222,  37,   0, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255,  46,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  47, 255, 255, 255, 215,   0,   0,   0,   0,   0,  35, 215, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 216, 255, 
-     255, 255,  46,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      48, 255, 255, 255, 255,   0,   0,   0,   0,   0,  30, 206, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  11, 143, 252, 255, 255, 255, 255, 255, 255, 255, 255, 202, 
-      41,   0,  21, 255, 255, 255, 224,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,  28, 215, 255, 255, 255, 255, 205,  20,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 129, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 125,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,  57, 241, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 182,   6,   0,   0,   0,   0,   0,   0,   0,   6, 183, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 240,  57,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 131,   0,   0,   0,   0,   0,   0, 241, 255, 255, 255,  13,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  68, 245, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 213,  27,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  45, 255, 255, 255, 255, 255, 255,  45, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      78, 255, 255, 255, 255, 248,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       9, 248, 255, 255, 255, 255,  77,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 110, 
-     255, 255, 255, 246,  27,   0, 255, 255, 255, 255,   0,   0, 195, 255, 255, 255, 
-     160,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 159, 255, 255, 255, 192,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 190, 255, 255, 255, 160,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 159, 255, 
-     255, 255, 203,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  16, 238, 255, 255, 255, 133,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  11, 255, 255, 255, 250,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 129, 255, 255, 255, 169,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     171, 255, 255, 255, 127,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, 
-     229, 255, 255, 255,  95,   0,   0,  89, 255, 255, 255, 231,   4,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 105, 255, 255, 
-     255, 183,   0, 110, 255, 255, 255, 177,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 179, 255, 255, 255, 107,   0, 188, 255, 255, 255,  98,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  41, 247, 255, 255, 255, 182,   0, 
-       0,   0,   0,   0,   0,   0,   0, 117, 255, 255, 255, 255,  94,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  22, 225, 255, 255, 255, 248,  57,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       6, 242, 255, 255, 255,  54,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 130, 247, 255, 255, 
-     255, 255, 255, 255, 255, 255, 254, 164,  20,   0,   0, 255, 255, 255, 255,   0, 
-     255, 255, 255, 255,  94,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  95, 255, 255, 255, 180,   0,   0,   0,   0,   0,   0,   6, 111, 233, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 180,  60,   0, 182, 255, 
-     255, 255,  94,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      96, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   4,  98, 221, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 232, 144,  48,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  34, 122, 196, 227, 250, 245, 215, 161,  74,   1, 
-       0,   0,  47, 255, 255, 255, 207,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,  21, 207, 255, 255, 255, 255, 213,  26,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,  60, 202, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 200,  57,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,  41, 202, 255, 255, 255, 255, 255, 255, 
-     255, 255, 246, 116,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, 117, 
-     247, 255, 255, 255, 255, 255, 255, 255, 255, 202,  41,   0,   0, 255, 255, 255, 
-     255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  46, 137, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 203,  60,   0,   0,   0,   0,   0,   0,   0, 225, 255, 255, 255,  47,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  54, 209, 255, 255, 255, 
-     255, 255, 255, 255, 255, 253, 156,  14,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, 
-     222, 255, 255, 255, 155,   0, 255, 255, 255, 255,   0,   0,  99, 255, 255, 255, 
-     250,  48,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  47, 250, 255, 255, 255,  95,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  92, 255, 255, 255, 250,  48,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  47, 250, 255, 
-     255, 255, 106,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 119, 255, 255, 255, 244,  23,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  16, 255, 255, 255, 235,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  71, 255, 255, 255, 247,  16, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  18, 
-     248, 255, 255, 255,  69,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     135, 255, 255, 255, 192,   0,   0, 186, 255, 255, 255, 137,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  42, 255, 255, 
-     255, 242,   4, 172, 255, 255, 255, 115,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 117, 255, 255, 255, 168,   6, 245, 255, 255, 255,  35,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   4, 204, 255, 255, 255, 237,  25,   0, 
-       0,   0,   0,   0,   0,   0,   0,   3, 200, 255, 255, 255, 238,  25,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   6, 196, 255, 255, 255, 255,  95,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 172, 255, 255, 255, 132,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  25, 123, 190, 
-     230, 249, 248, 230, 191, 128,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 159,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 159, 255, 255, 255, 127,   0,   0,   0,   0,   0,   0,   0,   0,   8, 
-      73, 145, 201, 223, 244, 249, 235, 209, 163, 103,  23,   0,   0,   0, 129, 255, 
-     255, 255, 159,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     161, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   4,  62, 130, 
-     191, 218, 238, 252, 242, 229, 200, 161, 114,  47,   1,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 102, 255, 255, 255, 163,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,  15, 197, 255, 255, 255, 255, 221,  33,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1, 
-      58, 134, 197, 223, 245, 245, 223, 197, 133,  57,   1,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   1,  75, 161, 216, 245, 249, 224, 
-     191, 111,  23,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      23, 112, 192, 225, 249, 245, 215, 161,  74,   1,   0,   0,   0, 255, 255, 255, 
-     255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  40, 107, 158, 201, 231, 246, 251, 238, 220, 178, 127, 
-      45,   0,   0,   0,   0,   0,   0,   0,   0,   0, 185, 255, 255, 255, 127,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  81, 159, 216, 
-     238, 252, 239, 201, 136,  40,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      91, 255, 255, 255, 252,  40, 255, 255, 255, 255,   0,   0,   8, 230, 255, 255, 
-     255, 208,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   5, 207, 255, 255, 255, 226,   6,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   5, 223, 255, 255, 255, 208,   5,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, 207, 255, 255, 
-     255, 240,  11,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  10, 230, 255, 255, 255, 147,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  58, 255, 255, 255, 212,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, 235, 255, 255, 255, 138, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 142, 
-     255, 255, 255, 234,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      38, 255, 255, 255, 254,  35,  29, 253, 255, 255, 255,  40,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 233, 255, 
-     255, 255,  55, 233, 255, 255, 255,  52,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  55, 255, 255, 255, 229,  60, 255, 255, 255, 226,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 130, 255, 255, 255, 255,  86,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  42, 248, 255, 255, 255, 177,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 158, 255, 255, 255, 255, 141,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  94, 255, 255, 255, 209,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 242,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  10, 242, 255, 255, 255,  72,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  73, 255, 
-     255, 255, 242,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, 
-     243, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 181, 255, 255, 255, 113,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,  10, 186, 255, 255, 255, 255, 228,  41,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 131, 255, 255, 255, 248, 125, 
-      44,  11,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       1, 207, 255, 255, 255, 174, 255, 255, 255, 255,   0,   0,   0, 101, 255, 255, 
-     255, 255, 164,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   2, 160, 255, 255, 255, 255,  97,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  91, 255, 255, 255, 255, 164,   3,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 160, 255, 255, 255, 
-     255, 124,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 106, 255, 255, 255, 249,  32,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 159, 255, 255, 255, 163,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 131, 255, 255, 255, 253, 
-      74,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  78, 254, 
-     255, 255, 255, 128,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 196, 255, 255, 255, 131, 124, 255, 255, 255, 199,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 170, 255, 
-     255, 255, 160, 255, 255, 255, 242,   3,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   4, 244, 255, 255, 255, 160, 255, 255, 255, 163,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  55, 252, 255, 255, 255, 166,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 121, 255, 255, 255, 255,  91,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 113, 255, 255, 255, 255, 183,   3,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  20, 252, 255, 255, 255,  31,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 126,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 127, 255, 255, 255, 233,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, 234, 
-     255, 255, 255, 126,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 131, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  45, 254, 255, 255, 255,  53,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   7, 175, 255, 255, 255, 255, 235,  49,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  41, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  72, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   1, 195, 255, 
-     255, 255, 255, 171,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   7, 166, 255, 255, 255, 255, 191,   1,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0, 184, 255, 255, 255, 255, 171,   8,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, 166, 255, 255, 255, 255, 
-     216,   6,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   5, 221, 255, 255, 255, 160,   0, 
-       0,   0, 201,  91,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  86, 255, 255, 255, 255,  83,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  24, 239, 255, 255, 255, 
-     251, 117,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, 119, 252, 255, 
-     255, 255, 237,  22,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  99, 255, 255, 255, 226, 220, 255, 255, 255, 101,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 107, 255, 
-     255, 255, 251, 255, 255, 255, 184,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 187, 255, 255, 255, 251, 255, 255, 255,  99,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  10, 217, 255, 255, 255, 228,  17,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   3, 203, 255, 255, 255, 236,  23, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      71, 252, 255, 255, 255, 217,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 195, 255, 255, 255, 108,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 246,  51,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      51, 247, 255, 255, 255, 139,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 141, 
-     255, 255, 255, 246,  51,   0,   0,   0,   0,   0,   0,   0,   0,   0,  54, 248, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      11, 211, 255, 255, 255, 212,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   4, 163, 255, 255, 255, 255, 240,  59, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 158, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 190, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,  27, 233, 
-     255, 255, 255, 255, 221,  78,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      73, 219, 255, 255, 255, 255, 231,  25,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  21, 226, 255, 255, 255, 255, 221,  78,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  73, 219, 255, 255, 255, 255, 247, 
-      54,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  92, 255, 255, 255, 253,  42, 
-       0,   0, 255, 255, 232, 142,  61,   2,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  13, 132, 253, 255, 255, 255, 221,   8,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  80, 255, 255, 255, 
-     255, 255, 232, 140,  79,  34,  16,   4,  16,  33,  78, 140, 232, 255, 255, 255, 
-     255, 254,  76,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  12, 244, 255, 255, 255, 255, 255, 255, 246,  14,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  43, 255, 
-     255, 255, 255, 255, 255, 255, 121,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 125, 255, 255, 255, 255, 255, 255, 255,  35,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 149, 255, 255, 255, 254,  70,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  44, 249, 255, 255, 255, 173, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 118, 255, 255, 255, 186,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 235,  60,   0,   0,   0,   0,   0,   0,   0,  60, 
-     235, 255, 255, 255, 242,  27,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  28, 
-     242, 255, 255, 255, 235,  60,   0,   0,   0,   0,   0,   0,   0,  63, 237, 255, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 195,  75,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,  39, 
-     209, 255, 255, 255, 255, 110,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   1, 150, 255, 255, 255, 255, 245, 
-      70,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   9, 159, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  53, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,  52, 
-     241, 255, 255, 255, 255, 255, 214, 134,  64,  35,  12,  10,  34,  61, 130, 210, 
-     255, 255, 255, 255, 255, 239,  49,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  42, 234, 255, 255, 255, 255, 255, 214, 
-     134,  64,  35,  12,  10,  34,  61, 130, 210, 255, 255, 255, 255, 255, 254,  85, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 211, 255, 255, 255, 174, 
-       0,   0, 255, 255, 255, 255, 255, 234, 170, 121,  72,  39,  23,   6,   7,  19, 
-      47,  89, 158, 238, 255, 255, 255, 255, 255,  73,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 125, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 121,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 160, 255, 255, 255, 255, 255, 255, 163,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 234, 
-     255, 255, 255, 255, 255, 255,  59,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  63, 255, 255, 255, 255, 255, 255, 226,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  71, 255, 255, 255, 255, 148,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 124, 255, 255, 255, 255, 
-      87,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  40, 255, 255, 255, 249,  13,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 179, 255, 255, 254, 164,  72,  25,   6,  25,  72, 164, 254, 
-     255, 255, 255, 255, 110,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     111, 255, 255, 255, 255, 254, 163,  71,  24,   6,  25,  73, 166, 254, 255, 255, 
-     178, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 229, 146,  86,  39,  16,   4,  16,  38,  93, 170, 252, 
-     255, 255, 255, 255, 208,   5,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 137, 255, 255, 255, 255, 
-     249,  81,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  43, 135, 188, 
-     227, 243, 254, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 171, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-      51, 228, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 228,  49,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  41, 220, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 245,  84,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  78, 255, 255, 255, 255, 
-      54,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 254, 110,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  88, 246, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 245, 
-      86,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  62, 255, 255, 255, 255, 255, 255,  65,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 172, 
-     255, 255, 255, 255, 255, 246,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   8, 248, 255, 255, 255, 255, 255, 163,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  17, 229, 255, 255, 255, 217,  10,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, 206, 255, 255, 255, 
-     235,  21,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 219, 255, 255, 255,  85,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,  29, 235, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 173,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       2, 173, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 234, 
-      29, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 242,  46,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 123, 255, 255, 255, 
-     255, 252,  93,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  37, 251, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,  23, 175, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 176,  24,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  17, 163, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 209,  50,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 199, 255, 255, 255, 
-     188,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 233,  88,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  29, 
-     146, 246, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 146,  29, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   1, 220, 255, 255, 255, 255, 223,   1,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 108, 
-     255, 255, 255, 255, 255, 191,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 195, 255, 255, 255, 255, 255,  99,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 168, 255, 255, 255, 252,  55,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  46, 250, 255, 255, 
-     255, 171,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 141, 255, 255, 255, 162,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,  57, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 182,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   6, 183, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 240,  57, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 230,  48,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 109, 254, 255, 
-     255, 255, 254, 105,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  68, 191, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 192,  69,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  57, 180, 253, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 134,   3,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  37, 111, 185, 245, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 227, 134,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  17,  83, 145, 199, 220, 238, 251, 239, 221, 199, 146,  83,  17,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  64, 255, 255, 255, 236,   3,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,  41, 202, 255, 255, 255, 255, 255, 255, 255, 255, 
-     246, 116,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   3, 117, 247, 255, 255, 255, 255, 255, 255, 255, 255, 202,  41,   0, 
-       0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  60, 179, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     248, 147,  24,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 
-     255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  95, 252, 
-     255, 255, 255, 255, 120,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  33, 110, 170, 210, 238, 250, 250, 238, 211, 171, 111, 
-      35,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  26, 103, 
-     164, 205, 235, 249, 255, 248, 234, 255, 255, 255, 255, 220,  27,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   4,  49, 104, 148, 183, 216, 234, 246, 252, 240, 227, 
-     209, 167, 121,  62,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   4, 238, 255, 255, 255,  61,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   1,  75, 161, 216, 245, 249, 224, 191, 111, 
-      23,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  23, 112, 192, 225, 249, 245, 215, 161,  74,   1,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  23, 102, 161, 206, 234, 248, 248, 230, 210, 164,  98, 
-      25,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   2, 255, 255, 255, 252,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 
-     255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   3, 168, 255, 255, 255, 255, 217,  24,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 165, 255, 255, 255, 139,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  10, 255, 255, 255, 240,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   4, 171, 255, 255, 255, 255, 214,  22,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  87, 255, 255, 255, 217,   0,   0,   0,   0,   0,   0,   0, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  32, 255, 255, 255, 226,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   4, 175, 255, 255, 255, 255, 211,  20, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  72, 255, 255, 255, 191,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   6, 179, 255, 255, 255, 255, 208, 
-      18,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 156, 255, 255, 255, 147,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, 182, 255, 255, 255, 255, 
-     205,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   4,  34, 133, 254, 255, 255, 255,  72,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 225,   5,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,  82,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 255, 255, 255, 255, 248, 104,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 255, 253, 237, 206, 138,  32,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 164, 255, 255, 255, 254,  72,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  73, 254, 255, 255, 255, 164,   0,   0, 203, 255, 255, 255, 136,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 142, 
-     255, 255, 255, 201,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  32, 115, 170, 209, 232, 244, 254, 255,   0, 255, 255, 
-     255, 255,   0, 255, 254, 244, 233, 210, 171, 118,  33,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  54,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  14, 222, 255, 255, 255, 232,  22,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  23, 233, 255, 255, 255, 222,  14,   0,   0,  98, 255, 255, 255, 234,   7, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, 239, 
-     255, 255, 255,  92,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   9, 151, 254, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 154,  10,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  43, 119, 188, 223, 245, 246, 
-     222, 178, 116,  42,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   4, 122, 250,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  56, 251, 255, 255, 255, 181,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 182, 255, 255, 255, 252,  57,   0,   0,   0,   9, 238, 255, 255, 255,  92, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 104, 255, 
-     255, 255, 233,   6,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 158, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  56, 188, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 210, 121,  33,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      70, 209, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 124, 255, 255, 255, 255, 110,   0,   0,   0,   0,   0,   0,   0, 
-     111, 255, 255, 255, 255, 126,   0,   0,   0,   0,   0, 142, 255, 255, 255, 198, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 211, 255, 
-     255, 255, 131,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 251,   0,   0,   0,   0,   0,   0, 
-       0,   0,  39, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  39,   0,   0, 
-       0,   0,   0,   0,   0,   0,  15, 157, 254, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 201, 127,  66,  23,   5,  23,  54, 125, 209, 
-     255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   2, 193, 255, 255, 255, 247,  45,   0,   0,   0,   0,   0,  46, 
-     248, 255, 255, 255, 195,   3,   0,   0,   0,   0,   0,  37, 254, 255, 255, 255, 
-      47,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  65, 255, 255, 
-     255, 251,  27,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  10, 203, 255, 255, 255, 255, 102,   0,   0,   0,   0,   0,   0, 
-       0,   0, 129, 255, 255, 255, 255, 173,  75,  30,  10,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   9,  28,  73, 169, 255, 255, 255, 255, 129,   0,   0, 
-       0,   0,   0,   0,   0,   0, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 225,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  29, 238, 255, 255, 255, 212,   8,   0,   0,   0,   9, 213, 
-     255, 255, 255, 240,  31,   0,   0,   0,   0,   0,   0,   0, 186, 255, 255, 255, 
-     153,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 174, 255, 255, 
-     255, 170,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   2, 175, 255, 255, 255, 255, 141,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 181, 255, 255, 255, 169,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0, 168, 255, 255, 255, 180,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 215, 129,  56,  25,   5,  24, 
-      67, 129, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 160,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  84, 255, 255, 255, 255, 149,   0,   0,   0, 150, 255, 
-     255, 255, 255,  88,   0,   0,   0,   0,   0,   0,   0,   0,  81, 255, 255, 255, 
-     244,  14,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  30, 252, 255, 255, 
-     255,  61,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 140, 255, 255, 255, 255, 177,   2,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 222, 255, 255, 255,  68,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,  68, 255, 255, 255, 221,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 255, 221,  81,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  34, 123, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     193,  59,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 156, 255, 255, 255, 255,  77,   0,  77, 255, 255, 
-     255, 255, 160,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, 227, 255, 255, 
-     255, 109,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 135, 255, 255, 255, 
-     208,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 104, 255, 255, 255, 255, 206,  11,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 239, 255, 255, 255,  23,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,  24, 255, 255, 255, 237,   0,   0, 
-       0,   0,   0,   0,   0,   0, 255, 149,   9,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  44, 118, 179, 223, 247, 246, 224, 190, 123,  46, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  11, 217, 255, 255, 255, 234,  50, 235, 255, 255, 
-     255, 220,  13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 125, 255, 255, 
-     255, 213,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, 235, 255, 255, 255, 
-     100,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      71, 251, 255, 255, 255, 229,  27,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 250, 255, 255, 255,   5,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   7, 255, 255, 255, 250,   0,   0, 
-       0,   0,   0,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  50, 249, 255, 255, 255, 250, 255, 255, 255, 
-     251,  54,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  24, 250, 255, 
-     255, 255,  64,   0,   0,   0,   0,   0,   0,   0,   0,  96, 255, 255, 255, 238, 
-       9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  44, 
-     241, 255, 255, 255, 245,  50,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 116, 255, 255, 255, 255, 255, 255, 255, 
-     122,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 169, 255, 
-     255, 255, 170,   0,   0,   0,   0,   0,   0,   0,   0, 205, 255, 255, 255, 139, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  24, 225, 
-     255, 255, 255, 253,  80,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   1, 186, 255, 255, 255, 255, 255, 193, 
-       2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  64, 255, 
-     255, 255, 250,  25,   0,   0,   0,   0,   0,   0,  58, 255, 255, 255, 253,  33, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  10, 203, 255, 
-     255, 255, 255, 117,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  72, 255, 255, 255, 255, 254,  36, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 213, 
-     255, 255, 255, 125,   0,   0,   0,   0,   0,   0, 166, 255, 255, 255, 178,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, 174, 255, 255, 
-     255, 255, 155,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  12, 218, 255, 255, 255, 255, 255, 146, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 108, 
-     255, 255, 255, 227,   3,   0,   0,   0,   0,  25, 250, 255, 255, 255,  69,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 140, 255, 255, 255, 
-     255, 189,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 161, 255, 255, 255, 255, 255, 255, 255, 
-      83,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  14, 
-     243, 255, 255, 255,  81,   0,   0,   0,   0, 128, 255, 255, 255, 216,   1,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 103, 255, 255, 255, 255, 
-     216,  17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   4, 255, 255, 255, 254,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 254, 255, 255, 255,   3,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,  91, 255, 255, 255, 255, 252, 255, 255, 255, 
-     241,  35,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-     152, 255, 255, 255, 187,   0,   0,   0,   5, 230, 255, 255, 255, 108,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  70, 251, 255, 255, 255, 236, 
-      35,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  18, 255, 255, 255, 246,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 247, 255, 255, 255,  17,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,  35, 242, 255, 255, 255, 213,  61, 249, 255, 255, 
-     255, 205,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      47, 255, 255, 255, 254,  37,   0,   0,  89, 255, 255, 255, 242,  13,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,  43, 241, 255, 255, 255, 249,  61, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  56, 255, 255, 255, 228,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 230, 255, 255, 255,  55,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   5, 202, 255, 255, 255, 247,  45,   0, 107, 255, 255, 
-     255, 255, 150,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 197, 255, 255, 255, 142,   0,   0, 198, 255, 255, 255, 147,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,  23, 224, 255, 255, 255, 255,  94,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 128, 255, 255, 255, 194,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 196, 255, 255, 255, 127,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 139, 255, 255, 255, 255, 105,   0,   0,   0, 169, 255, 
-     255, 255, 255,  87,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  91, 255, 255, 255, 238,   9,  50, 255, 255, 255, 254,  39,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   9, 202, 255, 255, 255, 255, 132,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-      33, 239, 255, 255, 255, 134,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 137, 255, 255, 255, 238,  33, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,  70, 254, 255, 255, 255, 174,   0,   0,   0,   0,  13, 218, 
-     255, 255, 255, 242,  37,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   6, 234, 255, 255, 255,  98, 159, 255, 255, 255, 186,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   1, 173, 255, 255, 255, 255, 169,   1,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  15,  51, 123, 
-     236, 255, 255, 255, 252,  38,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,  41, 253, 255, 255, 255, 236, 
-     123,  51,  15,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  23, 232, 255, 255, 255, 225,  17,   0,   0,   0,   0,   0,  48, 
-     247, 255, 255, 255, 208,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 135, 255, 255, 255, 213, 247, 255, 255, 255,  77,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0, 139, 255, 255, 255, 255, 200,   8,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 
-     255, 255, 255, 254, 108,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 112, 254, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   1, 184, 255, 255, 255, 252,  60,   0,   0,   0,   0,   0,   0,   0, 
-     102, 255, 255, 255, 255, 154,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  32, 253, 255, 255, 255, 255, 255, 255, 222,   2,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 102, 255, 255, 255, 255, 225,  23,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 
-     255, 252, 187,  64,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  65, 187, 251, 255, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 116, 255, 255, 255, 255, 125,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 164, 255, 255, 255, 255,  91,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 180, 255, 255, 255, 255, 255, 255, 116,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255, 255, 
-     255, 248, 175,  51,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51, 174, 248, 255, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  52, 250, 255, 255, 255, 191,   2,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  12, 215, 255, 255, 255, 243,  40,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  74, 255, 255, 255, 255, 255, 245,  17,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 255, 255, 255, 
-     255, 255, 255, 251,  93,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,  96, 252, 255, 255, 255, 
-     255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-      13, 219, 255, 255, 255, 236,  27,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  44, 246, 255, 255, 255, 211,   9,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   2, 221, 255, 255, 255, 255, 155,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   2,  16,  54, 129, 
-     240, 255, 255, 255, 248,  31,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,  34, 249, 255, 255, 255, 239, 
-     127,  53,  16,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-     163, 255, 255, 255, 255,  77,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  97, 255, 255, 255, 255, 159,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 120, 255, 255, 255, 255,  46,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 
-      40, 242, 255, 255, 255, 129,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 132, 255, 255, 255, 241,  37, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0, 151, 255, 255, 255, 193,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0, 134, 255, 255, 255, 191,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 193, 255, 255, 255, 132,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,  24, 244, 255, 255, 255,  85,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  60, 255, 255, 255, 227,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 228, 255, 255, 255,  58,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 172, 255, 255, 255, 228,   4,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  20, 255, 255, 255, 245,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 247, 255, 255, 255,  19,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  93, 255, 255, 255, 255, 124,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   5, 255, 255, 255, 254,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 254, 255, 255, 255,   5,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,  51, 244, 255, 255, 255, 245,  22,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  31, 
-     115, 240, 255, 255, 255, 255, 137,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 255, 231,  17,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-     255, 255, 255, 255, 253,  75,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 
-     255, 255, 255, 245,  93,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 254, 
-     240, 205, 135,  30,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 250, 255, 255, 255,   5,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   7, 255, 255, 255, 250,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 239, 255, 255, 255,  22,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,  23, 255, 255, 255, 237,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 222, 255, 255, 255,  67,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,  67, 255, 255, 255, 221,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 181, 255, 255, 255, 167,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0, 165, 255, 255, 255, 180,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0, 129, 255, 255, 255, 255, 169,  74,  28,   8,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   8,  27,  71, 166, 255, 255, 255, 255, 129,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,  39, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  39,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0, 158, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   9, 153, 254, 255, 255, 255, 255, 255, 255, 255,   0, 255, 255, 
-     255, 255,   0, 255, 255, 255, 255, 255, 255, 255, 255, 156,  10,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,  32, 116, 171, 210, 234, 245, 254, 255,   0, 255, 255, 
-     255, 255,   0, 255, 254, 245, 235, 212, 172, 118,  35,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 
-     255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 
-       0,   0,   0,   0,   0,   0,   0,   0};
+    0,4,17,21,21,17,4,0,0,0,0,1,10,20,21,20,10,1,0,0,0,0,0,1,
+    10,20,21,20,10,1,0,0,0,0,0,0,0,4,17,21,17,4,0,0,0,0,0,0,
+    0,0,0,0,0,0,1,6,17,21,21,21,17,4,0,0,4,17,21,21,21,17,6,1,
+    0,0,0,0,0,0,0,0,0,0,4,17,21,21,20,10,1,0,0,4,17,21,21,20,
+    10,1,0,0,0,0,0,4,17,21,21,21,21,21,17,4,0,0,4,17,21,21,21,21,
+    21,17,4,0,0,0,0,0,0,0,0,0,0,3,10,20,21,21,21,21,20,10,3,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,1,6,17,21,21,21,21,17,6,1,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,4,17,21,21,17,4,0,0,4,17,21,21,
+    17,4,0,0,0,0,0,0,0,0,0,0,1,10,20,21,21,20,10,1,0,0,0,0,
+    1,10,20,21,17,4,0,0,0,0,0,0,0,0,0,0,0,4,17,21,21,21,20,10,
+    3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,10,20,21,21,20,10,3,0,
+    0,0,0,0,0,0,0,3,6,17,21,21,21,21,20,10,1,0,0,0,0,0,0,0,
+    0,0,0,0,3,10,20,21,21,21,21,17,4,0,0,0,0,0,0,0,1,6,17,21,
+    21,21,21,17,6,1,0,0,0,0,0,0,0,0,0,4,17,21,21,21,20,10,1,0,
+    0,0,0,0,0,0,0,0,0,0,1,6,17,21,21,21,21,21,17,6,1,0,0,0,
+    0,0,0,0,0,0,0,3,10,20,21,21,21,21,20,10,5,1,0,0,0,0,0,0,
+    0,0,0,0,1,6,17,21,21,21,21,17,6,1,0,0,0,0,0,0,0,0,0,0,
+    1,6,17,21,21,21,21,21,17,6,1,0,0,0,0,0,4,17,21,21,17,4,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,10,20,21,20,
+    10,1,0,0,0,0,0,1,6,17,21,21,21,17,4,5,5,5,1,0,0,0,0,3,
+    5,5,3,10,20,21,21,20,10,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,4,32,57,64,64,57,32,4,0,0,0,17,46,62,64,62,
+    46,17,0,0,0,0,0,17,46,62,64,62,46,17,0,0,0,0,0,0,4,32,57,64,
+    57,32,4,0,0,0,0,0,0,0,0,0,0,6,28,41,57,64,64,64,57,32,4,4,
+    32,57,64,64,64,57,41,28,6,0,0,0,0,0,0,0,0,4,32,57,64,64,62,46,
+    17,0,4,32,57,64,64,62,46,17,0,0,0,0,4,32,57,64,64,64,64,64,57,32,
+    4,4,32,57,64,64,64,64,64,57,32,4,0,0,0,0,0,0,1,10,21,37,47,62,
+    64,64,64,64,62,47,37,18,4,0,0,0,0,0,0,0,0,0,0,1,10,28,41,57,
+    64,64,64,64,57,41,28,10,1,0,0,0,0,0,0,0,0,0,0,6,32,57,64,64,
+    57,32,4,4,32,57,64,64,57,32,6,0,0,0,0,0,0,0,0,6,28,47,62,64,
+    64,62,47,28,6,0,0,1,17,46,62,64,57,32,4,0,0,0,0,0,0,0,0,4,
+    18,37,57,64,64,64,62,47,37,17,1,0,0,0,0,0,0,0,0,0,0,1,17,37,
+    47,62,64,64,62,47,37,17,1,0,0,0,0,1,17,37,42,57,64,64,64,64,62,47,
+    28,10,1,0,0,0,0,0,0,0,1,17,37,47,62,64,64,64,64,57,37,17,1,0,
+    0,0,0,6,28,41,57,64,64,64,64,57,41,28,6,0,0,0,0,0,0,4,18,37,
+    57,64,64,64,62,47,28,10,1,0,0,0,0,0,0,0,1,10,28,41,57,64,64,64,
+    64,64,57,41,28,10,1,0,0,0,0,0,0,4,18,37,47,62,64,64,64,64,62,47,
+    41,28,10,1,0,0,0,0,0,0,1,10,28,41,57,64,64,64,64,57,41,28,10,1,
+    0,0,0,0,0,0,0,6,28,41,57,64,64,64,64,64,57,41,28,10,1,0,0,4,
+    32,57,64,64,57,32,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,17,46,62,64,62,46,17,0,0,0,0,6,28,41,57,64,64,64,57,37,41,
+    42,41,28,6,0,1,17,37,42,42,37,47,62,64,64,62,47,28,10,1,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,57,92,106,106,92,57,17,
+    0,0,3,37,75,103,106,103,75,37,3,0,0,0,3,37,75,103,106,103,75,37,3,0,
+    0,0,0,0,17,57,92,106,92,57,17,0,0,0,0,0,0,0,0,0,4,32,62,83,
+    93,106,106,106,92,57,17,17,57,92,106,106,106,93,83,62,32,4,0,0,0,0,0,0,
+    0,18,57,92,106,106,103,75,37,3,17,57,92,106,106,103,75,37,4,0,0,0,17,57,
+    92,106,106,106,106,106,92,57,17,17,57,92,106,106,106,106,106,92,57,17,0,0,0,0,
+    0,4,19,46,62,75,86,103,106,106,106,106,103,86,75,57,37,17,1,0,0,0,0,0,
+    0,0,1,17,46,65,83,93,106,106,106,106,93,83,65,46,17,1,0,0,0,0,0,0,
+    0,0,1,28,62,92,106,106,92,57,17,17,57,92,106,106,92,62,28,1,0,0,0,0,
+    0,0,4,32,62,84,103,106,106,103,84,62,32,4,0,10,46,77,103,106,92,57,17,0,
+    0,0,0,0,0,0,4,32,57,75,93,106,106,106,103,86,75,47,17,0,0,0,0,0,
+    0,0,0,0,1,17,47,75,86,103,106,106,103,86,75,47,17,1,0,0,0,17,47,75,
+    85,93,106,106,106,106,103,84,65,46,17,1,0,0,0,0,0,6,28,48,75,86,103,106,
+    106,106,106,93,75,46,10,0,0,0,6,32,62,83,93,106,106,106,106,93,83,62,32,6,
+    0,0,0,0,6,32,57,75,93,106,106,106,103,84,65,46,17,1,0,0,0,0,0,1,
+    17,46,65,83,93,106,106,106,106,106,93,83,65,46,17,1,0,0,0,1,17,37,57,75,
+    86,103,106,106,106,106,103,86,83,65,46,17,1,0,0,0,0,1,17,46,65,83,93,106,
+    106,106,106,93,83,65,46,17,1,0,0,0,0,0,6,32,62,83,93,106,106,106,106,106,
+    93,83,65,46,17,0,0,17,57,92,106,106,92,57,17,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,3,37,75,103,106,103,75,37,3,0,0,6,32,62,
+    83,93,106,106,106,93,75,83,85,83,62,28,1,10,46,75,85,85,75,84,103,106,106,103,
+    84,65,46,17,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    21,64,106,143,143,106,64,21,0,0,5,42,85,128,149,128,85,42,5,0,0,0,5,42,
+    85,128,149,128,85,42,5,0,0,0,0,3,22,64,106,138,106,64,26,10,3,0,0,0,
+    0,0,0,0,18,57,92,120,128,146,149,143,106,64,21,21,64,106,143,149,146,128,120,92,
+    57,18,0,0,0,0,0,0,4,37,75,109,143,140,120,83,41,5,20,62,103,133,146,128,
+    93,57,18,0,0,0,21,64,106,143,149,149,149,143,106,64,21,21,64,106,143,149,149,149,
+    143,106,64,21,0,0,0,0,6,32,57,77,103,109,128,135,149,149,149,149,135,128,109,93,
+    75,47,17,1,0,0,0,0,0,1,17,47,77,103,120,128,146,149,149,146,128,120,103,77,
+    47,17,1,0,0,0,0,0,0,0,6,41,83,120,146,140,106,64,21,21,64,106,140,146,
+    120,83,41,6,0,0,0,0,0,0,18,57,92,120,135,149,149,135,120,92,57,18,1,28,
+    65,103,135,140,106,64,21,0,0,0,0,0,0,1,19,57,92,109,128,146,149,149,135,128,
+    106,75,37,3,0,0,0,0,0,0,0,0,17,47,77,106,128,135,149,149,135,128,106,77,
+    47,17,0,0,3,37,75,106,128,128,146,149,149,149,135,120,103,77,47,17,0,0,0,0,
+    4,32,62,84,106,128,135,149,149,149,146,128,103,62,20,0,0,4,32,62,92,120,128,146,
+    149,149,146,128,120,92,62,32,4,0,0,4,32,62,92,109,128,146,149,149,135,120,103,77,
+    47,17,0,0,0,0,1,17,47,77,103,120,128,146,149,149,149,146,128,120,103,77,46,10,
+    0,0,1,17,47,75,93,109,128,135,149,149,149,149,135,128,120,103,77,46,10,0,0,0,
+    1,17,47,77,103,120,128,146,149,149,146,128,120,103,77,47,17,1,0,0,0,6,32,62,
+    92,120,128,146,149,149,149,146,128,120,103,75,37,3,0,21,64,106,143,143,106,64,21,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,42,85,128,149,128,
+    85,42,5,0,4,32,62,92,120,128,146,149,146,128,106,120,128,120,83,41,5,20,62,103,
+    128,128,106,120,135,149,149,135,120,103,77,46,10,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,5,42,85,128,159,128,
+    85,42,5,0,0,0,5,42,85,128,159,128,85,42,5,0,0,1,17,37,47,68,106,138,
+    106,69,62,47,37,17,1,0,0,0,0,3,37,75,109,146,165,152,149,143,106,64,21,21,
+    64,106,143,149,152,165,146,109,75,37,3,0,0,0,0,0,18,57,93,128,153,128,93,62,
+    28,1,10,46,77,109,146,146,109,75,37,4,0,0,21,64,106,149,163,149,149,143,106,64,
+    21,21,64,106,143,149,149,163,149,106,64,21,0,0,0,6,32,62,92,109,135,149,156,158,
+    149,149,149,149,158,158,146,128,106,77,47,17,1,0,0,0,0,17,47,77,106,135,152,159,
+    152,149,149,152,159,152,135,106,77,47,17,0,0,0,0,0,0,0,17,57,93,128,159,128,
+    93,57,17,17,57,93,128,159,128,93,57,17,0,0,0,0,0,4,37,75,109,146,148,128,
+    128,148,146,109,75,37,17,48,84,120,148,128,93,57,17,0,0,0,0,0,0,10,46,77,
+    109,143,158,152,149,149,151,156,128,85,42,5,0,0,0,0,0,0,0,4,37,75,106,135,
+    159,151,149,149,151,159,135,106,75,37,4,0,5,42,85,128,156,156,149,149,149,149,158,152,
+    135,106,75,37,4,0,0,1,19,57,92,120,135,158,151,149,149,149,152,149,106,64,21,0,
+    0,18,57,92,120,149,161,152,149,149,152,161,149,120,92,57,18,0,0,18,57,92,120,146,
+    154,149,149,149,159,152,135,106,75,37,4,0,0,0,17,47,77,106,135,152,159,152,149,149,
+    149,152,159,152,135,103,62,20,0,0,17,47,77,106,128,146,156,151,149,149,149,149,158,161,
+    152,135,103,62,20,0,0,0,17,47,77,106,135,152,159,152,149,149,152,159,152,135,106,77,
+    47,17,0,0,1,28,62,92,120,149,159,152,149,149,149,159,159,152,128,85,42,5,0,21,
+    64,106,149,149,106,64,21,5,5,5,1,0,0,0,0,0,0,0,0,0,0,0,0,3,
+    5,5,8,42,85,128,159,128,85,42,5,0,18,57,92,120,149,161,152,149,149,153,135,128,
+    159,128,85,42,5,21,64,106,149,149,122,148,151,149,149,158,152,135,103,65,32,4,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,
+    0,0,5,41,83,120,128,120,83,41,5,0,0,0,5,42,85,128,159,128,85,42,5,0,
+    1,17,47,75,86,103,112,138,112,106,103,86,75,46,10,0,0,0,0,5,42,85,128,159,
+    149,120,106,106,92,57,17,17,57,92,106,106,120,149,159,128,85,42,5,0,0,0,0,3,
+    37,75,109,146,146,109,75,37,6,0,1,19,57,93,128,153,128,93,57,17,0,0,21,64,
+    106,149,149,112,106,106,92,57,17,17,57,92,106,106,112,149,149,106,64,21,0,0,6,32,
+    62,92,120,146,156,146,128,128,109,106,106,109,128,135,152,158,135,106,77,47,17,1,0,0,
+    4,37,75,106,135,160,149,128,120,106,106,120,128,149,160,135,106,75,37,4,0,0,0,0,
+    0,0,22,64,106,146,152,120,83,41,6,6,41,83,120,152,146,106,64,22,0,0,0,0,
+    0,17,57,93,128,153,128,94,94,128,153,128,93,57,37,75,106,135,135,106,75,37,4,0,
+    0,0,0,0,0,20,62,103,135,159,135,120,106,106,120,128,128,85,42,5,0,0,0,0,
+    0,0,0,18,57,93,128,159,149,120,106,106,120,149,159,128,93,57,18,0,5,42,85,128,
+    128,128,109,106,106,109,128,149,159,128,93,57,17,0,0,10,46,77,109,146,159,135,120,106,
+    106,106,120,128,103,62,20,0,3,37,75,109,146,160,135,120,106,106,120,135,160,146,109,75,
+    37,3,4,37,75,109,146,160,135,109,106,109,135,163,162,128,93,57,18,0,0,4,37,75,
+    106,135,160,149,128,120,106,106,106,120,128,146,146,106,64,21,0,4,37,75,106,135,159,149,
+    128,120,106,106,106,109,128,135,149,146,106,64,21,0,0,4,37,75,106,135,160,149,128,120,
+    106,106,120,128,149,160,135,106,75,37,4,0,10,47,84,120,149,149,128,120,106,106,109,128,
+    128,146,128,85,42,5,0,21,64,106,149,149,106,64,42,42,42,41,28,10,1,0,0,0,
+    0,0,0,0,0,4,18,37,42,42,42,47,85,128,159,128,85,42,5,3,37,75,109,146,
+    160,135,120,106,109,128,145,152,165,128,85,42,5,21,64,106,149,163,148,135,120,106,109,128,
+    149,152,120,92,57,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    21,64,106,149,149,106,64,21,0,0,1,28,62,83,85,83,62,28,1,0,0,0,5,42,
+    85,128,159,128,85,42,5,0,17,47,77,106,128,135,149,156,149,149,135,128,103,62,20,0,
+    0,0,0,5,42,85,128,159,128,93,67,64,57,32,4,4,32,57,64,67,93,128,159,128,
+    85,42,5,0,0,0,0,10,47,86,128,156,128,93,57,18,0,0,0,4,37,75,109,149,
+    146,106,67,28,1,0,21,64,106,149,149,106,69,64,57,32,4,4,32,57,64,69,106,149,
+    149,106,64,21,0,1,28,62,92,120,149,160,135,109,93,85,75,64,64,75,86,103,120,135,
+    156,135,106,77,46,10,0,0,18,57,93,128,159,149,120,93,83,67,67,83,93,120,149,159,
+    128,93,57,18,0,0,0,0,0,3,37,75,109,149,146,106,67,28,1,1,28,67,106,146,
+    149,109,75,37,3,0,0,0,0,21,64,106,146,149,109,75,75,109,149,146,106,64,57,93,
+    128,148,120,84,48,17,0,0,0,0,0,0,0,21,64,106,149,152,120,87,67,67,83,93,
+    103,75,37,3,0,0,0,0,0,0,3,37,75,109,146,152,120,92,67,67,92,120,152,146,
+    109,75,37,3,3,37,75,103,93,85,75,64,64,75,93,120,152,146,106,64,21,0,0,21,
+    62,103,135,156,135,106,84,67,64,67,83,85,75,46,10,0,5,42,85,128,158,135,106,84,
+    67,67,84,106,135,158,128,85,42,5,17,57,93,128,158,135,106,77,64,77,106,135,166,146,
+    109,75,37,3,0,18,57,93,128,159,149,120,93,83,67,64,67,83,93,109,133,106,64,21,
+    0,18,57,93,128,159,149,120,93,83,67,64,64,75,86,103,109,133,106,64,21,0,0,18,
+    57,93,128,159,149,120,93,83,67,67,83,93,120,149,159,128,93,57,18,0,20,62,103,135,
+    158,128,94,83,67,64,75,85,93,109,120,83,41,5,0,21,64,106,149,149,106,72,83,85,
+    85,83,65,47,28,6,0,0,0,0,0,1,17,37,57,75,85,85,85,75,85,128,159,128,
+    85,42,5,10,47,86,128,158,135,106,84,67,75,93,120,152,170,128,85,42,5,21,64,106,
+    149,176,146,109,84,67,75,94,128,159,146,106,64,22,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,3,37,75,103,106,103,
+    75,37,3,0,0,0,5,42,85,128,159,128,85,42,5,4,37,75,106,135,158,151,149,156,
+    149,149,151,149,106,64,21,0,0,0,0,5,42,85,128,159,128,85,42,21,17,4,0,0,
+    4,17,21,42,85,128,159,128,85,42,5,0,0,0,0,21,62,103,135,151,120,83,41,6,
+    0,0,0,0,21,62,103,135,151,120,83,41,6,0,21,64,106,149,149,106,64,27,17,4,
+    0,0,4,17,27,64,106,149,149,106,64,21,0,10,47,84,120,149,160,135,106,77,70,83,
+    85,85,83,70,83,86,93,106,135,156,135,103,65,28,1,3,37,75,109,146,152,120,92,62,
+    41,28,28,41,62,92,120,152,146,109,75,37,3,0,0,0,0,10,47,86,128,156,128,93,
+    57,17,0,0,17,57,93,128,156,128,86,47,10,0,0,0,0,21,64,106,149,149,106,64,
+    64,106,149,149,106,66,77,109,143,135,103,65,28,1,0,0,0,0,0,0,0,21,64,106,
+    149,149,106,70,39,29,41,57,62,46,17,0,0,0,0,0,0,0,6,42,85,128,158,135,
+    103,65,32,32,65,103,135,158,128,85,42,6,0,17,46,62,57,42,37,22,22,37,67,106,
+    149,149,106,64,21,0,3,37,75,109,149,146,109,77,55,45,42,42,42,42,37,17,1,0,
+    5,42,85,128,159,128,86,49,28,28,49,86,128,159,128,85,42,5,21,64,106,146,152,120,
+    84,48,25,48,84,120,152,162,128,85,42,6,3,37,75,109,146,152,120,92,62,41,28,21,
+    28,41,57,77,103,92,57,17,3,37,75,109,146,152,120,92,62,41,28,21,22,37,47,62,
+    77,103,92,57,17,0,3,37,75,109,146,152,120,92,62,41,28,28,41,62,92,120,152,146,
+    109,75,37,3,21,64,106,149,149,109,75,44,28,22,37,42,57,75,83,62,28,1,0,21,
+    64,106,149,149,106,103,120,128,128,120,103,84,62,32,4,0,0,0,0,17,47,75,93,109,
+    128,128,128,109,97,128,159,128,85,42,5,20,62,103,135,158,128,86,49,28,37,67,106,146,
+    165,128,85,42,5,21,64,106,149,162,128,93,57,28,40,75,109,146,149,109,75,37,3,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,
+    0,0,5,42,85,128,149,128,85,42,5,0,0,0,5,42,85,128,159,128,85,42,5,17,
+    57,93,128,158,135,120,112,138,112,106,120,128,103,62,20,0,0,0,0,5,42,85,128,159,
+    128,85,42,5,0,0,0,0,0,0,5,42,85,128,159,128,85,42,5,0,0,0,3,37,
+    75,109,149,146,106,67,28,1,0,0,0,0,10,47,86,128,156,128,93,57,17,0,21,64,
+    106,149,149,106,64,21,0,0,0,0,0,0,21,64,106,149,149,106,64,21,1,28,65,103,
+    135,159,135,106,77,77,103,120,128,128,120,103,120,128,120,89,109,146,152,120,83,41,6,10,
+    47,86,128,158,135,103,65,32,7,1,1,7,32,65,103,135,158,128,86,47,10,0,0,0,
+    0,21,62,103,135,158,128,85,42,6,0,0,6,42,85,128,158,135,103,62,21,0,0,0,
+    0,21,64,106,149,149,106,67,67,106,149,149,106,74,103,135,143,109,77,46,10,0,0,0,
+    0,0,0,0,0,21,64,106,146,152,120,92,62,32,11,17,20,10,1,5,5,5,1,0,
+    0,0,17,57,93,128,156,128,86,47,10,10,47,86,128,156,128,93,57,17,0,1,10,20,
+    26,37,42,42,42,57,77,109,149,146,106,64,21,0,10,47,86,128,156,128,93,83,85,85,
+    85,75,57,37,17,1,0,0,5,42,85,128,156,128,93,65,47,47,65,93,128,156,128,85,
+    42,5,21,64,106,149,149,106,67,28,2,28,67,106,149,170,128,93,57,17,10,47,86,128,
+    158,135,103,65,32,7,1,0,1,6,19,46,62,57,32,4,10,47,86,128,158,135,103,65,
+    32,7,1,0,0,3,10,22,46,62,57,32,4,0,10,47,86,128,158,135,103,65,32,7,
+    1,1,7,32,65,103,135,158,128,86,47,10,21,64,106,149,149,109,77,57,42,37,22,22,
+    23,37,41,28,6,0,0,21,64,106,149,149,115,135,151,159,159,152,135,120,92,57,19,1,
+    0,0,6,37,75,106,128,146,158,159,156,146,120,128,159,128,85,42,5,21,64,106,149,149,
+    109,75,37,3,17,57,93,128,159,128,85,42,5,21,64,106,149,149,109,75,37,4,18,57,
+    93,128,156,128,85,42,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    21,64,106,149,149,106,64,21,0,0,5,42,85,128,159,128,85,42,5,0,0,0,5,42,
+    85,128,159,128,85,42,5,21,64,106,146,152,120,88,106,138,106,72,83,85,75,46,10,0,
+    0,0,0,5,42,85,128,159,128,85,42,5,0,0,0,0,0,0,5,42,85,128,159,128,
+    85,42,5,0,0,0,6,42,85,128,156,128,93,57,17,0,0,0,0,0,3,37,75,109,
+    149,146,106,64,22,0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,21,64,106,149,
+    149,106,64,21,6,41,83,120,152,146,109,77,77,106,135,152,159,159,151,135,128,159,128,85,
+    93,128,156,128,93,57,17,20,62,103,135,158,128,86,47,10,0,0,0,0,10,47,86,128,
+    158,135,103,62,20,0,0,0,3,37,75,109,149,149,109,75,37,3,0,0,3,37,75,109,
+    149,149,109,75,37,3,0,0,0,20,62,103,135,151,120,84,84,120,151,135,103,85,120,148,
+    128,93,57,28,21,20,10,1,0,0,0,0,0,17,57,93,128,159,149,120,92,62,32,6,
+    0,6,28,41,42,41,28,6,0,0,21,64,106,146,149,109,75,37,3,3,37,75,109,149,
+    146,106,64,21,0,0,0,10,46,75,85,85,85,93,109,135,154,128,93,57,17,0,20,62,
+    103,135,151,120,104,120,128,128,128,109,93,75,47,17,1,0,3,37,75,109,146,149,120,103,
+    86,86,103,120,149,146,109,75,37,3,21,64,106,149,149,106,67,28,2,28,67,106,149,176,
+    146,106,64,21,20,62,103,135,158,128,86,47,10,0,0,0,0,0,1,10,20,17,4,0,
+    20,62,103,135,158,128,86,47,10,0,1,10,20,21,21,21,25,31,29,14,1,0,20,62,
+    103,135,158,128,86,47,10,0,0,0,0,10,47,86,128,158,135,103,62,20,21,64,106,146,
+    160,135,109,93,85,75,64,62,47,37,18,1,0,0,0,21,64,106,149,152,135,148,135,128,
+    128,146,159,146,109,77,46,10,0,1,28,62,93,128,158,152,135,128,128,146,145,135,161,128,
+    85,42,5,21,64,106,149,149,106,64,22,0,6,42,85,128,159,128,85,42,5,21,64,106,
+    149,149,106,64,22,0,6,42,85,128,159,128,85,42,5,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,5,42,85,128,159,128,
+    85,42,5,0,0,0,5,42,85,128,159,128,85,42,5,21,64,106,149,149,109,80,106,138,
+    106,64,42,42,37,17,1,0,0,4,17,22,47,86,128,159,128,85,42,5,0,0,0,0,
+    0,0,5,42,85,128,159,128,85,42,21,17,4,0,17,57,93,128,156,128,85,42,6,0,
+    0,0,0,0,0,22,64,106,146,149,109,75,37,3,21,64,106,149,149,106,64,21,0,0,
+    0,0,0,0,21,64,106,149,149,106,64,21,17,57,93,128,159,128,93,70,103,135,160,149,
+    128,128,128,145,152,165,128,85,75,109,149,146,106,64,21,21,64,106,149,149,109,75,37,3,
+    0,0,0,0,3,37,75,109,149,149,106,64,21,0,0,0,6,42,85,128,158,135,103,62,
+    21,0,0,0,0,21,62,103,135,158,128,85,42,6,0,0,0,10,47,84,120,151,135,109,
+    109,135,151,120,89,106,135,146,109,75,62,64,64,62,47,28,6,0,0,0,6,32,62,92,
+    120,151,166,149,120,92,62,32,6,28,62,83,85,83,62,28,1,0,21,64,106,149,149,106,
+    64,22,0,0,22,64,106,149,149,106,64,21,0,0,0,20,62,103,128,128,128,128,146,148,
+    135,106,75,37,4,0,21,64,106,149,149,115,135,152,159,159,156,146,128,106,77,46,10,0,
+    0,18,57,92,120,146,148,135,128,128,135,148,146,120,92,57,18,0,21,64,106,146,152,120,
+    84,48,25,48,84,120,152,181,149,106,64,21,21,64,106,149,149,109,75,37,3,0,0,0,
+    0,0,0,0,0,0,0,0,21,64,106,149,149,109,75,37,3,0,17,46,62,64,64,64,
+    64,64,62,46,17,0,21,64,106,149,149,109,75,37,3,0,0,0,0,3,37,75,109,149,
+    149,106,64,21,17,57,93,128,162,163,146,128,128,109,106,103,86,75,47,17,1,0,0,21,
+    64,106,149,175,151,120,103,86,93,109,135,159,135,103,62,20,0,6,41,83,120,149,152,120,
+    103,86,93,109,135,165,169,128,85,42,5,21,64,106,149,149,106,67,28,1,10,47,86,128,
+    159,128,85,42,5,21,64,106,149,149,106,64,22,0,6,42,85,128,159,128,85,42,5,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,
+    0,0,5,42,85,128,159,128,85,42,5,0,0,0,5,42,85,128,159,128,85,42,5,20,
+    62,103,135,159,135,109,109,138,106,69,57,37,18,4,0,0,4,32,57,64,69,103,135,161,
+    128,85,42,5,0,0,0,0,0,0,5,42,85,128,159,128,93,67,64,57,32,4,21,64,
+    106,146,149,109,75,37,3,0,0,0,0,0,0,17,57,93,128,156,128,85,42,5,21,64,
+    106,149,149,106,64,21,0,0,0,0,0,0,21,64,106,149,149,106,64,21,21,64,106,146,
+    152,120,83,83,120,152,149,120,93,85,93,120,149,165,128,85,64,106,149,149,106,64,21,21,
+    64,106,149,149,106,64,22,0,0,0,0,0,0,22,64,106,149,149,106,64,21,0,0,0,
+    17,57,93,128,156,128,86,47,10,0,0,0,0,10,47,86,128,156,128,93,57,17,0,0,
+    0,1,28,65,103,135,148,149,149,148,135,103,93,128,148,120,92,84,103,106,106,103,84,62,
+    32,4,0,1,28,62,92,120,148,135,135,160,149,120,92,62,32,41,83,120,128,120,83,41,
+    5,0,21,64,106,149,149,106,64,21,0,0,21,64,106,149,149,106,64,21,0,0,0,21,
+    64,106,149,159,159,159,163,135,115,92,62,32,4,0,21,64,106,149,152,135,160,149,128,128,
+    128,149,159,135,103,65,28,1,0,10,46,77,106,122,152,162,159,159,162,152,122,106,77,46,
+    10,0,17,57,93,128,158,135,106,77,64,77,106,135,170,185,149,106,64,21,21,64,106,149,
+    149,106,64,22,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,22,
+    0,3,37,75,103,106,106,106,106,106,103,75,37,3,21,64,106,149,149,106,64,22,0,0,
+    0,0,0,0,22,64,106,149,149,106,64,21,4,37,75,106,135,152,166,169,162,149,149,135,
+    128,106,77,47,17,1,0,21,64,106,149,170,135,103,68,47,57,84,120,152,149,106,67,28,
+    1,17,57,93,128,161,135,103,68,47,57,84,120,152,169,128,85,42,5,21,64,106,146,152,
+    120,83,41,12,24,62,103,135,161,128,85,42,5,21,64,106,149,149,109,75,37,3,17,57,
+    93,128,156,128,85,42,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    21,64,106,149,149,106,64,21,0,0,5,42,85,128,159,128,85,42,5,0,0,0,5,42,
+    85,128,159,128,85,42,5,10,47,84,120,149,159,146,128,140,112,106,93,75,57,32,6,0,
+    17,57,92,106,106,120,152,149,120,83,41,5,0,0,0,0,0,0,5,41,83,120,149,149,
+    120,106,106,92,57,17,21,64,106,149,149,106,64,22,0,0,0,0,0,0,0,6,42,85,
+    128,159,128,85,42,5,21,64,106,149,149,106,64,21,0,0,0,0,0,0,21,64,106,149,
+    149,106,64,21,21,64,106,149,149,106,67,85,128,159,128,93,62,42,62,93,128,159,128,85,
+    67,106,149,149,106,64,21,21,64,106,149,149,106,64,21,0,0,0,0,0,0,21,64,106,
+    149,149,106,64,21,0,0,1,28,67,106,146,149,109,75,37,3,0,0,0,0,3,37,75,
+    109,149,146,106,67,28,1,0,0,0,10,46,77,103,120,128,128,120,103,84,109,146,135,103,
+    92,120,135,149,149,135,120,92,57,18,0,6,41,83,120,149,152,120,106,135,160,149,120,92,
+    62,57,93,128,156,128,85,42,5,0,21,64,106,149,149,106,64,21,0,0,21,64,106,149,
+    149,106,64,21,0,0,0,20,62,103,128,128,128,128,146,156,146,120,92,57,17,0,21,64,
+    106,149,177,167,149,120,93,85,93,120,149,152,120,84,47,10,1,28,65,103,135,152,152,135,
+    128,128,135,152,152,135,103,65,28,1,4,37,75,109,146,160,135,109,106,109,135,160,152,163,
+    149,106,64,21,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,0,0,0,0,0,
+    21,64,106,149,149,106,64,21,0,5,42,85,128,149,149,149,149,149,128,85,42,5,21,64,
+    106,149,149,106,64,21,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,17,47,77,
+    103,120,135,149,152,169,169,166,162,135,106,77,46,10,0,21,64,106,149,152,120,84,47,13,
+    28,65,103,135,151,120,83,41,5,21,64,106,146,152,120,84,47,13,28,65,103,135,161,128,
+    85,42,5,17,57,93,128,159,128,93,65,47,57,77,109,149,169,128,85,42,5,21,64,106,
+    149,162,128,86,49,28,37,67,106,146,149,109,75,37,3,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,5,42,85,128,159,128,
+    85,42,5,0,0,0,5,42,85,128,159,128,85,42,5,1,28,62,92,120,135,149,156,160,
+    149,146,128,109,92,62,28,1,21,64,106,143,149,152,152,120,92,62,28,1,0,0,0,0,
+    0,0,1,28,62,92,120,152,152,149,143,106,64,21,21,64,106,149,149,106,64,21,0,0,
+    0,0,0,0,0,5,42,85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,0,0,
+    0,0,0,0,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,85,128,159,128,85,
+    42,18,42,85,128,159,128,85,83,120,152,146,106,64,21,21,64,106,149,149,106,67,28,1,
+    0,0,0,0,1,28,67,106,149,149,106,64,21,0,0,6,41,83,120,151,135,103,62,21,
+    0,0,0,0,0,0,21,62,103,135,151,120,83,41,6,0,0,0,1,17,46,65,83,85,
+    85,83,72,103,135,145,120,89,109,146,148,128,128,148,146,109,75,37,4,17,57,93,128,161,
+    135,103,79,106,135,160,149,120,92,73,106,146,149,109,75,37,3,0,21,64,106,149,149,106,
+    64,21,0,0,21,64,106,149,149,106,64,21,0,0,0,10,46,75,85,85,85,93,109,135,
+    160,146,106,67,28,1,21,64,106,149,185,162,128,93,62,42,62,93,128,158,135,103,62,20,
+    10,47,84,120,152,149,120,103,86,86,103,120,149,152,120,84,47,10,0,18,57,92,120,149,
+    158,149,149,149,159,149,122,149,149,106,64,21,21,64,106,149,149,106,67,28,1,0,0,0,
+    0,0,0,0,0,0,0,0,21,64,106,149,149,106,67,28,1,5,42,85,128,149,149,149,
+    152,165,128,85,42,5,21,64,106,149,149,106,67,28,1,0,0,0,0,1,28,67,106,149,
+    149,106,64,21,0,1,17,46,65,84,103,106,120,128,128,146,162,160,135,103,65,28,1,21,
+    64,106,149,149,106,67,28,1,10,47,86,128,159,128,85,42,5,21,64,106,149,149,106,67,
+    28,1,10,47,86,128,159,128,85,42,5,6,41,83,120,152,149,120,103,86,93,109,135,159,
+    169,128,85,42,5,21,64,106,149,171,135,106,84,67,75,93,120,152,146,106,64,22,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,
+    0,0,5,42,85,128,159,128,85,42,5,0,0,0,5,42,85,128,159,128,85,42,5,0,
+    6,32,62,84,103,109,128,149,149,152,158,146,120,84,47,10,21,64,106,143,149,162,152,120,
+    92,62,28,1,0,0,0,0,0,0,1,28,62,92,120,152,152,149,143,106,64,21,21,64,
+    106,149,149,106,64,21,0,0,0,0,0,0,0,5,42,85,128,159,128,85,42,5,21,64,
+    106,149,149,106,64,21,0,0,0,0,0,0,21,64,106,149,149,106,64,21,21,64,106,149,
+    149,106,67,85,128,159,128,93,62,42,62,93,128,159,128,86,93,128,156,128,93,57,17,21,
+    64,106,146,152,120,83,41,6,0,0,0,0,6,41,83,120,152,146,106,64,21,0,0,17,
+    57,93,128,159,128,86,47,10,0,0,0,0,0,0,10,47,86,128,159,128,93,57,17,0,
+    0,0,0,1,10,28,41,42,42,52,84,120,148,128,93,93,128,153,128,94,94,128,153,128,
+    93,57,17,21,64,106,146,152,120,84,55,77,106,135,160,149,120,96,120,151,135,103,62,21,
+    0,0,21,64,106,149,149,106,67,28,1,1,28,67,106,149,149,106,64,21,0,0,0,1,
+    17,37,42,42,42,57,77,106,135,151,120,83,41,5,21,64,106,149,180,149,109,75,37,11,
+    37,75,109,149,149,106,64,21,20,62,103,135,151,120,92,65,47,47,65,92,120,151,135,103,
+    62,20,0,4,32,62,92,120,128,146,149,149,135,120,120,152,146,106,64,21,21,64,106,146,
+    152,120,83,41,6,0,0,0,0,0,0,1,5,3,0,0,21,64,106,146,152,120,83,41,
+    6,3,37,75,103,106,106,106,128,159,128,85,42,5,21,64,106,146,152,120,83,41,6,0,
+    0,0,0,6,41,83,120,152,146,106,64,21,0,0,1,10,28,47,62,67,83,85,93,109,
+    128,152,152,120,83,41,5,21,64,106,149,149,106,64,21,0,5,42,85,128,159,128,85,42,
+    5,21,64,106,149,149,106,64,21,0,5,42,85,128,159,128,85,42,5,1,28,65,103,135,
+    160,152,135,128,128,146,145,135,161,128,85,42,5,21,64,106,149,163,148,135,120,106,109,128,
+    149,152,120,92,57,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    21,64,106,149,149,106,64,21,0,0,5,42,85,128,159,128,85,42,5,0,0,0,5,42,
+    85,128,159,128,85,42,5,0,0,8,28,47,62,76,106,138,112,120,135,159,135,103,62,20,
+    17,57,92,106,109,128,152,149,120,83,41,5,0,0,0,0,0,0,5,41,83,120,149,152,
+    120,106,106,92,57,17,21,64,106,149,149,106,67,28,1,0,0,0,0,0,0,10,47,86,
+    128,159,128,85,42,5,21,64,106,149,149,106,64,21,0,0,0,0,0,0,21,64,106,149,
+    149,106,64,21,21,64,106,146,152,120,83,83,120,152,149,120,93,85,93,120,149,165,128,104,
+    120,149,146,109,75,37,4,17,57,93,128,159,128,93,57,19,1,0,0,1,19,57,93,128,
+    159,128,93,57,17,0,1,28,67,106,146,152,120,83,41,5,0,0,0,0,0,0,5,41,
+    83,120,152,146,106,67,28,1,0,0,0,0,0,1,5,9,32,65,103,135,146,109,79,106,
+    146,149,109,75,75,109,149,146,106,64,21,21,64,106,149,149,106,67,31,47,77,106,135,160,
+    149,120,135,158,128,86,47,10,0,0,20,62,103,135,151,120,83,41,6,6,41,83,120,151,
+    135,103,62,20,0,4,17,20,10,4,5,5,6,19,49,86,128,159,128,85,42,5,20,62,
+    103,135,171,149,106,64,23,0,23,64,106,149,149,106,64,21,21,64,106,149,149,106,67,32,
+    10,10,32,67,106,149,149,106,64,21,0,0,6,32,62,83,93,106,106,106,103,91,128,159,
+    128,93,57,17,17,57,93,128,159,128,93,57,19,1,0,0,0,0,6,28,41,37,17,1,
+    17,57,93,128,159,128,93,57,19,1,17,46,62,64,64,85,128,159,128,85,42,5,17,57,
+    93,128,159,128,93,57,19,1,0,0,1,19,57,93,128,159,128,93,57,17,0,4,17,20,
+    11,13,20,28,41,42,57,75,103,135,161,128,85,42,5,21,64,106,149,149,106,67,28,1,
+    10,47,86,128,159,128,85,42,5,21,64,106,149,149,106,67,28,1,10,47,86,128,159,128,
+    85,42,5,0,10,46,77,106,135,149,158,159,156,146,120,128,159,128,85,42,5,21,64,106,
+    149,149,122,148,151,149,149,158,152,135,103,65,32,4,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,5,42,85,128,159,128,
+    85,42,5,0,0,0,5,42,85,128,159,128,85,42,5,1,17,37,41,31,31,64,106,138,
+    106,85,109,149,149,106,64,21,4,32,57,64,75,103,135,161,128,85,42,5,0,0,0,0,
+    0,0,5,42,85,128,161,135,103,69,64,57,32,4,20,62,103,135,151,120,83,41,5,0,
+    0,0,0,0,0,20,62,103,135,151,120,83,41,5,21,64,106,149,149,106,64,21,0,0,
+    0,0,0,0,21,64,106,149,149,106,64,21,17,57,93,128,159,128,93,70,103,135,160,149,
+    128,128,128,145,152,166,135,135,148,146,120,92,57,18,0,6,41,83,120,152,146,109,77,47,
+    22,10,10,22,47,77,109,146,152,120,83,41,6,0,5,41,83,120,152,146,106,67,28,1,
+    0,0,0,0,0,0,1,28,67,106,146,152,120,83,41,5,0,0,0,0,0,0,0,18,
+    57,92,120,143,120,92,70,106,149,149,106,64,64,106,149,149,106,64,21,21,64,106,149,149,
+    109,75,40,26,47,77,106,135,160,152,160,146,109,75,37,3,0,0,10,47,86,128,159,128,
+    93,57,19,19,57,93,128,159,128,86,47,10,4,32,57,62,47,28,17,6,6,19,49,86,
+    128,159,128,85,42,5,10,47,86,128,169,149,109,75,37,11,37,75,109,149,149,106,64,21,
+    21,64,106,149,149,106,67,32,10,10,32,67,106,149,149,106,64,21,0,0,4,19,35,42,
+    57,64,64,64,71,103,135,151,120,83,41,6,6,41,83,120,152,146,109,77,47,22,10,5,
+    10,21,37,62,83,75,46,10,6,41,83,120,152,146,109,77,48,28,17,16,21,25,42,85,
+    128,159,128,85,42,5,6,41,83,120,152,146,109,77,47,22,10,10,22,47,77,109,146,152,
+    120,83,41,6,4,32,57,62,47,37,21,11,10,12,28,52,87,128,159,128,85,42,5,21,
+    64,106,149,152,120,83,41,12,24,62,103,135,151,120,83,41,5,21,64,106,146,152,120,83,
+    41,12,28,65,103,135,161,128,85,42,5,0,1,17,47,77,103,109,128,128,128,109,101,128,
+    156,128,85,42,5,21,64,106,149,149,109,120,135,149,149,135,120,103,77,46,10,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,
+    0,0,5,42,85,128,159,128,85,42,5,0,0,0,5,42,85,128,159,128,85,42,5,10,
+    46,75,83,67,62,66,106,138,106,80,109,149,149,106,64,21,0,4,17,22,47,86,128,159,
+    128,85,42,5,0,0,0,0,0,0,5,42,85,128,159,128,86,47,22,17,4,0,10,47,
+    86,128,159,128,86,47,10,0,0,0,0,0,1,28,67,106,149,149,106,67,28,1,21,64,
+    106,149,149,106,64,21,0,0,0,0,0,0,21,64,106,149,149,106,64,21,6,41,83,120,
+    152,146,109,77,77,106,135,152,159,159,151,135,128,164,152,146,128,109,92,62,32,4,0,1,
+    28,65,103,135,159,135,106,77,62,47,47,62,77,106,135,159,135,103,65,28,1,0,10,47,
+    86,128,159,128,93,57,17,0,0,0,0,0,0,0,0,17,57,93,128,159,128,86,47,10,
+    0,0,0,0,0,0,6,37,75,109,146,135,103,65,64,106,149,149,106,67,67,106,149,149,
+    106,64,21,20,62,103,135,158,128,94,75,57,42,60,80,106,135,171,170,128,99,65,32,6,
+    0,0,5,41,83,120,152,146,109,77,49,49,77,109,146,152,120,83,41,5,17,57,92,103,
+    84,67,57,42,42,57,77,106,135,151,120,83,41,5,5,41,83,120,152,162,128,93,62,42,
+    62,93,128,158,135,103,62,20,21,64,106,146,152,120,92,65,47,47,65,92,120,152,146,106,
+    64,21,0,4,32,57,64,62,47,42,47,65,92,120,152,146,106,67,28,1,1,28,65,103,
+    135,159,135,106,77,62,47,42,47,62,75,93,120,103,62,20,1,28,65,103,135,159,135,106,
+    84,67,57,42,42,47,62,86,128,159,128,85,42,5,1,28,65,103,135,159,135,106,77,62,
+    47,47,62,77,106,135,159,135,103,65,28,1,17,57,92,103,86,75,62,47,42,42,57,75,
+    103,135,158,128,85,42,5,21,64,106,149,169,128,93,65,47,57,77,109,149,149,106,67,28,
+    1,17,57,93,128,159,128,93,65,47,57,84,120,152,169,128,85,42,5,0,1,28,62,83,
+    78,78,85,85,85,84,109,146,149,109,75,37,3,21,64,106,149,149,106,85,103,106,106,103,
+    84,65,46,17,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    21,64,106,149,149,106,64,21,0,0,5,42,85,128,159,128,85,42,5,0,0,0,5,42,
+    85,128,159,128,85,42,5,20,62,103,120,106,103,86,106,138,109,109,135,159,135,103,62,20,
+    0,0,0,5,42,85,128,159,128,85,42,5,0,0,0,0,0,0,5,42,85,128,159,128,
+    85,42,5,0,0,0,5,41,83,120,151,135,103,62,21,0,0,0,0,0,6,41,83,120,
+    151,135,103,62,20,0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,21,64,106,149,
+    149,106,64,21,1,28,65,103,135,159,135,103,70,77,103,120,128,128,120,103,120,128,120,106,
+    93,75,57,32,6,0,0,0,10,47,84,120,149,160,135,109,103,86,86,103,109,135,160,149,
+    120,84,47,10,0,0,21,62,103,135,151,120,83,41,6,0,0,0,0,0,0,0,0,6,
+    41,83,120,151,135,103,62,21,0,0,0,0,0,1,28,62,93,128,145,120,84,47,62,103,
+    135,151,120,84,84,120,151,135,103,62,20,10,47,84,120,152,149,128,109,93,85,93,106,120,
+    149,167,167,149,120,92,62,32,6,0,1,28,65,103,135,159,135,106,86,86,106,135,159,135,
+    103,65,28,1,21,64,106,133,120,106,93,85,85,93,109,135,160,146,106,67,28,1,1,28,
+    65,103,135,166,149,120,93,85,93,120,149,152,120,84,47,10,17,57,93,128,159,149,120,103,
+    86,86,103,120,149,159,128,93,57,17,0,17,57,92,106,103,86,85,86,103,120,149,152,120,
+    92,57,17,0,0,10,47,84,120,149,160,135,109,103,86,85,86,103,109,128,140,106,64,21,
+    0,10,47,84,120,149,160,135,120,106,93,85,85,86,103,109,135,161,128,85,42,5,0,10,
+    47,84,120,149,160,135,109,103,86,86,103,109,135,160,149,120,84,47,10,0,21,64,106,133,
+    128,109,103,86,85,85,93,109,128,152,146,109,75,37,3,21,64,106,149,172,148,120,103,86,
+    93,109,135,156,135,103,62,20,0,6,41,83,120,149,149,120,103,86,93,109,135,165,169,128,
+    85,42,5,0,5,41,83,120,109,103,86,85,93,109,135,159,135,103,62,21,0,21,64,106,
+    149,149,106,66,62,64,64,62,47,28,10,1,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,5,42,85,128,159,128,
+    85,42,5,0,0,0,5,42,85,128,159,128,85,42,5,21,64,106,143,149,135,128,128,143,
+    128,146,160,149,120,84,47,10,0,0,0,5,42,85,128,159,128,85,42,5,0,0,0,0,
+    0,0,5,42,85,128,159,128,85,42,5,0,0,0,1,28,67,106,146,149,109,75,37,3,
+    0,0,0,0,17,57,93,128,156,128,86,47,10,0,21,64,106,149,149,106,64,21,3,0,
+    0,0,0,3,21,64,106,149,149,106,64,21,0,10,47,84,120,149,152,120,103,77,70,83,
+    85,85,83,70,83,90,97,103,77,50,21,4,0,0,0,0,1,28,62,92,120,149,159,149,
+    135,128,128,135,149,160,149,120,92,62,28,1,0,3,37,75,109,149,149,106,67,28,1,0,
+    0,0,0,0,0,0,0,1,28,67,106,149,149,109,75,37,3,0,0,0,0,10,47,84,
+    120,145,128,93,62,28,47,84,120,151,135,109,109,135,151,120,84,47,10,1,28,65,103,135,
+    152,159,146,128,128,128,146,152,159,135,135,160,149,120,92,62,28,1,0,10,47,84,120,149,
+    160,135,128,128,135,160,149,120,84,47,10,0,21,64,106,149,152,146,128,128,128,128,146,159,
+    149,120,92,57,17,0,0,10,47,84,120,149,166,149,128,128,128,149,159,135,103,65,28,1,
+    4,37,75,106,135,160,152,135,128,128,135,152,160,135,106,75,37,4,0,21,64,106,143,135,
+    128,128,128,135,152,152,135,103,65,32,4,0,0,1,28,62,92,120,149,159,149,135,128,128,
+    128,135,149,158,146,106,64,21,0,1,28,62,92,120,146,158,152,146,128,128,128,128,135,149,
+    154,146,120,83,41,5,0,1,28,62,92,120,149,159,149,135,128,128,135,149,159,149,120,92,
+    62,28,1,0,21,64,106,149,159,149,135,128,128,128,128,146,159,149,120,92,57,18,0,21,
+    64,106,149,152,135,148,135,128,128,146,159,146,109,77,46,10,0,1,28,62,93,128,158,152,
+    135,128,128,146,145,135,161,128,85,42,5,0,5,42,85,128,149,135,128,128,128,146,160,149,
+    120,84,47,10,0,21,64,106,149,149,106,64,27,21,21,20,10,1,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,
+    0,0,5,42,85,128,159,128,85,42,5,0,0,3,12,47,86,128,159,128,85,42,5,20,
+    62,103,135,149,151,159,159,164,159,152,146,120,92,62,28,1,0,0,0,5,42,85,128,159,
+    128,85,42,21,17,4,0,0,4,17,21,42,85,128,159,128,85,42,5,0,0,0,0,17,
+    57,93,128,156,128,86,47,10,0,0,0,1,28,67,106,146,149,109,75,37,3,0,21,64,
+    106,149,149,106,64,42,37,17,1,1,17,37,42,64,106,149,149,106,64,21,0,1,28,62,
+    92,120,149,152,135,109,93,83,67,64,64,75,93,109,128,135,103,62,20,0,0,0,0,0,
+    0,6,32,62,92,120,135,149,158,159,159,162,179,152,120,92,62,32,6,0,0,10,47,86,
+    128,158,135,103,62,20,0,0,0,0,0,0,0,0,0,0,20,62,103,135,158,128,86,47,
+    10,0,0,0,0,20,62,103,135,146,109,75,37,6,28,65,103,135,148,149,149,148,135,103,
+    65,28,1,0,10,46,77,103,120,146,152,159,159,159,152,146,128,106,106,135,149,140,120,83,
+    41,5,0,1,28,62,92,120,146,151,159,159,151,146,120,92,62,28,1,0,20,62,103,135,
+    149,152,159,159,159,156,149,135,120,92,62,32,4,0,0,1,28,62,92,120,135,152,159,159,
+    156,146,128,106,77,46,10,0,0,17,47,77,106,135,149,158,159,159,158,149,135,106,77,47,
+    17,0,0,21,64,106,143,158,159,159,159,151,146,120,103,77,46,10,0,0,0,0,6,32,
+    62,92,120,135,149,158,159,159,159,158,149,135,120,92,57,17,0,0,6,32,62,92,109,128,
+    146,152,159,159,159,159,151,146,128,109,92,62,28,1,0,0,6,32,62,92,120,135,149,158,
+    159,159,158,149,135,120,92,62,32,6,0,0,20,62,103,128,146,149,158,159,159,159,156,149,
+    146,120,92,62,32,4,0,21,64,106,143,143,115,135,151,159,159,152,135,120,92,57,19,1,
+    0,0,6,37,75,106,128,146,158,159,156,146,120,128,149,128,85,42,5,0,5,41,83,120,
+    146,151,159,159,159,152,146,120,92,62,28,1,0,21,64,106,149,149,106,64,21,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    21,64,106,149,149,106,64,21,0,4,17,42,85,128,159,128,85,42,5,1,17,37,42,65,
+    103,135,158,128,85,42,5,10,46,77,103,106,120,128,128,143,128,120,106,92,62,32,6,0,
+    0,0,0,5,42,85,128,159,128,93,67,64,57,32,4,4,32,57,64,67,93,128,159,128,
+    85,42,5,0,0,0,0,6,41,83,120,151,135,103,65,28,1,0,0,10,47,84,120,151,
+    135,103,62,21,0,0,21,64,106,149,149,106,85,85,75,46,10,10,46,75,85,85,106,149,
+    149,106,64,21,0,0,6,32,62,92,120,149,159,146,128,120,106,106,106,109,128,146,158,146,
+    106,64,21,0,0,0,0,0,0,0,6,32,62,84,103,109,128,128,128,135,163,152,120,92,
+    62,32,6,0,0,20,62,103,135,156,128,86,47,10,0,0,0,0,0,0,0,0,0,0,
+    10,47,86,128,156,135,103,62,20,0,0,0,0,20,62,103,128,120,92,57,18,0,10,46,
+    77,103,120,128,128,120,103,77,46,10,0,0,1,17,46,65,92,106,120,128,128,128,120,106,
+    93,75,77,103,106,106,103,75,37,3,0,0,6,32,62,92,106,120,128,128,120,106,92,62,
+    32,6,0,0,10,46,77,103,106,120,128,128,128,128,109,103,84,62,32,6,0,0,0,0,
+    6,32,62,84,103,120,128,128,128,109,93,75,47,17,1,0,0,1,17,47,77,103,109,128,
+    128,128,128,109,103,77,47,17,1,0,0,17,57,92,109,128,128,128,128,120,106,92,65,46,
+    17,1,0,0,0,0,0,6,32,62,84,103,109,128,128,128,128,128,109,103,84,62,32,4,
+    0,0,0,6,32,57,75,93,106,120,128,128,128,128,120,106,93,75,57,32,6,0,0,0,
+    0,6,32,62,84,103,109,128,128,128,128,109,103,84,62,32,6,0,0,0,10,46,75,93,
+    106,109,128,128,128,128,128,109,106,92,62,32,6,0,0,17,57,92,106,106,92,103,120,128,
+    128,120,103,84,62,32,4,0,0,0,0,17,47,75,93,109,128,128,128,109,92,103,106,103,
+    75,37,3,0,1,28,62,92,106,120,128,128,128,120,106,92,62,32,6,0,0,20,62,103,
+    128,128,103,62,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,4,32,57,67,93,128,159,128,
+    85,42,5,10,46,75,85,93,120,152,149,109,75,37,3,1,17,46,62,67,83,85,106,138,
+    106,83,67,57,32,6,0,0,0,0,0,5,42,85,128,159,149,120,106,106,92,57,17,17,
+    57,92,106,106,120,149,159,128,85,42,5,0,0,0,0,1,28,65,103,135,151,120,84,48,
+    17,0,4,32,65,103,135,151,120,84,47,10,0,0,21,64,106,149,152,128,128,128,103,62,
+    20,20,62,103,128,128,128,152,149,106,64,21,0,0,0,6,32,62,92,120,135,152,159,152,
+    149,149,149,149,156,152,135,120,92,57,17,0,0,0,0,0,0,0,0,6,28,47,62,75,
+    85,85,86,106,135,160,149,120,92,62,28,1,0,20,62,103,128,128,106,75,37,3,0,0,
+    0,0,0,0,0,0,0,0,3,37,75,106,128,128,103,62,20,0,0,0,0,10,46,75,
+    85,83,62,32,4,0,1,17,46,65,83,85,85,83,65,46,17,1,0,0,0,1,10,32,
+    57,67,83,85,85,85,83,67,57,37,46,62,64,64,62,46,17,0,0,0,0,6,32,57,
+    67,83,85,85,83,67,57,32,6,0,0,0,1,17,46,62,67,83,85,85,85,85,75,62,
+    47,28,6,0,0,0,0,0,0,6,28,47,65,83,85,85,85,75,57,37,17,1,0,0,
+    0,0,1,17,46,62,75,85,85,85,85,75,62,46,17,1,0,0,0,4,32,57,75,85,
+    85,85,85,83,67,57,32,10,1,0,0,0,0,0,0,0,6,28,47,62,75,85,85,85,
+    85,85,75,62,47,28,6,0,0,0,0,0,4,18,37,57,67,83,85,85,85,85,83,67,
+    57,37,18,4,0,0,0,0,0,0,6,28,47,62,75,85,85,85,85,75,62,47,28,6,
+    0,0,0,0,1,17,37,57,64,75,85,85,85,85,85,75,64,57,32,6,0,0,0,4,
+    32,57,64,64,57,65,83,85,85,83,65,47,28,6,0,0,0,0,0,1,17,37,57,75,
+    85,85,85,75,57,62,64,62,46,17,0,0,0,6,32,57,67,83,85,85,85,83,67,57,
+    32,6,0,0,0,10,46,75,85,85,75,46,10,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,
+    17,57,92,106,120,149,152,120,83,41,5,20,62,103,128,128,149,160,135,103,62,21,0,0,
+    1,10,20,28,41,64,106,138,106,64,30,17,4,0,0,0,0,0,0,3,37,75,109,146,
+    165,152,149,143,106,64,21,21,64,106,143,149,152,165,146,109,75,37,3,0,0,0,0,0,
+    10,47,84,120,151,135,106,75,37,3,17,57,92,120,151,135,103,65,28,1,0,0,21,64,
+    106,149,165,159,159,149,106,64,21,21,64,106,149,159,159,165,149,106,64,21,0,0,0,0,
+    6,32,62,84,103,120,128,146,149,149,149,146,128,120,103,84,62,32,4,0,0,0,0,0,
+    0,0,0,0,1,10,21,37,42,42,49,77,106,135,149,140,120,83,41,5,0,10,46,75,
+    85,85,75,47,17,0,0,0,0,0,0,0,0,0,0,0,0,17,47,75,85,85,75,46,
+    10,0,0,0,0,1,17,37,42,41,28,6,0,0,0,1,10,28,41,42,42,41,28,10,
+    1,0,0,0,0,0,0,4,17,28,41,42,42,42,41,28,17,4,10,20,21,21,20,10,
+    1,0,0,0,0,0,4,17,28,41,42,42,41,28,17,4,0,0,0,0,0,1,10,20,
+    28,41,42,42,42,42,37,21,10,1,0,0,0,0,0,0,0,0,1,10,28,41,42,42,
+    42,37,18,4,0,0,0,0,0,0,0,1,10,21,37,42,42,42,42,37,21,10,1,0,
+    0,0,0,0,4,18,37,42,42,42,42,41,28,17,4,0,0,0,0,0,0,0,0,0,
+    0,1,10,21,37,42,42,42,42,42,37,21,10,1,0,0,0,0,0,0,0,0,4,17,
+    28,41,42,42,42,42,41,28,17,4,0,0,0,0,0,0,0,0,0,1,10,21,37,42,
+    42,42,42,37,21,10,1,0,0,0,0,0,0,0,4,17,22,37,42,42,42,42,42,37,
+    22,17,4,0,0,0,0,0,4,17,21,21,17,28,41,42,42,41,28,10,1,0,0,0,
+    0,0,0,0,0,4,18,37,42,42,42,37,18,20,21,20,10,1,0,0,0,0,4,17,
+    28,41,42,42,42,41,28,17,4,0,0,0,0,1,17,37,42,42,37,17,1,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    21,64,106,149,149,106,64,21,21,64,106,143,152,160,135,103,65,28,1,21,64,106,149,159,
+    152,135,106,77,46,10,0,0,0,0,0,1,21,64,106,138,106,64,21,0,0,0,0,0,
+    0,0,0,0,18,57,92,120,128,146,149,143,106,64,21,21,64,106,143,149,146,128,120,92,
+    57,18,0,0,0,0,0,0,1,28,65,103,128,128,120,83,41,5,20,62,103,128,128,120,
+    84,47,10,0,0,0,20,62,103,128,128,128,128,128,103,62,20,20,62,103,128,128,128,128,
+    128,103,62,20,0,0,0,0,0,6,28,47,65,83,93,106,106,106,106,106,93,83,65,47,
+    28,6,0,0,0,0,0,0,0,0,0,0,0,0,0,3,5,5,17,47,77,103,106,106,
+    103,75,37,3,0,1,17,37,42,42,37,17,1,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,17,37,42,42,37,17,1,0,0,0,0,0,0,3,5,5,1,0,0,0,0,0,
+    0,1,5,5,5,5,1,0,0,0,0,0,0,0,0,0,0,1,5,5,5,5,5,1,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,5,5,5,5,1,0,0,
+    0,0,0,0,0,0,0,0,1,5,5,5,5,5,3,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,1,5,5,5,5,3,0,0,0,0,0,0,0,0,0,0,0,0,3,5,
+    5,5,5,3,0,0,0,0,0,0,0,0,0,0,3,5,5,5,5,5,1,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,3,5,5,5,5,5,3,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,1,5,5,5,5,5,5,1,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,3,5,5,5,5,3,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,3,5,5,5,5,5,3,0,0,0,0,0,0,0,0,0,0,0,0,0,1,5,5,
+    5,5,1,0,0,0,0,0,0,0,0,0,0,0,0,3,5,5,5,3,0,0,0,0,
+    0,0,0,0,0,0,0,0,1,5,5,5,5,5,1,0,0,0,0,0,0,0,0,3,
+    5,5,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,21,64,106,143,149,135,106,77,
+    46,10,0,20,62,103,128,128,120,103,77,47,17,1,0,0,0,0,0,0,17,57,92,106,
+    92,57,17,0,0,0,0,0,0,0,0,0,4,32,62,83,93,106,106,106,92,57,17,17,
+    57,92,106,106,106,93,83,62,32,4,0,0,0,0,0,0,0,10,46,75,85,85,83,62,
+    28,1,10,46,75,85,85,83,62,28,1,0,0,0,10,46,75,85,85,85,85,85,75,46,
+    10,10,46,75,85,85,85,85,85,75,46,10,0,0,0,0,0,0,1,10,28,41,57,64,
+    64,64,64,64,57,41,28,10,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,1,17,46,62,64,64,62,46,17,0,0,0,0,3,5,5,3,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,3,5,5,3,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,143,143,106,64,21,
+    17,57,92,106,106,103,77,47,17,1,0,10,46,75,85,85,83,65,46,17,1,0,0,0,
+    0,0,0,0,4,32,57,64,57,32,4,0,0,0,0,0,0,0,0,0,0,6,28,41,
+    57,64,64,64,57,32,4,4,32,57,64,64,64,57,41,28,6,0,0,0,0,0,0,0,
+    0,1,17,37,42,42,41,28,6,0,1,17,37,42,42,41,28,6,0,0,0,0,1,17,
+    37,42,42,42,42,42,37,17,1,1,17,37,42,42,42,42,42,37,17,1,0,0,0,0,
+    0,0,0,0,1,6,17,21,21,21,21,21,17,6,1,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,10,20,21,21,20,10,1,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    17,57,92,106,106,92,57,17,4,32,57,64,64,62,46,17,1,0,0,1,17,37,42,42,
+    41,28,10,1,0,0,0,0,0,0,0,0,0,4,17,21,17,4,0,0,0,0,0,0,
+    0,0,0,0,0,0,1,6,17,21,21,21,17,4,0,0,4,17,21,21,21,17,6,1,
+    0,0,0,0,0,0,0,0,0,0,0,3,5,5,5,1,0,0,0,0,3,5,5,5,
+    1,0,0,0,0,0,0,0,3,5,5,5,5,5,3,0,0,0,0,3,5,5,5,5,
+    5,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,4,32,57,64,64,57,32,4,0,4,17,21,21,20,10,1,
+    0,0,0,0,0,3,5,5,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,17,21,21,17,4,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,4,17,21,21,21,17,4,5,5,5,1,0,0,0,0,0,3,6,17,
+    21,21,21,21,17,6,1,0,0,0,0,0,0,1,10,20,21,21,21,21,21,21,21,21,
+    21,17,4,0,0,0,0,0,0,1,6,17,21,21,21,20,10,1,0,0,0,0,0,4,
+    17,21,21,17,4,0,0,0,0,0,1,10,20,21,20,10,1,0,0,0,0,0,0,1,
+    10,20,21,21,21,17,4,0,0,4,17,21,21,17,4,0,0,0,0,0,0,0,0,0,
+    0,0,4,17,21,21,17,4,0,0,4,17,21,21,17,4,0,0,0,0,0,0,0,0,
+    0,0,0,0,4,17,21,21,17,4,0,0,4,17,21,21,20,10,1,0,0,0,1,10,
+    20,21,21,17,4,0,0,4,17,21,21,20,10,1,0,0,0,0,0,0,0,0,1,10,
+    20,21,20,10,4,17,21,21,17,4,0,0,0,0,0,0,0,3,6,17,21,21,21,17,
+    4,0,0,0,0,0,0,0,0,0,0,0,0,0,1,10,20,21,21,20,10,1,0,0,
+    0,0,4,17,21,21,21,21,21,21,21,21,21,21,21,20,10,1,0,0,0,0,0,0,
+    0,0,1,10,20,21,21,20,10,1,0,0,0,0,0,0,0,0,4,17,21,21,21,21,
+    21,21,21,21,20,10,3,0,0,0,0,0,0,4,17,21,21,21,21,21,21,21,21,17,
+    6,1,0,0,0,0,0,0,0,0,4,17,21,21,21,21,21,21,21,21,21,21,21,20,
+    10,1,0,0,4,17,21,21,21,21,21,21,21,21,21,21,17,4,0,0,4,17,21,21,
+    17,4,0,0,0,0,0,1,10,20,21,20,10,1,0,0,4,17,21,21,17,4,0,0,
+    4,17,21,21,17,4,0,0,0,0,4,17,21,21,21,17,4,0,0,0,4,17,21,21,
+    17,4,0,0,0,0,0,0,0,0,0,0,0,4,17,21,21,21,20,10,1,0,0,0,
+    0,1,10,20,21,21,21,17,4,0,0,4,17,21,21,21,17,4,0,0,0,0,4,17,
+    21,21,17,4,0,0,4,17,21,21,21,21,21,21,21,20,10,3,0,0,0,0,0,0,
+    4,17,21,21,21,21,21,21,21,21,17,4,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,4,18,37,57,64,64,64,57,37,41,42,41,28,
+    6,0,0,4,18,37,42,57,64,64,64,64,57,41,28,6,0,0,0,0,0,17,46,62,
+    64,64,64,64,64,64,64,64,64,57,32,4,0,0,0,1,10,28,41,57,64,64,64,62,
+    47,28,6,0,0,0,4,32,57,64,64,57,32,4,0,0,0,0,17,46,62,64,62,46,
+    17,0,0,0,0,0,6,28,47,62,64,64,64,57,32,4,4,32,57,64,64,57,32,4,
+    0,0,0,0,0,0,0,0,0,4,32,57,64,64,57,32,4,4,32,57,64,64,57,32,
+    4,0,0,0,0,0,0,0,0,0,0,4,32,57,64,64,57,32,4,4,32,57,64,64,
+    62,46,17,0,0,0,17,46,62,64,64,57,32,4,4,32,57,64,64,62,46,17,0,0,
+    0,0,0,0,0,0,17,46,62,64,62,46,32,57,64,64,57,32,4,0,0,0,0,4,
+    18,37,42,57,64,64,64,57,32,4,0,0,0,0,0,0,0,0,0,0,0,1,17,46,
+    62,64,64,62,46,17,0,0,0,4,32,57,64,64,64,64,64,64,64,64,64,64,64,62,
+    46,17,0,0,0,0,0,0,0,0,17,46,62,64,64,62,46,17,0,0,0,0,0,0,
+    0,4,32,57,64,64,64,64,64,64,64,64,62,47,37,17,1,0,0,0,4,32,57,64,
+    64,64,64,64,64,64,64,57,41,28,17,4,0,0,0,0,0,4,32,57,64,64,64,64,
+    64,64,64,64,64,64,64,62,46,17,0,4,32,57,64,64,64,64,64,64,64,64,64,64,
+    57,32,4,4,32,57,64,64,57,32,4,0,0,0,0,17,46,62,64,62,46,17,0,4,
+    32,57,64,64,57,32,4,4,32,57,64,64,57,32,4,0,0,6,32,57,64,64,64,57,
+    32,4,0,4,32,57,64,64,57,32,4,0,0,0,0,0,0,0,0,0,4,32,57,64,
+    64,64,62,46,17,0,0,0,0,17,46,62,64,64,64,57,32,4,4,32,57,64,64,64,
+    57,32,6,0,0,4,32,57,64,64,57,32,4,4,32,57,64,64,64,64,64,64,64,62,
+    47,37,18,4,0,0,0,4,32,57,64,64,64,64,64,64,64,64,57,37,18,4,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,32,57,75,93,106,
+    106,106,93,75,83,85,83,62,28,1,4,32,57,75,85,93,106,106,106,106,93,83,62,32,
+    6,0,0,0,3,37,75,103,106,106,106,106,106,106,106,106,106,92,57,17,0,0,1,17,
+    46,65,83,93,106,106,106,103,84,62,32,6,0,0,17,57,92,106,106,92,57,17,0,0,
+    0,3,37,75,103,106,103,75,37,3,0,0,0,6,32,62,84,103,106,106,106,92,57,17,
+    17,57,92,106,106,92,57,17,0,0,0,0,0,0,0,0,0,17,57,92,106,106,92,57,
+    17,17,57,92,106,106,92,57,17,0,0,0,0,0,0,0,0,0,0,17,57,92,106,106,
+    92,57,17,17,57,92,106,106,103,75,37,3,0,3,37,75,103,106,106,92,57,17,17,57,
+    92,106,106,103,75,37,3,0,0,0,0,0,0,3,37,75,103,106,103,75,57,92,106,106,
+    92,57,17,0,0,0,4,32,57,75,85,93,106,106,106,92,57,17,0,0,0,0,0,0,
+    0,0,0,0,0,17,47,77,103,106,106,103,75,37,3,0,0,17,57,92,106,106,106,106,
+    106,106,106,106,106,106,106,103,75,37,3,0,0,0,0,0,0,4,37,75,103,106,106,103,
+    75,37,4,0,0,0,0,0,0,17,57,92,106,106,106,106,106,106,106,106,103,86,75,47,
+    17,1,0,0,17,57,92,106,106,106,106,106,106,106,106,93,83,67,57,32,6,0,0,0,
+    0,17,57,92,106,106,106,106,106,106,106,106,106,106,106,103,75,37,3,17,57,92,106,106,
+    106,106,106,106,106,106,106,106,92,57,17,17,57,92,106,106,92,57,17,0,0,0,3,37,
+    75,103,106,103,75,37,3,17,57,92,106,106,92,57,17,17,57,92,106,106,92,57,17,0,
+    6,32,62,92,106,106,106,92,57,17,0,17,57,92,106,106,92,57,17,0,0,0,0,0,
+    0,0,0,0,17,57,92,106,106,106,103,75,37,4,0,0,4,37,75,103,106,106,106,92,
+    57,17,17,57,92,106,106,106,92,62,28,1,0,17,57,92,106,106,92,57,17,17,57,92,
+    106,106,106,106,106,106,106,103,86,75,57,32,6,0,0,17,57,92,106,106,106,106,106,106,
+    106,106,93,75,57,32,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,28,62,92,109,128,146,149,146,128,106,120,128,120,83,41,5,17,57,92,109,128,128,
+    146,149,149,146,128,120,92,62,32,6,0,0,5,42,85,128,149,149,149,149,149,149,149,149,
+    143,106,64,21,0,0,10,46,77,103,120,128,146,149,149,135,120,92,62,32,4,0,21,64,
+    106,143,143,106,64,21,0,0,0,5,42,85,128,149,128,85,42,5,0,0,1,28,62,92,
+    120,135,149,149,143,106,64,21,21,64,106,143,143,106,64,21,0,0,0,0,0,0,0,0,
+    0,21,64,106,143,143,106,64,21,21,64,106,143,143,106,64,21,0,0,0,0,0,0,0,
+    0,0,0,21,64,106,143,143,106,64,21,20,62,103,133,149,128,86,47,10,0,10,47,86,
+    128,149,133,103,62,20,21,64,106,143,149,128,85,42,5,0,0,0,0,0,0,5,42,85,
+    128,149,128,85,67,106,143,140,106,64,21,0,0,0,17,57,92,109,128,128,146,149,143,106,
+    64,21,0,0,0,0,0,0,0,0,0,0,6,37,75,106,135,149,149,128,85,42,5,0,
+    0,21,64,106,143,149,149,149,149,149,149,149,149,149,149,128,85,42,5,0,0,0,0,0,
+    0,17,57,93,128,149,149,128,93,57,17,0,0,0,0,0,0,21,64,106,143,149,149,149,
+    149,149,149,149,135,128,106,77,47,17,0,0,21,64,106,143,149,149,149,149,149,149,146,128,
+    120,106,92,62,32,6,0,0,0,21,64,106,143,149,149,149,149,149,149,149,149,149,149,128,
+    85,42,5,21,64,106,143,149,149,149,149,149,149,149,149,143,106,64,21,21,64,106,143,143,
+    106,64,21,0,0,0,5,42,85,128,149,128,85,42,5,21,64,106,143,143,106,64,21,21,
+    64,106,143,143,106,64,21,6,32,62,92,120,146,146,133,103,62,20,0,21,64,106,143,143,
+    106,64,21,0,0,0,0,0,0,0,0,0,21,64,106,143,149,149,128,93,57,17,0,0,
+    17,57,93,128,149,149,143,106,64,21,21,64,106,143,149,146,120,84,47,10,0,21,64,106,
+    143,143,106,64,21,21,64,106,143,149,149,149,149,149,149,135,128,109,92,62,28,1,0,21,
+    64,106,143,149,149,149,149,149,149,146,128,109,92,62,32,4,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,17,48,84,120,146,158,152,149,149,153,135,128,159,128,85,
+    42,5,21,64,106,143,158,159,152,149,149,149,156,149,120,92,62,28,1,0,5,42,85,128,
+    165,152,149,149,149,149,149,149,143,106,64,21,0,0,20,62,103,135,151,156,149,149,149,158,
+    149,120,92,57,18,0,21,64,106,149,149,106,64,21,0,0,0,5,42,85,128,159,128,85,
+    42,5,0,0,10,47,84,120,149,151,149,149,143,106,64,21,21,64,106,149,149,106,64,21,
+    5,5,5,3,0,0,0,0,0,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,
+    21,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,10,47,86,128,158,
+    135,103,65,28,2,28,65,103,135,158,128,86,47,10,21,64,106,149,170,128,85,42,5,0,
+    0,0,0,0,0,10,47,86,128,156,128,85,83,120,151,128,93,57,17,0,0,0,21,64,
+    106,143,156,156,149,163,149,106,64,21,0,0,0,0,0,0,0,0,0,1,28,62,93,128,
+    154,152,165,128,85,42,5,0,0,21,64,106,143,149,149,149,149,149,149,149,149,163,152,120,
+    83,41,5,0,0,0,0,0,1,28,67,106,146,176,176,146,106,67,28,1,0,0,0,0,
+    0,21,64,106,149,163,149,149,149,149,149,149,158,159,135,106,75,37,4,0,21,64,106,149,
+    163,149,149,149,149,149,152,159,151,146,120,92,62,32,6,0,0,21,64,106,149,163,149,149,
+    149,149,149,149,149,149,149,128,85,42,5,21,64,106,149,163,149,149,149,149,149,149,149,143,
+    106,64,21,21,64,106,149,149,106,64,21,0,0,0,5,42,85,128,159,128,85,42,5,21,
+    64,106,149,149,106,64,21,21,64,106,149,149,106,64,25,32,62,92,120,149,160,135,106,77,
+    46,10,0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,0,0,21,64,106,149,
+    176,167,146,106,67,28,1,1,28,67,106,146,167,176,149,106,64,21,21,64,106,149,181,170,
+    135,103,65,28,1,21,64,106,149,149,106,64,21,21,64,106,149,163,149,149,149,149,149,151,
+    158,146,120,84,47,10,0,21,64,106,149,163,149,149,149,149,149,152,158,146,120,92,57,18,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,37,75,106,135,159,135,120,
+    106,109,128,145,152,165,128,85,42,5,21,64,106,143,135,128,120,106,106,109,128,149,149,120,
+    84,47,10,0,5,42,85,128,159,128,106,106,106,106,106,106,106,92,57,17,0,0,21,64,
+    106,143,135,128,109,106,109,128,152,146,109,75,37,3,21,64,106,149,149,106,64,21,0,0,
+    0,5,42,85,128,159,128,85,42,5,0,4,24,62,103,135,151,120,106,106,106,92,57,17,
+    21,64,106,149,149,106,64,42,42,42,42,37,18,4,0,0,0,20,62,103,128,128,103,62,
+    20,21,64,106,149,149,106,64,21,1,10,20,21,21,20,10,1,0,0,21,64,106,149,149,
+    106,64,21,3,37,75,109,146,152,120,83,41,15,47,84,120,152,146,109,75,37,3,21,64,
+    106,149,170,128,85,42,5,0,0,1,10,20,21,26,62,103,135,149,109,75,86,128,159,128,
+    85,42,21,10,1,0,21,64,106,140,128,128,115,149,149,106,64,21,0,0,0,0,0,0,
+    0,0,0,17,48,84,120,148,135,128,159,128,85,42,5,0,0,17,57,92,106,106,106,106,
+    106,106,106,106,122,152,146,106,67,28,1,0,0,0,0,0,10,47,84,120,152,152,152,152,
+    120,84,47,10,0,0,0,0,0,21,64,106,149,149,112,106,106,106,106,109,128,149,159,128,
+    93,57,17,0,21,64,106,149,149,112,106,106,106,106,120,128,135,159,149,120,92,62,28,1,
+    0,21,64,106,149,149,112,106,106,106,106,106,106,106,106,103,75,37,3,21,64,106,149,149,
+    112,106,106,106,106,106,106,106,92,57,17,21,64,106,149,149,106,64,21,0,0,0,5,42,
+    85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,46,65,
+    92,120,149,160,135,106,77,47,17,1,0,21,64,106,149,149,106,64,21,0,0,0,0,0,
+    0,0,0,0,21,64,106,149,152,135,151,120,84,47,10,10,47,84,120,151,135,152,149,106,
+    64,21,21,64,106,149,163,152,152,120,84,47,10,21,64,106,149,149,106,64,21,21,64,106,
+    149,149,112,106,106,106,106,120,135,159,135,103,65,28,1,21,64,106,149,149,112,106,106,106,
+    106,120,135,160,146,109,75,37,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    10,47,86,128,159,146,109,84,67,75,94,128,162,170,128,85,42,5,20,62,103,120,103,86,
+    83,67,64,75,94,128,158,135,103,62,20,0,5,42,85,128,159,128,85,64,64,64,64,64,
+    64,57,32,4,0,0,20,62,103,120,103,86,75,64,75,103,135,158,128,85,42,5,21,64,
+    106,149,149,106,64,21,0,0,0,5,42,85,128,159,128,85,42,5,4,32,57,69,106,149,
+    149,106,75,74,74,60,32,4,21,64,106,149,149,106,72,83,85,85,85,75,57,32,6,0,
+    0,10,46,75,85,85,75,46,10,21,64,106,149,149,106,64,21,17,46,62,64,64,62,46,
+    17,0,0,21,64,106,149,149,106,64,21,0,18,57,93,128,156,128,93,57,29,62,103,135,
+    158,128,93,57,18,0,21,64,106,149,170,128,85,42,5,0,0,17,46,62,64,64,70,106,
+    149,146,106,74,103,135,151,120,84,64,62,46,17,0,17,57,92,106,93,85,106,149,149,106,
+    64,21,0,0,0,0,0,0,0,0,6,37,75,106,135,148,120,128,159,128,85,42,5,0,
+    0,4,32,57,64,64,64,64,64,64,69,103,135,158,128,93,57,17,0,0,0,0,0,0,
+    21,62,103,135,158,128,128,158,135,103,62,21,0,0,0,0,0,21,64,106,149,149,106,69,
+    64,64,64,75,93,120,152,146,106,64,21,0,21,64,106,149,149,106,69,64,64,67,83,86,
+    106,128,152,149,120,84,47,10,0,21,64,106,149,149,106,69,64,64,64,64,64,64,64,62,
+    46,17,0,21,64,106,149,149,106,69,64,64,64,64,64,64,57,32,4,21,64,106,149,149,
+    106,64,21,0,0,0,5,42,85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,21,
+    64,106,149,149,106,66,77,103,120,149,152,135,106,77,47,17,1,0,0,21,64,106,149,149,
+    106,64,21,0,0,0,0,0,0,0,0,0,21,64,106,149,149,128,158,135,103,62,21,21,
+    62,103,135,158,128,149,149,106,64,21,21,64,106,149,149,128,158,135,103,65,28,21,64,106,
+    149,149,106,64,21,21,64,106,149,149,106,69,64,64,67,84,109,146,152,120,83,41,5,21,
+    64,106,149,149,106,69,64,64,67,84,106,135,158,128,85,42,5,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,20,62,103,135,158,128,93,57,28,40,75,109,146,165,128,85,
+    42,5,10,46,75,83,65,47,41,28,22,40,75,109,149,149,106,64,21,0,5,42,85,128,
+    159,128,85,64,64,64,57,42,35,19,4,0,0,0,10,46,75,83,65,47,37,30,54,87,
+    128,159,128,85,42,5,21,64,106,149,149,106,64,21,0,0,0,5,42,85,128,159,128,85,
+    42,5,17,57,92,106,112,149,149,112,106,106,103,75,37,3,21,64,106,149,149,106,103,120,
+    128,128,128,109,92,62,32,6,0,17,57,92,106,106,92,57,17,21,64,106,149,149,106,64,
+    28,47,77,103,106,106,103,75,37,3,0,21,64,106,149,149,106,64,21,0,4,37,75,109,
+    149,146,109,75,47,75,109,149,149,109,75,37,4,0,21,64,106,149,170,128,85,42,5,0,
+    3,37,75,103,106,106,106,120,151,128,109,106,112,149,149,112,106,106,103,75,37,3,4,32,
+    57,64,57,64,106,149,149,106,64,21,0,0,0,0,0,0,0,1,28,62,93,128,153,128,
+    99,128,159,128,85,42,5,0,0,0,4,17,21,21,21,21,22,39,75,109,149,146,109,75,
+    37,4,0,0,0,0,0,3,37,75,109,149,149,109,109,149,149,109,75,37,3,0,0,0,
+    0,21,64,106,149,149,106,64,32,32,32,47,70,106,149,149,106,64,21,0,21,64,106,149,
+    149,106,64,27,21,28,41,49,75,103,135,159,135,103,62,21,0,21,64,106,149,149,106,64,
+    32,32,32,32,32,32,32,29,14,1,0,21,64,106,149,149,106,64,32,32,32,32,32,29,
+    18,4,0,21,64,106,149,149,106,64,27,21,21,21,21,42,85,128,159,128,85,42,5,21,
+    64,106,149,149,106,64,21,21,64,106,149,149,106,80,106,135,152,149,120,103,77,47,17,1,
+    0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,0,0,21,64,106,149,
+    149,117,146,149,109,75,37,37,75,109,149,146,117,149,149,106,64,21,21,64,106,149,149,117,
+    146,152,120,84,48,28,64,106,149,149,106,64,21,21,64,106,149,149,106,64,27,21,28,57,
+    93,128,159,128,85,42,5,21,64,106,149,149,106,64,27,21,28,49,86,128,159,128,85,42,
+    5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,109,75,37,
+    4,18,57,93,128,159,128,85,42,5,1,17,37,41,28,10,5,1,1,28,67,106,149,149,
+    106,64,21,0,5,42,85,128,159,128,106,106,106,106,93,83,62,37,17,1,0,0,1,17,
+    37,41,28,15,32,57,77,106,135,151,120,83,41,5,21,64,106,149,149,106,64,21,0,0,
+    0,5,42,85,128,159,128,85,42,5,21,64,106,143,149,163,163,149,149,149,128,85,42,5,
+    21,64,106,149,149,115,135,151,159,159,158,146,120,92,62,28,1,21,64,106,143,143,106,64,
+    21,21,64,106,149,149,106,64,47,77,106,135,149,140,120,83,41,5,0,21,64,106,149,149,
+    106,64,21,0,0,21,62,103,135,158,128,86,62,93,128,158,135,103,62,21,0,0,21,64,
+    106,149,170,128,85,42,5,0,5,42,85,128,149,149,149,152,171,152,149,149,149,163,163,149,
+    149,149,128,85,42,5,0,4,17,21,26,64,106,149,149,106,64,21,0,0,0,0,0,0,
+    0,17,48,84,120,148,135,106,90,128,159,128,85,42,5,0,0,0,0,0,0,0,0,0,
+    18,57,93,128,156,128,93,57,18,0,0,0,0,0,0,10,47,86,128,158,135,103,103,135,
+    158,128,86,47,10,0,0,0,0,21,64,106,149,149,106,69,64,64,64,75,93,120,152,146,
+    106,64,21,0,21,64,106,149,149,106,64,21,0,1,5,17,46,77,109,149,149,109,75,37,
+    3,21,64,106,149,149,106,69,64,64,64,64,64,64,64,57,32,4,0,21,64,106,149,149,
+    106,69,64,64,64,64,64,57,32,4,0,21,64,106,149,149,106,69,64,64,64,64,64,64,
+    85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,21,64,106,149,149,106,106,135,160,
+    149,120,92,65,46,17,1,0,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,
+    0,0,0,0,21,64,106,149,149,109,128,156,128,93,57,57,93,128,156,128,109,149,149,106,
+    64,21,21,64,106,149,149,109,120,151,135,106,75,39,64,106,149,149,106,64,21,21,64,106,
+    149,149,106,64,21,5,13,47,86,128,159,128,85,42,5,21,64,106,149,149,106,64,27,21,
+    28,57,93,128,159,128,85,42,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    21,64,106,149,149,106,64,22,0,6,42,85,128,159,128,85,42,5,0,0,3,5,1,0,
+    0,1,17,48,84,120,151,135,103,62,20,0,5,42,85,128,161,135,146,149,149,146,128,120,
+    93,75,46,10,0,0,0,0,3,5,6,32,62,92,109,135,159,135,103,65,28,1,21,64,
+    106,149,149,106,64,21,0,0,0,5,42,85,128,159,128,85,42,5,21,64,106,143,149,163,
+    163,149,149,149,128,85,42,5,21,64,106,149,152,135,148,135,128,128,135,160,149,120,83,41,
+    6,21,64,106,149,149,106,64,21,21,64,106,149,149,106,66,77,106,135,160,149,120,92,62,
+    28,1,0,21,64,106,149,149,106,64,21,0,0,10,47,84,120,151,135,103,79,109,146,152,
+    120,84,47,10,0,0,21,64,106,149,170,128,85,42,5,0,5,42,85,128,149,149,149,163,
+    163,149,149,149,152,171,152,149,149,149,128,85,42,5,0,0,0,0,21,64,106,149,149,106,
+    64,21,0,0,0,0,0,0,6,37,75,106,135,148,120,84,85,128,159,128,85,42,5,0,
+    0,0,0,0,0,0,0,3,37,75,109,146,152,120,83,41,6,0,0,0,0,0,1,28,
+    65,103,135,151,120,84,84,120,151,135,103,65,28,1,0,0,0,21,64,106,149,149,112,106,
+    106,106,106,109,128,149,158,128,93,57,17,0,21,64,106,149,149,106,64,21,0,0,0,1,
+    22,62,103,135,158,128,85,42,5,21,64,106,149,149,112,106,106,106,106,106,106,106,106,92,
+    57,17,0,21,64,106,149,149,112,106,106,106,106,106,106,92,57,17,0,21,64,106,149,149,
+    112,106,106,106,106,106,106,106,106,128,159,128,85,42,5,21,64,106,149,149,106,64,21,21,
+    64,106,149,149,115,135,160,149,120,92,62,32,10,1,0,0,0,0,0,21,64,106,149,149,
+    106,64,21,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,120,152,146,106,67,67,
+    106,146,152,120,106,149,149,106,64,21,21,64,106,149,149,106,103,135,158,128,93,57,64,106,
+    149,149,106,64,21,21,64,106,149,149,106,64,42,42,47,68,103,135,158,128,85,42,5,21,
+    64,106,149,149,106,69,64,64,67,84,109,146,152,120,83,41,5,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,22,0,6,42,85,128,159,128,85,
+    42,5,0,0,0,0,0,0,0,10,46,77,106,135,158,128,86,47,10,0,5,42,85,128,
+    164,152,149,149,149,152,161,149,128,103,65,32,4,0,0,0,0,1,28,62,92,120,146,160,
+    149,120,84,47,10,0,21,64,106,149,149,106,64,21,0,0,0,5,42,85,128,159,128,85,
+    42,5,17,57,92,106,112,149,149,112,106,106,103,75,37,3,21,64,106,149,172,148,120,103,
+    86,86,106,135,161,128,93,57,17,21,64,106,149,149,106,64,21,21,64,106,149,149,106,80,
+    106,135,160,149,120,92,62,32,6,0,0,21,64,106,149,149,106,64,21,0,0,1,28,67,
+    106,146,152,120,94,128,158,135,103,65,28,1,0,0,21,64,106,149,170,128,85,42,5,0,
+    3,37,75,103,106,106,112,149,146,112,106,109,128,151,120,106,106,106,103,75,37,3,0,0,
+    0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,1,28,62,93,128,153,128,93,64,
+    85,128,159,128,85,42,5,0,0,0,0,0,0,0,0,10,47,86,128,158,135,103,65,28,
+    1,0,0,0,0,0,6,41,83,120,152,146,106,67,67,106,146,152,120,83,41,6,0,0,
+    0,21,64,106,149,163,149,149,149,149,149,149,162,152,128,106,75,37,4,0,21,64,106,149,
+    149,106,64,21,0,0,0,0,10,47,86,128,159,128,85,42,5,21,64,106,149,163,149,149,
+    149,149,149,149,149,149,143,106,64,21,0,21,64,106,149,163,149,149,149,149,149,149,143,106,
+    64,21,0,21,64,106,149,163,149,149,149,149,149,149,149,149,149,152,165,128,85,42,5,21,
+    64,106,149,149,106,64,21,21,64,106,149,152,135,160,149,120,92,62,32,6,0,0,0,0,
+    0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,0,0,21,64,106,149,
+    149,106,103,135,151,120,84,84,120,151,135,103,106,149,149,106,64,21,21,64,106,149,149,106,
+    85,120,152,146,109,75,64,106,149,149,106,64,21,21,64,106,149,149,106,85,85,85,86,103,
+    120,152,146,109,75,37,3,21,64,106,149,149,112,106,106,106,106,120,135,160,146,106,67,28,
+    1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,109,75,37,
+    3,18,57,93,128,159,128,85,42,5,0,0,0,0,0,0,6,32,65,103,135,159,135,106,
+    75,37,3,0,5,42,85,128,128,120,106,106,106,120,135,152,152,120,92,57,18,0,0,0,
+    0,6,41,83,120,149,166,149,120,92,62,28,1,0,21,64,106,149,149,106,64,21,0,0,
+    0,5,42,85,128,159,128,85,42,5,4,32,57,69,106,149,149,106,69,64,62,46,17,0,
+    21,64,106,149,162,128,93,65,47,49,84,120,152,146,106,64,21,21,64,106,149,149,106,64,
+    21,21,64,106,149,149,109,109,135,156,146,120,92,62,32,6,0,0,0,21,64,106,149,149,
+    106,64,21,0,0,0,17,57,93,128,158,135,112,135,158,128,86,47,10,0,0,0,21,64,
+    106,149,170,128,85,42,5,1,17,37,54,63,64,84,120,151,128,93,72,106,146,146,106,70,
+    64,64,62,46,17,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,17,
+    48,84,120,148,135,106,75,50,85,128,159,128,85,42,6,0,0,0,0,0,0,0,1,28,
+    65,103,135,158,128,86,47,10,0,0,0,0,0,0,17,57,93,128,159,128,93,57,57,93,
+    128,159,128,93,57,17,0,0,0,21,64,106,149,163,149,149,149,149,149,149,152,159,135,106,
+    77,46,10,0,21,64,106,149,149,106,64,21,0,0,0,0,5,42,85,128,159,128,85,42,
+    5,21,64,106,149,163,149,149,149,149,149,149,149,149,143,106,64,21,0,21,64,106,149,163,
+    149,149,149,149,149,149,143,106,64,21,0,21,64,106,149,163,149,149,149,149,149,149,149,149,
+    149,152,165,128,85,42,5,21,64,106,149,149,106,64,21,21,64,106,149,163,152,166,135,106,
+    77,47,17,1,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,
+    0,0,0,0,21,64,106,149,149,106,86,128,158,135,103,103,135,158,128,86,106,149,149,106,
+    64,21,21,64,106,149,149,106,74,103,135,158,128,93,70,106,149,149,106,64,21,21,64,106,
+    149,152,128,128,128,128,128,135,152,158,128,93,57,18,0,21,64,106,149,163,149,149,149,149,
+    149,152,159,146,120,92,57,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    20,62,103,135,158,128,86,49,28,40,75,109,146,165,128,85,42,5,0,0,0,0,0,6,
+    32,62,92,120,152,149,120,84,48,17,0,0,3,37,75,103,93,83,67,64,67,84,103,120,
+    152,146,109,75,37,3,0,0,0,17,57,93,128,161,135,120,92,62,32,6,0,0,21,64,
+    106,149,149,106,64,21,0,0,0,5,42,85,128,159,128,85,42,5,0,4,25,64,106,149,
+    149,106,64,27,20,10,1,0,21,64,106,149,149,109,75,37,10,28,67,106,149,149,106,64,
+    21,21,64,106,149,149,106,64,21,21,64,106,149,149,122,146,156,135,109,92,62,32,6,0,
+    0,0,0,21,64,106,149,149,106,64,21,0,0,0,4,37,75,109,149,149,122,152,146,109,
+    75,37,3,0,0,0,21,64,106,149,170,128,85,42,5,10,46,75,85,85,85,94,128,156,
+    128,90,89,120,151,128,97,85,85,75,46,16,1,0,0,0,0,0,21,64,106,149,149,106,
+    64,21,0,0,0,0,4,37,75,106,135,148,120,84,54,48,85,128,159,128,85,48,37,17,
+    1,0,0,0,0,0,6,41,83,120,152,146,109,75,37,3,0,0,0,0,0,1,28,67,
+    106,146,152,120,84,64,64,84,120,152,146,106,67,28,1,0,0,21,64,106,149,149,112,106,
+    106,106,106,106,120,135,156,135,103,65,28,1,21,64,106,149,149,106,64,21,0,0,0,0,
+    6,42,85,128,159,128,85,42,5,21,64,106,149,149,112,106,106,106,106,106,106,106,106,92,
+    57,17,0,21,64,106,149,149,112,106,106,106,106,106,106,92,57,17,0,21,64,106,149,149,
+    112,106,106,106,106,106,106,106,106,128,159,128,85,42,5,21,64,106,149,149,106,64,21,21,
+    64,106,149,149,122,149,160,135,106,77,47,17,1,0,0,0,0,0,0,21,64,106,149,149,
+    106,64,21,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,79,109,146,149,109,109,
+    149,146,109,79,106,149,149,106,64,21,21,64,106,149,149,106,66,84,120,152,146,109,79,106,
+    149,149,106,64,21,21,64,106,149,171,159,159,159,159,159,151,146,128,106,75,37,4,0,21,
+    64,106,149,163,149,149,149,149,149,162,152,122,99,70,40,7,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,10,47,86,128,158,135,106,84,67,75,94,128,162,170,128,85,
+    42,5,0,0,0,0,6,32,62,92,120,149,149,120,92,62,28,1,0,0,0,17,46,62,
+    57,41,28,21,28,47,68,103,135,158,128,85,42,5,0,0,0,21,64,106,146,152,120,87,
+    62,32,6,0,0,0,21,64,106,149,149,106,64,21,0,0,0,5,42,85,128,159,128,85,
+    42,5,0,0,21,64,106,149,149,106,64,21,0,0,0,0,21,64,106,149,149,106,64,22,
+    0,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,21,21,64,106,149,163,152,166,
+    135,106,77,57,32,6,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,21,
+    62,103,135,159,152,159,128,93,57,18,0,0,0,0,21,64,106,149,170,128,85,42,5,20,
+    62,103,128,128,128,128,149,152,128,128,128,135,162,135,128,128,128,103,62,20,0,0,0,0,
+    0,0,21,64,106,149,149,106,64,21,0,0,0,0,17,57,93,128,153,128,97,86,85,85,
+    90,128,159,128,90,85,75,46,10,0,0,0,0,0,18,57,93,128,156,128,93,57,18,0,
+    0,0,0,0,0,10,47,84,120,151,135,112,106,106,106,106,112,135,151,120,84,47,10,0,
+    0,21,64,106,149,149,106,69,64,64,64,67,84,109,146,152,120,83,41,5,21,64,106,149,
+    149,106,64,21,0,0,0,0,17,57,93,128,159,128,85,42,5,21,64,106,149,149,106,69,
+    64,64,64,64,64,64,64,57,32,4,0,21,64,106,149,149,106,69,64,64,64,64,64,57,
+    32,4,0,21,64,106,149,149,106,69,64,64,64,64,64,64,85,128,159,128,85,42,5,21,
+    64,106,149,149,106,64,21,21,64,106,149,149,109,120,149,160,135,106,77,47,17,1,0,0,
+    0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,0,0,21,64,106,149,
+    149,106,70,93,128,156,128,128,156,128,93,70,106,149,149,106,64,21,21,64,106,149,149,106,
+    64,65,103,135,158,128,93,106,149,149,106,64,21,21,64,106,149,152,128,128,128,128,128,120,
+    106,93,75,47,17,0,0,21,64,106,149,149,112,106,106,106,109,128,149,149,120,92,57,18,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,37,75,106,135,159,135,120,
+    106,109,128,145,152,165,128,85,42,5,0,0,0,6,32,62,92,120,149,149,120,92,62,32,
+    6,0,0,0,0,1,13,21,17,6,1,0,1,13,47,86,128,159,128,85,42,5,0,0,
+    0,21,64,106,149,149,106,67,30,6,0,0,0,0,21,64,106,149,149,106,64,22,0,0,
+    0,6,42,85,128,159,128,85,42,5,0,0,21,64,106,149,149,106,64,21,0,0,0,0,
+    21,64,106,149,149,106,64,21,0,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,
+    21,21,64,106,149,163,152,166,135,106,77,47,17,1,0,0,0,0,0,21,64,106,149,149,
+    106,64,21,0,0,0,0,10,47,84,120,152,179,149,109,75,37,4,0,0,0,0,21,64,
+    106,143,149,128,85,42,5,21,64,106,149,159,159,161,174,166,159,159,159,166,174,161,159,159,
+    149,106,64,21,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,21,64,
+    106,146,152,128,128,128,128,128,128,135,162,135,128,128,103,62,20,0,0,0,0,3,37,75,
+    109,146,149,109,75,37,4,0,0,0,0,0,0,21,62,103,135,166,152,149,149,149,149,149,
+    149,152,166,135,103,62,21,0,0,21,64,106,149,149,106,64,27,21,21,28,57,93,128,159,
+    128,85,42,5,21,64,106,149,149,106,64,21,0,0,0,5,32,67,106,146,152,120,83,41,
+    5,21,64,106,149,149,106,64,27,21,21,21,21,21,21,17,4,0,0,21,64,106,149,149,
+    106,64,27,21,21,21,21,17,4,0,0,21,64,106,149,149,106,64,27,21,21,21,21,42,
+    85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,21,64,106,149,149,106,92,120,149,
+    160,135,106,77,47,17,1,0,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,
+    0,0,0,0,21,64,106,149,149,106,64,83,120,152,152,152,152,120,83,64,106,149,149,106,
+    64,21,21,64,106,149,149,106,64,47,84,120,152,146,109,106,149,149,106,64,21,21,64,106,
+    149,149,106,85,85,85,85,83,67,57,37,17,1,0,0,21,64,106,149,149,106,69,64,64,
+    75,94,128,159,146,109,75,37,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,17,48,84,120,146,158,152,149,149,153,135,128,159,128,85,42,5,0,1,10,32,62,92,
+    120,149,149,120,92,62,32,6,0,0,0,0,1,17,37,41,28,10,3,0,1,12,47,86,
+    128,159,128,85,42,5,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,21,64,
+    106,149,149,109,75,37,5,0,1,18,57,93,128,156,128,85,42,5,0,0,21,64,106,149,
+    149,106,64,21,0,0,0,0,21,64,106,149,149,106,64,21,0,21,64,106,149,149,106,64,
+    21,21,64,106,149,149,106,64,21,21,64,106,149,149,122,149,160,135,106,77,47,17,1,0,
+    0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,1,28,65,103,135,162,135,103,62,
+    21,0,0,0,0,0,17,57,92,106,106,103,75,37,3,20,62,103,128,128,128,135,162,135,
+    128,128,128,152,152,128,128,128,128,103,62,20,0,0,0,0,3,5,21,64,106,149,149,106,
+    64,21,5,3,0,0,21,64,106,149,165,159,159,159,159,159,159,162,177,162,159,149,106,64,
+    21,0,0,0,0,10,47,86,128,158,135,103,62,21,0,0,0,0,0,0,4,37,75,109,
+    149,163,149,149,149,149,149,149,149,149,163,149,109,75,37,4,0,21,64,106,149,149,106,64,
+    21,5,5,13,47,86,128,159,128,85,42,5,21,64,106,149,149,106,64,21,5,10,20,32,
+    59,92,120,152,146,106,67,28,1,21,64,106,149,149,106,64,21,5,5,5,5,5,5,5,
+    1,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,0,21,64,106,149,149,
+    106,64,21,0,0,0,5,42,85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,21,
+    64,106,149,149,106,72,92,120,149,160,135,106,77,47,17,1,0,0,0,21,64,106,149,149,
+    106,64,21,5,5,5,5,5,5,3,0,0,21,64,106,149,149,106,64,67,106,146,176,171,
+    135,103,65,64,106,149,149,106,64,21,21,64,106,149,149,106,64,35,65,103,135,156,135,115,
+    149,149,106,64,21,21,64,106,149,149,106,64,42,42,42,41,28,17,4,0,0,0,0,21,
+    64,106,149,149,106,64,27,22,40,75,109,146,159,128,93,57,18,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,1,28,62,92,109,128,146,149,146,128,107,128,159,128,85,
+    42,5,1,17,46,65,92,120,149,149,120,92,62,36,23,21,17,4,0,0,10,46,75,83,
+    65,47,37,22,28,41,65,103,135,158,128,85,42,5,0,0,0,20,62,103,128,128,103,62,
+    22,0,0,0,0,0,20,62,103,135,158,128,93,57,37,22,28,44,75,109,146,149,109,75,
+    37,3,0,0,21,64,106,149,149,106,64,21,0,0,0,0,21,64,106,149,149,106,64,21,
+    0,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,21,21,64,106,149,149,109,120,
+    149,160,135,106,77,47,17,1,0,0,0,21,64,106,149,149,106,64,21,0,0,4,17,21,
+    37,75,109,146,152,120,84,47,10,0,0,0,0,0,10,46,75,85,85,83,62,28,1,10,
+    46,75,85,85,91,128,156,128,90,90,120,151,135,103,85,85,85,75,46,10,0,0,1,17,
+    37,42,42,64,106,149,149,106,64,42,42,37,17,1,20,62,103,128,128,128,128,128,128,128,
+    128,135,162,135,128,128,103,62,20,0,0,0,1,28,65,103,135,151,120,84,47,10,0,0,
+    0,0,0,0,17,57,93,128,158,135,109,106,106,106,106,106,106,109,135,158,128,93,57,17,
+    0,21,64,106,149,149,106,64,42,42,42,47,68,103,135,158,128,85,42,5,21,64,106,149,
+    149,106,64,42,42,47,62,67,92,112,146,159,128,93,57,17,0,21,64,106,149,149,106,64,
+    42,42,42,42,42,42,42,41,28,6,0,21,64,106,149,149,106,64,21,0,0,0,0,0,
+    0,0,0,21,64,106,149,149,106,64,21,0,0,0,5,42,85,128,159,128,85,42,5,21,
+    64,106,149,149,106,64,21,21,64,106,149,149,106,64,62,92,120,146,156,135,106,77,47,17,
+    1,0,0,21,64,106,149,149,106,64,42,42,42,42,42,42,42,37,17,1,21,64,106,149,
+    149,106,64,57,93,128,149,149,128,86,47,64,106,149,149,106,64,21,21,64,106,149,149,106,
+    64,25,46,77,109,146,152,122,149,149,106,64,21,21,64,106,149,149,106,64,21,5,5,5,
+    1,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,18,57,92,120,152,146,109,75,
+    37,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,32,57,75,93,106,
+    106,106,93,89,128,159,128,85,42,5,10,46,77,103,120,149,149,120,92,72,64,64,64,64,
+    57,32,4,0,20,62,103,120,103,86,75,64,67,83,93,120,152,146,109,75,37,3,0,0,
+    0,17,57,92,106,106,103,75,37,3,0,0,0,0,10,47,86,128,159,146,109,86,75,64,
+    67,83,94,128,159,146,106,64,22,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,
+    21,64,106,149,149,106,64,21,0,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,
+    21,21,64,106,149,149,106,92,120,149,160,135,106,77,47,17,1,0,0,21,64,106,149,149,
+    106,64,21,0,4,32,57,64,67,93,128,158,135,103,65,28,1,0,0,0,0,0,20,62,
+    103,128,128,120,83,41,5,1,17,37,42,63,103,135,149,109,75,85,128,159,128,86,50,42,
+    42,37,17,1,0,0,10,46,75,85,85,85,106,149,149,106,85,85,85,75,46,10,10,46,
+    75,85,85,85,85,85,85,85,90,128,159,128,90,85,75,46,10,0,0,0,10,47,84,120,
+    152,146,106,67,28,1,0,0,0,0,0,1,28,67,106,146,152,120,84,64,64,64,64,64,
+    64,84,120,152,146,106,67,28,1,21,64,106,149,149,106,85,85,85,85,86,103,120,152,149,
+    109,75,37,3,21,64,106,149,149,106,85,85,85,86,103,106,120,146,156,135,106,75,37,4,
+    0,21,64,106,149,149,106,85,85,85,85,85,85,85,85,83,62,28,1,21,64,106,149,149,
+    106,64,21,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,0,5,42,
+    85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,36,62,
+    92,109,135,156,135,106,77,47,17,1,0,21,64,106,149,149,106,85,85,85,85,85,85,85,
+    85,75,46,10,21,64,106,149,149,106,64,39,75,103,106,106,103,75,39,64,106,149,149,106,
+    64,21,21,64,106,149,149,106,64,21,19,57,93,128,158,135,152,149,106,64,21,21,64,106,
+    149,149,106,64,21,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,
+    4,32,65,103,135,158,128,93,57,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,4,18,37,57,64,64,64,59,85,128,159,128,85,42,5,20,62,103,135,152,152,
+    122,109,106,106,106,106,106,106,92,57,17,0,21,64,106,143,135,128,109,106,106,120,128,149,
+    158,128,93,57,18,0,0,0,0,21,64,106,143,149,128,85,42,5,0,0,0,0,3,37,
+    75,106,135,156,135,128,109,106,106,120,128,149,149,120,92,57,17,0,0,0,21,64,106,149,
+    149,106,64,21,0,0,0,0,21,64,106,149,149,106,64,21,0,21,64,106,149,149,106,64,
+    21,21,64,106,149,149,106,64,21,21,64,106,149,149,106,72,92,120,149,159,135,106,77,47,
+    17,1,0,21,64,106,149,149,106,64,21,0,17,57,92,106,106,120,149,159,128,86,47,10,
+    0,0,0,0,0,0,21,64,106,149,165,128,85,42,5,0,0,4,28,67,106,149,146,106,
+    70,93,128,151,120,83,41,8,5,3,0,0,0,0,20,62,103,128,128,128,128,152,152,128,
+    128,128,128,103,62,20,1,17,37,42,42,42,42,42,42,48,85,128,159,128,85,48,37,17,
+    1,0,0,0,21,62,103,135,158,128,93,57,17,0,0,0,0,0,0,6,41,83,120,152,
+    146,106,67,30,21,21,21,21,30,67,106,146,152,120,83,41,6,21,64,106,149,152,128,128,
+    128,128,128,128,135,152,159,135,103,62,21,0,21,64,106,149,152,128,128,128,128,128,135,149,
+    151,159,135,106,77,47,17,0,0,21,64,106,149,152,128,128,128,128,128,128,128,128,128,120,
+    83,41,5,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,0,21,64,106,149,149,
+    106,64,21,0,0,0,5,42,85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,21,
+    64,106,149,149,106,64,23,32,57,77,106,135,156,135,106,77,47,17,0,21,64,106,149,152,
+    128,128,128,128,128,128,128,128,128,103,62,20,21,64,106,149,149,106,64,28,46,62,64,64,
+    62,46,28,64,106,149,149,106,64,21,21,64,106,149,149,106,64,21,4,37,75,109,146,167,
+    177,149,106,64,21,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,0,0,0,21,
+    64,106,149,149,106,64,21,0,0,10,47,84,120,152,146,109,75,37,4,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,4,17,21,21,21,42,85,128,159,128,85,
+    42,5,21,64,106,149,181,163,149,149,149,149,149,149,149,143,106,64,21,0,21,64,106,146,
+    161,158,149,149,149,152,159,149,128,106,75,37,4,0,0,0,0,21,64,106,149,170,128,85,
+    42,5,0,0,0,0,0,17,47,77,106,135,158,158,149,149,149,152,159,149,120,92,62,32,
+    4,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,21,64,106,149,149,106,64,21,
+    0,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,
+    62,92,120,135,156,135,106,77,46,10,0,21,64,106,149,149,106,64,21,0,21,64,106,143,
+    149,152,160,135,106,75,37,3,0,0,0,0,0,0,21,64,106,149,165,128,85,42,5,0,
+    0,5,41,83,120,151,128,93,70,106,146,149,106,67,28,1,0,0,0,0,0,0,21,64,
+    106,149,159,159,159,165,165,159,159,159,149,106,64,21,0,0,3,5,5,5,5,5,8,42,
+    85,128,159,128,85,42,6,0,0,0,0,3,37,75,109,149,149,109,75,37,4,0,0,0,
+    0,0,0,17,57,93,128,156,128,93,57,17,0,0,0,0,17,57,93,128,156,128,93,57,
+    17,21,64,106,149,165,159,159,159,159,159,159,151,146,128,106,77,46,10,0,21,64,106,149,
+    165,159,159,159,159,159,158,149,135,128,106,77,47,17,1,0,0,21,64,106,149,165,159,159,
+    159,159,159,159,159,159,159,128,85,42,5,21,64,106,149,149,106,64,21,0,0,0,0,0,
+    0,0,0,21,64,106,149,149,106,64,21,0,0,0,5,42,85,128,159,128,85,42,5,21,
+    64,106,149,149,106,64,21,21,64,106,149,149,106,64,21,4,19,47,77,106,135,154,135,106,
+    75,37,3,21,64,106,149,165,159,159,159,159,159,159,159,159,149,106,64,21,21,64,106,149,
+    149,106,64,21,10,20,21,21,20,10,21,64,106,149,149,106,64,21,21,64,106,149,149,106,
+    64,21,0,18,57,93,128,161,170,149,106,64,21,21,64,106,149,149,106,64,21,0,0,0,
+    0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,1,28,65,103,135,158,128,
+    93,57,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,5,42,85,128,159,128,85,42,5,21,64,106,143,149,149,149,149,149,149,149,149,149,143,
+    106,64,21,0,17,57,92,120,128,135,149,149,149,146,128,120,93,75,47,17,0,0,0,0,
+    0,21,64,106,143,149,128,85,42,5,0,0,0,0,0,1,17,47,77,106,128,135,149,149,
+    149,146,128,120,92,62,32,6,0,0,0,0,21,64,106,143,143,106,64,21,0,0,0,0,
+    21,64,106,143,143,106,64,21,0,21,64,106,143,143,106,64,21,21,64,106,143,143,106,64,
+    21,21,64,106,143,143,106,64,36,62,84,106,135,146,133,103,62,20,0,21,64,106,143,143,
+    106,64,21,0,21,64,106,143,149,149,135,106,77,47,17,0,0,0,0,0,0,0,20,62,
+    103,128,128,120,83,41,5,0,0,5,41,83,120,128,120,83,62,103,128,128,103,62,20,0,
+    0,0,0,0,0,0,20,62,103,128,128,128,128,128,128,128,128,128,128,103,62,20,0,0,
+    0,0,0,0,0,0,5,41,83,120,128,120,83,41,5,0,0,0,0,5,41,83,120,128,
+    128,103,62,21,0,0,0,0,0,0,0,20,62,103,128,128,106,75,37,4,0,0,0,0,
+    4,37,75,106,128,128,103,62,20,20,62,103,128,128,128,128,128,128,128,128,120,106,93,75,
+    47,17,1,0,20,62,103,128,128,128,128,128,128,128,128,109,103,86,75,47,17,1,0,0,
+    0,20,62,103,128,128,128,128,128,128,128,128,128,128,128,120,83,41,5,20,62,103,128,128,
+    103,62,20,0,0,0,0,0,0,0,0,20,62,103,128,128,103,62,20,0,0,0,5,41,
+    83,120,128,120,83,41,5,20,62,103,128,128,103,62,20,20,62,103,128,128,103,62,20,0,
+    1,17,47,77,106,128,128,120,83,41,5,20,62,103,128,128,128,128,128,128,128,128,128,128,
+    128,103,62,20,20,62,103,128,128,103,62,20,0,0,0,0,0,0,20,62,103,128,128,103,
+    62,20,20,62,103,128,128,103,62,20,0,4,37,75,106,128,128,128,103,62,20,20,62,103,
+    128,128,103,62,20,0,0,0,0,0,0,0,0,0,0,20,62,103,128,128,103,62,20,0,
+    0,0,10,47,84,120,128,128,103,62,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,5,41,83,120,128,120,83,41,5,17,57,92,106,106,106,
+    106,106,106,106,106,106,106,106,92,57,17,0,4,32,62,83,86,103,106,106,106,106,93,83,
+    62,37,17,1,0,0,0,0,0,17,57,92,106,106,103,75,37,3,0,0,0,0,0,0,
+    1,17,47,75,86,103,106,106,106,106,93,83,62,32,6,0,0,0,0,0,17,57,92,106,
+    106,92,57,17,0,0,0,0,17,57,92,106,106,92,57,17,0,17,57,92,106,106,92,57,
+    17,17,57,92,106,106,92,57,17,17,57,92,106,106,92,57,19,28,48,77,103,106,106,92,
+    57,17,0,17,57,92,106,106,92,57,17,0,17,57,92,106,106,106,103,77,47,17,1,0,
+    0,0,0,0,0,0,10,46,75,85,85,83,62,28,1,0,0,1,28,62,83,85,83,62,
+    46,75,85,85,75,46,10,0,0,0,0,0,0,0,10,46,75,85,85,85,85,85,85,85,
+    85,85,85,75,46,10,0,0,0,0,0,0,0,0,1,28,62,83,85,83,62,28,1,0,
+    0,0,0,1,28,62,83,85,85,75,46,10,0,0,0,0,0,0,0,10,46,75,85,85,
+    75,47,17,0,0,0,0,0,0,17,47,75,85,85,75,46,10,10,46,75,85,85,85,85,
+    85,85,85,85,83,67,57,37,17,1,0,0,10,46,75,85,85,85,85,85,85,85,85,75,
+    62,47,37,17,1,0,0,0,0,10,46,75,85,85,85,85,85,85,85,85,85,85,85,83,
+    62,28,1,10,46,75,85,85,75,46,10,0,0,0,0,0,0,0,0,10,46,75,85,85,
+    75,46,10,0,0,0,1,28,62,83,85,83,62,28,1,10,46,75,85,85,75,46,10,10,
+    46,75,85,85,75,46,10,0,0,1,17,47,75,85,85,83,62,28,1,10,46,75,85,85,
+    85,85,85,85,85,85,85,85,85,75,46,10,10,46,75,85,85,75,46,10,0,0,0,0,
+    0,0,10,46,75,85,85,75,46,10,10,46,75,85,85,75,46,10,0,0,17,47,75,85,
+    85,85,75,46,10,10,46,75,85,85,75,46,10,0,0,0,0,0,0,0,0,0,0,10,
+    46,75,85,85,75,46,10,0,0,0,1,28,62,83,85,85,75,46,10,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,28,62,83,85,83,62,
+    28,1,4,32,57,64,64,64,64,64,64,64,64,64,64,64,57,32,4,0,0,6,28,41,
+    47,62,64,64,64,64,57,41,28,6,0,0,0,0,0,0,0,4,32,57,64,64,62,46,
+    17,0,0,0,0,0,0,0,0,1,17,37,47,62,64,64,64,64,57,41,28,6,0,0,
+    0,0,0,0,4,32,57,64,64,57,32,4,0,0,0,0,4,32,57,64,64,57,32,4,
+    0,4,32,57,64,64,57,32,4,4,32,57,64,64,57,32,4,4,32,57,64,64,57,32,
+    4,1,17,46,62,64,64,57,32,4,0,4,32,57,64,64,57,32,4,0,4,32,57,64,
+    64,64,62,46,17,1,0,0,0,0,0,0,0,0,1,17,37,42,42,41,28,6,0,0,
+    0,0,6,28,41,42,41,28,17,37,42,42,37,17,1,0,0,0,0,0,0,0,1,17,
+    37,42,42,42,42,42,42,42,42,42,42,37,17,1,0,0,0,0,0,0,0,0,0,6,
+    28,41,42,41,28,6,0,0,0,0,0,0,6,28,41,42,42,37,17,1,0,0,0,0,
+    0,0,0,1,17,37,42,42,37,17,1,0,0,0,0,0,0,1,17,37,42,42,37,17,
+    1,1,17,37,42,42,42,42,42,42,42,42,41,28,17,4,0,0,0,0,1,17,37,42,
+    42,42,42,42,42,42,42,37,21,10,3,0,0,0,0,0,0,1,17,37,42,42,42,42,
+    42,42,42,42,42,42,42,41,28,6,0,1,17,37,42,42,37,17,1,0,0,0,0,0,
+    0,0,0,1,17,37,42,42,37,17,1,0,0,0,0,6,28,41,42,41,28,6,0,1,
+    17,37,42,42,37,17,1,1,17,37,42,42,37,17,1,0,0,0,1,17,37,42,42,41,
+    28,6,0,1,17,37,42,42,42,42,42,42,42,42,42,42,42,37,17,1,1,17,37,42,
+    42,37,17,1,0,0,0,0,0,0,1,17,37,42,42,37,17,1,1,17,37,42,42,37,
+    17,1,0,0,1,17,37,42,42,42,37,17,1,1,17,37,42,42,37,17,1,0,0,0,
+    0,0,0,0,0,0,0,1,17,37,42,42,37,17,1,0,0,0,0,6,28,41,42,42,
+    37,17,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,6,28,41,42,41,28,6,0,0,4,17,21,21,21,21,21,21,21,21,21,21,21,
+    17,4,0,0,0,0,1,5,10,20,21,21,21,21,17,6,1,0,0,0,0,0,0,0,
+    0,0,4,17,21,21,20,10,1,0,0,0,0,0,0,0,0,0,0,3,10,20,21,21,
+    21,21,17,6,1,0,0,0,0,0,0,0,0,4,17,21,21,17,4,0,0,0,0,0,
+    0,4,17,21,21,17,4,0,0,0,4,17,21,21,17,4,0,0,4,17,21,21,17,4,
+    0,0,4,17,21,21,17,4,0,0,1,10,20,21,21,17,4,0,0,0,4,17,21,21,
+    17,4,0,0,0,4,17,21,21,21,20,10,1,0,0,0,0,0,0,0,0,0,0,0,
+    3,5,5,5,1,0,0,0,0,0,0,1,5,5,5,1,0,3,5,5,3,0,0,0,
+    0,0,0,0,0,0,0,0,3,5,5,5,5,5,5,5,5,5,5,3,0,0,0,0,
+    0,0,0,0,0,0,0,0,1,5,5,5,1,0,0,0,0,0,0,0,0,1,5,5,
+    5,3,0,0,0,0,0,0,0,0,0,0,0,3,5,5,3,0,0,0,0,0,0,0,
+    0,0,0,3,5,5,3,0,0,0,0,3,5,5,5,5,5,5,5,5,5,1,0,0,
+    0,0,0,0,0,0,3,5,5,5,5,5,5,5,5,3,0,0,0,0,0,0,0,0,
+    0,0,0,3,5,5,5,5,5,5,5,5,5,5,5,5,1,0,0,0,0,3,5,5,
+    3,0,0,0,0,0,0,0,0,0,0,0,0,3,5,5,3,0,0,0,0,0,0,0,
+    1,5,5,5,1,0,0,0,0,3,5,5,3,0,0,0,0,3,5,5,3,0,0,0,
+    0,0,0,0,3,5,5,5,1,0,0,0,0,3,5,5,5,5,5,5,5,5,5,5,
+    5,3,0,0,0,0,3,5,5,3,0,0,0,0,0,0,0,0,0,0,3,5,5,3,
+    0,0,0,0,3,5,5,3,0,0,0,0,0,0,3,5,5,5,3,0,0,0,0,3,
+    5,5,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,5,5,3,0,0,0,
+    0,0,0,0,1,5,5,5,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,5,5,5,1,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,4,17,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,17,4,0,0,4,17,21,21,17,4,0,0,0,0,0,0,0,0,4,17,21,21,17,
+    4,0,0,4,17,21,21,17,4,0,0,0,1,10,20,21,21,20,10,1,0,0,0,4,
+    17,21,21,17,4,0,0,0,4,17,21,21,20,10,1,0,0,0,0,4,17,21,21,20,
+    10,1,0,0,4,17,21,21,20,10,1,0,0,0,0,1,10,20,21,21,17,4,0,0,
+    1,10,20,21,21,21,21,21,21,21,21,21,21,21,21,21,17,4,0,0,0,0,1,10,
+    20,21,20,10,1,0,0,0,0,0,0,0,4,17,21,21,17,4,0,0,0,0,0,0,
+    0,0,1,10,20,21,20,10,1,0,0,0,0,0,0,0,0,0,0,1,5,10,20,21,
+    21,21,20,10,1,0,0,0,0,0,0,0,0,0,1,10,20,21,21,21,20,10,3,0,
+    0,0,0,0,0,0,0,3,10,20,21,21,21,17,6,1,0,0,0,0,0,0,0,0,
+    0,4,17,21,21,21,21,17,4,0,0,0,0,0,0,0,0,0,4,17,21,21,21,21,
+    20,10,3,0,0,0,0,0,3,5,5,3,0,0,0,0,0,3,5,5,3,0,0,0,
+    0,3,5,5,3,10,20,21,21,20,10,1,0,4,17,21,21,21,17,4,0,0,0,0,
+    0,0,3,5,5,3,10,20,21,21,21,17,4,0,0,0,0,0,0,3,5,5,3,10,
+    20,21,21,20,10,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,10,
+    20,17,4,0,0,4,17,20,10,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,4,17,21,21,17,4,0,0,0,0,0,4,17,21,21,17,4,0,0,4,17,21,
+    21,17,4,0,4,17,21,21,21,20,10,1,1,10,20,21,20,10,1,0,0,1,10,20,
+    21,21,17,4,0,0,1,10,20,21,21,17,4,0,0,0,1,10,20,21,21,21,21,21,
+    21,21,21,21,20,10,1,0,0,4,17,21,21,20,10,1,0,0,0,0,0,0,1,10,
+    20,21,17,4,0,0,0,0,0,0,0,4,17,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,17,4,0,0,0,0,0,0,0,0,0,0,4,32,57,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,57,32,4,4,32,57,64,64,57,32,6,0,0,0,0,
+    0,0,6,32,57,64,64,57,32,4,4,32,57,64,64,57,32,4,0,0,17,46,62,64,
+    64,62,46,17,0,0,6,32,57,64,64,57,32,4,0,4,32,57,64,64,62,46,17,1,
+    0,0,6,32,57,64,64,62,46,17,0,4,32,57,64,64,62,46,17,1,0,0,1,17,
+    46,62,64,64,57,32,4,0,17,46,62,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    57,32,4,0,0,0,17,46,62,64,62,46,17,0,0,0,0,0,0,4,32,57,64,64,
+    57,32,4,0,0,0,0,0,0,0,17,46,62,64,62,46,17,0,0,0,0,0,0,0,
+    0,0,6,28,41,47,62,64,64,64,62,47,28,10,1,0,0,0,0,0,1,10,28,47,
+    62,64,64,64,62,47,37,17,1,0,0,0,0,1,17,37,47,62,64,64,64,57,41,28,
+    6,0,0,0,0,0,0,4,18,37,57,64,64,64,64,57,37,17,1,0,0,0,0,0,
+    4,18,37,57,64,64,64,64,62,47,37,17,1,0,1,17,37,42,42,37,17,1,0,1,
+    17,37,42,42,37,17,1,1,17,37,42,42,37,47,62,64,64,62,47,28,17,37,57,64,
+    64,64,57,37,17,1,0,0,1,17,37,42,42,37,47,62,64,64,64,57,37,17,1,0,
+    0,1,17,37,42,42,37,47,62,64,64,62,46,17,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,3,10,21,37,47,62,57,32,4,4,32,57,62,47,37,21,10,3,0,0,0,
+    0,0,0,0,0,0,0,0,0,4,32,57,64,64,57,32,6,0,0,0,6,32,57,64,
+    64,57,32,4,4,32,57,64,64,57,32,9,32,57,64,64,64,62,46,17,17,46,62,64,
+    62,46,17,0,0,17,46,62,64,64,57,32,6,1,17,46,62,64,64,57,32,4,0,0,
+    17,46,62,64,64,64,64,64,64,64,64,64,62,46,17,0,4,32,57,64,64,62,46,17,
+    0,0,0,0,0,0,17,46,62,64,57,32,4,0,0,0,0,0,4,32,57,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,57,32,4,0,0,0,0,0,0,0,0,0,
+    17,57,92,106,106,106,106,106,106,106,106,106,106,106,106,106,106,92,57,17,17,57,92,106,
+    106,92,62,28,1,0,0,0,0,1,28,62,92,106,106,92,57,17,17,57,92,106,106,92,
+    57,18,0,4,37,75,103,106,106,103,75,37,4,1,28,62,92,106,106,92,57,17,0,17,
+    57,92,106,106,103,77,46,10,0,4,32,62,92,106,106,103,75,37,3,17,57,92,106,106,
+    103,77,46,10,0,0,10,46,77,103,106,106,92,57,17,3,37,75,103,106,106,106,106,106,
+    106,106,106,106,106,106,106,106,92,57,17,0,0,3,37,75,103,106,103,75,37,3,0,0,
+    0,0,0,17,57,92,106,106,92,57,17,0,0,0,0,0,0,3,37,75,103,106,103,75,
+    37,3,0,0,0,0,0,0,0,4,32,62,83,86,103,106,106,106,103,84,65,46,17,1,
+    0,0,0,1,17,46,65,84,103,106,106,106,103,86,75,47,17,0,0,0,1,17,47,75,
+    86,103,106,106,106,93,83,62,32,6,0,0,0,0,6,32,57,75,93,106,106,106,106,93,
+    75,48,28,6,0,0,0,6,32,57,75,93,106,106,106,106,103,86,75,47,17,0,10,46,
+    75,85,85,75,46,10,0,10,46,75,85,85,75,46,10,10,46,75,85,85,75,84,103,106,
+    106,103,84,62,47,75,93,106,106,106,93,75,47,17,1,0,10,46,75,85,85,75,84,103,
+    106,106,106,93,75,47,17,1,0,10,46,75,85,85,75,84,103,106,106,103,75,37,3,0,
+    0,0,0,0,0,0,0,0,1,6,18,37,47,62,75,86,103,92,57,17,17,57,92,103,
+    86,75,62,47,37,18,6,1,0,0,0,0,0,0,0,0,0,17,57,92,106,106,92,62,
+    28,1,0,1,28,62,92,106,106,92,57,17,17,57,92,106,106,92,62,32,57,92,106,106,
+    106,103,75,37,46,77,103,106,103,75,37,3,3,37,75,103,106,106,92,62,32,17,47,77,
+    103,106,106,92,57,17,0,3,37,75,103,106,106,106,106,106,106,106,106,106,103,75,37,3,
+    17,57,92,106,106,103,75,37,3,0,1,10,20,17,37,75,103,106,92,57,20,20,17,4,
+    0,0,17,57,92,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,92,57,17,0,
+    0,0,0,0,0,0,0,0,21,64,106,143,149,149,149,149,149,149,149,149,149,149,149,149,
+    143,106,64,21,20,62,103,133,146,120,84,47,10,0,0,0,0,10,47,84,120,146,133,103,
+    62,20,21,64,106,140,143,109,75,37,3,17,57,93,128,149,149,128,93,57,17,5,41,83,
+    120,146,140,106,64,21,0,20,62,103,133,146,135,103,65,32,5,19,57,92,120,146,140,120,
+    83,41,5,20,62,103,133,146,135,103,65,32,4,4,32,65,103,135,146,133,103,62,20,5,
+    42,85,128,149,149,149,149,149,149,149,149,149,149,149,149,143,106,64,21,0,0,5,42,85,
+    128,149,128,85,42,8,5,3,0,0,0,21,64,106,143,143,106,64,21,0,0,0,0,0,
+    0,5,42,85,128,149,128,85,42,5,0,0,0,0,0,0,0,17,57,92,120,128,135,149,
+    149,149,135,120,103,77,46,10,0,0,1,17,47,77,103,120,135,149,149,149,135,128,106,75,
+    37,3,0,1,17,47,77,106,128,135,149,149,146,128,120,92,62,32,4,0,0,1,28,62,
+    92,109,128,146,149,149,146,128,106,84,62,28,1,0,1,28,62,92,109,128,146,149,149,149,
+    135,128,106,75,37,3,20,62,103,128,128,103,62,20,0,20,62,103,128,128,103,62,20,20,
+    62,103,128,128,106,120,135,149,149,135,120,92,77,106,128,146,149,146,128,106,77,47,17,0,
+    20,62,103,128,128,106,120,135,149,149,146,128,106,77,47,17,0,20,62,103,128,128,106,120,
+    135,149,149,128,85,42,5,0,0,0,0,0,0,0,4,17,28,41,57,75,86,103,109,128,
+    133,106,64,21,21,64,106,133,128,109,103,86,75,57,41,28,17,4,0,0,0,0,0,0,
+    0,20,62,103,133,146,120,84,47,10,0,10,47,84,120,146,133,103,62,20,21,64,106,140,
+    146,120,83,42,64,106,143,149,149,128,85,42,62,103,135,146,128,85,42,5,5,41,83,120,
+    140,146,120,92,57,37,75,106,135,146,133,103,62,20,0,5,42,85,128,149,149,149,149,149,
+    149,149,149,149,128,85,42,5,21,64,106,143,149,128,85,42,5,1,17,46,62,57,47,85,
+    128,143,106,64,47,62,57,32,6,0,21,64,106,143,149,149,149,149,149,149,149,149,149,149,
+    149,149,149,143,106,64,21,0,0,0,0,0,0,0,0,0,21,64,106,143,149,149,149,149,
+    149,163,163,149,149,149,149,149,143,106,64,21,10,47,86,128,158,135,103,62,21,0,0,0,
+    0,21,62,103,135,158,128,86,47,10,17,57,93,128,156,128,85,42,6,22,64,106,146,179,
+    179,146,106,64,22,10,47,86,128,159,128,93,57,17,0,10,46,77,109,146,152,120,92,57,
+    23,46,77,109,146,159,128,93,62,28,1,10,46,77,109,146,152,120,92,57,19,19,57,92,
+    120,152,146,109,77,46,10,5,42,85,128,149,149,149,149,149,149,149,149,149,149,163,175,146,
+    106,64,21,0,1,17,45,85,128,159,128,85,48,42,42,37,17,1,0,21,64,106,149,149,
+    106,64,21,0,0,0,0,0,0,5,42,85,128,159,128,85,42,5,0,0,0,0,0,0,
+    0,21,64,106,146,156,149,149,149,149,158,152,135,103,65,28,1,0,10,46,77,106,135,152,
+    158,149,149,149,151,156,128,85,42,5,0,10,46,77,106,135,158,151,149,149,149,158,149,120,
+    92,57,18,0,0,17,48,84,120,146,158,152,149,149,152,158,135,120,84,48,17,0,10,47,
+    84,120,146,158,152,149,149,149,151,156,128,85,42,5,21,64,106,149,149,106,64,21,0,21,
+    64,106,149,149,106,64,21,21,64,106,149,149,122,148,151,149,149,159,149,120,106,135,153,149,
+    149,152,159,135,106,75,37,3,21,64,106,149,149,122,148,151,149,149,152,159,135,106,75,37,
+    3,21,64,106,149,149,122,148,151,149,149,128,85,42,5,0,0,0,0,3,10,21,37,57,
+    67,83,93,109,128,135,149,158,146,106,64,21,21,64,106,146,158,149,135,128,109,93,83,67,
+    57,37,21,10,3,0,0,0,0,10,47,86,128,158,135,103,62,21,0,21,62,103,135,158,
+    128,86,47,10,17,57,93,128,159,128,86,52,75,109,149,181,170,128,93,57,67,106,149,149,
+    109,75,37,3,1,28,62,92,120,152,146,109,77,62,93,128,158,135,106,77,46,10,0,5,
+    42,85,128,149,149,149,149,149,149,152,177,162,128,85,42,5,21,64,106,149,170,128,85,42,
+    5,10,46,77,103,93,75,85,128,149,106,72,84,103,92,62,28,1,21,64,106,143,149,149,
+    149,149,149,149,149,149,149,149,149,149,149,143,106,64,21,0,0,0,0,0,0,0,0,0,
+    17,57,92,106,106,106,106,106,112,149,149,112,106,106,106,106,106,92,57,17,3,37,75,109,
+    149,149,109,75,37,4,0,0,4,37,75,109,149,149,109,75,37,3,6,42,85,128,156,128,
+    93,57,17,37,75,109,149,171,171,149,109,75,37,20,62,103,135,158,128,85,42,6,0,1,
+    19,57,92,120,152,146,109,77,47,65,103,135,159,135,106,75,37,6,0,1,19,57,92,120,
+    152,146,109,77,46,46,77,109,146,152,120,92,57,19,1,3,37,75,103,106,106,106,106,106,
+    106,106,106,106,122,152,152,120,92,57,17,0,10,46,75,90,128,159,128,90,85,85,85,75,
+    46,10,0,21,64,106,143,143,106,64,21,0,0,0,0,0,0,5,42,85,128,159,128,85,
+    42,5,0,0,0,0,0,0,0,21,64,106,133,128,109,106,106,109,128,149,152,120,83,41,
+    6,1,28,65,103,135,160,149,128,109,106,106,120,128,128,85,42,5,1,28,65,103,135,156,
+    135,120,106,106,109,135,160,146,109,75,37,4,3,37,75,106,135,159,135,120,106,106,120,135,
+    159,135,106,75,37,3,20,62,103,135,159,135,120,106,106,106,120,128,128,85,42,5,21,64,
+    106,149,149,106,64,21,0,21,64,106,149,149,106,64,21,21,64,106,149,163,148,135,120,106,
+    109,135,160,149,135,145,128,109,106,120,149,159,128,86,47,10,21,64,106,149,163,148,135,120,
+    106,106,120,149,159,128,86,47,10,21,64,106,149,163,148,135,120,106,106,103,75,37,3,0,
+    1,10,21,37,47,62,75,93,106,120,128,146,158,158,149,135,120,92,57,17,17,57,92,120,
+    135,149,158,158,146,128,120,106,93,75,62,47,37,21,10,1,0,3,37,75,109,146,149,109,
+    75,37,9,37,75,109,149,146,109,75,37,3,6,42,85,128,158,135,103,63,85,128,159,152,
+    160,146,106,64,83,120,152,146,106,64,22,0,0,6,32,65,103,135,156,135,106,92,120,149,
+    149,120,84,48,17,1,0,3,37,75,103,106,106,106,106,106,115,135,166,146,109,75,37,3,
+    21,64,106,143,149,128,85,42,5,20,62,103,135,128,106,91,128,149,106,93,120,135,120,83,
+    41,5,17,57,92,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,92,57,17,0,
+    0,0,0,0,0,0,0,0,4,32,57,64,64,64,64,69,106,149,149,106,69,64,64,64,
+    64,57,32,4,0,21,62,103,135,158,128,93,57,17,0,0,17,57,93,128,158,135,103,62,
+    21,0,3,37,75,109,149,146,106,64,22,42,85,128,158,135,135,158,128,85,42,22,64,106,
+    149,149,109,75,37,3,0,0,4,32,65,103,135,156,135,103,70,92,120,152,149,120,84,48,
+    17,0,0,0,4,32,65,103,135,156,135,103,65,65,103,135,156,135,103,65,32,4,0,0,
+    17,46,62,64,64,64,64,64,64,66,80,106,135,159,135,103,65,32,4,0,20,62,103,128,
+    135,162,135,128,128,128,128,103,62,20,0,17,57,92,106,106,92,57,17,0,0,3,5,5,
+    5,8,42,85,128,159,128,85,42,8,5,5,5,3,0,0,0,17,57,92,103,86,78,74,
+    74,79,93,120,151,128,93,57,17,6,41,83,120,152,149,120,93,75,64,67,83,93,103,75,
+    37,3,6,41,83,120,151,135,106,84,67,64,77,106,135,154,128,93,57,17,10,47,86,128,
+    159,146,109,84,67,67,84,109,146,159,128,85,42,6,21,64,106,149,149,109,84,67,64,67,
+    83,93,103,75,37,3,21,64,106,149,149,106,64,21,0,21,64,106,149,149,106,64,21,21,
+    64,106,149,170,135,106,84,67,77,109,146,171,151,120,93,75,67,93,128,158,135,103,62,20,
+    21,64,106,149,170,135,106,84,67,67,93,128,158,135,103,62,20,21,64,106,149,170,135,106,
+    84,67,64,62,46,17,0,1,17,46,62,75,86,103,109,128,146,152,156,149,135,128,109,103,
+    84,62,32,4,4,32,62,84,103,109,128,135,149,156,152,146,128,109,103,86,75,62,46,17,
+    1,0,18,57,93,128,156,128,93,57,27,57,93,128,156,128,93,57,18,0,3,37,75,109,
+    149,149,106,71,93,128,159,128,146,149,109,75,86,128,159,128,93,57,17,0,0,0,10,46,
+    77,109,146,159,128,109,146,159,128,93,62,28,1,0,0,0,17,46,62,64,64,64,72,93,
+    128,159,149,120,92,57,18,0,17,57,92,106,106,103,75,37,3,20,62,103,128,143,135,120,
+    128,149,115,128,143,135,120,83,41,5,7,40,66,74,74,74,74,74,74,74,74,74,74,74,
+    74,74,74,74,66,40,7,0,0,0,0,0,0,0,0,0,0,4,17,21,21,21,27,64,
+    106,149,149,106,64,27,21,21,21,17,4,0,0,10,47,84,120,152,146,106,67,28,1,1,
+    28,67,106,146,152,120,84,47,10,0,0,22,64,106,146,149,109,75,37,57,93,128,159,128,
+    128,159,128,93,57,37,75,109,149,146,106,64,22,0,0,0,0,10,46,77,109,146,152,120,
+    92,109,146,152,120,92,62,28,1,0,0,0,0,10,46,77,109,146,152,120,92,92,120,152,
+    146,109,77,46,10,0,0,0,1,10,20,21,21,21,21,25,46,77,106,135,156,135,106,77,
+    46,10,0,0,21,64,106,149,162,177,162,159,159,159,149,106,64,21,0,4,32,57,64,64,
+    57,32,4,1,17,37,42,42,42,42,48,85,128,159,128,85,48,42,42,42,42,37,17,1,
+    0,4,32,60,78,86,103,106,106,106,106,112,149,146,106,64,21,17,57,93,128,156,128,93,
+    62,37,22,28,41,57,62,46,17,0,17,57,93,128,151,120,91,85,85,85,85,90,109,149,
+    146,106,64,21,20,62,103,135,158,128,93,57,28,28,57,93,128,156,128,93,57,17,21,64,
+    106,149,149,109,86,75,64,57,52,57,62,46,17,0,21,64,106,149,149,106,64,21,0,21,
+    64,106,149,149,106,64,21,21,64,106,149,152,120,84,49,31,57,93,128,161,135,103,65,37,
+    37,75,109,149,149,106,64,21,21,64,106,149,152,120,84,49,28,37,75,109,149,149,106,64,
+    21,21,64,106,149,152,120,84,49,28,21,20,10,1,0,10,46,77,103,109,128,135,149,156,
+    152,146,128,109,103,86,75,62,47,28,6,0,0,6,28,47,62,75,86,103,109,128,146,152,
+    156,149,135,128,109,103,77,46,10,0,6,41,83,120,152,146,106,67,37,67,106,146,152,120,
+    83,41,6,0,0,22,64,106,146,152,120,84,106,146,152,120,128,156,128,85,103,135,158,128,
+    85,42,6,0,0,0,1,19,57,92,120,149,149,135,156,135,106,75,37,6,0,0,0,0,
+    1,10,20,23,36,62,92,120,149,149,120,92,62,32,4,0,4,32,57,64,64,62,46,17,
+    0,10,46,75,93,109,128,143,135,152,135,135,120,103,84,62,28,1,17,57,92,106,106,106,
+    106,106,106,106,106,106,106,106,106,106,106,106,92,57,17,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,1,28,67,
+    106,146,152,120,83,41,6,6,41,83,120,152,146,106,67,28,1,0,0,17,57,93,128,156,
+    128,85,42,64,106,146,152,120,120,152,146,106,64,42,85,128,156,128,93,57,17,0,0,0,
+    0,1,19,57,92,120,152,146,115,135,156,135,103,65,32,6,0,0,0,0,0,1,19,57,
+    92,120,152,146,109,109,146,152,120,92,57,19,1,0,0,0,0,0,0,0,0,0,6,32,
+    65,103,135,160,146,109,77,47,17,1,0,0,20,62,103,128,135,162,135,128,128,128,128,103,
+    62,20,0,0,4,17,21,21,17,4,0,10,46,75,85,85,85,85,85,90,128,159,128,90,
+    85,85,85,85,85,75,46,10,0,17,47,77,106,128,135,149,149,149,149,149,163,149,106,64,
+    21,21,64,106,146,149,109,75,37,6,0,1,6,17,20,10,1,0,21,64,106,146,152,128,
+    128,128,128,128,128,128,128,152,149,106,64,21,21,64,106,149,149,109,75,37,4,4,37,75,
+    109,149,146,106,64,21,20,62,103,135,159,135,128,109,106,93,83,65,46,22,1,0,21,64,
+    106,149,149,106,64,21,0,21,64,106,149,149,106,64,21,21,64,106,149,149,106,67,28,7,
+    42,85,128,159,128,86,47,10,22,64,106,149,149,106,64,21,21,64,106,149,149,106,67,28,
+    1,22,64,106,149,149,106,64,21,21,64,106,149,149,106,67,28,1,0,0,0,0,0,20,
+    62,103,135,149,162,159,146,128,120,106,93,75,62,47,37,21,10,1,0,0,0,0,1,10,
+    21,37,47,62,75,93,106,120,128,146,159,162,149,135,103,62,20,0,1,28,67,106,146,152,
+    120,83,52,83,120,152,146,106,67,28,1,0,0,17,57,93,128,159,128,90,109,149,146,106,
+    128,156,128,93,106,149,149,109,75,37,3,0,0,0,0,4,32,62,93,128,159,167,146,109,
+    77,47,17,0,0,0,0,0,0,0,1,28,62,92,120,149,152,120,92,62,32,6,0,0,
+    0,4,17,21,21,20,10,1,0,1,25,47,66,84,102,128,162,171,149,112,93,74,56,37,
+    10,0,21,64,106,143,149,149,149,149,149,149,149,149,149,149,149,149,149,143,106,64,21,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,
+    0,0,0,0,0,0,17,57,93,128,156,128,93,57,18,18,57,93,128,156,128,93,57,17,
+    0,0,0,6,42,85,128,156,128,93,57,75,109,149,149,106,106,149,149,109,75,57,93,128,
+    156,128,85,42,6,0,0,0,0,0,4,32,65,103,135,156,149,160,146,109,77,46,10,0,
+    0,0,0,0,0,0,4,32,65,103,135,159,135,135,159,135,103,65,32,4,0,0,0,0,
+    0,0,0,0,0,6,32,62,92,120,152,149,120,92,57,19,1,0,0,0,10,46,75,90,
+    128,159,128,90,85,85,85,75,46,10,0,0,0,3,5,5,3,0,0,20,62,103,128,128,
+    128,128,128,128,135,162,135,128,128,128,128,128,128,103,62,20,4,37,75,106,135,159,158,149,
+    149,149,149,149,163,149,106,64,21,21,64,106,149,149,106,64,22,0,0,0,0,0,0,0,
+    0,0,21,64,106,149,171,159,159,159,159,159,159,159,159,165,149,106,64,21,21,64,106,149,
+    149,106,64,22,0,0,22,64,106,149,149,106,64,21,10,47,84,120,146,158,158,149,146,128,
+    120,103,77,47,17,1,21,64,106,149,149,106,64,21,0,21,64,106,149,149,106,64,21,21,
+    64,106,149,149,106,64,21,5,42,85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,
+    21,64,106,149,149,106,64,21,0,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,
+    21,0,0,0,0,0,0,21,64,106,149,179,182,149,117,102,93,76,66,47,31,19,6,0,
+    0,0,0,0,0,0,0,0,0,6,19,31,47,66,76,93,102,117,149,182,179,149,106,64,
+    21,0,0,17,57,93,128,156,128,93,66,93,128,156,128,93,57,17,0,0,0,6,41,83,
+    120,151,135,104,128,156,128,93,109,149,146,106,120,151,135,103,62,21,0,0,0,0,0,1,
+    19,57,92,120,152,171,135,103,65,32,6,0,0,0,0,0,0,1,17,48,84,120,149,160,
+    135,103,65,32,6,0,0,0,0,0,3,5,5,5,1,0,0,10,46,75,93,109,128,143,
+    135,152,135,135,120,103,84,62,28,1,21,64,106,143,149,149,149,149,149,149,149,149,149,149,
+    149,149,149,143,106,64,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,
+    106,149,149,106,64,21,0,0,0,0,0,0,0,0,4,37,75,109,149,146,109,75,37,37,
+    75,109,146,149,109,75,37,4,0,0,0,3,37,75,109,149,146,106,64,85,128,158,135,103,
+    103,135,158,128,85,64,106,146,149,109,75,37,3,0,0,0,0,0,0,10,46,77,109,146,
+    176,152,120,92,57,19,1,0,0,0,0,0,0,0,0,10,47,84,120,149,167,167,149,120,
+    84,47,10,0,0,0,0,0,0,0,0,0,1,28,62,92,120,149,149,120,92,62,32,4,
+    0,0,0,0,1,17,45,85,128,159,128,85,48,42,42,37,17,1,0,1,17,37,42,42,
+    37,17,1,21,64,106,149,159,159,159,159,159,162,177,162,159,159,159,159,159,149,106,64,21,
+    17,57,93,128,159,149,128,109,106,106,106,112,149,149,106,64,21,21,64,106,149,149,106,64,
+    22,0,0,0,0,0,0,0,0,0,21,64,106,149,152,128,128,128,128,128,128,128,128,128,
+    128,103,62,20,21,64,106,149,149,106,64,22,0,0,22,64,106,149,149,106,64,21,1,28,
+    62,92,109,128,135,149,152,159,152,135,106,77,46,10,21,64,106,149,149,106,64,21,0,21,
+    64,106,149,149,106,64,21,21,64,106,149,149,106,64,21,5,42,85,128,159,128,85,42,5,
+    21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,21,0,21,64,106,149,149,106,64,
+    21,21,64,106,149,149,106,64,21,0,0,0,0,0,0,20,62,103,135,149,162,159,146,128,
+    120,106,93,75,62,47,37,21,10,1,0,0,0,0,1,10,21,37,47,62,75,93,106,120,
+    128,146,159,162,149,135,103,62,20,0,0,4,37,75,109,149,146,109,84,109,146,149,109,75,
+    37,4,0,0,0,1,28,67,106,149,149,109,128,156,128,85,106,146,149,109,128,159,128,86,
+    47,10,0,0,0,0,0,17,47,77,109,146,160,152,152,120,92,62,28,1,0,0,0,0,
+    1,17,47,77,106,135,159,135,106,77,46,10,0,0,0,0,1,17,37,42,42,41,28,6,
+    0,20,62,103,128,143,135,120,128,149,115,128,143,135,120,83,41,5,17,57,92,106,106,106,
+    106,106,106,106,106,106,106,106,106,106,106,106,92,57,17,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,0,0,21,
+    62,103,135,158,128,86,47,47,86,128,158,135,103,62,21,0,0,0,0,0,22,64,106,146,
+    149,109,75,86,128,159,128,86,86,128,159,128,86,75,109,149,146,106,64,22,0,0,0,0,
+    0,0,0,6,37,75,106,135,171,149,109,77,46,10,0,0,0,0,0,0,0,0,0,1,
+    28,62,93,128,162,162,128,93,62,28,1,0,0,0,0,0,0,0,0,1,17,48,84,120,
+    149,159,128,93,62,32,6,0,0,0,0,0,0,5,42,85,128,159,128,85,42,8,5,3,
+    0,0,0,10,46,75,85,85,75,46,10,20,62,103,128,128,128,128,128,128,135,162,135,128,
+    128,128,128,128,128,103,62,20,21,64,106,146,152,120,93,75,64,64,78,109,149,149,106,64,
+    21,21,64,106,146,149,109,75,37,6,0,1,6,17,20,10,1,0,21,64,106,146,149,109,
+    89,85,85,85,85,85,85,85,85,75,46,10,21,64,106,146,149,109,75,37,4,4,37,75,
+    109,149,146,106,64,21,0,9,34,57,75,86,103,106,120,128,149,160,135,103,62,20,21,64,
+    106,149,149,106,64,22,1,28,67,106,149,149,106,64,21,21,64,106,149,149,106,64,21,5,
+    42,85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,21,
+    0,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,21,0,0,0,0,0,0,10,
+    46,77,103,109,128,135,149,156,152,146,128,109,103,86,75,62,47,28,6,0,0,6,28,47,
+    62,75,86,103,109,128,146,152,156,149,135,128,109,103,77,46,10,0,0,0,21,62,103,135,
+    158,128,96,128,158,135,103,62,21,0,0,0,0,0,20,62,103,135,151,122,146,149,109,75,
+    93,128,156,128,135,151,120,83,41,5,0,0,0,0,6,37,75,106,135,156,135,120,152,149,
+    120,84,48,17,1,0,0,0,17,47,77,106,135,159,135,106,77,47,28,21,20,10,1,0,
+    10,46,75,85,85,83,62,28,1,20,62,103,135,128,106,91,128,149,106,93,120,135,120,83,
+    41,5,4,32,57,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,57,32,4,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,
+    0,0,0,0,0,0,0,10,47,86,128,158,135,103,62,62,103,135,158,128,86,47,10,0,
+    0,0,0,0,17,57,93,128,156,128,85,103,135,151,120,83,83,120,151,135,103,85,128,156,
+    128,93,57,17,0,0,0,0,0,0,1,28,62,93,128,159,152,156,135,103,65,32,4,0,
+    0,0,0,0,0,0,0,0,6,37,75,109,149,149,109,75,37,6,0,0,0,0,0,0,
+    0,0,0,17,47,77,106,135,159,135,106,75,37,6,0,0,0,0,0,0,0,5,42,85,
+    128,159,128,85,42,5,0,0,0,0,0,20,62,103,128,128,103,62,20,10,46,75,85,85,
+    85,85,85,90,128,159,128,90,85,85,85,85,85,75,46,10,21,64,106,149,149,106,70,42,
+    35,57,93,128,162,149,106,64,21,17,57,93,128,156,128,93,62,37,22,28,41,57,62,46,
+    17,0,17,57,93,128,156,128,93,64,50,42,42,50,53,60,63,51,24,1,17,57,93,128,
+    156,128,93,57,28,28,57,93,128,156,128,93,57,17,4,32,57,62,52,55,62,67,83,93,
+    120,152,149,106,64,21,21,64,106,149,149,109,75,37,28,49,84,120,152,149,106,64,21,21,
+    64,106,149,149,106,64,21,5,42,85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,
+    21,64,106,149,149,106,64,21,0,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,
+    21,0,0,0,0,0,0,1,17,46,62,75,86,103,109,128,146,152,156,149,135,128,109,103,
+    84,62,32,4,4,32,62,84,103,109,128,135,149,156,152,146,128,109,103,86,75,62,46,17,
+    1,0,0,0,10,47,84,120,151,135,112,135,151,120,84,47,10,0,0,0,0,0,10,47,
+    86,128,161,135,152,146,106,64,85,128,158,135,152,149,106,67,28,1,0,0,0,1,28,62,
+    93,128,159,146,109,103,135,159,135,106,77,46,10,0,0,4,37,75,106,135,160,149,120,85,
+    66,64,64,64,62,46,17,0,20,62,103,128,128,120,83,41,5,10,46,77,103,93,75,85,
+    128,149,106,72,84,103,92,62,28,1,0,4,17,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,17,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,
+    106,149,149,106,64,21,0,0,0,0,0,0,0,0,0,3,37,75,109,146,149,109,75,75,
+    109,149,146,109,75,37,3,0,0,0,0,0,6,42,85,128,156,128,93,106,149,149,106,67,
+    67,106,149,149,106,93,128,156,128,85,42,6,0,0,0,0,0,0,17,48,84,120,149,149,
+    122,146,152,120,92,57,19,1,0,0,0,0,0,0,0,0,0,22,64,106,149,149,106,64,
+    22,0,0,0,0,0,0,0,0,0,6,37,75,106,135,156,135,106,77,47,17,0,0,0,
+    0,0,0,0,0,5,42,85,128,159,128,85,42,5,0,0,0,0,0,21,64,106,149,149,
+    106,64,21,1,17,37,42,42,42,42,48,85,128,159,128,85,48,42,42,42,42,37,17,1,
+    21,64,106,149,152,120,87,67,67,84,109,146,176,149,106,64,21,6,41,83,120,152,149,120,
+    93,75,64,67,83,93,103,75,37,3,6,41,83,120,152,149,120,93,75,64,64,75,85,93,
+    103,75,37,3,6,42,85,128,159,146,109,84,67,67,84,109,146,159,128,85,42,6,17,57,
+    92,103,86,83,67,64,67,84,109,149,149,106,64,21,20,62,103,135,158,128,93,67,67,84,
+    106,135,170,149,106,64,21,21,64,106,149,149,106,64,21,5,42,85,128,159,128,85,42,5,
+    21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,21,0,21,64,106,149,149,106,64,
+    21,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,1,10,21,37,47,62,75,93,
+    106,120,128,146,158,158,149,135,120,92,57,17,17,57,92,120,135,149,158,158,146,128,120,106,
+    93,75,62,47,37,21,10,1,0,0,0,0,1,28,67,106,146,152,128,152,146,106,67,28,
+    1,0,0,0,0,0,5,41,83,120,152,171,166,128,93,57,75,109,149,171,167,135,103,62,
+    20,0,0,0,1,17,48,84,120,149,149,120,92,77,106,135,159,135,103,65,32,6,0,17,
+    57,93,128,162,152,122,109,106,106,106,106,106,103,75,37,3,21,64,106,149,165,128,85,42,
+    5,1,17,46,62,57,47,85,128,143,106,64,47,62,57,32,6,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,0,0,0,
+    18,57,93,128,156,128,93,93,128,156,128,93,57,18,0,0,0,0,0,0,3,37,75,109,
+    149,146,106,120,151,135,103,62,62,103,135,151,120,106,146,149,109,75,37,3,0,0,0,0,
+    0,6,37,75,106,135,158,128,101,120,152,146,109,77,46,10,0,0,0,0,0,0,0,0,
+    0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,0,6,32,62,93,128,159,146,
+    109,77,47,17,1,0,0,0,0,0,0,0,0,5,42,85,128,159,128,85,42,8,5,3,
+    0,0,1,28,67,106,149,146,106,64,21,0,0,3,5,5,5,8,42,85,128,159,128,85,
+    42,8,5,5,5,3,0,0,20,62,103,135,162,135,120,106,106,120,135,148,163,149,106,64,
+    21,1,28,65,103,135,160,149,128,109,106,106,120,128,128,85,42,5,1,28,65,103,135,160,
+    149,128,109,106,106,109,128,128,128,85,42,5,3,37,75,106,135,159,135,120,106,106,120,135,
+    159,135,106,75,37,3,21,64,106,133,128,120,106,106,106,120,135,159,135,103,62,20,10,47,
+    86,128,159,149,120,106,106,120,135,148,163,149,106,64,21,21,64,106,149,149,106,64,21,5,
+    42,85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,21,
+    0,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,
+    0,0,0,3,10,21,37,57,67,83,93,109,128,135,149,158,146,106,64,21,21,64,106,146,
+    158,149,135,128,109,93,83,67,57,37,21,10,3,0,0,0,0,0,0,0,0,17,57,93,
+    128,165,170,165,128,93,57,17,0,0,0,0,0,0,1,28,67,106,149,183,162,128,85,42,
+    64,106,146,179,169,128,86,47,10,0,0,0,10,46,77,106,135,158,128,93,62,48,84,120,
+    149,152,120,92,62,28,1,21,64,106,146,177,163,149,149,149,149,149,149,149,128,85,42,5,
+    21,64,106,149,165,128,85,42,5,0,1,10,20,17,37,75,103,106,92,57,20,20,17,4,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,
+    0,0,0,0,0,0,0,0,6,41,83,120,152,146,106,106,146,152,120,83,41,6,0,0,
+    0,0,0,0,0,22,64,106,146,149,109,128,159,128,86,47,47,86,128,159,128,109,149,146,
+    106,64,22,0,0,0,0,0,4,32,62,93,128,158,135,106,79,103,135,156,135,103,65,32,
+    4,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,
+    4,32,62,92,120,149,149,120,92,57,21,6,5,5,5,5,5,1,0,0,0,5,42,85,
+    128,159,128,85,48,42,42,37,17,1,5,41,83,120,151,128,93,57,17,0,0,0,0,0,
+    0,5,42,85,128,159,128,85,42,5,0,0,0,0,0,0,10,47,84,120,149,161,152,149,
+    149,151,148,122,149,149,106,64,21,0,10,46,77,106,135,152,158,149,149,149,151,156,128,85,
+    42,5,0,10,46,77,106,135,152,158,149,149,149,149,156,156,128,85,42,5,0,17,48,84,
+    120,146,158,152,149,149,152,158,135,120,84,48,17,0,21,64,106,146,159,151,149,149,149,151,
+    158,146,120,84,47,10,3,37,75,106,135,159,152,149,149,151,148,122,149,149,106,64,21,21,
+    64,106,149,149,106,64,21,5,42,85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,
+    21,64,106,149,149,106,64,21,0,21,64,106,149,149,106,64,21,21,64,106,149,149,106,64,
+    21,0,0,0,0,0,0,0,0,0,0,0,0,0,4,17,28,41,57,75,86,103,109,128,
+    133,106,64,21,21,64,106,133,128,109,103,86,75,57,41,28,17,4,0,0,0,0,0,0,
+    0,0,0,0,0,6,41,83,120,146,149,146,120,83,41,6,0,0,0,0,0,0,0,20,
+    62,103,135,149,143,109,75,37,57,93,128,149,146,120,83,41,5,0,0,0,20,62,103,133,
+    146,135,106,75,37,28,62,92,120,146,140,120,83,41,5,21,64,106,143,149,149,149,149,149,
+    149,149,149,149,128,85,42,5,20,62,103,128,128,120,83,41,5,0,0,0,0,0,17,46,
+    62,64,57,32,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,
+    106,149,149,106,64,21,0,0,0,0,0,0,0,0,0,0,1,28,67,106,146,152,120,120,
+    152,146,106,67,28,1,0,0,0,0,0,0,0,17,57,93,128,156,128,135,151,120,83,41,
+    41,83,120,151,135,128,156,128,93,57,17,0,0,0,0,1,19,57,92,120,149,149,120,84,
+    55,77,109,146,152,120,92,57,19,1,0,0,0,0,0,0,0,21,64,106,149,149,106,64,
+    21,0,0,0,0,0,0,1,19,57,92,120,149,152,120,92,64,47,42,42,42,42,42,42,
+    41,28,6,0,0,5,42,85,128,159,128,94,85,85,85,75,46,10,10,47,86,128,151,120,
+    83,41,6,0,0,0,0,0,0,5,42,85,128,159,128,85,42,5,0,0,0,0,0,0,
+    1,28,62,92,120,128,146,149,149,135,120,106,128,128,103,62,20,0,1,17,47,77,103,120,
+    135,149,149,149,135,128,106,75,37,3,0,1,17,47,77,103,120,135,149,149,149,146,128,128,
+    106,75,37,3,0,1,28,62,92,109,128,146,149,149,146,128,106,84,62,28,1,0,17,57,
+    92,120,128,135,149,149,149,135,128,109,92,62,28,1,0,17,47,77,106,128,146,149,149,135,
+    120,106,128,128,103,62,20,20,62,103,128,128,103,62,20,5,41,83,120,128,120,83,41,5,
+    20,62,103,128,128,103,62,20,20,62,103,128,128,103,62,20,0,20,62,103,128,128,103,62,
+    20,20,62,103,128,128,103,62,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,6,18,37,47,62,75,86,103,92,57,17,17,57,92,103,86,75,62,47,37,18,6,1,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,1,28,62,92,106,106,106,92,62,28,1,
+    0,0,0,0,0,0,0,10,46,77,103,106,106,92,57,18,37,75,103,106,106,92,62,28,
+    1,0,0,0,17,57,92,106,106,103,77,47,17,6,32,62,92,106,106,103,75,37,3,17,
+    57,92,106,106,106,106,106,106,106,106,106,106,103,75,37,3,10,46,75,85,85,83,62,28,
+    1,0,0,0,0,0,1,10,20,21,17,4,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,0,0,0,0,
+    0,17,57,93,128,158,135,128,156,128,93,57,17,0,0,0,0,0,0,0,0,6,42,85,
+    128,158,135,152,149,106,67,28,28,67,106,149,152,135,158,128,85,42,6,0,0,0,0,10,
+    46,77,109,146,159,128,93,62,33,57,92,120,152,146,109,77,46,10,0,0,0,0,0,0,
+    0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,10,46,77,109,146,160,135,104,86,
+    85,85,85,85,85,85,85,85,83,62,28,1,0,5,41,83,120,152,149,128,128,128,128,103,
+    62,20,20,62,103,135,146,106,67,28,1,0,0,0,0,0,0,5,42,85,128,149,128,85,
+    42,5,0,0,0,0,0,0,0,6,32,62,83,93,106,106,106,103,84,75,85,85,75,46,
+    10,0,0,1,17,46,65,84,103,106,106,106,103,86,75,47,17,0,0,0,1,17,46,65,
+    84,103,106,106,106,106,93,85,75,47,17,0,0,0,6,32,57,75,93,106,106,106,106,93,
+    75,48,28,6,0,0,4,32,62,83,86,103,106,106,106,103,86,75,57,32,6,0,0,1,
+    17,47,75,93,106,106,106,103,84,75,85,85,75,46,10,10,46,75,85,85,75,46,10,1,
+    28,62,83,85,83,62,28,1,10,46,75,85,85,75,46,10,10,46,75,85,85,75,46,10,
+    0,10,46,75,85,85,75,46,10,10,46,75,85,85,75,46,10,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,3,10,21,37,47,62,57,32,4,4,32,57,62,
+    47,37,21,10,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,32,
+    57,64,64,64,57,32,6,0,0,0,0,0,0,0,0,1,17,46,62,64,64,57,32,4,
+    17,46,62,64,64,57,32,6,0,0,0,0,4,32,57,64,64,62,46,17,1,0,6,32,
+    57,64,64,62,46,17,0,4,32,57,64,64,64,64,64,64,64,64,64,64,62,46,17,0,
+    1,17,37,42,42,41,28,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,
+    0,0,0,0,0,0,0,0,0,4,37,75,109,149,163,152,149,109,75,37,4,0,0,0,
+    0,0,0,0,0,3,37,75,109,149,171,167,135,103,62,20,20,62,103,135,167,171,149,109,
+    75,37,3,0,0,0,4,32,65,103,135,159,135,106,75,37,9,32,65,103,135,156,135,103,
+    65,32,4,0,0,0,0,0,0,21,64,106,149,149,106,64,21,0,0,0,0,0,0,20,
+    62,103,135,163,152,128,128,128,128,128,128,128,128,128,128,128,120,83,41,5,0,1,28,65,
+    103,135,152,159,159,159,149,106,64,21,20,62,103,128,120,92,57,17,0,0,0,0,0,0,
+    0,3,37,75,103,106,103,75,37,3,0,0,0,0,0,0,0,0,6,28,41,57,64,64,
+    64,62,47,37,42,42,37,17,1,0,0,0,1,10,28,47,62,64,64,64,62,47,37,17,
+    1,0,0,0,0,1,10,28,47,62,64,64,64,64,57,42,37,17,1,0,0,0,0,4,
+    18,37,57,64,64,64,64,57,37,17,1,0,0,0,0,6,28,41,47,62,64,64,64,62,
+    47,37,18,4,0,0,0,0,1,17,37,57,64,64,64,62,47,37,42,42,37,17,1,1,
+    17,37,42,42,37,17,1,0,6,28,41,42,41,28,6,0,1,17,37,42,42,37,17,1,
+    1,17,37,42,42,37,17,1,0,1,17,37,42,42,37,17,1,1,17,37,42,42,37,17,
+    1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,10,
+    20,17,4,0,0,4,17,20,10,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,4,17,21,21,21,17,4,0,0,0,0,0,0,0,0,0,0,
+    1,10,20,21,21,17,4,0,1,10,20,21,21,17,4,0,0,0,0,0,0,4,17,21,
+    21,20,10,1,0,0,0,4,17,21,21,20,10,1,0,0,4,17,21,21,21,21,21,21,
+    21,21,21,21,20,10,1,0,0,0,3,5,5,5,1,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,
+    106,149,149,106,64,21,0,0,0,0,0,0,0,0,0,0,0,0,21,62,103,135,166,166,
+    135,103,62,21,0,0,0,0,0,0,0,0,0,0,22,64,106,146,169,165,128,86,47,10,
+    10,47,86,128,165,169,146,106,64,22,0,0,0,0,17,57,92,120,151,149,120,84,48,17,
+    0,10,46,77,109,146,151,120,92,57,17,0,0,0,0,0,0,21,64,106,149,149,106,64,
+    21,0,0,0,0,0,0,21,64,106,149,169,165,159,159,159,159,159,159,159,159,159,159,159,
+    128,85,42,5,0,0,10,46,77,103,120,128,128,128,128,103,62,20,10,46,75,85,83,62,
+    32,4,0,0,0,0,0,0,0,0,17,46,62,64,62,46,17,0,0,0,0,0,0,0,
+    0,0,0,1,6,17,21,21,21,20,10,3,5,5,3,0,0,0,0,0,0,0,1,10,
+    20,21,21,21,20,10,3,0,0,0,0,0,0,0,0,1,10,20,21,21,21,21,17,6,
+    3,0,0,0,0,0,0,0,0,4,17,21,21,21,21,17,4,0,0,0,0,0,0,0,
+    1,5,10,20,21,21,21,20,10,3,0,0,0,0,0,0,0,0,4,17,21,21,21,20,
+    10,3,5,5,3,0,0,0,0,3,5,5,3,0,0,0,0,1,5,5,5,1,0,0,
+    0,0,3,5,5,3,0,0,0,0,3,5,5,3,0,0,0,0,0,3,5,5,3,0,
+    0,0,0,3,5,5,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,20,62,103,128,128,103,62,20,0,0,0,0,0,0,0,0,0,0,
+    0,0,10,47,84,120,128,128,120,84,47,10,0,0,0,0,0,0,0,0,0,0,17,57,
+    92,120,128,128,120,83,41,5,5,41,83,120,128,128,120,92,57,17,0,0,0,0,20,62,
+    103,128,128,120,92,62,28,1,0,1,19,57,92,120,128,128,103,62,20,0,0,0,0,0,
+    0,20,62,103,128,128,103,62,20,0,0,0,0,0,0,20,62,103,128,128,128,128,128,128,
+    128,128,128,128,128,128,128,128,120,83,41,5,0,0,1,17,46,65,83,85,85,85,85,75,
+    46,10,1,17,37,42,41,28,6,0,0,0,0,0,0,0,0,0,1,10,20,21,20,10,
+    1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,46,75,85,85,75,46,10,0,0,
+    0,0,0,0,0,0,0,0,0,0,1,28,62,83,85,85,83,62,28,1,0,0,0,0,
+    0,0,0,0,0,0,4,32,62,83,85,85,83,62,28,1,1,28,62,83,85,85,83,62,
+    32,4,0,0,0,0,10,46,75,85,85,83,62,32,6,0,0,0,4,32,62,83,85,85,
+    75,46,10,0,0,0,0,0,0,10,46,75,85,85,75,46,10,0,0,0,0,0,0,10,
+    46,75,85,85,85,85,85,85,85,85,85,85,85,85,85,85,83,62,28,1,0,0,0,1,
+    10,28,41,42,42,42,42,37,17,1,0,0,3,5,5,1,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,17,
+    37,42,42,37,17,1,0,0,0,0,0,0,0,0,0,0,0,0,0,6,28,41,42,42,
+    41,28,6,0,0,0,0,0,0,0,0,0,0,0,0,6,28,41,42,42,41,28,6,0,
+    0,6,28,41,42,42,41,28,6,0,0,0,0,0,1,17,37,42,42,41,28,6,0,0,
+    0,0,0,6,28,41,42,42,37,17,1,0,0,0,0,0,0,1,17,37,42,42,37,17,
+    1,0,0,0,0,0,0,1,17,37,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    41,28,6,0,0,0,0,0,0,1,5,5,5,5,5,3,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,3,5,5,3,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,1,5,5,5,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,5,5,5,5,1,0,0,0,0,1,5,5,5,5,1,0,0,0,0,0,0,0,0,
+    3,5,5,5,1,0,0,0,0,0,0,0,1,5,5,5,3,0,0,0,0,0,0,0,
+    0,0,0,3,5,5,3,0,0,0,0,0,0,0,0,0,0,3,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,4,17,21,21,17,10,20,21,20,10,1,0,0,4,17,
+    21,21,17,4,0,0,0,0,0,0,0,0,4,17,21,21,21,17,4,0,0,0,0,0,
+    0,0,0,0,4,17,21,21,17,4,0,0,4,17,21,21,20,10,1,0,0,0,0,0,
+    0,0,0,0,3,5,5,5,3,0,0,0,0,0,0,1,5,3,0,0,0,4,17,21,
+    21,17,4,0,0,4,17,21,21,21,21,21,21,20,10,1,0,0,4,17,21,21,21,21,
+    21,21,21,21,21,21,21,21,17,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,32,57,64,64,57,46,62,
+    64,62,46,17,0,4,32,57,64,64,57,32,4,0,0,0,0,0,0,6,32,57,64,64,
+    64,57,32,6,0,0,0,0,0,0,0,4,32,57,64,64,57,32,4,4,32,57,64,64,
+    62,46,17,1,0,0,0,0,0,1,10,21,37,42,42,42,37,21,10,3,0,1,10,28,
+    41,37,17,1,4,32,57,64,64,57,32,4,4,32,57,64,64,64,64,64,64,62,46,17,
+    0,4,32,57,64,64,64,64,64,64,64,64,64,64,64,64,57,32,4,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    17,57,92,106,106,92,75,103,106,103,75,37,3,17,57,92,106,106,92,57,17,0,0,0,
+    0,0,6,32,62,92,106,106,106,92,62,32,6,0,0,0,0,0,0,17,57,92,106,106,
+    92,57,17,17,57,92,106,106,103,77,46,10,0,0,0,0,6,28,47,62,75,85,85,85,
+    75,62,47,37,22,28,47,65,83,75,46,10,17,57,92,106,106,92,57,17,17,57,92,106,
+    106,106,106,106,106,103,75,37,3,17,57,92,106,106,106,106,106,106,106,106,106,106,106,106,
+    92,57,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,21,64,106,143,143,106,85,128,149,128,85,42,5,21,64,106,
+    143,143,106,64,21,0,0,0,0,6,32,62,92,120,146,149,146,120,92,62,32,6,0,0,
+    0,0,0,21,64,106,143,143,106,64,21,20,62,103,133,146,135,103,65,32,4,0,0,4,
+    32,62,84,103,109,128,128,128,109,103,86,75,64,67,84,103,120,103,62,20,21,64,106,143,
+    143,106,64,21,21,64,106,143,149,149,149,149,149,128,85,42,5,21,64,106,143,149,149,149,
+    149,149,149,149,149,149,149,143,106,64,21,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,85,128,
+    159,128,85,42,5,21,64,106,149,149,106,64,21,0,0,0,6,32,62,92,120,149,160,149,
+    160,149,120,92,62,32,6,0,0,0,0,22,64,106,149,149,106,64,21,10,46,77,106,135,
+    148,120,92,57,19,1,0,17,57,92,120,135,149,156,159,158,149,135,128,109,106,106,120,135,
+    143,106,64,21,21,64,106,149,149,106,64,21,21,64,106,143,149,149,149,149,149,128,85,42,
+    5,21,64,106,143,149,149,149,149,149,149,149,149,149,149,143,106,64,21,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    21,64,106,149,149,106,85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,0,0,6,
+    32,62,92,120,149,160,135,112,135,160,149,120,92,62,32,6,0,0,3,37,75,109,149,135,
+    103,62,20,1,17,47,77,106,135,146,109,77,47,17,0,21,64,106,146,151,146,128,128,135,
+    149,151,156,149,149,149,151,151,135,103,62,20,21,64,106,143,143,106,64,21,17,57,92,106,
+    106,106,106,106,106,103,75,37,3,17,57,92,106,106,106,106,106,106,106,106,106,106,106,106,
+    92,57,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,21,64,106,149,149,106,85,128,159,128,85,42,5,21,64,106,
+    149,149,106,64,21,0,6,32,62,92,120,149,160,135,106,84,106,135,160,149,120,92,62,32,
+    6,0,6,42,85,128,153,128,86,47,10,0,1,17,48,84,120,145,135,106,75,37,3,21,
+    64,106,140,120,106,93,86,103,106,120,128,146,149,146,128,120,103,77,46,10,17,57,92,106,
+    106,92,57,17,4,32,57,64,64,64,64,64,64,62,46,17,0,4,32,57,64,64,64,64,
+    64,64,64,64,64,64,64,64,57,32,4,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,64,106,149,149,106,85,128,
+    159,128,85,42,5,21,64,106,149,149,106,64,21,4,32,62,92,120,149,152,135,106,77,55,
+    77,106,135,152,149,120,92,62,32,4,17,57,93,128,149,109,75,37,3,0,0,1,28,62,
+    92,120,128,120,83,41,5,17,57,92,106,92,67,57,47,62,67,83,93,106,106,106,93,83,
+    65,46,17,1,4,32,57,64,64,57,32,4,0,4,17,21,21,21,21,21,21,20,10,1,
+    0,0,4,17,21,21,21,21,21,21,21,21,21,21,21,21,17,4,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    21,64,106,149,149,106,85,128,159,128,85,42,5,21,64,106,149,149,106,64,21,17,57,92,
+    120,148,149,120,103,77,47,25,47,77,103,120,149,148,120,92,57,17,21,64,106,140,135,103,
+    62,21,0,0,0,0,6,32,62,83,85,83,62,28,1,4,32,57,64,57,32,17,10,20,
+    28,41,57,64,64,64,57,41,28,10,1,0,0,4,17,21,21,17,4,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,20,62,103,128,128,103,83,120,128,120,83,41,5,20,62,103,
+    128,128,103,62,20,20,62,103,128,128,120,92,65,46,17,1,17,46,65,92,120,128,128,103,
+    62,20,17,57,92,106,103,77,46,10,0,0,0,0,0,6,28,41,42,41,28,6,0,0,
+    4,17,21,17,4,0,0,0,1,6,17,21,21,21,17,6,1,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,46,75,85,85,75,62,83,
+    85,83,62,28,1,10,46,75,85,85,75,46,10,10,46,75,85,85,83,62,32,10,1,0,
+    1,10,32,62,83,85,85,75,46,10,4,32,57,64,62,46,17,1,0,0,0,0,0,0,
+    1,5,5,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,17,37,42,42,37,28,41,42,41,28,6,0,1,17,37,42,42,37,17,1,1,17,37,
+    42,42,41,28,6,0,0,0,0,0,6,28,41,42,42,37,17,1,0,4,17,21,20,10,
+    1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,3,5,5,3,1,5,5,5,1,0,0,0,0,3,
+    5,5,3,0,0,0,0,3,5,5,5,1,0,0,0,0,0,0,0,1,5,5,5,3,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
 
-Font DejaVu = {56, 45, -11, DejaVu_chars, DejaVu_kern, 1016, 141, DejaVu_tex};
+Font DejaVu = {56, 45, -11, DejaVu_chars, DejaVu_kern, 512, 92, 2, 6, DejaVu_tex};
 
 }}
-
@@ -1,5 +1,6 @@
 #include "../Render/Render_GL_Device.h"
 #include "Kernel/OVR_Log.h"
+#include "Kernel/OVR_SysFile.h"
 
 namespace OVR {
 namespace Render {
@@ -24,7 +25,12 @@ PFNGLDELETEBUFFERSPROC glDeleteBuffers;
 PFNGLBUFFERDATAPROC glBufferData;
 PFNGLGENBUFFERSPROC glGenBuffers;
 PFNGLMAPBUFFERPROC glMapBuffer;
+PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
 PFNGLUNMAPBUFFERPROC glUnmapBuffer;
+PFNGLBUFFERSTORAGEPROC glBufferStorage;
+PFNGLFENCESYNCPROC glFenceSync;
+PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+PFNGLDELETESYNCPROC glDeleteSync;
 PFNGLGETSHADERINFOLOGPROC glGetShaderInfoLog;
 PFNGLGETSHADERIVPROC glGetShaderiv;
 PFNGLCOMPILESHADERPROC glCompileShader;
@@ -41,6 +47,9 @@ PFNGLUSEPROGRAMPROC glUseProgram;
 PFNGLGETPROGRAMINFOLOGPROC glGetProgramInfoLog;
 PFNGLGETPROGRAMIVPROC glGetProgramiv;
 PFNGLLINKPROGRAMPROC glLinkProgram;
+PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+PFNGLPROGRAMBINARYPROC glProgramBinary;
+PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
 PFNGLBINDATTRIBLOCATIONPROC glBindAttribLocation;
 PFNGLUNIFORM4FVPROC glUniform4fv;
 PFNGLUNIFORM3FVPROC glUniform3fv;
@@ -75,7 +84,12 @@ void InitGLExtensions()
   glBufferData = (PFNGLBUFFERDATAPROC) wglGetProcAddress("glBufferData");
   glGenBuffers = (PFNGLGENBUFFERSPROC) wglGetProcAddress("glGenBuffers");
   glMapBuffer = (PFNGLMAPBUFFERPROC) wglGetProcAddress("glMapBuffer");
+  glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC) wglGetProcAddress("glMapBufferRange");
   glUnmapBuffer = (PFNGLUNMAPBUFFERPROC) wglGetProcAddress("glUnmapBuffer");
+  glBufferStorage = (PFNGLBUFFERSTORAGEPROC) wglGetProcAddress("glBufferStorage");
+  glFenceSync = (PFNGLFENCESYNCPROC) wglGetProcAddress("glFenceSync");
+  glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC) wglGetProcAddress("glClientWaitSync");
+  glDeleteSync = (PFNGLDELETESYNCPROC) wglGetProcAddress("glDeleteSync");
   glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC) wglGetProcAddress("glGetShaderInfoLog");
   glGetShaderiv = (PFNGLGETSHADERIVPROC) wglGetProcAddress("glGetShaderiv");
   glCompileShader = (PFNGLCOMPILESHADERPROC) wglGetProcAddress("glCompileShader");
@@ -92,6 +106,9 @@ void InitGLExtensions()
   glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC) wglGetProcAddress("glGetProgramInfoLog");
   glGetProgramiv = (PFNGLGETPROGRAMIVPROC) wglGetProcAddress("glGetProgramiv");
   glLinkProgram = (PFNGLLINKPROGRAMPROC) wglGetProcAddress("glLinkProgram");
+  glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC) wglGetProcAddress("glGetProgramBinary");
+  glProgramBinary = (PFNGLPROGRAMBINARYPROC) wglGetProcAddress("glProgramBinary");
+  glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC) wglGetProcAddress("glProgramParameteri");
   glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC) wglGetProcAddress("glBindAttribLocation");
   glUniform4fv = (PFNGLUNIFORM4FVPROC) wglGetProcAddress("glUniform4fv");
   glUniform3fv = (PFNGLUNIFORM3FVPROC) wglGetProcAddress("glUniform3fv");
@@ -315,6 +332,21 @@ static const char* AlphaTextureFragShaderSrc = R"derp(
     }
 )derp";
 
+// Text from a signed distance field atlas; the edge is antialiased over one
+// screen pixel whatever the magnification.
+static const char* DistanceFieldFragShaderSrc = R"derp(
+    uniform sampler2D Texture0;
+    varying vec4 oColor;
+    varying vec2 oTexCoord;
+    void main()
+    {
+       float d = texture2D(Texture0, oTexCoord).a;
+       float w = fwidth(d) * 0.5;
+       float a = smoothstep(0.5 - w, 0.5 + w, d);
+       gl_FragColor = oColor * vec4(1,1,1,a);
+    }
+)derp";
+
 static const char* MultiTextureFragShaderSrc = R"derp(
     uniform sampler2D Texture0;
         uniform sampler2D Texture1;
@@ -353,7 +385,10 @@ static const char* PostProcessFragShaderSrc = R"derp(
     uniform vec2 Scale;
     uniform vec2 ScaleIn;
     uniform vec4 HmdWarpParam;
+    uniform mat4 Reproject;
+    uniform float OverlayWeight;
     uniform sampler2D Texture0;
+    uniform sampler2D Texture1;
     varying vec2 oTexCoord;
     
     vec2 HmdWarp(vec2 in01)
@@ -364,13 +399,26 @@ static const char* PostProcessFragShaderSrc = R"derp(
                                HmdWarpParam.z * rSq * rSq + HmdWarpParam.w * rSq * rSq * rSq);
        return LensCenter + Scale * theta1;
     }
+    // Rotational reprojection into the eye buffer; identity unless set.
+    vec2 Reprojected(vec2 tc)
+    {
+       vec3 p = (Reproject * vec4(tc, 1, 0)).xyz;
+       return p.xy / p.z;
+    }
+    bool InEye(vec2 tc)
+    {
+       return all(equal(clamp(tc, ScreenCenter-vec2(0.25,0.5), ScreenCenter+vec2(0.25,0.5)), tc));
+    }
     void main()
     {
-       vec2 tc = HmdWarp(oTexCoord);
-       if (!all(equal(clamp(tc, ScreenCenter-vec2(0.25,0.5), ScreenCenter+vec2(0.25,0.5)), tc)))
-           gl_FragColor = vec4(0);
-       else
+       vec2 warped = HmdWarp(oTexCoord);
+       vec2 tc = Reprojected(warped);
+       gl_FragColor = vec4(0);
+       if (InEye(tc))
            gl_FragColor = texture2D(Texture0, tc);
+       // The head-locked overlay layer is not reprojected.
+       if (InEye(warped))
+           gl_FragColor.rgb += OverlayWeight * texture2D(Texture1, warped).rgb;
     }
 )derp";
 
@@ -382,9 +430,23 @@ static const char* PostProcessFullFragShaderSrc = R"derp(
     uniform vec2 ScaleIn;
     uniform vec4 HmdWarpParam;
     uniform vec4 ChromAbParam;
+    uniform mat4 Reproject;
+    uniform float OverlayWeight;
     uniform sampler2D Texture0;
+    uniform sampler2D Texture1;
     varying vec2 oTexCoord;
     
+    // Rotational reprojection into the eye buffer; identity unless set.
+    vec2 Reprojected(vec2 tc)
+    {
+       vec3 p = (Reproject * vec4(tc, 1, 0)).xyz;
+       return p.xy / p.z;
+    }
+    bool InEye(vec2 tc)
+    {
+       return all(equal(clamp(tc, ScreenCenter-vec2(0.25,0.5), ScreenCenter+vec2(0.25,0.5)), tc));
+    }
+    
     // Scales input texture coordinates for distortion.
     // ScaleIn maps texture coordinates to Scales to ([-1, 1]), although top/bottom will be
     // larger due to aspect ratio.
@@ -395,28 +457,35 @@ static const char* PostProcessFullFragShaderSrc = R"derp(
        vec2  theta1 = theta * (HmdWarpParam.x + HmdWarpParam.y * rSq + 
                       HmdWarpParam.z * rSq * rSq + HmdWarpParam.w * rSq * rSq * rSq);
        
+       vec2  thetaBlue = theta1 * (ChromAbParam.z + ChromAbParam.w * rSq);
+       vec2  thetaRed = theta1 * (ChromAbParam.x + ChromAbParam.y * rSq);
+       vec2  warpedBlue = LensCenter + Scale * thetaBlue;
+       vec2  warpedGreen = LensCenter + Scale * theta1;
+       vec2  warpedRed = LensCenter + Scale * thetaRed;
+       
        // Detect whether blue texture coordinates are out of range since these will scaled out the furthest.
-       vec2 thetaBlue = theta1 * (ChromAbParam.z + ChromAbParam.w * rSq);
-       vec2 tcBlue = LensCenter + Scale * thetaBlue;
-       if (!all(equal(clamp(tcBlue, ScreenCenter-vec2(0.25,0.5), ScreenCenter+vec2(0.25,0.5)), tcBlue)))
+       vec2 tcBlue = Reprojected(warpedBlue);
+       gl_FragColor = vec4(0);
+       if (InEye(tcBlue))
        {
-           gl_FragColor = vec4(0);
-           return;
+           // Now do blue texture lookup.
+           float blue = texture2D(Texture0, tcBlue).b;
+           
+           // Do green lookup (no scaling).
+           vec4  center = texture2D(Texture0, Reprojected(warpedGreen));
+           
+           // Do red scale and lookup.
+           float red = texture2D(Texture0, Reprojected(warpedRed)).r;
+           
+           gl_FragColor = vec4(red, center.g, blue, center.a);
        }
        
-       // Now do blue texture lookup.
-       float blue = texture2D(Texture0, tcBlue).b;
-       
-       // Do green lookup (no scaling).
-       vec2  tcGreen = LensCenter + Scale * theta1;
-       vec4  center = texture2D(Texture0, tcGreen);
-       
-       // Do red scale and lookup.
-       vec2  thetaRed = theta1 * (ChromAbParam.x + ChromAbParam.y * rSq);
-       vec2  tcRed = LensCenter + Scale * thetaRed;
-       float red = texture2D(Texture0, tcRed).r;
-       
-       gl_FragColor = vec4(red, center.g, blue, center.a);
+       // The head-locked overlay layer is not reprojected.
+       if (InEye(warpedBlue))
+       {
+           gl_FragColor.rgb += OverlayWeight * vec3(texture2D(Texture1, warpedRed).r,
+               texture2D(Texture1, warpedGreen).g, texture2D(Texture1, warpedBlue).b);
+       }
     }
 )derp";
 
@@ -427,34 +496,217 @@ static const char* FShaderSrcs[FShader_Count] = { SolidFragShaderSrc,
     GouraudFragShaderSrc, TextureFragShaderSrc, AlphaTextureFragShaderSrc,
     PostProcessFragShaderSrc, PostProcessFullFragShaderSrc,
     LitSolidFragShaderSrc, LitTextureFragShaderSrc, MultiTextureFragShaderSrc,
-    DebugFragShaderSrc };
-
-RenderDevice::RenderDevice(const RendererParams&) {
-  for (int i = 0; i < VShader_Count; i++)
-    VertexShaders[i] = *new Shader(this, Shader_Vertex, VShaderSrcs[i]);
-
-  for (int i = 0; i < FShader_Count; i++)
-    FragShaders[i] = *new Shader(this, Shader_Fragment, FShaderSrcs[i]);
+    DebugFragShaderSrc, DistanceFieldFragShaderSrc };
+
+RenderDevice::RenderDevice(const RendererParams& p)
+    : ProgramBinariesLoaded(false), ProgramBinariesSupported(false),
+      ProgramBinariesDirty(false) {
+  Params = p;
+#if defined(OVR_GL_PERSISTENT_MAPPING)
+  StreamVerticesChecked = false;
+#endif
 
-  Ptr<ShaderSet> gouraudShaders = *new ShaderSet();
-  gouraudShaders->SetShader(VertexShaders[VShader_MVP]);
-  gouraudShaders->SetShader(FragShaders[FShader_Gouraud]);
+  // Builtin shaders are compiled by LoadBuiltinShader on first use.
+  Ptr<ShaderSet> gouraudShaders = *new ShaderSet(this);
+  gouraudShaders->SetShader(LoadBuiltinShader(Shader_Vertex, VShader_MVP));
+  gouraudShaders->SetShader(LoadBuiltinShader(Shader_Fragment, FShader_Gouraud));
   DefaultFill = *new ShaderFill(gouraudShaders);
 
   glGenFramebuffersEXT(1, &CurrentFbo);
+
+  // The distortion shaders add the overlay layer after reprojecting the scene.
+  OverlaySupported = true;
+}
+
+void RenderDevice::Shutdown() {
+  saveProgramBinaries();
+  Programs.Clear();
 }
 
 Shader *RenderDevice::LoadBuiltinShader(ShaderStage stage, int shader) {
   switch (stage) {
     case Shader_Vertex:
+      if (!VertexShaders[shader])
+        VertexShaders[shader] = *new Shader(this, Shader_Vertex, VShaderSrcs[shader]);
       return VertexShaders[shader];
     case Shader_Fragment:
+      if (!FragShaders[shader])
+        FragShaders[shader] = *new Shader(this, Shader_Fragment, FShaderSrcs[shader]);
       return FragShaders[shader];
     default:
       return NULL;
   }
 }
 
+#if defined(OVR_GL_PROGRAM_BINARY)
+// Separates the two sources in a program binary key; can't occur in GLSL.
+static const UInt32 ProgramCacheKeySeparator = 1;
+#endif
+
+Program* RenderDevice::GetProgram(Shader* vs, Shader* fs) {
+  ProgramKey key = { vs, fs };
+  Ptr<Program>* cached = Programs.Get(key);
+  if (cached) {
+    return *cached;
+  }
+
+  Ptr<Program> prog = *new Program(vs, fs);
+  bool linked = false;
+  bool cacheable = false;
+
+#if defined(OVR_GL_PROGRAM_BINARY)
+  // Keyed by both sources in full, so a hit is always the same program.
+  String binaryKey;
+  cacheable = !vs->Source.IsEmpty() && !fs->Source.IsEmpty()
+      && !Params.ShaderCachePath.IsEmpty() && loadProgramBinaries();
+  if (cacheable) {
+    binaryKey = vs->Source;
+    binaryKey.AppendChar(ProgramCacheKeySeparator);
+    binaryKey += fs->Source;
+    const ProgramBinary* binary = ProgramBinaries.Get(binaryKey);
+    if (binary) {
+      linked = prog->LoadBinary(binary->Format, &binary->Data[0],
+          (int) binary->Data.GetSize());
+    }
+  }
+#endif
+
+  if (!linked) {
+    if (!prog->Link(cacheable)) {
+      return NULL;
+    }
+#if defined(OVR_GL_PROGRAM_BINARY)
+    ProgramBinary binary;
+    if (cacheable && prog->GetBinary(&binary.Format, &binary.Data)) {
+      ProgramBinaries.Set(binaryKey, binary);
+      ProgramBinariesDirty = true;
+    }
+#endif
+  }
+
+  Programs.Add(key, prog);
+  return prog;
+}
+
+#if defined(OVR_GL_PROGRAM_BINARY)
+
+// Program binary cache file: header, then one record per program. Strings are
+// stored as a length and that many bytes.
+//   magic, version, driver id, record count
+//   record: key (vertex source, separator, fragment source), format, binary
+static const UInt32 ProgramCacheMagic = 0x5052564F; // "OVRP"
+static const UInt32 ProgramCacheVersion = 2;
+
+static bool readCacheBytes(File* file, Array<UByte>* data) {
+  UInt32 size = file->ReadUInt32();
+  if (size == 0 || size > (UInt32) file->GetLength()) {
+    return false;
+  }
+  data->Resize(size);
+  return file->Read(&(*data)[0], (int) size) == (int) size;
+}
+
+static bool readCacheString(File* file, String* str) {
+  Array<UByte> data;
+  if (!readCacheBytes(file, &data)) {
+    return false;
+  }
+  *str = String((const char*) &data[0], data.GetSize());
+  return true;
+}
+
+static void writeCacheString(File* file, const String& str) {
+  file->WriteUInt32((UInt32) str.GetSize());
+  file->Write((const UByte*) str.ToCStr(), (int) str.GetSize());
+}
+
+bool RenderDevice::loadProgramBinaries() {
+  if (ProgramBinariesLoaded) {
+    return ProgramBinariesSupported;
+  }
+  ProgramBinariesLoaded = true;
+
+  const char* extensions = (const char*) glGetString(GL_EXTENSIONS);
+  GLint formats = 0;
+  if (extensions && strstr(extensions, "GL_ARB_get_program_binary")) {
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+  }
+  ProgramBinariesSupported = formats > 0;
+  if (!ProgramBinariesSupported) {
+    return false;
+  }
+
+  DriverId = (const char*) glGetString(GL_VENDOR);
+  DriverId += "\n";
+  DriverId += (const char*) glGetString(GL_RENDERER);
+  DriverId += "\n";
+  DriverId += (const char*) glGetString(GL_VERSION);
+
+  SysFile file;
+  if (!file.Open(Params.ShaderCachePath, File::Open_Read | File::Open_Buffered)) {
+    return true;
+  }
+  String driver;
+  if (file.ReadUInt32() != ProgramCacheMagic
+      || file.ReadUInt32() != ProgramCacheVersion
+      || !readCacheString(&file, &driver) || driver != DriverId) {
+    return true;
+  }
+
+  UInt32 count = file.ReadUInt32();
+  for (UInt32 i = 0; i < count; i++) {
+    String key;
+    ProgramBinary binary;
+    if (!readCacheString(&file, &key)) {
+      break;
+    }
+    binary.Format = file.ReadUInt32();
+    if (!readCacheBytes(&file, &binary.Data)) {
+      break;
+    }
+    ProgramBinaries.Set(key, binary);
+  }
+  return true;
+}
+
+void RenderDevice::saveProgramBinaries() {
+  if (!ProgramBinariesDirty) {
+    return;
+  }
+  ProgramBinariesDirty = false;
+
+  SysFile file;
+  if (!file.Open(Params.ShaderCachePath,
+      File::Open_Write | File::Open_Create | File::Open_Truncate)) {
+    LogError("Could not write shader cache %s", Params.ShaderCachePath.ToCStr());
+    return;
+  }
+
+  file.WriteUInt32(ProgramCacheMagic);
+  file.WriteUInt32(ProgramCacheVersion);
+  writeCacheString(&file, DriverId);
+  file.WriteUInt32((UInt32) ProgramBinaries.GetSize());
+  for (Hash<String, ProgramBinary, String::HashFunctor>::ConstIterator it =
+      ProgramBinaries.Begin(); it != ProgramBinaries.End(); ++it) {
+    const ProgramBinary& binary = it->Second;
+    writeCacheString(&file, it->First);
+    file.WriteUInt32(binary.Format);
+    file.WriteUInt32((UInt32) binary.Data.GetSize());
+    file.Write(&binary.Data[0], (int) binary.Data.GetSize());
+  }
+}
+
+#else
+
+bool RenderDevice::loadProgramBinaries() {
+  return false;
+}
+
+void RenderDevice::saveProgramBinaries() {
+}
+
+#endif
+
 void RenderDevice::BeginRendering() {
   glEnable(GL_DEPTH_TEST);
   //glEnable(GL_CULL_FACE);
@@ -591,66 +843,78 @@ void RenderDevice::Render(const Matrix4f& matrix, Model* model, const ViewMatric
       (int) model->Indices.GetSize(), model->GetPrimType(), fullView);
 }
 
-void RenderDevice::Render(const Fill* fill, Render::Buffer* vertices,
-    Render::Buffer* indices, const Matrix4f& matrix, int offset, int count,
-    PrimitiveType rprim, const ViewMatrices* fullView) {
+bool RenderDevice::applyFill(const Fill* fill, const Matrix4f& matrix,
+    const ViewMatrices* fullView) {
   ShaderSet* shaders = (ShaderSet*) ((ShaderFill*) fill)->GetShaders();
-
-  GLenum prim;
-  switch (rprim) {
-    case Prim_Triangles:
-      prim = GL_TRIANGLES;
-      break;
-    case Prim_Lines:
-      prim = GL_LINES;
-      break;
-    case Prim_TriangleStrip:
-      prim = GL_TRIANGLE_STRIP;
-      break;
-    default:
-      assert(0);
-      return;
+  Program* prog = shaders->pProgram;
+  if (!prog) {
+    return false;
   }
 
   fill->Set();
-  if (shaders->ProjLoc >= 0) {
-    glUniformMatrix4fv(shaders->ProjLoc, 1, 0, &Proj.M[0][0]);
+  if (prog->ProjLoc >= 0) {
+    glUniformMatrix4fv(prog->ProjLoc, 1, 0, &Proj.M[0][0]);
   }
-  if (shaders->ViewLoc >= 0) {
-    glUniformMatrix4fv(shaders->ViewLoc, 1, 0, &matrix.Transposed().M[0][0]);
+  if (prog->ViewLoc >= 0) {
+    glUniformMatrix4fv(prog->ViewLoc, 1, 0, &matrix.Transposed().M[0][0]);
   }
 
   fd::Mat4f iden;
   iden.storeIdentity();
-  if (shaders->WorldMatLoc >= 0) {
-    glUniformMatrix4fv(shaders->WorldMatLoc, 1, false, iden.raw());
+  if (prog->WorldMatLoc >= 0) {
+    glUniformMatrix4fv(prog->WorldMatLoc, 1, false, iden.raw());
   }
 
   fd::Vec4f zero;
-  if (shaders->WorldPosLoc >= 0) {
-    glUniform4fv(shaders->WorldPosLoc, 1, zero.raw());
+  if (prog->WorldPosLoc >= 0) {
+    glUniform4fv(prog->WorldPosLoc, 1, zero.raw());
   }
 
-  if (fullView && shaders->CameraPosLoc >= 0) {
-    glUniform4fv(shaders->CameraPosLoc, 1, fullView->CameraPos.raw());
+  if (fullView && prog->CameraPosLoc >= 0) {
+    glUniform4fv(prog->CameraPosLoc, 1, fullView->CameraPos.raw());
   }
 
-  if (fullView && shaders->CameraMatrixLoc >= 0) {
-    glUniformMatrix4fv(shaders->CameraMatrixLoc, 1, false, fullView->CameraView.raw());
+  if (fullView && prog->CameraMatrixLoc >= 0) {
+    glUniformMatrix4fv(prog->CameraMatrixLoc, 1, false, fullView->CameraView.raw());
   }
 
-  if (fullView && shaders->FourToThreeLoc >= 0) {
-    glUniformMatrix4fv(shaders->FourToThreeLoc, 1, false, fullView->FourToThree.raw());
+  if (fullView && prog->FourToThreeLoc >= 0) {
+    glUniformMatrix4fv(prog->FourToThreeLoc, 1, false, fullView->FourToThree.raw());
   }
 
-  if (fullView && shaders->FourNearFarPlaneLoc >= 0) {
-    glUniform4fv(shaders->FourNearFarPlaneLoc, 1, fullView->FourNearFarPlane.raw());
+  if (fullView && prog->FourNearFarPlaneLoc >= 0) {
+    glUniform4fv(prog->FourNearFarPlaneLoc, 1, fullView->FourNearFarPlane.raw());
   }
 
-  if (shaders->UsesLighting && Lighting->Version != shaders->LightingVer) {
-    shaders->LightingVer = Lighting->Version;
+  if (prog->UsesLighting && Lighting->Version != prog->LightingVer) {
+    prog->LightingVer = Lighting->Version;
     Lighting->Set(shaders);
   }
+  return true;
+}
+
+void RenderDevice::Render(const Fill* fill, Render::Buffer* vertices,
+    Render::Buffer* indices, const Matrix4f& matrix, int offset, int count,
+    PrimitiveType rprim, const ViewMatrices* fullView) {
+  GLenum prim;
+  switch (rprim) {
+    case Prim_Triangles:
+      prim = GL_TRIANGLES;
+      break;
+    case Prim_Lines:
+      prim = GL_LINES;
+      break;
+    case Prim_TriangleStrip:
+      prim = GL_TRIANGLE_STRIP;
+      break;
+    default:
+      assert(0);
+      return;
+  }
+
+  if (!applyFill(fill, matrix, fullView)) {
+    return;
+  }
 
   glBindBuffer(GL_ARRAY_BUFFER, ((Buffer*) vertices)->GLBuffer);
   for (int i = 0; i < 5; i++) {
@@ -692,6 +956,35 @@ void RenderDevice::RenderWithAlpha(const Fill* fill, Render::Buffer* vertices,
   //glDisable(GL_BLEND);
 }
 
+void RenderDevice::RenderGlyphs(const Fill* fill, Render::Buffer* vertices,
+    const Matrix4f& matrix, int offset, int count) {
+  if (!applyFill(fill, matrix, NULL)) {
+    return;
+  }
+
+  // Normal and second texture coordinate are left disabled and read as constants.
+  glBindBuffer(GL_ARRAY_BUFFER, ((Buffer*) vertices)->GLBuffer);
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(2);
+  glEnableVertexAttribArray(4);
+
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"     // To suppress offsetof warning.
+  char* pointer_offset = reinterpret_cast<char*>(offset);
+  glVertexAttribPointer(0, 2, GL_FLOAT, false, sizeof(GlyphVertex),
+      pointer_offset + offsetof(GlyphVertex, X));
+  glVertexAttribPointer(2, 2, GL_UNSIGNED_SHORT, true, sizeof(GlyphVertex),
+      pointer_offset + offsetof(GlyphVertex, U));
+  glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, true, sizeof(GlyphVertex),
+      pointer_offset + offsetof(GlyphVertex, C));
+#pragma GCC diagnostic warning "-Winvalid-offsetof"
+
+  glDrawArrays(GL_TRIANGLES, 0, count);
+
+  glDisableVertexAttribArray(0);
+  glDisableVertexAttribArray(2);
+  glDisableVertexAttribArray(4);
+}
+
 void RenderDevice::SetLighting(const LightingParams* lt) {
   Lighting = lt;
 }
@@ -726,12 +1019,14 @@ bool Buffer::Data(int use, const void* buffer, size_t size) {
 }
 
 void* Buffer::Map(size_t start, size_t size, int flags) {
-  int mode = GL_WRITE_ONLY;
-  //if (flags & Map_Unsynchronized)
-  //    mode |= GL_MAP_UNSYNCHRONIZED;
+  GLbitfield access = GL_MAP_WRITE_BIT;
+  if (flags & Map_Discard)
+    access |= GL_MAP_INVALIDATE_BUFFER_BIT;
+  if (flags & Map_Unsynchronized)
+    access |= GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
 
   glBindBuffer(Use, GLBuffer);
-  void* v = glMapBuffer(Use, mode);
+  void* v = glMapBufferRange(Use, start, size, access);
   glBindBuffer(Use, 0);
   return v;
 }
@@ -743,10 +1038,130 @@ bool Buffer::Unmap(void*) {
   return r;
 }
 
-bool Shader::Compile(const char* src) {
-  if (!GLShader)
-    GLShader = glCreateShader(GLStage());
+#if defined(OVR_GL_PERSISTENT_MAPPING)
+
+StreamBuffer::StreamBuffer(RenderDevice* r)
+    : Buffer(r), pMapped(NULL), SegmentSize(0), Head(0), CurrentSegment(0) {
+  for (int i = 0; i < SegmentCount; i++)
+    SegmentFences[i] = 0;
+}
+
+StreamBuffer::~StreamBuffer() {
+  for (int i = 0; i < SegmentCount; i++)
+    if (SegmentFences[i])
+      glDeleteSync(SegmentFences[i]);
+
+  if (pMapped) {
+    glBindBuffer(Use, GLBuffer);
+    glUnmapBuffer(Use);
+    glBindBuffer(Use, 0);
+  }
+}
+
+bool StreamBuffer::Init(size_t size) {
+  const char* extensions = (const char*) glGetString(GL_EXTENSIONS);
+  if (!extensions || !strstr(extensions, "GL_ARB_buffer_storage"))
+    return false;
+
+  GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT
+      | GL_MAP_COHERENT_BIT;
+
+  Use = GL_ARRAY_BUFFER;
+  glGenBuffers(1, &GLBuffer);
+  glBindBuffer(Use, GLBuffer);
+  glBufferStorage(Use, size, NULL, access);
+  pMapped = (UByte*) glMapBufferRange(Use, 0, size, access);
+  glBindBuffer(Use, 0);
+  if (!pMapped)
+    return false;
+
+  Size = size;
+  SegmentSize = size / SegmentCount;
+  return true;
+}
 
+void StreamBuffer::waitSegment(int segment) {
+  GLsync fence = SegmentFences[segment];
+  if (!fence)
+    return;
+
+  for (;;) {
+    GLenum r = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+    if (r == GL_ALREADY_SIGNALED || r == GL_CONDITION_SATISFIED
+        || r == GL_WAIT_FAILED)
+      break;
+  }
+  glDeleteSync(fence);
+  SegmentFences[segment] = 0;
+}
+
+void* StreamBuffer::Alloc(size_t size, size_t* offset) {
+  if (size == 0 || size > SegmentSize)
+    return NULL;
+
+  // Allocations never straddle segments, so a segment's fence covers every draw
+  // that reads from it.
+  size_t start = Head;
+  if (start / SegmentSize != (start + size - 1) / SegmentSize)
+    start = ((start / SegmentSize) + 1) * SegmentSize;
+  if (start + size > Size)
+    start = 0;
+
+  int segment = (int) (start / SegmentSize);
+  if (segment != CurrentSegment) {
+    // All draws using CurrentSegment have been issued by now.
+    SegmentFences[CurrentSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,
+        0);
+    waitSegment(segment);
+    CurrentSegment = segment;
+  }
+
+  Head = start + size;
+  *offset = start;
+  return pMapped + start;
+}
+
+#endif
+
+void* RenderDevice::MapDynamicVertices(size_t size, Render::Buffer** buffer,
+    int* byteOffset) {
+#if defined(OVR_GL_PERSISTENT_MAPPING)
+  if (!StreamVerticesChecked) {
+    StreamVerticesChecked = true;
+    Ptr<StreamBuffer> stream = *new StreamBuffer(this);
+    if (stream->Init(DynamicVertexCapacity))
+      pStreamVertices = stream;
+  }
+
+  if (pStreamVertices) {
+    size_t offset;
+    void* vertices = pStreamVertices->Alloc(size, &offset);
+    if (vertices) {
+      *buffer = pStreamVertices;
+      *byteOffset = (int) offset;
+      return vertices;
+    }
+  }
+#endif
+
+  return Render::RenderDevice::MapDynamicVertices(size, buffer, byteOffset);
+}
+
+void RenderDevice::UnmapDynamicVertices(void* vertices) {
+#if defined(OVR_GL_PERSISTENT_MAPPING)
+  if (pStreamVertices && pStreamVertices->Owns(vertices))
+    return;
+#endif
+
+  Render::RenderDevice::UnmapDynamicVertices(vertices);
+}
+
+bool Shader::Compile() {
+  if (GLShader)
+    return 1;
+
+  GLShader = glCreateShader(GLStage());
+  const char* src = Source.ToCStr();
   glShaderSource(GLShader, 1, &src, 0);
   glCompileShader(GLShader);
   GLint r;
@@ -756,30 +1171,45 @@ bool Shader::Compile(const char* src) {
     glGetShaderInfoLog(GLShader, sizeof(msg), 0, msg);
     if (msg[0])
       OVR::LogError("Compiling shader\n%s\nfailed: %s\n", src, msg);
-    if (!r)
-      return 0;
+    glDeleteShader(GLShader);
+    GLShader = 0;
+    return 0;
   }
   return 1;
 }
 
-ShaderSet::ShaderSet()
-    : WorldMatLoc(0), WorldPosLoc(0), CameraPosLoc(0), CameraMatrixLoc(0)
-     ,FourToThreeLoc(0), FourNearFarPlaneLoc(0), ProjLoc(0), ViewLoc(0)
- {
+Program::Program(Shader* vs, Shader* fs)
+    : VertexShader(vs), FragmentShader(fs), ProjLoc(-1), ViewLoc(-1),
+      WorldMatLoc(-1), WorldPosLoc(-1), CameraPosLoc(-1), CameraMatrixLoc(-1),
+      FourToThreeLoc(-1), FourNearFarPlaneLoc(-1), UsesLighting(0),
+      LightingVer(0) {
   Prog = glCreateProgram();
 }
 
-ShaderSet::~ShaderSet() {
+Program::~Program() {
   glDeleteProgram(Prog);
 }
 
-bool ShaderSet::Link() {
+bool Program::Link(bool retrievable) {
+  if (!VertexShader->Compile() || !FragmentShader->Compile())
+    return 0;
+
+  glAttachShader(Prog, VertexShader->GLShader);
+  glAttachShader(Prog, FragmentShader->GLShader);
+
   glBindAttribLocation(Prog, 0, "Position");
   glBindAttribLocation(Prog, 1, "Normal");
   glBindAttribLocation(Prog, 2, "TexCoord");
   glBindAttribLocation(Prog, 3, "TexCoord1");
   glBindAttribLocation(Prog, 4, "Color");
 
+#if defined(OVR_GL_PROGRAM_BINARY)
+  if (retrievable)
+    glProgramParameteri(Prog, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#else
+  OVR_UNUSED(retrievable);
+#endif
+
   glLinkProgram(Prog);
   GLint r;
   glGetProgramiv(Prog, GL_LINK_STATUS, &r);
@@ -787,9 +1217,48 @@ bool ShaderSet::Link() {
     GLchar msg[1024];
     glGetProgramInfoLog(Prog, sizeof(msg), 0, msg);
     LogError("Linking shaders failed: %s\n", msg);
-    if (!r)
-      return 0;
+    return 0;
   }
+
+  reflect();
+  return 1;
+}
+
+bool Program::LoadBinary(GLenum format, const void* data, int size) {
+#if defined(OVR_GL_PROGRAM_BINARY)
+  glProgramBinary(Prog, format, data, size);
+  GLint r;
+  glGetProgramiv(Prog, GL_LINK_STATUS, &r);
+  if (!r)
+    return 0;
+
+  reflect();
+  return 1;
+#else
+  OVR_UNUSED3(format, data, size);
+  return 0;
+#endif
+}
+
+bool Program::GetBinary(GLenum* format, Array<UByte>* data) const {
+#if defined(OVR_GL_PROGRAM_BINARY)
+  GLint size = 0;
+  glGetProgramiv(Prog, GL_PROGRAM_BINARY_LENGTH, &size);
+  if (size <= 0)
+    return 0;
+
+  data->Resize(size);
+  GLsizei written = 0;
+  glGetProgramBinary(Prog, size, &written, format, &(*data)[0]);
+  data->Resize(written);
+  return written > 0;
+#else
+  OVR_UNUSED2(format, data);
+  return 0;
+#endif
+}
+
+void Program::reflect() {
   glUseProgram(Prog);
 
   UniformInfo.Clear();
@@ -862,14 +1331,29 @@ bool ShaderSet::Link() {
   }
   if (UsesLighting)
     OVR_ASSERT(ProjLoc >= 0 && ViewLoc >= 0);
-  return 1;
+}
+
+bool ShaderSet::Link() {
+  Shader* vs = (Shader*) (Render::Shader*) Shaders[Shader_Vertex];
+  Shader* fs = (Shader*) (Render::Shader*) Shaders[Shader_Fragment];
+  pProgram = NULL;
+  if (!vs || !fs)
+    return 0;
+
+  pProgram = Ren->GetProgram(vs, fs);
+  return pProgram != NULL;
 }
 
 void ShaderSet::Set(PrimitiveType) const {
-  glUseProgram(Prog);
+  if (pProgram)
+    glUseProgram(pProgram->Prog);
 }
 
 bool ShaderSet::SetUniform(const char* name, int n, const float* v) {
+  if (!pProgram)
+    return 0;
+  const Array<Program::Uniform>& UniformInfo = pProgram->UniformInfo;
+  GLuint Prog = pProgram->Prog;
   for (UPInt i = 0; i < UniformInfo.GetSize(); i++)
     if (!strcmp(UniformInfo[i].Name.ToCStr(), name)) {
       OVR_ASSERT(UniformInfo[i].Location >= 0);
@@ -899,6 +1383,10 @@ bool ShaderSet::SetUniform(const char* name, int n, const float* v) {
 }
 
 bool ShaderSet::SetUniform4x4f(const char* name, const Matrix4f& m) {
+  if (!pProgram)
+    return 0;
+  const Array<Program::Uniform>& UniformInfo = pProgram->UniformInfo;
+  GLuint Prog = pProgram->Prog;
   for (UPInt i = 0; i < UniformInfo.GetSize(); i++)
     if (!strcmp(UniformInfo[i].Name.ToCStr(), name)) {
       glUseProgram(Prog);
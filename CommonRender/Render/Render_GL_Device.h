@@ -19,6 +19,19 @@
 #include <GL/glext.h>
 #endif
 
+// Persistently mapped streaming buffers need GL_ARB_buffer_storage (GL 4.4) at
+// compile time; availability is still checked at runtime.
+#if defined(GL_MAP_PERSISTENT_BIT) && defined(GL_SYNC_GPU_COMMANDS_COMPLETE)
+#define OVR_GL_PERSISTENT_MAPPING 1
+#endif
+
+// Linked programs can be saved and reloaded with GL_ARB_get_program_binary (GL 4.1).
+#if defined(GL_PROGRAM_BINARY_LENGTH)
+#define OVR_GL_PROGRAM_BINARY 1
+#endif
+
+#include "Kernel/OVR_Hash.h"
+
 namespace OVR {
 namespace Render {
 namespace GL {
@@ -42,7 +55,12 @@ extern PFNGLDELETEBUFFERSPROC glDeleteBuffers;
 extern PFNGLBUFFERDATAPROC glBufferData;
 extern PFNGLGENBUFFERSPROC glGenBuffers;
 extern PFNGLMAPBUFFERPROC glMapBuffer;
+extern PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
 extern PFNGLUNMAPBUFFERPROC glUnmapBuffer;
+extern PFNGLBUFFERSTORAGEPROC glBufferStorage;
+extern PFNGLFENCESYNCPROC glFenceSync;
+extern PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+extern PFNGLDELETESYNCPROC glDeleteSync;
 extern PFNGLGETSHADERINFOLOGPROC glGetShaderInfoLog;
 extern PFNGLGETSHADERIVPROC glGetShaderiv;
 extern PFNGLCOMPILESHADERPROC glCompileShader;
@@ -59,6 +77,9 @@ extern PFNGLUSEPROGRAMPROC glUseProgram;
 extern PFNGLGETPROGRAMINFOLOGPROC glGetProgramInfoLog;
 extern PFNGLGETPROGRAMIVPROC glGetProgramiv;
 extern PFNGLLINKPROGRAMPROC glLinkProgram;
+extern PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+extern PFNGLPROGRAMBINARYPROC glProgramBinary;
+extern PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
 extern PFNGLBINDATTRIBLOCATIONPROC glBindAttribLocation;
 extern PFNGLUNIFORM4FVPROC glUniform4fv;
 extern PFNGLUNIFORM3FVPROC glUniform3fv;
@@ -104,6 +125,54 @@ public:
   virtual bool Data(int use, const void* buffer, size_t size);
 };
 
+#if defined(OVR_GL_PERSISTENT_MAPPING)
+
+// Vertex ring that stays mapped for its whole lifetime. The ring is split into
+// segments; a fence is placed when writing leaves a segment and waited on before
+// it is reused, so the CPU never overwrites vertices the GPU hasn't consumed.
+class StreamBuffer: public Buffer {
+public:
+  enum {
+    SegmentCount = 4
+  };
+
+  UByte* pMapped;
+  size_t SegmentSize;
+  size_t Head;
+  int CurrentSegment;
+  GLsync SegmentFences[SegmentCount];
+
+  StreamBuffer(RenderDevice* r);
+  ~StreamBuffer();
+
+  // Creates immutable storage; fails if the driver lacks GL_ARB_buffer_storage.
+  bool Init(size_t size);
+
+  // Returns NULL if size doesn't fit in one segment.
+  void* Alloc(size_t size, size_t* offset);
+
+  bool Owns(const void* p) const {
+    return (const UByte*) p >= pMapped && (const UByte*) p < pMapped + Size;
+  }
+
+  virtual void* Map(size_t start, size_t size, int flags = 0) {
+    OVR_UNUSED2(size, flags);
+    return pMapped + start;
+  }
+  virtual bool Unmap(void*) {
+    return true;
+  }
+  virtual bool Data(int, const void*, size_t) {
+    OVR_ASSERT(0); // Storage is immutable.
+    return false;
+  }
+
+private:
+  void waitSegment(int segment);
+};
+
+#endif
+
 class Texture: public Render::Texture {
 public:
   RenderDevice* Ren;
@@ -127,21 +196,25 @@ public:
 
 class Shader: public Render::Shader {
 public:
+  // 0 until compiled.
   GLuint GLShader;
+  // Compiled on first link, so programs restored from the binary cache never
+  // compile it. Empty for shaders made from a GL object, which aren't cached.
+  String Source;
 
   Shader(RenderDevice*, ShaderStage st, GLuint s)
       : Render::Shader(st), GLShader(s) {
   }
   Shader(RenderDevice*, ShaderStage st, const char* src)
-      : Render::Shader(st), GLShader(0) {
-    Compile(src);
+      : Render::Shader(st), GLShader(0), Source(src) {
   }
   ~Shader() {
     if (GLShader) {
       glDeleteShader(GLShader);
     }
   }
-  bool Compile(const char* src);
+  // Compiles Source if that hasn't been done yet.
+  bool Compile();
 
   GLenum GLStage() const {
     switch (Stage) {
@@ -159,9 +232,13 @@ public:
   //void SetUniformBuffer(Render::Buffer* buffers, int i = 0);
 };
 
-class ShaderSet: public Render::ShaderSet {
+// A linked program and its uniform locations. One is shared by every ShaderSet
+// using the same vertex/fragment pair; see RenderDevice::GetProgram.
+class Program: public RefCountBase<Program> {
 public:
   GLuint Prog;
+  Ptr<Shader> VertexShader;
+  Ptr<Shader> FragmentShader;
 
   struct Uniform {
     String Name;
@@ -185,24 +262,37 @@ public:
   bool UsesLighting;
   int LightingVer;
 
-  ShaderSet();
-  ~ShaderSet();
+  Program(Shader* vs, Shader* fs);
+  ~Program();
+
+  // Compiles the shaders if needed and links them. A retrievable program can
+  // be saved with GetBinary.
+  bool Link(bool retrievable);
+  // Restores a binary saved by GetBinary; fails if the driver rejects it.
+  bool LoadBinary(GLenum format, const void* data, int size);
+  bool GetBinary(GLenum* format, Array<UByte>* data) const;
+
+private:
+  void reflect();
+};
+
+class ShaderSet: public Render::ShaderSet {
+public:
+  RenderDevice* Ren;
+  // NULL until both stages are set.
+  Ptr<Program> pProgram;
+
+  ShaderSet(RenderDevice* r)
+      : Ren(r) {
+  }
 
   virtual void SetShader(Render::Shader *s) {
     Shaders[s->GetStage()] = s;
-    Shader* gls = (Shader*) s;
-    glAttachShader(Prog, gls->GLShader);
-    if (Shaders[Shader_Vertex] && Shaders[Shader_Fragment]) {
-      Link();
-    }
+    Link();
   }
   virtual void UnsetShader(int stage) {
-    Shader* gls = (Shader*) (Render::Shader*) Shaders[stage];
-    if (gls) {
-      glDetachShader(Prog, gls->GLShader);
-    }
     Shaders[stage] = NULL;
-    Link();
+    pProgram = NULL;
   }
 
   virtual void Set(PrimitiveType prim) const;
@@ -210,6 +300,7 @@ public:
   // Set a uniform (other than the standard matrices). It is undefined whether the
   // uniforms from one shader occupy the same space as those in other shaders
   // (unless a buffer is used, then each buffer is independent).
+  // Sets sharing a program share its uniforms.
   virtual bool SetUniform(const char* name, int n, const float* v);
   virtual bool SetUniform4x4f(const char* name, const Matrix4f& m);
 
@@ -239,8 +330,64 @@ class RenderDevice: public Render::RenderDevice {
 
   const LightingParams* Lighting;
 
+  // Linked programs by shader pair, so identical ShaderSets share one program.
+  struct ProgramKey {
+    const Shader* VS;
+    const Shader* FS;
+
+    bool operator==(const ProgramKey& b) const {
+      return VS == b.VS && FS == b.FS;
+    }
+    struct HashFunctor {
+      UPInt operator()(const ProgramKey& k) const {
+        return ((UPInt) k.VS >> 4) * 31 + ((UPInt) k.FS >> 4);
+      }
+    };
+  };
+  Hash<ProgramKey, Ptr<Program>, ProgramKey::HashFunctor> Programs;
+
+  // Driver binaries of linked programs keyed by both shader sources in full;
+  // loaded from and saved to Params.ShaderCachePath.
+  struct ProgramBinary {
+    GLenum Format;
+    Array<UByte> Data;
+  };
+  Hash<String, ProgramBinary, String::HashFunctor> ProgramBinaries;
+  // Vendor, renderer and version; binaries only load into the same driver.
+  String DriverId;
+  bool ProgramBinariesLoaded;
+  bool ProgramBinariesSupported;
+  bool ProgramBinariesDirty;
+
+  // Reads the cache on first call. Returns false if the driver can't save and
+  // restore programs.
+  bool loadProgramBinaries();
+  void saveProgramBinaries();
+
+#if defined(OVR_GL_PERSISTENT_MAPPING)
+  // Created on first use; NULL if persistent mapping isn't supported.
+  Ptr<StreamBuffer> pStreamVertices;
+  bool StreamVerticesChecked;
+#endif
+
+  virtual void* MapDynamicVertices(size_t size, Render::Buffer** buffer,
+      int* byteOffset);
+  virtual void UnmapDynamicVertices(void* vertices);
+
+  // Binds the fill and sets the per-draw uniforms shared by Render and RenderGlyphs.
+  // Returns false if the fill's shaders aren't linked.
+  bool applyFill(const Fill* fill, const Matrix4f& matrix,
+      const ViewMatrices* fullView);
+
 public:
   RenderDevice(const RendererParams& p);
+  ~RenderDevice() {
+    Shutdown();
+  }
+
+  // Releases GL objects and saves the program binary cache; call while the
+  // context is still current.
+  virtual void Shutdown();
 
   virtual void SetRealViewport(const Viewport& vp);
 
@@ -271,14 +418,23 @@ public:
   virtual void RenderWithAlpha(const Fill* fill, Render::Buffer* vertices,
       Render::Buffer* indices, const Matrix4f& matrix, int offset, int count,
       PrimitiveType prim = Prim_Triangles, const ViewMatrices* fullView = NULL) override;
+  virtual void RenderGlyphs(const Fill* fill, Render::Buffer* vertices,
+      const Matrix4f& matrix, int offset, int count) override;
+
+  virtual int GetCaps() const {
+    return Cap_VertexBuffer | Cap_GlyphVertices;
+  }
 
   virtual Buffer* CreateBuffer();
   virtual Texture* CreateTexture(int format, int width, int height,
       const void* data, int mipcount = 1);
   virtual ShaderSet* CreateShaderSet() {
-    return new ShaderSet;
+    return new ShaderSet(this);
   }
 
+  // Returns the program linking vs and fs, creating it on first use.
+  Program* GetProgram(Shader* vs, Shader* fs);
+
   virtual Fill *CreateSimpleFill(int flags = Fill::F_Solid);
 
   virtual Shader *LoadBuiltinShader(ShaderStage stage, int shader);
@@ -138,6 +138,8 @@ void RenderDevice::Shutdown()
 {
     if (WglContext)
     {
+        GL::RenderDevice::Shutdown();
+
         wglMakeCurrent(NULL,NULL);
         wglDeleteContext(WglContext);
         ReleaseDC(Window, GdiDc);
@@ -101,15 +101,22 @@ Texture* LoadTextureDDS(RenderDevice* ren, File* f)
         }
     }
 
-    int            byteLen = f->BytesAvailable();
-    unsigned char* bytes   = new unsigned char[byteLen];
-    f->Read(bytes, byteLen);
+    // Mapped files hand the texture data to the device without a copy.
+    int                  byteLen = f->BytesAvailable();
+    const unsigned char* bytes   = f->View(f->LTell(), byteLen);
+    unsigned char*       copy    = NULL;
+    if (!bytes)
+    {
+        copy  = new unsigned char[byteLen];
+        f->Read(copy, byteLen);
+        bytes = copy;
+    }
     Texture* out = ren->CreateTexture(format, (int)width, (int)height, bytes, mipCount);
     if(strstr(f->GetFilePath(), "_c."))
     {
         out->SetSampleMode(Sample_Clamp);
     }
-    OVR_FREE(bytes);
+    delete[] copy;
     return out;
 }
 
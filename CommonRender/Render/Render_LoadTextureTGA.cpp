@@ -43,62 +43,71 @@ Texture* LoadTextureTga(RenderDevice* ren, File* f, unsigned char alpha)
     int height = f->ReadUInt16();
     int bpp = f->ReadUByte();
     f->ReadUByte();
+    if (imgtype != 2 || (bpp != 24 && bpp != 32))
+        return NULL;
+
     int imgsize = width * height * 4;
     unsigned char* imgdata = (unsigned char*) OVR_ALLOC(imgsize);
-    unsigned char buf[16];
     f->Read(imgdata, desclen);
     f->Read(imgdata, palCount * (palSize + 7) >> 3);
     int bpl = width * 4;
 
-    switch (imgtype)
+    // Convert straight from the file's memory when it is mapped; otherwise
+    // read all the pixels in one call rather than one pixel at a time.
+    int srcPixelSize = bpp >> 3;
+    int srcSize      = width * height * srcPixelSize;
+    const unsigned char* src     = f->View(f->LTell(), srcSize);
+    unsigned char*       srcCopy = NULL;
+    if (!src)
+    {
+        srcCopy = (unsigned char*) OVR_ALLOC(srcSize);
+        int readSize = f->Read(srcCopy, srcSize);
+        if (readSize < srcSize)
+            memset(srcCopy + Alg::Max(readSize, 0), 0, srcSize - Alg::Max(readSize, 0));
+        src = srcCopy;
+    }
+
+    switch (bpp)
     {
-    case 2:
-        switch (bpp)
-        {
-        case 24:
-            for (int y = 0; y < height; y++)
-                for (int x = 0; x < width; x++)
-                {
-                    f->Read(buf, 3);
-                    imgdata[y*bpl+x*4+0] = buf[2];
-                    imgdata[y*bpl+x*4+1] = buf[1];
-                    imgdata[y*bpl+x*4+2] = buf[0];
+    case 24:
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++)
+            {
+                const unsigned char* buf = src + (y*width+x)*3;
+                imgdata[y*bpl+x*4+0] = buf[2];
+                imgdata[y*bpl+x*4+1] = buf[1];
+                imgdata[y*bpl+x*4+2] = buf[0];
+                imgdata[y*bpl+x*4+3] = alpha;
+            }
+        break;
+    case 32:
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++)
+            {
+                const unsigned char* buf = src + (y*width+x)*4;
+                imgdata[y*bpl+x*4+0] = buf[2];
+                imgdata[y*bpl+x*4+1] = buf[1];
+                imgdata[y*bpl+x*4+2] = buf[0];
+                if (buf[3] == 255)
                     imgdata[y*bpl+x*4+3] = alpha;
-                }
-            break;
-        case 32:
-            for (int y = 0; y < height; y++)
-                for (int x = 0; x < width; x++)
-                {
-                    f->Read(buf, 4);
-                    imgdata[y*bpl+x*4+0] = buf[2];
-                    imgdata[y*bpl+x*4+1] = buf[1];
-                    imgdata[y*bpl+x*4+2] = buf[0];
-                    if (buf[3] == 255)
-                        imgdata[y*bpl+x*4+3] = alpha;
-                    else
+                else
                     imgdata[y*bpl+x*4+3] = buf[3];
-                }
-            break;
-
-        default:
-            OVR_FREE(imgdata);
-            return NULL;
-        }
+            }
         break;
+    }
 
-    default:
-        OVR_FREE(imgdata);
-        return NULL;
+    if (srcCopy)
+    {
+        OVR_FREE(srcCopy);
     }
 
-	Texture* out = ren->CreateTexture(Texture_RGBA|Texture_GenMipmaps, width, height, imgdata);
+    Texture* out = ren->CreateTexture(Texture_RGBA|Texture_GenMipmaps, width, height, imgdata);
 
-	// check for clamp based on texture name
-	if(strstr(f->GetFilePath(), "_c."))
-	{
-		out->SetSampleMode(Sample_Clamp);
-	}
+    // check for clamp based on texture name
+    if(strstr(f->GetFilePath(), "_c."))
+    {
+        out->SetSampleMode(Sample_Clamp);
+    }
 
     OVR_FREE(imgdata);
     return out;
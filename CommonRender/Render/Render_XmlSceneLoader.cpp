@@ -17,6 +17,27 @@ XmlHandler::~XmlHandler() {
   delete pXmlDocument;
 }
 
+ShaderFill* XmlHandler::GetMaterialFill(RenderDevice* pRender,
+    const Material& material) {
+  Ptr<ShaderFill>* cached = Materials.Get(material);
+  if (cached) {
+    return *cached;
+  }
+
+  Ptr<ShaderFill> shader = *new ShaderFill(*pRender->CreateShaderSet());
+  shader->GetShaders()->SetShader(
+      pRender->LoadBuiltinShader(Shader_Vertex, material.VertexShader));
+  shader->GetShaders()->SetShader(
+      pRender->LoadBuiltinShader(Shader_Fragment, material.FragmentShader));
+  for (int i = 0; i < Material::TextureCount; i++) {
+    if (material.Textures[i]) {
+      shader->SetTexture(i, material.Textures[i]);
+    }
+  }
+  Materials.Add(material, shader);
+  return shader;
+}
+
 bool XmlHandler::ReadFile(const char* fileName,
     OVR::Render::RenderDevice* pRender, OVR::Render::Scene* pScene,
     OVR::Array<Ptr<CollisionModel> >* pCollisions,
@@ -57,7 +78,7 @@ bool XmlHandler::ReadFile(const char* fileName,
       OVR_sprintf(fname, 300, "%s%s", filePath, textureName);
     }
 
-    SysFile* pFile = new SysFile(fname);
+    SysFile* pFile = new SysFile(fname, File::Open_Read | File::Open_Buffered | File::Open_Mapped);
     Ptr<Texture> texture;
     if (textureName[dotpos + 1] == 'd' || textureName[dotpos + 1] == 'D') {
       // DDS file
@@ -66,7 +87,7 @@ bool XmlHandler::ReadFile(const char* fileName,
       texture.SetPtr(*LoadTextureTga(pRender, pFile));
     }
 
-    Textures.PushBack(texture);
+    Textures.PushBack(Move(texture));
     pFile->Close();
     pFile->Release();
     pXmlTexture = pXmlTexture->NextSiblingElement("texture");
@@ -147,25 +168,23 @@ bool XmlHandler::ReadFile(const char* fileName,
       pXmlCurMaterial = pXmlCurMaterial->NextSiblingElement("material");
     }
 
-    //set up the shader
-    Ptr<ShaderFill> shader = *new ShaderFill(*pRender->CreateShaderSet());
-    shader->GetShaders()->SetShader(
-        pRender->LoadBuiltinShader(Shader_Vertex, VShader_MVP));
+    //set up the shader, shared with every other model using the same material
+    Material material;
+    material.VertexShader = VShader_MVP;
+    material.Textures[0] = NULL;
+    material.Textures[1] = NULL;
     if (diffuseTextureIndex > -1) {
-      shader->SetTexture(0, Textures[diffuseTextureIndex]);
+      material.Textures[0] = Textures[diffuseTextureIndex];
       if (lightmapTextureIndex > -1) {
-        shader->GetShaders()->SetShader(
-            pRender->LoadBuiltinShader(Shader_Fragment, FShader_MultiTexture));
-        shader->SetTexture(1, Textures[lightmapTextureIndex]);
+        material.FragmentShader = FShader_MultiTexture;
+        material.Textures[1] = Textures[lightmapTextureIndex];
       } else {
-        shader->GetShaders()->SetShader(
-            pRender->LoadBuiltinShader(Shader_Fragment, FShader_Texture));
+        material.FragmentShader = FShader_Texture;
       }
     } else {
-      shader->GetShaders()->SetShader(
-          pRender->LoadBuiltinShader(Shader_Fragment, FShader_LitGouraud));
+      material.FragmentShader = FShader_LitGouraud;
     }
-    Models[i]->Fill = shader;
+    Models[i]->Fill = GetMaterialFill(pRender, material);
 
     //add all the vertices to the model
     const UPInt numVerts = vertices->GetSize();
@@ -229,7 +248,9 @@ bool XmlHandler::ReadFile(const char* fileName,
     pScene->Models.PushBack(Models[i]);
     pXmlModel = pXmlModel->NextSiblingElement("model");
   }
-  OVR_DEBUG_LOG(("Done."));
+  // Draw models sharing a material back to back.
+  pScene->World.SortByFill();
+  OVR_DEBUG_LOG(("Done. %i materials.", (int) Materials.GetSize()));
 
   //load the collision models
   OVR_DEBUG_LOG(("Loading collision models... "));
@@ -262,7 +283,7 @@ bool XmlHandler::ReadFile(const char* fileName,
       pXmlPlane = pXmlPlane->NextSiblingElement("plane");
     }
 
-    pCollisions->PushBack(cm);
+    pCollisions->PushBack(Move(cm));
     pXmlCollisionModel = pXmlCollisionModel->NextSiblingElement(
         "collisionModel");
   }
@@ -297,7 +318,7 @@ bool XmlHandler::ReadFile(const char* fileName,
       pXmlPlane = pXmlPlane->NextSiblingElement("plane");
     }
 
-    pGroundCollisions->PushBack(cm);
+    pGroundCollisions->PushBack(Move(cm));
     pXmlCollisionModel = pXmlCollisionModel->NextSiblingElement(
         "collisionModel");
   }
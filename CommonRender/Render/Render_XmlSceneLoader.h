@@ -3,6 +3,7 @@
 
 #include "Render_Device.h"
 #include <Kernel/OVR_SysFile.h>
+#include <Kernel/OVR_Hash.h>
 using namespace OVR;
 using namespace OVR::Render;
 
@@ -30,6 +31,32 @@ protected:
   void ParseVectorString(const char* str, OVR::Array<OVR::Vector3f> *array,
       bool is2element = false);
 
+  // Builtin shaders and textures a model is drawn with.
+  struct Material {
+    enum {
+      TextureCount = 2
+    };
+    int VertexShader;
+    int FragmentShader;
+    Texture* Textures[TextureCount];
+
+    bool operator==(const Material& b) const {
+      return VertexShader == b.VertexShader
+          && FragmentShader == b.FragmentShader
+          && Textures[0] == b.Textures[0] && Textures[1] == b.Textures[1];
+    }
+    struct HashFunctor {
+      UPInt operator()(const Material& m) const {
+        return String::BernsteinHashFunction(&m, sizeof(Material));
+      }
+    };
+  };
+
+  // Returns the fill for material, creating it the first time it is seen so that
+  // models with the same material share shaders and texture bindings.
+  ShaderFill* GetMaterialFill(OVR::Render::RenderDevice* pRender,
+      const Material& material);
+
 private:
   tinyxml2::XMLDocument* pXmlDocument;
   char filePath[250];
@@ -37,6 +64,7 @@ private:
   OVR::Array<Ptr<Texture> > Textures;
   int modelCount;
   OVR::Array<Ptr<Model> > Models;
+  OVR::Hash<Material, Ptr<ShaderFill>, Material::HashFunctor> Materials;
   int collisionModelCount;
   int groundCollisionModelCount;
 };
@@ -0,0 +1,250 @@
+/************************************************************************************
+
+Filename    :   FontDistanceField.cpp
+Content     :   Converts a bitmap font header into a distance field font header
+Created     :   October 18, 2026
+Notes       :   Built by the Makefile next to this file from FONT_HEADER, a font
+                header holding a coverage bitmap, such as the one
+                Render_FontEmbed_DejaVu48.h was made from:
+
+                  git show db3e014:CommonRender/Render/Render_FontEmbed_DejaVu48.h \
+                      > DejaVu48Bitmap.h
+                  make FONT_HEADER=DejaVu48Bitmap.h FONT=DejaVu
+                  ./FontDistanceField > ../Render/Render_FontEmbed_DejaVu48.h
+
+                Metrics and kerning are copied unchanged. Each glyph gets its own
+                cell in a new atlas at 1/FieldScale of the bitmap's resolution,
+                padded so the field around it never reaches a neighbour.
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// The Font layout bitmap headers were written for; it had no texel scale or
+// spread. Defining the guard keeps FONT_HEADER from pulling in the current one.
+#define OVR_Render_Font_h
+namespace OVR { namespace Render {
+class Fill;
+struct Font {
+  enum {
+    CharCount = 128
+  };
+  struct Char {
+    short x, y;
+    short advance;
+    float u1, v1, u2, v2;
+  };
+  int lineheight, ascent, descent;
+  const Char* chars;
+  const short** kerning;
+  int twidth, theight;
+  const unsigned char* tex;
+  mutable Fill* fill;
+};
+}}
+
+#include FONT_HEADER
+
+using namespace OVR::Render;
+
+#define STRINGIZE2(x) #x
+#define STRINGIZE(x) STRINGIZE2(x)
+static const char* FontName = STRINGIZE(FONT);
+static const Font& Source = FONT;
+
+// Bitmap pixels, which are font units, per field texel.
+static const int FieldScale = 2;
+// Distance in font units over which the field goes from 0 to 1.
+static const int FieldSpread = 6;
+// Field texels around each glyph's cell, enough for the field to reach 0.
+static const int CellPadding = FieldSpread / FieldScale;
+static const int AtlasWidth = 512;
+
+struct GlyphCell {
+  // Glyph rectangle in the bitmap, in pixels.
+  int X0, Y0, Width, Height;
+  // Cell origin in the atlas, in texels.
+  int CellX, CellY;
+};
+
+static bool ink(const GlyphCell& g, int x, int y) {
+  if (x < g.X0 || y < g.Y0 || x >= g.X0 + g.Width || y >= g.Y0 + g.Height) {
+    return false;
+  }
+  return Source.tex[y * Source.twidth + x] >= 128;
+}
+
+// Signed distance from the centre of bitmap pixel (x, y) to the glyph's edge,
+// positive inside, limited to FieldSpread. Pixels of other glyphs count as
+// outside.
+static float pixelDistance(const GlyphCell& g, int x, int y) {
+  bool inside = ink(g, x, y);
+  int best = FieldSpread * FieldSpread * 4;
+  for (int dy = -FieldSpread; dy <= FieldSpread; dy++) {
+    for (int dx = -FieldSpread; dx <= FieldSpread; dx++) {
+      if (dx * dx + dy * dy < best && ink(g, x + dx, y + dy) != inside) {
+        best = dx * dx + dy * dy;
+      }
+    }
+  }
+  // Pixel centres on either side of an edge are a pixel apart, so the edge
+  // itself lies half way.
+  float d = sqrtf((float) best) - 0.5f;
+  if (d > FieldSpread) {
+    d = (float) FieldSpread;
+  }
+  return inside ? d : -d;
+}
+
+static int cellWidth(const GlyphCell& g) {
+  return (g.Width + FieldScale - 1) / FieldScale + 2 * CellPadding;
+}
+
+static int cellHeight(const GlyphCell& g) {
+  return (g.Height + FieldScale - 1) / FieldScale + 2 * CellPadding;
+}
+
+int main() {
+  GlyphCell cells[Font::CharCount];
+  int order[Font::CharCount];
+  int glyphCount = 0;
+
+  for (int c = 0; c < Font::CharCount; c++) {
+    const Font::Char& ch = Source.chars[c];
+    GlyphCell& g = cells[c];
+    g.X0 = (int) floorf(ch.u1 * Source.twidth + 0.5f);
+    g.Y0 = (int) floorf(ch.v1 * Source.theight + 0.5f);
+    g.Width = (int) floorf(ch.u2 * Source.twidth + 0.5f) - g.X0;
+    g.Height = (int) floorf(ch.v2 * Source.theight + 0.5f) - g.Y0;
+    g.CellX = g.CellY = 0;
+    if (g.Width > 0 && g.Height > 0) {
+      order[glyphCount++] = c;
+    }
+  }
+
+  // Pack the cells in rows, tallest first, so rows waste little height.
+  for (int i = 1; i < glyphCount; i++) {
+    for (int j = i; j > 0 && cells[order[j]].Height > cells[order[j - 1]].Height; j--) {
+      int t = order[j];
+      order[j] = order[j - 1];
+      order[j - 1] = t;
+    }
+  }
+  int x = 0, y = 0, rowHeight = 0;
+  for (int i = 0; i < glyphCount; i++) {
+    GlyphCell& g = cells[order[i]];
+    if (x + cellWidth(g) > AtlasWidth) {
+      x = 0;
+      y += rowHeight;
+      rowHeight = 0;
+    }
+    g.CellX = x;
+    g.CellY = y;
+    x += cellWidth(g);
+    if (cellHeight(g) > rowHeight) {
+      rowHeight = cellHeight(g);
+    }
+  }
+  int width = AtlasWidth;
+  int height = y + rowHeight;
+
+  // Each texel is the mean distance at the FieldScale x FieldScale bitmap pixels
+  // it covers, which is the distance at its centre wherever the edge is straight.
+  unsigned char* field = (unsigned char*) calloc(width * height, 1);
+  for (int i = 0; i < glyphCount; i++) {
+    const GlyphCell& g = cells[order[i]];
+    for (int ty = 0; ty < cellHeight(g); ty++) {
+      for (int tx = 0; tx < cellWidth(g); tx++) {
+        int px = g.X0 + (tx - CellPadding) * FieldScale;
+        int py = g.Y0 + (ty - CellPadding) * FieldScale;
+        float sum = 0;
+        for (int sy = 0; sy < FieldScale; sy++) {
+          for (int sx = 0; sx < FieldScale; sx++) {
+            sum += pixelDistance(g, px + sx, py + sy);
+          }
+        }
+        float d = sum / (FieldScale * FieldScale);
+        float v = 0.5f + d / (2.0f * FieldSpread);
+        v = v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+        field[(g.CellY + ty) * width + g.CellX + tx] = (unsigned char) (v
+            * 255.0f + 0.5f);
+      }
+    }
+  }
+
+  printf("// Generated by CommonRender/Tools/FontDistanceField from the %s\n"
+      "// coverage bitmap; see the notes there before editing.\n\n", FontName);
+  printf("#include \"Render_Font.h\"\n\n");
+  printf("namespace OVR { namespace Render {\n\n");
+
+  printf("const Font::Char %s_chars[] = {\n", FontName);
+  for (int c = 0; c < Font::CharCount; c++) {
+    const Font::Char& ch = Source.chars[c];
+    const GlyphCell& g = cells[c];
+    float u1 = 0, v1 = 0, u2 = 0, v2 = 0;
+    if (g.Width > 0 && g.Height > 0) {
+      u1 = (g.CellX + CellPadding) / (float) width;
+      v1 = (g.CellY + CellPadding) / (float) height;
+      u2 = (g.CellX + CellPadding + g.Width / (float) FieldScale) / (float) width;
+      v2 = (g.CellY + CellPadding + g.Height / (float) FieldScale)
+          / (float) height;
+    }
+    printf("    /* %4d %c */ {%2d,%2d,%3d, %.10ff, %.10ff, %.10ff, %.10ff}%s\n", c,
+        (c > 32 && c < 127) ? c : ' ', ch.x, ch.y, ch.advance, u1, v1, u2, v2,
+        (c + 1 < Font::CharCount) ? "," : "};");
+  }
+  printf("\n");
+
+  for (int c = 0; c < Font::CharCount; c++) {
+    const short* kern = Source.kerning[c];
+    if (!kern) {
+      continue;
+    }
+    printf("const short %s_kern%d[] = {", FontName, c);
+    for (int k = 0; k < Font::CharCount; k++) {
+      printf("%s%3d%s", (k % 16) ? "" : "\n    ", kern[k],
+          (k + 1 < Font::CharCount) ? "," : "};\n");
+    }
+  }
+  printf("\nconst short* %s_kern[] = {", FontName);
+  for (int c = 0; c < Font::CharCount; c++) {
+    printf("%s", (c % 8) ? " " : "\n    ");
+    if (Source.kerning[c]) {
+      printf("%s_kern%d", FontName, c);
+    } else {
+      printf("0");
+    }
+    printf("%s", (c + 1 < Font::CharCount) ? "," : "};\n");
+  }
+
+  printf("\nconst unsigned char %s_tex[] = {", FontName);
+  for (int i = 0; i < width * height; i++) {
+    printf("%s%d%s", (i % 24) ? "" : "\n    ", field[i],
+        (i + 1 < width * height) ? "," : "};\n");
+  }
+
+  printf("\nFont %s = {%d, %d, %d, %s_chars, %s_kern, %d, %d, %d, %d, %s_tex};\n",
+      FontName, Source.lineheight, Source.ascent, Source.descent, FontName,
+      FontName, width, height, FieldScale, FieldSpread, FontName);
+  printf("\n}}\n");
+
+  free(field);
+  return 0;
+}
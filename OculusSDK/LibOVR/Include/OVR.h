@@ -27,9 +27,13 @@ limitations under the License.
 #define OVR_h
 
 #include "../Src/Kernel/OVR_Allocator.h"
+#include "../Src/Kernel/OVR_AsyncLog.h"
+#include "../Src/Kernel/OVR_FrameArena.h"
 #include "../Src/Kernel/OVR_Log.h"
 #include "../Src/Kernel/OVR_Math.h"
+#include "../Src/Kernel/OVR_PoolAllocator.h"
 #include "../Src/Kernel/OVR_System.h"
+#include "../Src/Kernel/OVR_TrackingAllocator.h"
 #include "../Src/Kernel/OVR_Types.h"
 #include "../Src/OVR_Device.h"
 #include "../Src/OVR_DeviceConstants.h"
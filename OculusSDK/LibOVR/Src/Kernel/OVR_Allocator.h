@@ -126,6 +126,45 @@ OVR_FORCE_INLINE T*  ConstructAlt(void *p, const S1& src1, const S2& src2)
     return ::new(p) T(src1, src2);
 }
 
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+
+// Casts source to an rvalue, so that it is moved from rather than copied.
+template <class T>
+OVR_FORCE_INLINE T&& Move(T& source)
+{
+    return static_cast<T&&>(source);
+}
+
+// Move-constructs T in place from source, which is left in a valid but
+// unspecified state.
+template <class T>
+OVR_FORCE_INLINE T*  ConstructMove(void *p, T& source)
+{
+    return ::new(p) T(static_cast<T&&>(source));
+}
+
+#else
+
+// Without rvalue references Move is a no-op, and callers fall back to copying.
+template <class T>
+OVR_FORCE_INLINE T& Move(T& source)
+{
+    return source;
+}
+
+#endif
+
+#if defined(OVR_CPP_VARIADIC_TEMPLATES)
+
+// Constructs T in place from any constructor arguments, forwarding them as given.
+template <class T, class... Args>
+OVR_FORCE_INLINE T*  ConstructArgs(void *p, Args&&... args)
+{
+    return ::new(p) T(static_cast<Args&&>(args)...);
+}
+
+#endif
+
 template <class T>
 OVR_FORCE_INLINE void ConstructArray(void *p, UPInt count)
 {
@@ -177,6 +216,7 @@ OVR_FORCE_INLINE void DestructArray(T *pobj, UPInt count)
 class Allocator
 {
     friend class System;
+    friend class TrackingAllocator;
 public:
 
     // *** Standard Alignment Alloc/Free
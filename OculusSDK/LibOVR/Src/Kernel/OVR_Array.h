@@ -117,6 +117,20 @@ struct ArrayDataBase
         Policy.SetCapacity(0);
     }
 
+    // Releases our contents and takes over the buffer of other, leaving it empty.
+    void Take(SelfType& other)
+    {
+        if (&other == this)
+            return;
+        ClearAndRelease();
+        Data = other.Data;
+        Size = other.Size;
+        Policy.SetCapacity(other.Policy.GetCapacity());
+        other.Data = 0;
+        other.Size = 0;
+        other.Policy.SetCapacity(0);
+    }
+
     void Reserve(UPInt newCapacity)
     {
         if (Policy.NeverShrinking() && newCapacity < GetCapacity())
@@ -243,6 +257,14 @@ struct ArrayData : ArrayDataBase<T, Allocator, SizePolicy>
         Allocator::Construct(this->Data + this->Size - 1, val);
     }
 
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    void PushBackMove(ValueType& val)
+    {
+        BaseType::ResizeNoConstruct(this->Size + 1);
+        Allocator::ConstructMove(this->Data + this->Size - 1, val);
+    }
+#endif
+
     template<class S>
     void PushBackAlt(const S& val)
     {
@@ -302,6 +324,14 @@ struct ArrayDataCC : ArrayDataBase<T, Allocator, SizePolicy>
         Allocator::Construct(this->Data + this->Size - 1, val);
     }
 
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    void PushBackMove(ValueType& val)
+    {
+        BaseType::ResizeNoConstruct(this->Size + 1);
+        Allocator::ConstructMove(this->Data + this->Size - 1, val);
+    }
+#endif
+
     template<class S>
     void PushBackAlt(const S& val)
     {
@@ -363,6 +393,11 @@ public:
         : Data(size) {}
     ArrayBase(const SelfType& a)
         : Data(a.Data) {}
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    // Takes over the storage of a, without copying the elements.
+    ArrayBase(SelfType&& a)
+        : Data() { Data.Take(a.Data); }
+#endif
 
     ArrayBase(const ValueType& defval)
         : Data(defval) {}
@@ -433,6 +468,26 @@ public:
         Data.PushBack(val);
     }
 
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    // Moves val into the end of the array, avoiding a copy (and for Ptr, the
+    // AddRef/Release pair that comes with it).
+    void    PushBack(ValueType&& val)
+    {
+        Data.PushBackMove(val);
+    }
+#endif
+
+#if defined(OVR_CPP_VARIADIC_TEMPLATES)
+    // Constructs a new element at the end of the array from the given
+    // constructor arguments, and returns it.
+    template<class... Args>
+    ValueType& EmplaceBack(Args&&... args)
+    {
+        Data.ResizeNoConstruct(Data.Size + 1);
+        return *OVR::ConstructArgs<ValueType>(Data.Data + Data.Size - 1, static_cast<Args&&>(args)...);
+    }
+#endif
+
     template<class S>
     void PushBackAlt(const S& val)
     {
@@ -478,6 +533,15 @@ public:
         return *this;
     }
 
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    // Array move. Takes over the storage of a, leaving it empty.
+    const SelfType& operator = (SelfType&& a)
+    {
+        Data.Take(a.Data);
+        return *this;
+    }
+#endif
+
     // Removing multiple elements from the array.
     void    RemoveMultipleAt(UPInt index, UPInt num)
     {
@@ -533,6 +597,24 @@ public:
         AllocatorType::Construct(Data.Data + index, val);
     }
 
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    // Same as above, but moves val into place.
+    void    InsertAt(UPInt index, ValueType&& val)
+    {
+        OVR_ASSERT(index <= Data.Size);
+
+        Data.Resize(Data.Size + 1);
+        if (index < Data.Size - 1)
+        {
+            AllocatorType::CopyArrayBackward(
+                Data.Data + index + 1, 
+                Data.Data + index, 
+                Data.Size - 1 - index);
+        }
+        AllocatorType::ConstructMove(Data.Data + index, val);
+    }
+#endif
+
     // Insert the given object at the given index shifting all the elements up.
     void    InsertMultipleAt(UPInt index, UPInt num, const ValueType& val = ValueType())
     {
@@ -729,6 +811,10 @@ public:
     Array(const SizePolicyType& p) : BaseType() { SetSizePolicy(p); }
     Array(const SelfType& a) : BaseType(a) {}
     const SelfType& operator=(const SelfType& a) { BaseType::operator=(a); return *this; }
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    Array(SelfType&& a) : BaseType(static_cast<BaseType&&>(a)) {}
+    const SelfType& operator=(SelfType&& a) { BaseType::operator=(static_cast<BaseType&&>(a)); return *this; }
+#endif
 };
 
 // ***** ArrayPOD
@@ -751,6 +837,10 @@ public:
     ArrayPOD(const SizePolicyType& p) : BaseType() { SetSizePolicy(p); }
     ArrayPOD(const SelfType& a) : BaseType(a) {}
     const SelfType& operator=(const SelfType& a) { BaseType::operator=(a); return *this; }
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    ArrayPOD(SelfType&& a) : BaseType(static_cast<BaseType&&>(a)) {}
+    const SelfType& operator=(SelfType&& a) { BaseType::operator=(static_cast<BaseType&&>(a)); return *this; }
+#endif
 };
 
 
@@ -773,6 +863,10 @@ public:
     ArrayCPP(const SizePolicyType& p) : BaseType() { SetSizePolicy(p); }
     ArrayCPP(const SelfType& a) : BaseType(a) {}
     const SelfType& operator=(const SelfType& a) { BaseType::operator=(a); return *this; }
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    ArrayCPP(SelfType&& a) : BaseType(static_cast<BaseType&&>(a)) {}
+    const SelfType& operator=(SelfType&& a) { BaseType::operator=(static_cast<BaseType&&>(a)); return *this; }
+#endif
 };
 
 
@@ -0,0 +1,252 @@
+/************************************************************************************
+
+Filename    :   OVR_AsyncLog.cpp
+Content     :   Log that hands messages to a background writer thread
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+************************************************************************************/
+
+#include "OVR_AsyncLog.h"
+#include "OVR_Threads.h"
+#include "OVR_Timer.h"
+#include "OVR_Std.h"
+
+namespace OVR {
+
+//-----------------------------------------------------------------------------------
+// ***** AsyncLog
+
+AsyncLog::AsyncLog(unsigned logMask)
+    : Log(logMask), pWriter(0), pWriterEvent(0), Running(0),
+      RateLimit(DefaultRateLimit), WindowStartMs(0), WindowCount(0),
+      Dropped(0), TotalDropped(0)
+{
+}
+
+AsyncLog::~AsyncLog()
+{
+    Stop();
+}
+
+AsyncLog* AsyncLog::GetAsyncLog()
+{
+    static AsyncLog asyncLog;
+    return &asyncLog;
+}
+
+
+bool AsyncLog::Start()
+{
+#ifdef OVR_ENABLE_THREADS
+    if (pWriter)
+        return true;
+
+    pWriterEvent = new Event;
+    pWriter      = new Thread(writerThreadFn, this);
+    if (!pWriter->Start())
+    {
+        pWriter->Release();
+        pWriter = 0;
+        delete pWriterEvent;
+        pWriterEvent = 0;
+        return false;
+    }
+    Running.Store_Release(1);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AsyncLog::Stop()
+{
+#ifdef OVR_ENABLE_THREADS
+    if (!pWriter)
+        return;
+
+    // From here on messages are written synchronously. Messages that saw the
+    // writer running may still be claimed but unpublished; once they are all
+    // published, the writer's final drain writes them out.
+    Running.Store_Release(0);
+    Messages.WaitForPushes();
+    pWriter->SetExitFlag(true);
+    pWriterEvent->SetEvent();
+    while (!pWriter->IsFinished())
+        Thread::MSleep(1);
+    pWriter->Release();
+    pWriter = 0;
+    delete pWriterEvent;
+    pWriterEvent = 0;
+#endif
+}
+
+void AsyncLog::Flush()
+{
+#ifdef OVR_ENABLE_THREADS
+    UInt32 target = Messages.GetClaimedCount();
+    while (Running && (SInt32)(Messages.GetPoppedCount() - target) < 0)
+        Thread::MSleep(1);
+#endif
+}
+
+
+void AsyncLog::LogMessageVarg(LogMessageType messageType, const char* fmt, va_list argList)
+{
+    if ((messageType & GetLoggingMask()) == 0)
+        return;
+#ifndef OVR_BUILD_DEBUG
+    if (IsDebugMessage(messageType))
+        return;
+#endif
+
+    if (messageType != Log_Assert)
+    {
+        // Stop waits for pushes that saw the writer running.
+        Messages.BeginPush();
+        bool running = (Running != 0);
+        bool queued  = running && push(messageType, fmt, argList);
+        Messages.EndPush();
+
+        // An error that finds the ring full is written out of order rather than lost.
+        if (queued || (running && (messageType != Log_Error)))
+            return;
+    }
+    else
+    {
+        // Asserts are followed by a debug break, so they go out immediately,
+        // after whatever was queued before them.
+        Flush();
+    }
+
+    char buffer[MaxLogBufferMessageSize];
+    FormatLog(buffer, MaxLogBufferMessageSize, messageType, fmt, argList);
+    WriteMessage(buffer, IsDebugMessage(messageType));
+}
+
+void AsyncLog::WriteMessage(const char* text, bool debug)
+{
+    DefaultLogOutput(text, debug);
+}
+
+
+// Counts the message against the rate limit for the current one-second window.
+bool AsyncLog::acceptMessage()
+{
+    if (RateLimit == 0)
+        return true;
+
+    UInt32 now   = Timer::GetTicksMs();
+    UInt32 start = WindowStartMs;
+    if (now - start >= 1000)
+    {
+        // Whoever wins the race starts the new window.
+        if (WindowStartMs.CompareAndSet_Sync(start, now))
+            WindowCount.Store_Release(0);
+    }
+    return ++WindowCount <= RateLimit;
+}
+
+bool AsyncLog::push(LogMessageType messageType, const char* fmt, va_list argList)
+{
+    // Errors are never rate limited.
+    if ((messageType != Log_Error) && !acceptMessage())
+    {
+        dropMessage();
+        return false;
+    }
+
+    UInt32         pos;
+    QueuedMessage* message = Messages.Claim(&pos);
+    if (!message)
+    {
+        // Ring is full; the writer is behind.
+        if (messageType != Log_Error)
+            dropMessage();
+        return false;
+    }
+
+    FormatLog(message->Text, MaxMessageSize, messageType, fmt, argList);
+    message->Debug = IsDebugMessage(messageType);
+    if (Messages.Publish(pos))
+        wakeWriter();
+    return true;
+}
+
+void AsyncLog::dropMessage()
+{
+    TotalDropped++;
+    // The first drop since the last report wakes the writer to report it.
+    if (Dropped.ExchangeAdd_Sync(1) == 0)
+        wakeWriter();
+}
+
+// Only called while the writer is running.
+void AsyncLog::wakeWriter()
+{
+#ifdef OVR_ENABLE_THREADS
+    pWriterEvent->SetEvent();
+#endif
+}
+
+UPInt AsyncLog::drain()
+{
+    UPInt count = 0;
+    while (QueuedMessage* message = Messages.Peek())
+    {
+        WriteMessage(message->Text, message->Debug);
+        Messages.Pop();
+        count++;
+    }
+
+    UInt32 dropped = Dropped.Exchange_NoSync(0);
+    if (dropped)
+    {
+        char buffer[64];
+        OVR_sprintf(buffer, sizeof(buffer), "OVR::AsyncLog - %u messages dropped.\n", dropped);
+        WriteMessage(buffer, false);
+    }
+    return count;
+}
+
+#ifdef OVR_ENABLE_THREADS
+int AsyncLog::writerThreadFn(Thread* thread, void* h)
+{
+    AsyncLog* log = (AsyncLog*)h;
+    thread->SetThreadName("OVR::AsyncLog");
+
+    while (!thread->GetExitFlag())
+    {
+        if (log->drain())
+            continue;
+
+        // Ask the next push for a wakeup, then look once more before sleeping.
+        // Stop sets the exit flag before the event, so it is checked after the reset.
+        log->pWriterEvent->ResetEvent();
+        log->Messages.RequestWake();
+        if (!log->Messages.Peek() && !log->Dropped && !thread->GetExitFlag())
+            log->pWriterEvent->Wait();
+    }
+    log->drain();
+    return 0;
+}
+#endif
+
+} // OVR
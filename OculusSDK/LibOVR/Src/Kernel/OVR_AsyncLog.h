@@ -0,0 +1,140 @@
+/************************************************************************************
+
+PublicHeader:   OVR.h
+Filename    :   OVR_AsyncLog.h
+Content     :   Log that hands messages to a background writer thread
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+************************************************************************************/
+
+#ifndef OVR_AsyncLog_h
+#define OVR_AsyncLog_h
+
+#include "OVR_Log.h"
+#include "OVR_MPSCRing.h"
+
+namespace OVR {
+
+class Thread;
+class Event;
+
+//-----------------------------------------------------------------------------------
+// ***** AsyncLog
+
+// AsyncLog formats each message on the calling thread into a slot of a
+// preallocated lock-free ring, and a background thread writes the slots out.
+// Logging from the sensor or render threads therefore never waits on a slow
+// terminal or file, and never allocates.
+//
+// When the ring is full, or more than the rate limit's worth of messages arrive
+// within one second, messages are dropped rather than blocking the caller; the
+// writer reports how many were lost. Errors are never dropped: they don't count
+// against the limit, and are written synchronously if the ring is full. Messages
+// longer than MaxMessageSize are truncated. Assert messages are written
+// synchronously, after the ring has been flushed, since a debug break follows them.
+//
+// The writer thread needs the system allocator, so it is started after
+// System::Init; System::Destroy stops it. Until Start and after Stop, messages
+// are written synchronously:
+//
+//   System::Init(AsyncLog::ConfigureAsyncLog(LogMask_All));
+//   AsyncLog::GetAsyncLog()->Start();
+
+class AsyncLog : public Log
+{
+public:
+    enum
+    {
+        Capacity            = 256,  // Slots in the ring; must be a power of two.
+        MaxMessageSize      = 512,
+        DefaultRateLimit    = 500   // Messages per second.
+    };
+
+    AsyncLog(unsigned logMask = LogMask_Debug);
+    virtual ~AsyncLog();
+
+    // Starts the writer thread; returns false if it couldn't be started, in
+    // which case messages continue to be written synchronously.
+    bool            Start();
+    // Writes out everything queued and stops the writer thread.
+    void            Stop();
+    // Waits until every message queued before the call has been written.
+    void            Flush();
+
+    // Messages per second accepted before the rest of that second's messages
+    // are dropped; 0 disables the limit.
+    void            SetRateLimit(unsigned messagesPerSecond) { RateLimit = messagesPerSecond; }
+    // Number of messages dropped so far, for a full ring or the rate limit.
+    UInt32          GetDroppedCount() const { return TotalDropped; }
+
+    virtual void    LogMessageVarg(LogMessageType messageType, const char* fmt, va_list argList);
+
+    // Returns the AsyncLog singleton, created statically like the default log.
+    static AsyncLog* GetAsyncLog();
+
+    // Applies logMask to the AsyncLog singleton and returns a pointer to it.
+    static AsyncLog* ConfigureAsyncLog(unsigned logMask = LogMask_Debug)
+    {
+        AsyncLog* log = GetAsyncLog();
+        log->SetLoggingMask(logMask);
+        return log;
+    }
+
+protected:
+    // Outputs one formatted message; called on the writer thread, or on the
+    // logging thread when the writer isn't running. Override to redirect output.
+    virtual void    WriteMessage(const char* text, bool debug);
+
+private:
+    struct QueuedMessage
+    {
+        bool    Debug;
+        char    Text[MaxMessageSize];
+    };
+
+    bool            acceptMessage();
+    bool            push(LogMessageType messageType, const char* fmt, va_list argList);
+    void            dropMessage();
+    void            wakeWriter();
+    // Writes out all published messages; returns the number written.
+    UPInt           drain();
+
+    static int      writerThreadFn(Thread* thread, void* h);
+
+    // Pushes are bracketed with BeginPush/EndPush around the Running check.
+    MPSCRing<QueuedMessage, Capacity> Messages;
+
+    Thread*             pWriter;
+    // Set when there is something for the writer to do.
+    Event*              pWriterEvent;
+    AtomicInt<UInt32>   Running;
+
+    unsigned            RateLimit;
+    AtomicInt<UInt32>   WindowStartMs;
+    AtomicInt<UInt32>   WindowCount;
+    // Dropped since the writer last reported them, and in total.
+    AtomicInt<UInt32>   Dropped;
+    AtomicInt<UInt32>   TotalDropped;
+};
+
+} // OVR
+
+#endif
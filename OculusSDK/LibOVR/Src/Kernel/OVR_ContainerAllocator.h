@@ -73,6 +73,13 @@ public:
         *(T*)p = source;
     }
 
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    static void ConstructMove(void *p, T& source)
+    {
+        *(T*)p = source;
+    }
+#endif
+
     static void ConstructArray(void*, UPInt) {}
 
     static void ConstructArray(void* p, UPInt count, const T& source)
@@ -129,6 +136,14 @@ public:
         OVR::ConstructAlt<T,S>(p, source);
     }
 
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    // Constructs from source by moving, leaving source valid but unspecified.
+    static void ConstructMove(void* p, T& source)
+    {
+        OVR::ConstructMove<T>(p, source);
+    }
+#endif
+
     static void ConstructArray(void* p, UPInt count)
     {
         UByte* pdata = (UByte*)p;
@@ -202,6 +217,13 @@ public:
         OVR::ConstructAlt<T,S>(p, source);        
     }
 
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    static void ConstructMove(void* p, T& source)
+    {
+        OVR::ConstructMove<T>(p, source);
+    }
+#endif
+
     static void ConstructArray(void* p, UPInt count)
     {
         UByte* pdata = (UByte*)p;
@@ -547,6 +547,14 @@ int     BufferedFile::CopyFromStream(File *pstream, int byteSize)
     return count;
 }
 
+const UByte* BufferedFile::View(SInt64 offset, SInt64 size)
+{
+    // Pending writes must reach the underlying file before its data is viewed.
+    if (BufferMode == WriteBuffer)
+        FlushBuffer();
+    return pFile->View(offset, size);
+}
+
 // Closing files
 bool    BufferedFile::Close()
 {
@@ -77,7 +77,11 @@ public:
         Open_CreateOnly = 24,
 
         // Open file with buffering
-        Open_Buffered    = 32
+        Open_Buffered    = 32,
+
+        // Map a read-only file into memory, so View can return pointers
+        // into it; falls back to a normal open if it can't be mapped
+        Open_Mapped      = 64
     };
 
     // *** File Mode flags
@@ -194,6 +198,11 @@ public:
     // Return -1 for error, else # of bytes written
     virtual int         CopyFromStream(File *pstream, int byteSize) = 0;
 
+    // Direct access to file contents already in memory
+    // Returns a pointer to size bytes starting at offset, valid until the file is closed,
+    // or 0 if the file isn't memory-backed or the range isn't within the file
+    virtual const UByte* View(SInt64 offset, SInt64 size)   { OVR_UNUSED2(offset, size); return 0; }
+
     // Closes the file
     // After close, file cannot be accessed 
     virtual bool        Close() = 0;
@@ -318,6 +327,8 @@ public:
     virtual SInt64      LSeek(SInt64 offset, int origin=Seek_Set)   { return pFile->LSeek(offset,origin); }
 
     virtual int         CopyFromStream(File *pstream, int byteSize) { return pFile->CopyFromStream(pstream,byteSize); }
+
+    virtual const UByte* View(SInt64 offset, SInt64 size)          { return pFile->View(offset,size); }
                         
     // Closing the file 
     virtual bool        Close()                                     { return pFile->Close(); }    
@@ -396,6 +407,8 @@ public:
     virtual SInt64      LSeek(SInt64 offset, int origin=Seek_Set);
 
     virtual int         CopyFromStream(File *pstream, int byteSize);
+
+    virtual const UByte* View(SInt64 offset, SInt64 size);
     
     virtual bool        Close();    
 };                          
@@ -433,6 +446,13 @@ public:
         return 0;
     }
 
+    const UByte* View(SInt64 offset, SInt64 size)
+    {
+        if (offset < 0 || size < 0 || size > FileSize - offset)
+            return 0;
+        return FileData + offset;
+    }
+
     int         Write(const UByte *pbuffer, int numBytes)
     {   OVR_UNUSED2(pbuffer, numBytes);
         return 0;
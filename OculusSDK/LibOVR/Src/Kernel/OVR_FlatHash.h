@@ -0,0 +1,742 @@
+/************************************************************************************
+
+PublicHeader:   None
+Filename    :   OVR_FlatHash.h
+Content     :   Open-addressing hash-table/set with group-probed control bytes
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+************************************************************************************/
+
+#ifndef OVR_FlatHash_h
+#define OVR_FlatHash_h
+
+#include "OVR_Hash.h"
+#include <string.h>
+
+#if defined(OVR_CPU_SSE) && (defined(__SSE2__) || defined(OVR_CC_MSVC))
+#  include <emmintrin.h>
+#  define OVR_FLATHASH_SSE2
+#endif
+
+// 'new' operator is redefined/used in this file.
+#undef new
+
+namespace OVR {
+
+//-----------------------------------------------------------------------------------
+// ***** FlatHashSet
+
+// FlatHashSet and FlatHash.
+//
+// Open-addressing hash table in the style of Google's "Swiss tables". Besides
+// the flat array of values, the table keeps one control byte per slot: either
+// Empty, Deleted, or the low 7 bits of the value's hash. Slots are probed 16 at
+// a time; one SSE2 compare of the control bytes finds every slot in the group
+// whose value might match, so most lookups touch a single control cache line and
+// compare against only the value they are looking for. Without SSE2 the group
+// is scanned byte by byte.
+//
+// The interface matches HashSet and Hash, including alternative-key lookups
+// (GetAlt, FindAlt, RemoveAlt), so either can be swapped for the other. Values
+// never move once inserted, except when the table grows; like HashSet, it never
+// shrinks unless you Clear() it.
+//
+// It pays off for large, lookup-heavy tables, where most of the cost of the
+// chained HashSet is cache misses. With a few dozen entries the two perform
+// about the same, and the chained HashSet is smaller when nearly empty.
+
+
+// Sixteen control bytes and matching against them. Match results are bitmasks
+// with bit i set for byte i of the group.
+class FlatHashGroup
+{
+public:
+    enum
+    {
+        Width       = 16,
+        // Control byte values; full slots hold 7 bits of the hash (0..127).
+        Ctrl_Empty   = 0x80,
+        Ctrl_Deleted = 0xFE
+    };
+
+    explicit FlatHashGroup(const UByte* ctrl)
+    {
+#if defined(OVR_FLATHASH_SSE2)
+        Ctrl = _mm_loadu_si128((const __m128i*)ctrl);
+#else
+        pCtrl = ctrl;
+#endif
+    }
+
+    UInt32 Match(UByte h2) const
+    {
+#if defined(OVR_FLATHASH_SSE2)
+        return (UInt32)_mm_movemask_epi8(_mm_cmpeq_epi8(Ctrl, _mm_set1_epi8((char)h2)));
+#else
+        return matchByte(h2);
+#endif
+    }
+
+    UInt32 MatchEmpty() const
+    {
+#if defined(OVR_FLATHASH_SSE2)
+        return (UInt32)_mm_movemask_epi8(_mm_cmpeq_epi8(Ctrl, _mm_set1_epi8((char)Ctrl_Empty)));
+#else
+        return matchByte(Ctrl_Empty);
+#endif
+    }
+
+    // Empty and Deleted are the only values with the high bit set.
+    UInt32 MatchEmptyOrDeleted() const
+    {
+#if defined(OVR_FLATHASH_SSE2)
+        return (UInt32)_mm_movemask_epi8(Ctrl);
+#else
+        UInt32 mask = 0;
+        for (unsigned i = 0; i < Width; i++)
+            mask |= (UInt32)(pCtrl[i] >> 7) << i;
+        return mask;
+#endif
+    }
+
+    static bool IsFull(UByte ctrl) { return (ctrl & 0x80) == 0; }
+
+    // Index of the lowest set bit of a non-zero match mask.
+    static unsigned LowestBit(UInt32 mask)
+    {
+#if defined(OVR_CC_GNU)
+        return (unsigned)__builtin_ctz(mask);
+#else
+        return Alg::LowerBit(mask);
+#endif
+    }
+
+private:
+#if defined(OVR_FLATHASH_SSE2)
+    __m128i         Ctrl;
+#else
+    UInt32 matchByte(UByte value) const
+    {
+        UInt32 mask = 0;
+        for (unsigned i = 0; i < Width; i++)
+            mask |= (UInt32)(pCtrl[i] == value) << i;
+        return mask;
+    }
+
+    const UByte*    pCtrl;
+#endif
+};
+
+
+template<class C, class HashF = FixedSizeHash<C>,
+         class AltHashF = HashF,
+         class Allocator = ContainerAllocator<C> >
+class FlatHashSet
+{
+    enum { HashMinSize = FlatHashGroup::Width };
+
+public:
+    OVR_MEMORY_REDEFINE_NEW(FlatHashSet)
+
+    typedef FlatHashSet<C, HashF, AltHashF, Allocator>    SelfType;
+
+    FlatHashSet() : pTable(NULL)                       {   }
+    FlatHashSet(int sizeHint) : pTable(NULL)           { SetCapacity(sizeHint);  }
+    FlatHashSet(const SelfType& src) : pTable(NULL)    { Assign(src); }
+    ~FlatHashSet()                                     { Clear(); }
+
+    void operator = (const SelfType& src)   { Assign(src); }
+
+    void Assign(const SelfType& src)
+    {
+        if (&src == this)
+            return;
+        Clear();
+        if (src.IsEmpty() == false)
+        {
+            SetCapacity(src.GetSize());
+
+            for (ConstIterator it = src.Begin(); it != src.End(); ++it)
+            {
+                Add(*it);
+            }
+        }
+    }
+
+    // Remove all entries from the table and free it.
+    void Clear()
+    {
+        if (pTable)
+        {
+            for (UPInt i = 0, n = pTable->SizeMask; i <= n; i++)
+            {
+                if (FlatHashGroup::IsFull(ctrl()[i]))
+                    E(i).~C(); // placement delete
+            }
+
+            Allocator::Free(pTable);
+            pTable = NULL;
+        }
+    }
+
+    bool IsEmpty() const
+    {
+        return pTable == NULL || pTable->EntryCount == 0;
+    }
+
+    // Set a new or existing value under the key, to the value.
+    // Pass a different class of 'key' so that assignment reference object
+    // can be passed instead of the actual object.
+    template<class CRef>
+    void Set(const CRef& key)
+    {
+        UPInt  hashValue = mixHash(HashF()(key));
+        SPInt  index     = (pTable != NULL) ? findIndexCore(key, hashValue) : -1;
+
+        if (index >= 0)
+            E(index) = key;
+        else
+            add(key, hashValue);
+    }
+
+    template<class CRef>
+    inline void Add(const CRef& key)
+    {
+        add(key, mixHash(HashF()(key)));
+    }
+
+    // Remove by alternative key.
+    template<class K>
+    void RemoveAlt(const K& key)
+    {
+        SPInt index = findIndexAlt(key);
+        if (index >= 0)
+            removeAt((UPInt)index);
+    }
+
+    // Remove by main key.
+    template<class CRef>
+    void Remove(const CRef& key)
+    {
+        RemoveAlt(key);
+    }
+
+    // Retrieve the pointer to a value under the given key.
+    //  - If there's no value under the key, then return NULL.
+    //  - If there is a value, return the pointer.
+    template<class K>
+    C* Get(const K& key)
+    {
+        SPInt   index = findIndex(key);
+        return (index >= 0) ? &E(index) : 0;
+    }
+
+    template<class K>
+    const C* Get(const K& key) const
+    {
+        SPInt   index = findIndex(key);
+        return (index >= 0) ? &E(index) : 0;
+    }
+
+    // Alternative key versions of Get. Used by Hash.
+    template<class K>
+    const C* GetAlt(const K& key) const
+    {
+        SPInt   index = findIndexAlt(key);
+        return (index >= 0) ? &E(index) : 0;
+    }
+
+    template<class K>
+    C* GetAlt(const K& key)
+    {
+        SPInt   index = findIndexAlt(key);
+        return (index >= 0) ? &E(index) : 0;
+    }
+
+    template<class K>
+    bool GetAlt(const K& key, C* pval) const
+    {
+        SPInt   index = findIndexAlt(key);
+        if (index >= 0)
+        {
+            if (pval)
+                *pval = E(index);
+            return true;
+        }
+        return false;
+    }
+
+    UPInt GetSize() const
+    {
+        return pTable == NULL ? 0 : (UPInt)pTable->EntryCount;
+    }
+
+    // Hint the bucket count to >= n.
+    void Resize(UPInt n)
+    {
+        SetCapacity(n);
+    }
+
+    // Size the table so that it can contain the given number of elements
+    // without growing. If it already holds more than newSize, this is a no-op.
+    void SetCapacity(UPInt newSize)
+    {
+        UPInt newRawSize = (newSize * 8 + 6) / 7;
+        if (newSize <= GetSize() || (pTable && newRawSize <= pTable->SizeMask + 1))
+            return;
+        setRawCapacity(newRawSize);
+    }
+
+
+    // Iterator API, like STL.
+    struct ConstIterator
+    {
+        const C&    operator * () const
+        {
+            OVR_ASSERT(Index >= 0 && Index <= (SPInt)pHash->pTable->SizeMask);
+            return pHash->E(Index);
+        }
+
+        const C*    operator -> () const
+        {
+            OVR_ASSERT(Index >= 0 && Index <= (SPInt)pHash->pTable->SizeMask);
+            return &pHash->E(Index);
+        }
+
+        void    operator ++ ()
+        {
+            // Find next full slot.
+            if (Index <= (SPInt)pHash->pTable->SizeMask)
+            {
+                Index++;
+                while ((UPInt)Index <= pHash->pTable->SizeMask &&
+                       !FlatHashGroup::IsFull(pHash->ctrl()[Index]))
+                {
+                    Index++;
+                }
+            }
+        }
+
+        bool    operator == (const ConstIterator& it) const
+        {
+            if (IsEnd() && it.IsEnd())
+                return true;
+            return (pHash == it.pHash) && (Index == it.Index);
+        }
+
+        bool    operator != (const ConstIterator& it) const
+        {
+            return ! (*this == it);
+        }
+
+        bool    IsEnd() const
+        {
+            return (pHash == NULL) ||
+                   (pHash->pTable == NULL) ||
+                   (Index > (SPInt)pHash->pTable->SizeMask);
+        }
+
+        ConstIterator()
+            : pHash(NULL), Index(0)
+        { }
+
+    public:
+        // Constructor was intentionally made public to allow create
+        // iterator with arbitrary index.
+        ConstIterator(const SelfType* h, SPInt index)
+            : pHash(h), Index(index)
+        { }
+
+        const SelfType* GetContainer() const
+        {
+            return pHash;
+        }
+        SPInt GetIndex() const
+        {
+            return Index;
+        }
+
+    protected:
+        friend class FlatHashSet<C, HashF, AltHashF, Allocator>;
+
+        const SelfType* pHash;
+        SPInt           Index;
+    };
+
+    friend struct ConstIterator;
+
+
+    // Non-const Iterator; Get most of it from ConstIterator.
+    struct Iterator : public ConstIterator
+    {
+        // Allow non-const access to entries.
+        C&  operator*() const
+        {
+            OVR_ASSERT(ConstIterator::Index >= 0 && ConstIterator::Index <= (SPInt)ConstIterator::pHash->pTable->SizeMask);
+            return const_cast<SelfType*>(ConstIterator::pHash)->E(ConstIterator::Index);
+        }
+
+        C*  operator->() const
+        {
+            return &(operator*());
+        }
+
+        Iterator()
+            : ConstIterator(NULL, 0)
+        { }
+
+        // Removes current element from the table. Values don't move on removal,
+        // so the iterator can still be advanced afterwards.
+        void Remove()
+        {
+            const_cast<SelfType*>(ConstIterator::pHash)->removeAt((UPInt)ConstIterator::Index);
+        }
+
+        template <class K>
+        void RemoveAlt(const K& key)
+        {
+            SelfType* phash = const_cast<SelfType*>(ConstIterator::pHash);
+            SPInt     index = phash->findIndexAlt(key);
+            if (index == ConstIterator::Index)
+                phash->removeAt((UPInt)index);
+            else
+                OVR_ASSERT(index < 0); // Key is in the table, but not at this iterator.
+        }
+
+    private:
+        friend class FlatHashSet<C, HashF, AltHashF, Allocator>;
+
+        Iterator(SelfType* h, SPInt i0)
+            : ConstIterator(h, i0)
+        { }
+    };
+
+    friend struct Iterator;
+
+    Iterator    Begin()
+    {
+        if (pTable == 0)
+            return Iterator(NULL, 0);
+
+        // Scan till we hit the first full slot.
+        UPInt  i0 = 0;
+        while (i0 <= pTable->SizeMask && !FlatHashGroup::IsFull(ctrl()[i0]))
+        {
+            i0++;
+        }
+        return Iterator(this, i0);
+    }
+    Iterator        End()           { return Iterator(NULL, 0); }
+
+    ConstIterator   Begin() const   { return const_cast<SelfType*>(this)->Begin();     }
+    ConstIterator   End() const     { return const_cast<SelfType*>(this)->End();   }
+
+    template<class K>
+    Iterator Find(const K& key)
+    {
+        SPInt index = findIndex(key);
+        if (index >= 0)
+            return Iterator(this, index);
+        return Iterator(NULL, 0);
+    }
+
+    template<class K>
+    Iterator FindAlt(const K& key)
+    {
+        SPInt index = findIndexAlt(key);
+        if (index >= 0)
+            return Iterator(this, index);
+        return Iterator(NULL, 0);
+    }
+
+    template<class K>
+    ConstIterator Find(const K& key) const       { return const_cast<SelfType*>(this)->Find(key); }
+
+    template<class K>
+    ConstIterator FindAlt(const K& key) const    { return const_cast<SelfType*>(this)->FindAlt(key); }
+
+private:
+    // Spreads the user hash over all bits; the low 7 bits go into the control
+    // byte and the rest select the group, so both need to be well mixed.
+    static inline UPInt mixHash(UPInt h)
+    {
+#ifdef OVR_64BIT_POINTERS
+        h ^= h >> 33;
+        h *= (UPInt)0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+#else
+        h ^= h >> 16;
+        h *= (UPInt)0x85EBCA6BU;
+        h ^= h >> 13;
+#endif
+        return h;
+    }
+
+    static inline UByte hashControl(UPInt hashValue) { return (UByte)(hashValue & 0x7F); }
+    inline UPInt        hashGroup(UPInt hashValue) const
+    {
+        return (hashValue >> 7) & (pTable->SizeMask / FlatHashGroup::Width);
+    }
+
+    template<class K>
+    SPInt findIndex(const K& key) const
+    {
+        if (pTable == NULL)
+            return -1;
+        return findIndexCore(key, mixHash(HashF()(key)));
+    }
+
+    template<class K>
+    SPInt findIndexAlt(const K& key) const
+    {
+        if (pTable == NULL)
+            return -1;
+        return findIndexCore(key, mixHash(AltHashF()(key)));
+    }
+
+    // Find the index of the matching value. If no match, then return -1.
+    // Groups are visited in triangular order (+1, +2, +3...), which covers every
+    // group of a power-of-two table; a group with an empty slot ends the probe.
+    template<class K>
+    SPInt findIndexCore(const K& key, UPInt hashValue) const
+    {
+        OVR_ASSERT(pTable != 0);
+
+        UByte       h2        = hashControl(hashValue);
+        UPInt       groupMask = pTable->SizeMask / FlatHashGroup::Width;
+        UPInt       group     = hashGroup(hashValue);
+        const UByte* pctrl    = ctrl();
+        const C*    pvalues   = (const C*)(pctrl + pTable->SizeMask + 1);
+
+        for (UPInt probe = 1; probe <= groupMask + 1; probe++)
+        {
+            UPInt         base = group * FlatHashGroup::Width;
+            FlatHashGroup g(pctrl + base);
+
+            for (UInt32 match = g.Match(h2); match; match &= match - 1)
+            {
+                UPInt index = base + FlatHashGroup::LowestBit(match);
+                if (pvalues[index] == key)
+                    return (SPInt)index;
+            }
+            if (g.MatchEmpty())
+                break;
+
+            group = (group + probe) & groupMask;
+        }
+        return -1;
+    }
+
+    // Add a new value to the table, under the specified key.
+    template<class CRef>
+    void add(const CRef& key, UPInt hashValue)
+    {
+        if (pTable == NULL)
+        {
+            setRawCapacity(HashMinSize);
+        }
+        else if (pTable->GrowthLeft == 0)
+        {
+            // Rehashing in place is enough when most of the used slots are
+            // tombstones left by removals; otherwise double.
+            UPInt capacity = pTable->SizeMask + 1;
+            setRawCapacity((pTable->EntryCount * 2 <= maxEntries(capacity)) ?
+                           capacity : capacity * 2);
+        }
+
+        UPInt index = findInsertSlot(hashValue);
+        if (ctrl()[index] == FlatHashGroup::Ctrl_Empty)
+            pTable->GrowthLeft--;
+        ctrl()[index] = hashControl(hashValue);
+        pTable->EntryCount++;
+
+        new (&E(index)) C(key);
+    }
+
+    // First Empty or Deleted slot along the probe sequence of hashValue.
+    UPInt findInsertSlot(UPInt hashValue) const
+    {
+        UPInt   groupMask = pTable->SizeMask / FlatHashGroup::Width;
+        UPInt   group     = hashGroup(hashValue);
+
+        for (UPInt probe = 1; ; probe++)
+        {
+            UPInt  base = group * FlatHashGroup::Width;
+            UInt32 free = FlatHashGroup(ctrl() + base).MatchEmptyOrDeleted();
+            if (free)
+                return base + FlatHashGroup::LowestBit(free);
+
+            // The load limit guarantees a free slot in some group.
+            OVR_ASSERT(probe <= groupMask);
+            group = (group + probe) & groupMask;
+        }
+    }
+
+    void removeAt(UPInt index)
+    {
+        OVR_ASSERT(FlatHashGroup::IsFull(ctrl()[index]));
+        E(index).~C(); // placement delete
+        pTable->EntryCount--;
+
+        // A probe stops at the first group with an empty slot, so if this group
+        // already has one no probe can pass through it and the slot can simply
+        // become empty. Otherwise a tombstone keeps later probes going.
+        UPInt base = index & ~(UPInt)(FlatHashGroup::Width - 1);
+        if (FlatHashGroup(ctrl() + base).MatchEmpty())
+        {
+            ctrl()[index] = FlatHashGroup::Ctrl_Empty;
+            pTable->GrowthLeft++;
+        }
+        else
+        {
+            ctrl()[index] = FlatHashGroup::Ctrl_Deleted;
+        }
+    }
+
+    // Tables are kept at most 7/8 full.
+    static UPInt maxEntries(UPInt capacity) { return capacity - capacity / 8; }
+
+    // Index access helpers.
+    UByte* ctrl() const
+    {
+        return (UByte*)(pTable + 1);
+    }
+    C& E(UPInt index)
+    {
+        // Must have pTable and access needs to be within bounds.
+        OVR_ASSERT(index <= pTable->SizeMask);
+        return *(((C*) (ctrl() + pTable->SizeMask + 1)) + index);
+    }
+    const C& E(UPInt index) const
+    {
+        OVR_ASSERT(index <= pTable->SizeMask);
+        return *(((const C*) (ctrl() + pTable->SizeMask + 1)) + index);
+    }
+
+
+    // Resize the table to the given number of slots (rehashing the contents of
+    // the current table). Any tombstones are dropped in the process.
+    void    setRawCapacity(UPInt newSize)
+    {
+        if (newSize == 0)
+        {
+            // Special case.
+            Clear();
+            return;
+        }
+
+        // Force newSize to be a power of two, and at least one group.
+        if (newSize < HashMinSize)
+            newSize = HashMinSize;
+        else
+        {
+            int bits = Alg::UpperBit(newSize-1) + 1;
+            OVR_ASSERT((UPInt(1) << bits) >= newSize);
+            newSize = UPInt(1) << bits;
+        }
+
+        // Control bytes sit between the header and the values; the header is a
+        // multiple of 16 bytes, as is newSize, so the values stay 16-byte aligned.
+        TableType* newTable = (TableType*)
+            Allocator::Alloc(sizeof(TableType) + newSize + sizeof(C) * newSize);
+        // Need to do something on alloc failure!
+        OVR_ASSERT(newTable);
+
+        newTable->EntryCount = 0;
+        newTable->SizeMask   = newSize - 1;
+        newTable->GrowthLeft = maxEntries(newSize);
+        memset(newTable + 1, FlatHashGroup::Ctrl_Empty, newSize);
+
+        TableType* oldTable = pTable;
+        pTable = newTable;
+
+        if (oldTable)
+        {
+            UByte* oldCtrl   = (UByte*)(oldTable + 1);
+            C*     oldValues = (C*)(oldCtrl + oldTable->SizeMask + 1);
+
+            for (UPInt i = 0, n = oldTable->SizeMask; i <= n; i++)
+            {
+                if (FlatHashGroup::IsFull(oldCtrl[i]))
+                {
+                    // The key is already known to be unique, so skip the lookup.
+                    UPInt hashValue = mixHash(HashF()(oldValues[i]));
+                    UPInt index     = findInsertSlot(hashValue);
+                    ctrl()[index] = hashControl(hashValue);
+                    new (&E(index)) C(oldValues[i]);
+                    oldValues[i].~C();
+                }
+            }
+            pTable->EntryCount = oldTable->EntryCount;
+            pTable->GrowthLeft = maxEntries(newSize) - oldTable->EntryCount;
+
+            Allocator::Free(oldTable);
+        }
+    }
+
+    struct TableType
+    {
+        UPInt EntryCount;
+        UPInt SizeMask;
+        // Number of Empty slots that can still be filled before a rehash.
+        UPInt GrowthLeft;
+        UPInt Pad;
+        // Control bytes, then the value array, follow this structure in memory.
+    };
+    TableType*  pTable;
+};
+
+
+//-----------------------------------------------------------------------------------
+// ***** FlatHash
+
+// Hash with a FlatHashSet as its container; a drop-in replacement for Hash.
+template<class C, class U, class HashF = FixedSizeHash<C>, class Allocator = ContainerAllocator<C> >
+class FlatHash
+    : public Hash<C, U, HashF, Allocator, HashNode<C,U,HashF>,
+                  HashsetNodeEntry<HashNode<C,U,HashF>, typename HashNode<C,U,HashF>::NodeHashF>,
+                  FlatHashSet<HashNode<C,U,HashF>, typename HashNode<C,U,HashF>::NodeHashF,
+                              typename HashNode<C,U,HashF>::NodeAltHashF, Allocator> >
+{
+public:
+    typedef FlatHash<C, U, HashF, Allocator>                    SelfType;
+    typedef Hash<C, U, HashF, Allocator, HashNode<C,U,HashF>,
+                 HashsetNodeEntry<HashNode<C,U,HashF>, typename HashNode<C,U,HashF>::NodeHashF>,
+                 FlatHashSet<HashNode<C,U,HashF>, typename HashNode<C,U,HashF>::NodeHashF,
+                             typename HashNode<C,U,HashF>::NodeAltHashF, Allocator> > BaseType;
+
+    // Delegated constructors.
+    FlatHash()                                        { }
+    FlatHash(int sizeHint) : BaseType(sizeHint)       { }
+    FlatHash(const SelfType& src) : BaseType(src)     { }
+    ~FlatHash()                                       { }
+    void operator = (const SelfType& src)             { BaseType::operator = (src); }
+};
+
+
+} // OVR
+
+
+#ifdef OVR_DEFINE_NEW
+#define new OVR_DEFINE_NEW
+#endif
+
+#endif
@@ -0,0 +1,268 @@
+/************************************************************************************
+
+Filename    :   OVR_FrameArena.cpp
+Content     :   Per-frame linear allocator and containers that allocate from it
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+************************************************************************************/
+
+#include "OVR_FrameArena.h"
+#include "OVR_Alg.h"
+#include "OVR_Log.h"
+#include "OVR_Std.h"
+#include <string.h>
+
+namespace OVR {
+
+//------------------------------------------------------------------------
+// ***** FrameArena
+
+enum
+{
+    // Each allocation is preceded by a header holding its size, which keeps
+    // the data 16-byte aligned.
+    ArenaHeaderSize = 16,
+    ArenaAlignMask  = 15
+};
+
+static inline UPInt arenaAlign(UPInt size)
+{
+    return (size + ArenaAlignMask) & ~(UPInt)ArenaAlignMask;
+}
+
+static inline UPInt& arenaAllocSize(void* p)
+{
+    return *(UPInt*)((UByte*)p - ArenaHeaderSize);
+}
+
+FrameArena* FrameArena::pCurrent = 0;
+
+
+FrameArena::FrameArena(UPInt blockSize)
+    : pBlocks(0), BlockSize(blockSize), pLast(0),
+      UsedSize(0), PeakSize(0), HeapAllocCount(0)
+{
+}
+
+FrameArena::~FrameArena()
+{
+    if (pCurrent == this)
+        pCurrent = 0;
+    freeBlocks();
+}
+
+UByte* FrameArena::blockData(Block* block) const
+{
+    return (UByte*)block + arenaAlign(sizeof(Block));
+}
+
+FrameArena::Block* FrameArena::newBlock(UPInt size)
+{
+    Block* block = (Block*)OVR_ALLOC(arenaAlign(sizeof(Block)) + size);
+    if (!block)
+        return 0;
+    HeapAllocCount++;
+    block->pNext = pBlocks;
+    block->Size  = size;
+    block->Used  = 0;
+    pBlocks = block;
+    return block;
+}
+
+void FrameArena::freeBlocks()
+{
+    while (pBlocks)
+    {
+        Block* next = pBlocks->pNext;
+        OVR_FREE(pBlocks);
+        pBlocks = next;
+    }
+    pLast = 0;
+}
+
+void* FrameArena::Alloc(UPInt size)
+{
+    UPInt  needed = ArenaHeaderSize + arenaAlign(size);
+    Block* block  = pBlocks;
+
+    if (!block || (block->Size - block->Used < needed))
+    {
+        // Overflow for this frame; Reset will size the next frame's block to fit.
+        block = newBlock(Alg::Max(needed, BlockSize));
+        if (!block)
+            return 0;
+    }
+
+    UByte* p = blockData(block) + block->Used + ArenaHeaderSize;
+    block->Used += needed;
+    arenaAllocSize(p) = size;
+    pLast = p;
+
+    UsedSize += needed;
+    if (UsedSize > PeakSize)
+        PeakSize = UsedSize;
+    return p;
+}
+
+void* FrameArena::Realloc(void* p, UPInt newSize)
+{
+    if (!p)
+        return Alloc(newSize);
+
+    UPInt oldSize = arenaAllocSize(p);
+
+    if (p == pLast)
+    {
+        // Grow or shrink the most recent allocation in place if the block has room.
+        Block* block   = pBlocks;
+        UPInt  oldUsed = arenaAlign(oldSize);
+        UPInt  newUsed = arenaAlign(newSize);
+        if (block->Used - oldUsed + newUsed <= block->Size)
+        {
+            block->Used += newUsed - oldUsed;
+            UsedSize    += newUsed - oldUsed;
+            if (UsedSize > PeakSize)
+                PeakSize = UsedSize;
+            arenaAllocSize(p) = newSize;
+            return p;
+        }
+    }
+    else if (newSize <= oldSize)
+    {
+        arenaAllocSize(p) = newSize;
+        return p;
+    }
+
+    void* newP = Alloc(newSize);
+    if (!newP)
+        return 0;
+    memcpy(newP, p, Alg::Min(oldSize, newSize));
+    return newP;
+}
+
+void FrameArena::Free(void* p)
+{
+    if (p && (p == pLast))
+    {
+        UPInt used = ArenaHeaderSize + arenaAlign(arenaAllocSize(p));
+        pBlocks->Used -= used;
+        UsedSize      -= used;
+        pLast = 0;
+    }
+}
+
+void FrameArena::Reset()
+{
+    if (pBlocks && pBlocks->pNext)
+    {
+        // The last frame didn't fit in one block: replace them all with a block
+        // that holds the peak, so that later frames fit without growing.
+        freeBlocks();
+        BlockSize = Alg::Max(BlockSize, arenaAlign(PeakSize + PeakSize / 4));
+        newBlock(BlockSize);
+    }
+    else if (pBlocks)
+    {
+        pBlocks->Used = 0;
+    }
+    pLast    = 0;
+    UsedSize = 0;
+}
+
+bool FrameArena::Owns(const void* p) const
+{
+    for (Block* block = pBlocks; block; block = block->pNext)
+    {
+        const UByte* data = blockData(block);
+        if ((const UByte*)p >= data && (const UByte*)p < data + block->Size)
+            return true;
+    }
+    return false;
+}
+
+
+void* FrameArena::AllocCurrent(UPInt size)
+{
+    return pCurrent ? pCurrent->Alloc(size) : OVR_ALLOC(size);
+}
+
+void* FrameArena::ReallocCurrent(void* p, UPInt newSize)
+{
+    if (!p)
+        return AllocCurrent(newSize);
+    if (pCurrent && pCurrent->Owns(p))
+        return pCurrent->Realloc(p, newSize);
+    return OVR_REALLOC(p, newSize);
+}
+
+void FrameArena::FreeCurrent(void* p)
+{
+    if (!p)
+        return;
+    if (pCurrent && pCurrent->Owns(p))
+        pCurrent->Free(p);
+    else
+        OVR_FREE(p);
+}
+
+
+//-----------------------------------------------------------------------------------
+// ***** FrameString
+
+void FrameString::Clear()
+{
+    Chars.Resize(1);
+    Chars[0] = 0;
+}
+
+void FrameString::AppendString(const char* data, SPInt size)
+{
+    if (!data)
+        return;
+    if (size < 0)
+        size = (SPInt)OVR_strlen(data);
+
+    UPInt oldSize = GetSize();
+    Chars.Resize(oldSize + size + 1);
+    memcpy(&Chars[oldSize], data, size);
+    Chars[oldSize + size] = 0;
+}
+
+void FrameString::AppendFormat(const char* format, ...)
+{
+    va_list argList;
+
+    va_start(argList, format);
+    UPInt size = OVR_vscprintf(format, argList);
+    va_end(argList);
+
+    // Format straight into the grown buffer, including the terminator.
+    UPInt oldSize = GetSize();
+    Chars.Resize(oldSize + size + 1);
+
+    va_start(argList, format);
+    UPInt result = OVR_vsprintf(&Chars[oldSize], size + 1, format, argList);
+    OVR_UNUSED1(result);
+    va_end(argList);
+    OVR_ASSERT_LOG(result == size, ("Error in OVR_vsprintf"));
+}
+
+} // OVR
@@ -0,0 +1,178 @@
+/************************************************************************************
+
+PublicHeader:   OVR.h
+Filename    :   OVR_FrameArena.h
+Content     :   Per-frame linear allocator and containers that allocate from it
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+************************************************************************************/
+
+#ifndef OVR_FrameArena_h
+#define OVR_FrameArena_h
+
+#include "OVR_Array.h"
+
+namespace OVR {
+
+//------------------------------------------------------------------------
+// ***** FrameArena
+
+// FrameArena hands out memory by bumping a pointer through a block, and takes
+// it all back at once in Reset, which the application calls once per frame
+// (after Present). Free only reclaims the most recent allocation.
+//
+// When a frame needs more than the block holds, further blocks are taken from
+// the heap; the next Reset replaces them with a single block large enough for
+// the whole frame, so a steady-state frame never touches the heap.
+//
+// One arena can be made current for the calling code with SetCurrent; the
+// FrameArray and FrameString containers below allocate from it, falling back
+// to the global heap when there is none. The arena is not thread-safe, so it
+// should only be used from the thread that renders.
+
+class FrameArena : public NewOverrideBase
+{
+public:
+    enum { DefaultBlockSize = 64 * 1024 };
+
+    FrameArena(UPInt blockSize = DefaultBlockSize);
+    ~FrameArena();
+
+    // Allocations are 16-byte aligned and valid until the next Reset.
+    void*   Alloc(UPInt size);
+    // Grows in place when p is the most recent allocation and there is room.
+    void*   Realloc(void* p, UPInt newSize);
+    void    Free(void* p);
+
+    // Releases all allocations made since the last Reset.
+    void    Reset();
+
+    bool    Owns(const void* p) const;
+
+    // Bytes handed out since the last Reset, and the largest such amount seen.
+    UPInt   GetUsedSize() const     { return UsedSize; }
+    UPInt   GetPeakSize() const     { return PeakSize; }
+    // Number of heap allocations the arena itself has made.
+    UPInt   GetHeapAllocCount() const { return HeapAllocCount; }
+
+    static FrameArena*  GetCurrent()                    { return pCurrent; }
+    static void         SetCurrent(FrameArena* arena)   { pCurrent = arena; }
+
+    // Allocation through the current arena, or the global heap if there is none.
+    static void*    AllocCurrent(UPInt size);
+    static void*    ReallocCurrent(void* p, UPInt newSize);
+    static void     FreeCurrent(void* p);
+
+private:
+    struct Block
+    {
+        Block*  pNext;
+        UPInt   Size;
+        UPInt   Used;
+    };
+
+    Block*  newBlock(UPInt size);
+    void    freeBlocks();
+
+    UByte*  blockData(Block* block) const;
+
+    Block*  pBlocks;    // Current block first.
+    UPInt   BlockSize;
+    UByte*  pLast;      // Most recent allocation, for in-place Realloc and Free.
+    UPInt   UsedSize;
+    UPInt   PeakSize;
+    UPInt   HeapAllocCount;
+
+    static FrameArena* pCurrent;
+};
+
+
+//-----------------------------------------------------------------------------------
+// ***** FrameArray
+
+// Container allocator that allocates from the current FrameArena. Memory that
+// didn't come from the arena (allocated while there was none) goes to the heap.
+class ContainerAllocatorBase_Frame
+{
+public:
+    static void* Alloc(UPInt size)                { return FrameArena::AllocCurrent(size); }
+    static void* Realloc(void* p, UPInt newSize)  { return FrameArena::ReallocCurrent(p, newSize); }
+    static void  Free(void *p)                    { FrameArena::FreeCurrent(p); }
+};
+
+template<class T> struct ContainerAllocator_Frame : ContainerAllocatorBase_Frame, ConstructorMov<T> {};
+
+// Array of movable objects whose storage comes from the current FrameArena.
+// It must not outlive the frame it was filled in.
+template<class T, class SizePolicy=ArrayDefaultPolicy>
+class FrameArray : public ArrayBase<ArrayData<T, ContainerAllocator_Frame<T>, SizePolicy> >
+{
+public:
+    typedef T                                                                   ValueType;
+    typedef ContainerAllocator_Frame<T>                                         AllocatorType;
+    typedef SizePolicy                                                          SizePolicyType;
+    typedef FrameArray<T, SizePolicy>                                           SelfType;
+    typedef ArrayBase<ArrayData<T, ContainerAllocator_Frame<T>, SizePolicy> >   BaseType;
+
+    FrameArray() : BaseType() {}
+    FrameArray(int size) : BaseType(size) {}
+    FrameArray(const SizePolicyType& p) : BaseType() { SetSizePolicy(p); }
+    FrameArray(const SelfType& a) : BaseType(a) {}
+    const SelfType& operator=(const SelfType& a) { BaseType::operator=(a); return *this; }
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    FrameArray(SelfType&& a) : BaseType(static_cast<BaseType&&>(a)) {}
+    const SelfType& operator=(SelfType&& a) { BaseType::operator=(static_cast<BaseType&&>(a)); return *this; }
+#endif
+};
+
+
+//-----------------------------------------------------------------------------------
+// ***** FrameString
+
+// Null-terminated UTF-8 string built in the current FrameArena, for text that is
+// assembled and drawn within one frame. Only appending is supported.
+class FrameString
+{
+public:
+    FrameString()                       { Clear(); }
+    FrameString(const char* data)       { Clear(); AppendString(data); }
+    FrameString(const FrameString& src) { Clear(); AppendString(src.ToCStr(), src.GetSize()); }
+
+    const char* ToCStr() const          { return &Chars[0]; }
+    UPInt       GetSize() const         { return Chars.GetSize() - 1; }
+    bool        IsEmpty() const         { return GetSize() == 0; }
+
+    void        Clear();
+    void        AppendString(const char* data, SPInt size = -1);
+    void        AppendFormat(const char* format, ...);
+
+    void        operator =  (const FrameString& src) { Clear(); AppendString(src.ToCStr(), src.GetSize()); }
+    void        operator =  (const char* data)       { Clear(); AppendString(data); }
+    void        operator += (const FrameString& src) { AppendString(src.ToCStr(), src.GetSize()); }
+    void        operator += (const char* data)       { AppendString(data); }
+
+private:
+    FrameArray<char, ArrayConstPolicy<0, 64, true> > Chars;
+};
+
+} // OVR
+
+#endif
@@ -42,6 +42,13 @@ namespace OVR {
 // {
 //     . . .
 // };
+//
+// A list's root is a ListNode but not a T, and any node's neighbour may be the
+// root. Neighbours are therefore always accessed through asNode, as ListNode.
+// Accessing the root as a T would let the compiler assume, under strict
+// aliasing, that writes through a neighbour can't change the list, and reuse
+// stale values of it; loops such as "while (!list.IsEmpty()) remove first"
+// then never end.
 
 template<class T>
 struct ListNode
@@ -55,17 +62,19 @@ struct ListNode
         void* pVoidNext;
     };
 
+    static ListNode* asNode(ListNode* p) { return p; }
+
     void    RemoveNode()
     {
-        pPrev->pNext = pNext;
-        pNext->pPrev = pPrev;
+        asNode(pPrev)->pNext = pNext;
+        asNode(pNext)->pPrev = pPrev;
     }
 
     // Removes us from the list and inserts pnew there instead.
     void    ReplaceNodeWith(T* pnew)
     {
-        pPrev->pNext = pnew;
-        pNext->pPrev = pnew;
+        asNode(pPrev)->pNext = pnew;
+        asNode(pNext)->pPrev = pnew;
         pnew->pPrev = pPrev;
         pnew->pNext = pNext;
     }
@@ -73,26 +82,26 @@ struct ListNode
     // Inserts the argument linked list node after us in the list.
     void    InsertNodeAfter(T* p)
     {
-        p->pPrev          = pNext->pPrev; // this
-        p->pNext          = pNext;
-        pNext->pPrev      = p;
-        pNext             = p;
+        p->pPrev              = asNode(pNext)->pPrev; // this
+        p->pNext              = pNext;
+        asNode(pNext)->pPrev  = p;
+        pNext                 = p;
     }
     // Inserts the argument linked list node before us in the list.
     void    InsertNodeBefore(T* p)
     {
-        p->pNext          = pNext->pPrev; // this
-        p->pPrev          = pPrev;
-        pPrev->pNext      = p;
-        pPrev             = p;
+        p->pNext              = asNode(pNext)->pPrev; // this
+        p->pPrev              = pPrev;
+        asNode(pPrev)->pNext  = p;
+        pPrev                 = p;
     }
 
     void    Alloc_MoveTo(ListNode<T>* pdest)
     {
         pdest->pNext = pNext;
         pdest->pPrev = pPrev;
-        pPrev->pNext = (T*)pdest;
-        pNext->pPrev = (T*)pdest;
+        asNode(pPrev)->pNext = (T*)pdest;
+        asNode(pNext)->pPrev = (T*)pdest;
     }
 };
 
@@ -152,8 +161,6 @@ public:
           ValueType* GetLast ()       { return (ValueType*)Root.pPrev; }
 
     // Determine if list is empty (i.e.) points to itself.
-    // Go through void* access to avoid issues with strict-aliasing optimizing out the
-    // access after RemoveNode(), etc.
     bool IsEmpty()                   const { return Root.pVoidNext == (const T*)(const B*)&Root; }
     bool IsFirst(const ValueType* p) const { return p == Root.pNext; }
     bool IsLast (const ValueType* p) const { return p == Root.pPrev; }
@@ -166,24 +173,24 @@ public:
 
     void PushFront(ValueType* p)
     {
-        p->pNext          =  Root.pNext;
-        p->pPrev          = (ValueType*)&Root;
-        Root.pNext->pPrev =  p;
-        Root.pNext        =  p;
+        p->pNext                  =  Root.pNext;
+        p->pPrev                  = (ValueType*)&Root;
+        asNode(Root.pNext)->pPrev =  p;
+        Root.pNext                =  p;
     }
 
     void PushBack(ValueType* p)
     {
-        p->pPrev          =  Root.pPrev;
-        p->pNext          = (ValueType*)&Root;
-        Root.pPrev->pNext =  p;
-        Root.pPrev        =  p;
+        p->pPrev                  =  Root.pPrev;
+        p->pNext                  = (ValueType*)&Root;
+        asNode(Root.pPrev)->pNext =  p;
+        Root.pPrev                =  p;
     }
 
     static void Remove(ValueType* p)
     {
-        p->pPrev->pNext = p->pNext;
-        p->pNext->pPrev = p->pPrev;
+        asNode(p->pPrev)->pNext = p->pNext;
+        asNode(p->pNext)->pPrev = p->pPrev;
     }
 
     void BringToFront(ValueType* p)
@@ -209,8 +216,8 @@ public:
             src.Clear();
             plast->pNext   = Root.pNext;
             pfirst->pPrev  = (ValueType*)&Root;
-            Root.pNext->pPrev = plast;
-            Root.pNext        = pfirst;
+            asNode(Root.pNext)->pPrev = plast;
+            Root.pNext                = pfirst;
         }
     }
 
@@ -223,8 +230,8 @@ public:
             src.Clear();
             plast->pNext   = (ValueType*)&Root;
             pfirst->pPrev  = Root.pPrev;
-            Root.pPrev->pNext = pfirst;
-            Root.pPrev        = plast;
+            asNode(Root.pPrev)->pNext = pfirst;
+            Root.pPrev                = plast;
         }
     }
 
@@ -237,13 +244,13 @@ public:
             ValueType *plast = src.Root.pPrev;
 
             // Remove list remainder from source.
-            pfirst->pPrev->pNext = (ValueType*)&src.Root;
+            asNode(pfirst->pPrev)->pNext = (ValueType*)&src.Root;
             src.Root.pPrev      = pfirst->pPrev;
             // Add the rest of the items to list.
             plast->pNext      = Root.pNext;
             pfirst->pPrev     = (ValueType*)&Root;
-            Root.pNext->pPrev = plast;
-            Root.pNext        = pfirst;
+            asNode(Root.pNext)->pPrev = plast;
+            Root.pNext                = pfirst;
         }
     }
 
@@ -263,8 +270,8 @@ public:
             // Add the rest of the items to list.
             plast->pNext      = Root.pNext;
             pfirst->pPrev     = (ValueType*)&Root;
-            Root.pNext->pPrev = plast;
-            Root.pNext        = pfirst;
+            asNode(Root.pNext)->pPrev = plast;
+            Root.pNext                = pfirst;
         }
     }
 
@@ -275,16 +282,16 @@ public:
     {
         if (pfirst != pend)
         {
-            ValueType *plast = pend->pPrev;
+            ValueType *plast = asNode(pend)->pPrev;
 
             // Remove list remainder from source.
-            pfirst->pPrev->pNext = pend;
-            pend->pPrev          = pfirst->pPrev;
+            asNode(pfirst->pPrev)->pNext = pend;
+            asNode(pend)->pPrev          = pfirst->pPrev;
             // Add the rest of the items to list.
             plast->pNext      = Root.pNext;
             pfirst->pPrev     = (ValueType*)&Root;
-            Root.pNext->pPrev = plast;
-            Root.pNext        = pfirst;
+            asNode(Root.pNext)->pPrev = plast;
+            Root.pNext                = pfirst;
         }
     }
 
@@ -298,13 +305,15 @@ public:
             pdest->Root.pNext = Root.pNext;
             pdest->Root.pPrev = Root.pPrev;
 
-            Root.pNext->pPrev = (ValueType*)&pdest->Root;
-            Root.pPrev->pNext = (ValueType*)&pdest->Root;
+            asNode(Root.pNext)->pPrev = (ValueType*)&pdest->Root;
+            asNode(Root.pPrev)->pNext = (ValueType*)&pdest->Root;
         }        
     }
 
 
 private:
+    static ListNode<B>* asNode(ListNode<B>* p) { return p; }
+
     // Copying is prohibited
     List(const List<T>&);
     const List<T>& operator = (const List<T>&);
@@ -0,0 +1,295 @@
+/************************************************************************************
+
+Filename    :   OVR_MMapFile.cpp
+Content     :   Read-only file mapped into memory
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+************************************************************************************/
+
+#include "OVR_MMapFile.h"
+#include "OVR_UTF8Util.h"
+
+#include <string.h>
+
+#ifdef OVR_OS_WIN32
+#include "windows.h"
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+namespace OVR {
+
+//-----------------------------------------------------------------------------------
+// ***** Platform mapping
+
+#ifdef OVR_OS_WIN32
+
+static int MMerror()
+{
+    DWORD error = ::GetLastError();
+    if (error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND)
+        return FileConstants::Error_FileNotFound;
+    else if (error == ERROR_ACCESS_DENIED || error == ERROR_SHARING_VIOLATION)
+        return FileConstants::Error_Access;
+    else
+        return FileConstants::Error_IOError;
+}
+
+// Maps the file at path; on success returns 0 and fills in *pdata and *psize,
+// leaving *pdata null for an empty file. Otherwise returns the error code.
+static int MapFile(const String& path, UByte** pdata, SInt64* psize)
+{
+    wchar_t *pwpath = (wchar_t*)OVR_ALLOC((UTF8Util::GetLength(path.ToCStr())+1) * sizeof(wchar_t));
+    UTF8Util::DecodeString(pwpath, path.ToCStr());
+    HANDLE file = ::CreateFileW(pwpath, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, 0);
+    OVR_FREE(pwpath);
+    if (file == INVALID_HANDLE_VALUE)
+        return MMerror();
+
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size))
+    {
+        int error = MMerror();
+        ::CloseHandle(file);
+        return error;
+    }
+    if ((UInt64)size.QuadPart != (UPInt)size.QuadPart)
+    {
+        // Doesn't fit in the address space.
+        ::CloseHandle(file);
+        return FileConstants::Error_IOError;
+    }
+
+    UByte* data = 0;
+    if (size.QuadPart > 0)
+    {
+        // The view keeps the mapping, and the mapping the file, open.
+        HANDLE mapping = ::CreateFileMappingW(file, 0, PAGE_READONLY, 0, 0, 0);
+        if (mapping)
+            data = (UByte*)::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        int error = data ? 0 : MMerror();
+        if (mapping)
+            ::CloseHandle(mapping);
+        if (error)
+        {
+            ::CloseHandle(file);
+            return error;
+        }
+    }
+    ::CloseHandle(file);
+
+    *pdata = data;
+    *psize = size.QuadPart;
+    return 0;
+}
+
+static void UnmapFile(UByte* data, SInt64 size)
+{
+    OVR_UNUSED(size);
+    ::UnmapViewOfFile(data);
+}
+
+#else
+
+static int MMerror()
+{
+    if (errno == ENOENT)
+        return FileConstants::Error_FileNotFound;
+    else if (errno == EACCES || errno == EPERM)
+        return FileConstants::Error_Access;
+    else
+        return FileConstants::Error_IOError;
+}
+
+// Maps the file at path; on success returns 0 and fills in *pdata and *psize,
+// leaving *pdata null for an empty file. Otherwise returns the error code.
+static int MapFile(const String& path, UByte** pdata, SInt64* psize)
+{
+    int fd = ::open(path.ToCStr(), O_RDONLY);
+    if (fd < 0)
+        return MMerror();
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+    {
+        int error = MMerror();
+        ::close(fd);
+        return error;
+    }
+    if (!S_ISREG(st.st_mode) || ((UInt64)st.st_size != (UPInt)st.st_size))
+    {
+        // Only regular files that fit in the address space can be mapped.
+        ::close(fd);
+        return FileConstants::Error_IOError;
+    }
+
+    UByte* data = 0;
+    if (st.st_size > 0)
+    {
+        void* p = ::mmap(0, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED)
+        {
+            int error = MMerror();
+            ::close(fd);
+            return error;
+        }
+        data = (UByte*)p;
+    }
+    // The mapping keeps its own reference to the file.
+    ::close(fd);
+
+    *pdata = data;
+    *psize = st.st_size;
+    return 0;
+}
+
+static void UnmapFile(UByte* data, SInt64 size)
+{
+    ::munmap(data, (size_t)size);
+}
+
+#endif // OVR_OS_WIN32
+
+
+//-----------------------------------------------------------------------------------
+// ***** MMapFile
+
+MMapFile::MMapFile()
+    : pData(0), Size(0), Pos(0), Opened(false), ErrorCode(0)
+{
+}
+
+MMapFile::MMapFile(const String& path)
+    : pData(0), Size(0), Pos(0), Opened(false), ErrorCode(0)
+{
+    Open(path);
+}
+
+MMapFile::~MMapFile()
+{
+    Close();
+}
+
+bool MMapFile::Open(const String& path)
+{
+    Close();
+    FilePath  = path;
+    ErrorCode = MapFile(path, &pData, &Size);
+    Opened    = (ErrorCode == 0);
+    return Opened;
+}
+
+const UByte* MMapFile::View(SInt64 offset, SInt64 size)
+{
+    if (!pData || offset < 0 || size < 0 || size > Size - offset)
+        return 0;
+    return pData + offset;
+}
+
+
+int MMapFile::Write(const UByte *pbuffer, int numBytes)
+{
+    OVR_UNUSED2(pbuffer, numBytes);
+    ErrorCode = Error_Access;
+    return -1;
+}
+
+int MMapFile::Read(UByte *pbuffer, int numBytes)
+{
+    if (!Opened)
+        return -1;
+    numBytes = SkipBytes(numBytes);
+    if (numBytes > 0)
+        memcpy(pbuffer, pData + Pos - numBytes, numBytes);
+    return numBytes;
+}
+
+int MMapFile::SkipBytes(int numBytes)
+{
+    if (!Opened)
+        return -1;
+    if (numBytes > BytesAvailable())
+        numBytes = BytesAvailable();
+    if (numBytes > 0)
+        Pos += numBytes;
+    return numBytes > 0 ? numBytes : 0;
+}
+
+int MMapFile::BytesAvailable()
+{
+    SInt64 available = Size - Pos;
+    if (available <= 0)
+        return 0;
+    return (available > 0x7FFFFFFF) ? 0x7FFFFFFF : (int)available;
+}
+
+int MMapFile::Seek(int offset, int origin)
+{
+    return (int)LSeek(offset, origin);
+}
+
+SInt64 MMapFile::LSeek(SInt64 offset, int origin)
+{
+    if (!Opened)
+        return -1;
+
+    SInt64 pos;
+    switch (origin)
+    {
+    case Seek_Set:  pos = offset;           break;
+    case Seek_Cur:  pos = Pos + offset;     break;
+    case Seek_End:  pos = Size + offset;    break;
+    default:        return -1;
+    }
+    if (pos < 0)
+        return -1;
+
+    // Like a read-only stdio stream, seeking past the end is allowed, and reads there return 0.
+    Pos = pos;
+    return Pos;
+}
+
+int MMapFile::CopyFromStream(File *pstream, int byteSize)
+{
+    OVR_UNUSED2(pstream, byteSize);
+    ErrorCode = Error_Access;
+    return -1;
+}
+
+bool MMapFile::Close()
+{
+    if (!Opened)
+        return false;
+    if (pData)
+        UnmapFile(pData, Size);
+    pData  = 0;
+    Size   = 0;
+    Pos    = 0;
+    Opened = false;
+    return true;
+}
+
+} // OVR
@@ -0,0 +1,101 @@
+/************************************************************************************
+
+PublicHeader:   Kernel
+Filename    :   OVR_MMapFile.h
+Content     :   Read-only file mapped into memory
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+************************************************************************************/
+
+#ifndef OVR_MMapFile_h
+#define OVR_MMapFile_h
+
+#include "OVR_File.h"
+
+namespace OVR {
+
+//-----------------------------------------------------------------------------------
+// ***** MMapFile
+
+// MMapFile maps a whole file read-only into the address space. Read copies out
+// of the mapping like any other file, but GetData and View return pointers into
+// it, so loaders can use the contents in place, straight from the page cache.
+// Those pointers stay valid until the file is closed or destroyed.
+//
+// SysFile opens files this way when Open_Mapped is given; MMapFile can also be
+// used directly. An empty file opens successfully with no data.
+
+class MMapFile : public File
+{
+public:
+    MMapFile();
+    // path should be encoded as UTF-8 to support international file names.
+    MMapFile(const String& path);
+    ~MMapFile();
+
+    bool                Open(const String& path);
+
+    // Contents of the whole file; null if it is empty or not open.
+    const UByte*        GetData() const         { return pData; }
+
+    virtual const UByte* View(SInt64 offset, SInt64 size);
+
+    // ** File implementation
+    virtual const char* GetFilePath()           { return FilePath.ToCStr(); }
+
+    virtual bool        IsValid()               { return Opened; }
+    virtual bool        IsWritable()            { return false; }
+
+    virtual int         Tell()                  { return (int)Pos; }
+    virtual SInt64      LTell()                 { return Pos; }
+    virtual int         GetLength()             { return (int)Size; }
+    virtual SInt64      LGetLength()            { return Size; }
+
+    virtual int         GetErrorCode()          { return ErrorCode; }
+
+    virtual int         Write(const UByte *pbuffer, int numBytes);
+    virtual int         Read(UByte *pbuffer, int numBytes);
+    virtual int         SkipBytes(int numBytes);
+    virtual int         BytesAvailable();
+    virtual bool        Flush()                 { return Opened; }
+
+    virtual int         Seek(int offset, int origin=Seek_Set);
+    virtual SInt64      LSeek(SInt64 offset, int origin=Seek_Set);
+
+    virtual int         CopyFromStream(File *pstream, int byteSize);
+    virtual bool        Close();
+
+private:
+    // Not copyable; the mapping has a single owner.
+    MMapFile(const MMapFile&);
+    void operator = (const MMapFile&);
+
+    String      FilePath;
+    UByte*      pData;
+    SInt64      Size;
+    SInt64      Pos;
+    bool        Opened;
+    int         ErrorCode;
+};
+
+} // OVR
+
+#endif
@@ -0,0 +1,186 @@
+/************************************************************************************
+
+PublicHeader:   None
+Filename    :   OVR_MPSCRing.h
+Content     :   Bounded lock-free multi-producer / single-consumer ring
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+************************************************************************************/
+
+#ifndef OVR_MPSCRing_h
+#define OVR_MPSCRing_h
+
+#include "OVR_Types.h"
+#include "OVR_Atomic.h"
+#include "OVR_Threads.h"
+
+namespace OVR {
+
+//-----------------------------------------------------------------------------------
+// ***** MPSCRing
+
+// MPSCRing is a fixed array of SlotCount values of type T, used as a queue that
+// any number of threads push to without locking or allocating, and one thread
+// at a time pops from. SlotCount must be a power of two.
+//
+// Each slot carries a sequence number telling whose turn it is: a slot at ring
+// position pos is free for the producer that claims pos when Sequence == pos,
+// and holds a published value for the consumer when Sequence == pos + 1.
+// Producers claim positions by advancing the enqueue position with
+// compare-and-set; only the consumer advances the dequeue position.
+//
+// Pushing a value:
+//
+//    UInt32 pos;
+//    if (T* value = ring.Claim(&pos))
+//    {
+//        ... fill in *value ...
+//        if (ring.Publish(pos))
+//            ... wake the consumer ...
+//    }
+//
+// Popping:
+//
+//    while (T* value = ring.Peek())
+//    {
+//        ... use *value ...
+//        ring.Pop();
+//    }
+//
+// A consumer that sleeps when the ring is empty calls RequestWake and then
+// Peeks once more before sleeping; a value published after that is reported by
+// Publish, one published before it is found by the Peek.
+//
+// A producer that checks some state of its owner before pushing, such as
+// whether the owner is shutting down, brackets the check and the push with
+// BeginPush and EndPush. After changing that state the owner calls
+// WaitForPushes, which returns once every push that might have seen the old
+// state has been published or abandoned.
+
+template<class T, UInt32 SlotCount>
+class MPSCRing
+{
+public:
+    MPSCRing() : EnqueuePos(0), DequeuePos(0), ActivePushes(0), WakeRequested(1)
+    {
+        OVR_COMPILER_ASSERT((SlotCount & (SlotCount - 1)) == 0);
+        for (UInt32 i = 0; i < SlotCount; i++)
+            Slots[i].Sequence.Store_Release(i);
+    }
+
+    // *** Producer functions, callable from any thread.
+
+    // Claims the next free slot and returns its value, or returns 0 if the ring
+    // is full. The value must be passed to Publish once filled in.
+    T*      Claim(UInt32* pos)
+    {
+        UInt32 claim = EnqueuePos;
+        while(1)
+        {
+            Slot&  slot = Slots[claim & Mask];
+            SInt32 diff = (SInt32)(slot.Sequence.Load_Acquire() - claim);
+
+            if (diff == 0)
+            {
+                if (EnqueuePos.CompareAndSet_Sync(claim, claim + 1))
+                {
+                    *pos = claim;
+                    return &slot.Data;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The consumer is a whole ring of values behind.
+                return 0;
+            }
+            claim = EnqueuePos;
+        }
+    }
+
+    // Hands the claimed value to the consumer. Returns true if the consumer
+    // asked to be woken by RequestWake since the last Publish that returned true.
+    bool    Publish(UInt32 pos)
+    {
+        Slots[pos & Mask].Sequence.Store_Release(pos + 1);
+        return WakeRequested.Exchange_Sync(0) != 0;
+    }
+
+    void    BeginPush() { ActivePushes.ExchangeAdd_Sync(1); }
+    void    EndPush()   { ActivePushes.ExchangeAdd_Sync(-1); }
+
+    // Waits until no push is between BeginPush and EndPush.
+    void    WaitForPushes() const
+    {
+#ifdef OVR_ENABLE_THREADS
+        while (ActivePushes != 0)
+            Thread::MSleep(0);
+#endif
+    }
+
+    // *** Consumer functions, callable from one thread at a time.
+
+    // Returns the oldest published value, or 0 if there is none. A value that
+    // was claimed but not yet published holds back the ones behind it.
+    T*      Peek()
+    {
+        UInt32 pos  = DequeuePos;
+        Slot&  slot = Slots[pos & Mask];
+        if ((SInt32)(slot.Sequence.Load_Acquire() - (pos + 1)) < 0)
+            return 0;
+        return &slot.Data;
+    }
+
+    // Frees the slot of the value returned by Peek for reuse.
+    void    Pop()
+    {
+        UInt32 pos = DequeuePos;
+        Slots[pos & Mask].Sequence.Store_Release(pos + SlotCount);
+        DequeuePos.Store_Release(pos + 1);
+    }
+
+    // Asks the next Publish to return true.
+    void    RequestWake() { WakeRequested.Exchange_Sync(1); }
+
+    // *** Positions, for waiting on progress from other threads.
+
+    // Number of slots claimed so far, and popped so far; both wrap around.
+    UInt32  GetClaimedCount() const { return EnqueuePos; }
+    UInt32  GetPoppedCount() const  { return DequeuePos.Load_Acquire(); }
+
+private:
+    enum { Mask = SlotCount - 1 };
+
+    struct Slot
+    {
+        AtomicInt<UInt32> Sequence;
+        T                 Data;
+    };
+
+    AtomicInt<UInt32>   EnqueuePos;
+    AtomicInt<UInt32>   DequeuePos;
+    AtomicInt<SInt32>   ActivePushes;
+    AtomicInt<SInt32>   WakeRequested;
+    Slot                Slots[SlotCount];
+};
+
+} // OVR
+
+#endif
@@ -74,6 +74,142 @@ const double Math<double>::SingularityRadius	= 0.000000000001; // Use for Gimbal
 //-------------------------------------------------------------------------------------
 // ***** Matrix4f
 
+Matrix4f Matrix4f::Inverted() const
+{
+#if defined(OVR_MATH_SSE)
+    // Cramer's rule on the transposed matrix, computing the cofactors from 2x2
+    // sub-determinants shared between them (Intel AP-928).
+    const float* src = &M[0][0];
+    __m128 minor0, minor1, minor2, minor3;
+    __m128 row0, row1, row2, row3;
+    __m128 det, tmp1 = _mm_setzero_ps();
+
+    row1 = _mm_setzero_ps();
+    row3 = _mm_setzero_ps();
+    tmp1 = _mm_loadh_pi(_mm_loadl_pi(tmp1, (const __m64*)(src)),      (const __m64*)(src + 4));
+    row1 = _mm_loadh_pi(_mm_loadl_pi(row1, (const __m64*)(src + 8)),  (const __m64*)(src + 12));
+    row0 = _mm_shuffle_ps(tmp1, row1, 0x88);
+    row1 = _mm_shuffle_ps(row1, tmp1, 0xDD);
+    tmp1 = _mm_loadh_pi(_mm_loadl_pi(tmp1, (const __m64*)(src + 2)),  (const __m64*)(src + 6));
+    row3 = _mm_loadh_pi(_mm_loadl_pi(row3, (const __m64*)(src + 10)), (const __m64*)(src + 14));
+    row2 = _mm_shuffle_ps(tmp1, row3, 0x88);
+    row3 = _mm_shuffle_ps(row3, tmp1, 0xDD);
+
+    tmp1   = _mm_mul_ps(row2, row3);
+    tmp1   = _mm_shuffle_ps(tmp1, tmp1, 0xB1);
+    minor0 = _mm_mul_ps(row1, tmp1);
+    minor1 = _mm_mul_ps(row0, tmp1);
+    tmp1   = _mm_shuffle_ps(tmp1, tmp1, 0x4E);
+    minor0 = _mm_sub_ps(_mm_mul_ps(row1, tmp1), minor0);
+    minor1 = _mm_sub_ps(_mm_mul_ps(row0, tmp1), minor1);
+    minor1 = _mm_shuffle_ps(minor1, minor1, 0x4E);
+
+    tmp1   = _mm_mul_ps(row1, row2);
+    tmp1   = _mm_shuffle_ps(tmp1, tmp1, 0xB1);
+    minor0 = _mm_add_ps(_mm_mul_ps(row3, tmp1), minor0);
+    minor3 = _mm_mul_ps(row0, tmp1);
+    tmp1   = _mm_shuffle_ps(tmp1, tmp1, 0x4E);
+    minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row3, tmp1));
+    minor3 = _mm_sub_ps(_mm_mul_ps(row0, tmp1), minor3);
+    minor3 = _mm_shuffle_ps(minor3, minor3, 0x4E);
+
+    tmp1   = _mm_mul_ps(_mm_shuffle_ps(row1, row1, 0x4E), row3);
+    tmp1   = _mm_shuffle_ps(tmp1, tmp1, 0xB1);
+    row2   = _mm_shuffle_ps(row2, row2, 0x4E);
+    minor0 = _mm_add_ps(_mm_mul_ps(row2, tmp1), minor0);
+    minor2 = _mm_mul_ps(row0, tmp1);
+    tmp1   = _mm_shuffle_ps(tmp1, tmp1, 0x4E);
+    minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row2, tmp1));
+    minor2 = _mm_sub_ps(_mm_mul_ps(row0, tmp1), minor2);
+    minor2 = _mm_shuffle_ps(minor2, minor2, 0x4E);
+
+    tmp1   = _mm_mul_ps(row0, row1);
+    tmp1   = _mm_shuffle_ps(tmp1, tmp1, 0xB1);
+    minor2 = _mm_add_ps(_mm_mul_ps(row3, tmp1), minor2);
+    minor3 = _mm_sub_ps(_mm_mul_ps(row2, tmp1), minor3);
+    tmp1   = _mm_shuffle_ps(tmp1, tmp1, 0x4E);
+    minor2 = _mm_sub_ps(_mm_mul_ps(row3, tmp1), minor2);
+    minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row2, tmp1));
+
+    tmp1   = _mm_mul_ps(row0, row3);
+    tmp1   = _mm_shuffle_ps(tmp1, tmp1, 0xB1);
+    minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row2, tmp1));
+    minor2 = _mm_add_ps(_mm_mul_ps(row1, tmp1), minor2);
+    tmp1   = _mm_shuffle_ps(tmp1, tmp1, 0x4E);
+    minor1 = _mm_add_ps(_mm_mul_ps(row2, tmp1), minor1);
+    minor2 = _mm_sub_ps(minor2, _mm_mul_ps(row1, tmp1));
+
+    tmp1   = _mm_mul_ps(row0, row2);
+    tmp1   = _mm_shuffle_ps(tmp1, tmp1, 0xB1);
+    minor1 = _mm_add_ps(_mm_mul_ps(row3, tmp1), minor1);
+    minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row1, tmp1));
+    tmp1   = _mm_shuffle_ps(tmp1, tmp1, 0x4E);
+    minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row3, tmp1));
+    minor3 = _mm_add_ps(_mm_mul_ps(row1, tmp1), minor3);
+
+    det = _mm_mul_ps(row0, minor0);
+    det = _mm_add_ps(_mm_shuffle_ps(det, det, 0x4E), det);
+    det = _mm_add_ss(_mm_shuffle_ps(det, det, 0xB1), det);
+    assert(_mm_cvtss_f32(det) != 0);
+    det = _mm_div_ss(_mm_set_ss(1.0f), det);
+    det = _mm_shuffle_ps(det, det, 0x00);
+
+    Matrix4f result(NoInit);
+    _mm_storeu_ps(result.M[0], _mm_mul_ps(det, minor0));
+    _mm_storeu_ps(result.M[1], _mm_mul_ps(det, minor1));
+    _mm_storeu_ps(result.M[2], _mm_mul_ps(det, minor2));
+    _mm_storeu_ps(result.M[3], _mm_mul_ps(det, minor3));
+    return result;
+#else
+    float det = Determinant();
+    assert(det != 0);
+    return Adjugated() * (1.0f/det);
+#endif
+}
+
+void Matrix4f::Transform(Vector3f* dest, const Vector3f* src, UPInt count,
+                         UPInt destStride, UPInt srcStride) const
+{
+    UByte*       pdest = (UByte*)dest;
+    const UByte* psrc  = (const UByte*)src;
+
+#if defined(OVR_MATH_SSE)
+    // Columns of the upper 3x4 part; each point is then three multiply-adds.
+    __m128 c0 = _mm_setr_ps(M[0][0], M[1][0], M[2][0], 0);
+    __m128 c1 = _mm_setr_ps(M[0][1], M[1][1], M[2][1], 0);
+    __m128 c2 = _mm_setr_ps(M[0][2], M[1][2], M[2][2], 0);
+    __m128 c3 = _mm_setr_ps(M[0][3], M[1][3], M[2][3], 0);
+
+    for (UPInt i = 0; i < count; i++, pdest += destStride, psrc += srcStride)
+    {
+        const float* v = (const float*)psrc;
+        __m128 r = _mm_add_ps(c3, _mm_mul_ps(c0, _mm_set1_ps(v[0])));
+        r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(v[1])));
+        r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(v[2])));
+        _mm_storel_pi((__m64*)pdest, r);
+        _mm_store_ss((float*)pdest + 2, _mm_movehl_ps(r, r));
+    }
+#elif defined(OVR_MATH_NEON)
+    float32x4_t c0 = { M[0][0], M[1][0], M[2][0], 0 };
+    float32x4_t c1 = { M[0][1], M[1][1], M[2][1], 0 };
+    float32x4_t c2 = { M[0][2], M[1][2], M[2][2], 0 };
+    float32x4_t c3 = { M[0][3], M[1][3], M[2][3], 0 };
+
+    for (UPInt i = 0; i < count; i++, pdest += destStride, psrc += srcStride)
+    {
+        const float* v = (const float*)psrc;
+        float32x4_t r = vmlaq_n_f32(c3, c0, v[0]);
+        r = vmlaq_n_f32(r, c1, v[1]);
+        r = vmlaq_n_f32(r, c2, v[2]);
+        vst1_f32((float*)pdest, vget_low_f32(r));
+        vst1q_lane_f32((float*)pdest + 2, r, 2);
+    }
+#else
+    for (UPInt i = 0; i < count; i++, pdest += destStride, psrc += srcStride)
+        *(Vector3f*)pdest = Transform(*(const Vector3f*)psrc);
+#endif
+}
+
 
 Matrix4f Matrix4f::LookAtRH(const Vector3f& eye, const Vector3f& at, const Vector3f& up)
 {
@@ -36,6 +36,16 @@ limitations under the License.
 #include "OVR_RefCount.h"
 #include "OVR_Std.h"
 
+// Matrix4f and Quatf use SSE or NEON where available. The types keep their
+// scalar layout, so the vector code uses unaligned loads and stores.
+#if defined(OVR_CPU_SSE)
+#  include <xmmintrin.h>
+#  define OVR_MATH_SSE
+#elif defined(OVR_CPU_ARM_NEON)
+#  include <arm_neon.h>
+#  define OVR_MATH_NEON
+#endif
+
 namespace OVR {
 
 //-------------------------------------------------------------------------------------
@@ -575,6 +585,34 @@ public:
     static Matrix4f& Multiply(Matrix4f* d, const Matrix4f& a, const Matrix4f& b)
     {
         OVR_ASSERT((d != &a) && (d != &b));
+#if defined(OVR_MATH_SSE)
+        // Each row of the result is a combination of the rows of b.
+        __m128 b0 = _mm_loadu_ps(b.M[0]);
+        __m128 b1 = _mm_loadu_ps(b.M[1]);
+        __m128 b2 = _mm_loadu_ps(b.M[2]);
+        __m128 b3 = _mm_loadu_ps(b.M[3]);
+        for (int i = 0; i < 4; i++)
+        {
+            __m128 r = _mm_mul_ps(_mm_set1_ps(a.M[i][0]), b0);
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a.M[i][1]), b1));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a.M[i][2]), b2));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a.M[i][3]), b3));
+            _mm_storeu_ps(d->M[i], r);
+        }
+#elif defined(OVR_MATH_NEON)
+        float32x4_t b0 = vld1q_f32(b.M[0]);
+        float32x4_t b1 = vld1q_f32(b.M[1]);
+        float32x4_t b2 = vld1q_f32(b.M[2]);
+        float32x4_t b3 = vld1q_f32(b.M[3]);
+        for (int i = 0; i < 4; i++)
+        {
+            float32x4_t r = vmulq_n_f32(b0, a.M[i][0]);
+            r = vmlaq_n_f32(r, b1, a.M[i][1]);
+            r = vmlaq_n_f32(r, b2, a.M[i][2]);
+            r = vmlaq_n_f32(r, b3, a.M[i][3]);
+            vst1q_f32(d->M[i], r);
+        }
+#else
         int i = 0;
         do {
             d->M[i][0] = a.M[i][0] * b.M[0][0] + a.M[i][1] * b.M[1][0] + a.M[i][2] * b.M[2][0] + a.M[i][3] * b.M[3][0];
@@ -582,7 +620,7 @@ public:
             d->M[i][2] = a.M[i][0] * b.M[0][2] + a.M[i][1] * b.M[1][2] + a.M[i][2] * b.M[2][2] + a.M[i][3] * b.M[3][2];
             d->M[i][3] = a.M[i][0] * b.M[0][3] + a.M[i][1] * b.M[1][3] + a.M[i][2] * b.M[2][3] + a.M[i][3] * b.M[3][3];
         } while((++i) < 4);
-
+#endif
         return *d;
     }
 
@@ -636,6 +674,11 @@ public:
                         M[2][0] * v.x + M[2][1] * v.y + M[2][2] * v.z + M[2][3]);
     }
 
+    // Transforms count points from src into dest, which may be the same array.
+    // The strides allow transforming the positions within an array of vertices.
+    void Transform(Vector3f* dest, const Vector3f* src, UPInt count,
+                   UPInt destStride = sizeof(Vector3f), UPInt srcStride = sizeof(Vector3f)) const;
+
     Matrix4f Transposed() const
     {
         return Matrix4f(M[0][0], M[1][0], M[2][0], M[3][0],
@@ -676,12 +719,7 @@ public:
                         Cofactor(0,3), Cofactor(1,3), Cofactor(2,3), Cofactor(3,3));
     }
 
-    Matrix4f Inverted() const
-    {
-        float det = Determinant();
-        assert(det != 0);
-        return Adjugated() * (1.0f/det);
-    }
+    Matrix4f Inverted() const;
 
     void Invert()
     {
@@ -1111,10 +1149,12 @@ public:
     }
     
     // Rotate transforms vector in a manner that matches Matrix rotations (counter-clockwise,
-    // assuming negative direction of the axis). Standard formula: q(t) * V * q(t)^-1. 
+    // assuming negative direction of the axis). Standard formula: q(t) * V * q(t)^-1,
+    // expanded to avoid the two full quaternion products.
     Vector3<T> Rotate(const Vector3<T>& v) const
     {
-        return ((*this * Quat<T>(v.x, v.y, v.z, T(0))) * Inverted()).Imag();
+        Vector3<T> u(x, y, z);
+        return v * (w * w - u.LengthSq()) + u * (T(2) * u.Dot(v)) + u.Cross(v) * (T(2) * w);
     }
 
     
@@ -1311,6 +1351,48 @@ public:
 typedef Quat<float>  Quatf;
 typedef Quat<double> Quatd;
 
+// Each component of the product is a signed combination of b's components,
+// with the shuffles and signs given by the multiplication table:
+//   w * ( bx,  by,  bz,  bw)
+//   x * ( bw, -bz,  by, -bx)
+//   y * ( bz,  bw, -bx, -by)
+//   z * (-by,  bx,  bw, -bz)
+#if defined(OVR_MATH_SSE)
+template<>
+inline Quatf Quatf::operator* (const Quatf& b) const
+{
+    __m128 vb = _mm_loadu_ps(&b.x);
+    __m128 r  = _mm_mul_ps(_mm_set1_ps(w), vb);
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(x), _mm_xor_ps(_mm_shuffle_ps(vb, vb, _MM_SHUFFLE(0,1,2,3)),
+                                                           _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f))));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(y), _mm_xor_ps(_mm_shuffle_ps(vb, vb, _MM_SHUFFLE(1,0,3,2)),
+                                                           _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f))));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(z), _mm_xor_ps(_mm_shuffle_ps(vb, vb, _MM_SHUFFLE(2,3,0,1)),
+                                                           _mm_set_ps(-0.0f, 0.0f, 0.0f, -0.0f))));
+    float result[4];
+    _mm_storeu_ps(result, r);
+    return Quatf(result[0], result[1], result[2], result[3]);
+}
+#elif defined(OVR_MATH_NEON)
+template<>
+inline Quatf Quatf::operator* (const Quatf& b) const
+{
+    static const float signX[4] = { 1.0f, -1.0f,  1.0f, -1.0f };
+    static const float signY[4] = { 1.0f,  1.0f, -1.0f, -1.0f };
+    static const float signZ[4] = {-1.0f,  1.0f,  1.0f, -1.0f };
+
+    float32x4_t vb   = vld1q_f32(&b.x);
+    float32x4_t yxwz = vrev64q_f32(vb);
+    float32x4_t r    = vmulq_n_f32(vb, w);
+    r = vmlaq_n_f32(r, vmulq_f32(vextq_f32(yxwz, yxwz, 2), vld1q_f32(signX)), x);
+    r = vmlaq_n_f32(r, vmulq_f32(vextq_f32(vb, vb, 2), vld1q_f32(signY)), y);
+    r = vmlaq_n_f32(r, vmulq_f32(yxwz, vld1q_f32(signZ)), z);
+    float result[4];
+    vst1q_f32(result, r);
+    return Quatf(result[0], result[1], result[2], result[3]);
+}
+#endif
+
 
 
 //-------------------------------------------------------------------------------------
@@ -0,0 +1,343 @@
+/************************************************************************************
+
+Filename    :   OVR_PoolAllocator.cpp
+Content     :   Size-class pool allocator with per-thread caches
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+************************************************************************************/
+
+#include "OVR_PoolAllocator.h"
+#include <stdlib.h>
+#include <string.h>
+#if defined(OVR_OS_WIN32)
+ #include <windows.h>
+#else
+ #include <pthread.h>
+#endif
+
+namespace OVR {
+
+//------------------------------------------------------------------------
+// ***** PoolAllocator
+
+enum
+{
+    // Header in front of each block: size class and requested size.
+    HeaderSize      = 16,
+    LargeClass      = PoolAllocator::SizeClassCount,
+
+    ChunkSize       = 64 * 1024,
+    // Blocks moved between a thread cache and the shared lists at a time.
+    BatchCount      = 32,
+    // A thread cache holding more than this many blocks of a class gives a batch back.
+    MaxCachedCount  = BatchCount * 2
+};
+
+static const UPInt SizeClassSizes[PoolAllocator::SizeClassCount] =
+{
+    16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024
+};
+
+// Each allocator instance gets a new generation, so that thread caches left over
+// from an earlier instance are discarded rather than reused.
+static UPInt PoolGeneration = 0;
+
+static OVR_THREAD_LOCAL PoolAllocator::ThreadCache TlsCache;
+
+
+static inline UPInt* blockHeader(void* p)
+{
+    return (UPInt*)((UByte*)p - HeaderSize);
+}
+
+#if defined(OVR_OS_WIN32)
+static void WINAPI flushThreadCacheOnExit(void* allocator)
+#else
+static void flushThreadCacheOnExit(void* allocator)
+#endif
+{
+    ((PoolAllocator*)allocator)->FlushThreadCache();
+}
+
+
+PoolAllocator::PoolAllocator()
+    : pChunks(0), pChunkFree(0), ChunkFreeSize(0)
+{
+    Generation = ++PoolGeneration;
+
+    unsigned sizeClass = 0;
+    for (unsigned i = 0; i <= (MaxPoolSize >> 4); i++)
+    {
+        while (SizeClassSizes[sizeClass] < (UPInt)(i << 4))
+            sizeClass++;
+        SizeClassIndex[i] = (UByte)sizeClass;
+    }
+
+    for (unsigned i = 0; i < SizeClassCount; i++)
+    {
+        Pools[i].pFree = 0;
+        Pools[i].Count = 0;
+    }
+
+#if defined(OVR_OS_WIN32)
+    // Fiber local storage, unlike TLS, calls back when a thread exits.
+    CacheKey = (UPInt)FlsAlloc(flushThreadCacheOnExit);
+#else
+    pthread_key_t key;
+    pthread_key_create(&key, flushThreadCacheOnExit);
+    CacheKey = (UPInt)key;
+#endif
+}
+
+PoolAllocator::ThreadCache* PoolAllocator::getThreadCache()
+{
+    ThreadCache* cache = &TlsCache;
+    if (cache->Generation != Generation)
+    {
+        memset(cache, 0, sizeof(ThreadCache));
+        cache->Generation = Generation;
+        // A non-null value makes the key destructor run when this thread exits.
+#if defined(OVR_OS_WIN32)
+        FlsSetValue((DWORD)CacheKey, this);
+#else
+        pthread_setspecific((pthread_key_t)CacheKey, this);
+#endif
+    }
+    return cache;
+}
+
+void* PoolAllocator::Alloc(UPInt size)
+{
+    if (size > MaxPoolSize)
+    {
+        UPInt* header = (UPInt*)malloc(size + HeaderSize);
+        if (!header)
+            return 0;
+        header[0] = LargeClass;
+        header[1] = size;
+        return (UByte*)header + HeaderSize;
+    }
+
+    unsigned     sizeClass = SizeClassIndex[(size + 15) >> 4];
+    ThreadCache* cache     = getThreadCache();
+
+    if (!cache->pFree[sizeClass] && !refill(cache, sizeClass))
+        return 0;
+
+    FreeBlock* block = cache->pFree[sizeClass];
+    cache->pFree[sizeClass] = block->pNext;
+    cache->Count[sizeClass]--;
+
+    UPInt* header = (UPInt*)block;
+    header[0] = sizeClass;
+    header[1] = size;
+    return (UByte*)header + HeaderSize;
+}
+
+void* PoolAllocator::Realloc(void* p, UPInt newSize)
+{
+    if (!p)
+        return Alloc(newSize);
+
+    UPInt* header    = blockHeader(p);
+    UPInt  sizeClass = header[0];
+    UPInt  oldSize   = header[1];
+
+    if (sizeClass == LargeClass)
+    {
+        // Large blocks stay with malloc, even when shrunk below MaxPoolSize.
+        header = (UPInt*)realloc(header, newSize + HeaderSize);
+        if (!header)
+            return 0;
+        header[1] = newSize;
+        return (UByte*)header + HeaderSize;
+    }
+    if (newSize <= SizeClassSizes[sizeClass])
+    {
+        // Still fits, so shrinking never fails.
+        header[1] = newSize;
+        return p;
+    }
+
+    void* newP = Alloc(newSize);
+    if (!newP)
+        return 0;
+    memcpy(newP, p, (oldSize < newSize) ? oldSize : newSize);
+    Free(p);
+    return newP;
+}
+
+void PoolAllocator::Free(void *p)
+{
+    if (!p)
+        return;
+
+    UPInt* header    = blockHeader(p);
+    UPInt  sizeClass = header[0];
+
+    if (sizeClass == LargeClass)
+    {
+        free(header);
+        return;
+    }
+
+    OVR_ASSERT(sizeClass < SizeClassCount);
+    ThreadCache* cache = getThreadCache();
+    FreeBlock*   block = (FreeBlock*)header;
+
+    block->pNext = cache->pFree[sizeClass];
+    cache->pFree[sizeClass] = block;
+    if (++cache->Count[sizeClass] > MaxCachedCount)
+        release(cache, (unsigned)sizeClass, BatchCount);
+}
+
+
+// Moves a batch of blocks of sizeClass into the thread cache, from the shared
+// list if it has any, or freshly carved from a chunk otherwise.
+bool PoolAllocator::refill(ThreadCache* cache, unsigned sizeClass)
+{
+    SizeClassPool& pool = Pools[sizeClass];
+    FreeBlock*     head = 0;
+    UInt32         count = 0;
+
+    {
+        Lock::Locker lock(&pool.PoolLock);
+        while (pool.pFree && count < BatchCount)
+        {
+            FreeBlock* block = pool.pFree;
+            pool.pFree   = block->pNext;
+            block->pNext = head;
+            head = block;
+            count++;
+        }
+        pool.Count -= count;
+    }
+
+    if (!head)
+    {
+        head = carve(sizeClass, BatchCount);
+        if (!head)
+            return false;
+        count = BatchCount;
+    }
+
+    // Splice in front of whatever is cached.
+    FreeBlock* tail = head;
+    while (tail->pNext)
+        tail = tail->pNext;
+    tail->pNext = cache->pFree[sizeClass];
+    cache->pFree[sizeClass]  = head;
+    cache->Count[sizeClass] += count;
+    return true;
+}
+
+// Gives up to count cached blocks of sizeClass back to the shared list.
+void PoolAllocator::release(ThreadCache* cache, unsigned sizeClass, UInt32 count)
+{
+    FreeBlock* head = cache->pFree[sizeClass];
+    if (!head)
+        return;
+
+    FreeBlock* tail = head;
+    UInt32     n    = 1;
+    while (tail->pNext && n < count)
+    {
+        tail = tail->pNext;
+        n++;
+    }
+    cache->pFree[sizeClass]  = tail->pNext;
+    cache->Count[sizeClass] -= n;
+
+    SizeClassPool& pool = Pools[sizeClass];
+    Lock::Locker   lock(&pool.PoolLock);
+    tail->pNext = pool.pFree;
+    pool.pFree  = head;
+    pool.Count += n;
+}
+
+// Cuts count new blocks of sizeClass from the current chunk, allocating a new
+// chunk when it runs out. Returns them as a null-terminated list.
+PoolAllocator::FreeBlock* PoolAllocator::carve(unsigned sizeClass, UInt32 count)
+{
+    UPInt blockSize = SizeClassSizes[sizeClass] + HeaderSize;
+    UPInt needed    = blockSize * count;
+
+    Lock::Locker lock(&ChunkLock);
+
+    if (ChunkFreeSize < needed)
+    {
+        // The remainder of the old chunk is abandoned; with batches of at most
+        // BatchCount * (MaxPoolSize + HeaderSize) bytes this wastes little.
+        UPInt chunkSize = (needed + HeaderSize > (UPInt)ChunkSize) ? (needed + HeaderSize) : (UPInt)ChunkSize;
+        UByte* chunk = (UByte*)malloc(chunkSize);
+        if (!chunk)
+            return 0;
+        *(void**)chunk = pChunks;
+        pChunks       = chunk;
+        pChunkFree    = chunk + HeaderSize;
+        ChunkFreeSize = chunkSize - HeaderSize;
+    }
+
+    FreeBlock* head = 0;
+    for (UInt32 i = 0; i < count; i++)
+    {
+        FreeBlock* block = (FreeBlock*)(pChunkFree + (count - 1 - i) * blockSize);
+        block->pNext = head;
+        head = block;
+    }
+    pChunkFree    += needed;
+    ChunkFreeSize -= needed;
+    return head;
+}
+
+void PoolAllocator::FlushThreadCache()
+{
+    ThreadCache* cache = &TlsCache;
+    if (cache->Generation != Generation)
+        return;
+
+    for (unsigned i = 0; i < SizeClassCount; i++)
+        release(cache, i, cache->Count[i]);
+}
+
+void PoolAllocator::onSystemShutdown()
+{
+#if defined(OVR_OS_WIN32)
+    // Also runs the callback, on this thread, once per thread with a cache;
+    // only this thread's cache is flushed, and the chunks go next regardless.
+    FlsFree((DWORD)CacheKey);
+#else
+    pthread_key_delete((pthread_key_t)CacheKey);
+#endif
+
+    // All allocations should've been freed by now, so the chunks can go as a whole.
+    while (pChunks)
+    {
+        void* next = *(void**)pChunks;
+        free(pChunks);
+        pChunks = next;
+    }
+    TlsCache.Generation = 0;
+
+    Allocator_SingletonSupport<PoolAllocator>::onSystemShutdown();
+}
+
+} // OVR
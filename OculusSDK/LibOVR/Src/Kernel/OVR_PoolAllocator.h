@@ -0,0 +1,113 @@
+/************************************************************************************
+
+PublicHeader:   OVR.h
+Filename    :   OVR_PoolAllocator.h
+Content     :   Size-class pool allocator with per-thread caches
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+************************************************************************************/
+
+#ifndef OVR_PoolAllocator_h
+#define OVR_PoolAllocator_h
+
+#include "OVR_Allocator.h"
+#include "OVR_Atomic.h"
+
+namespace OVR {
+
+//------------------------------------------------------------------------
+// ***** PoolAllocator
+
+// PoolAllocator serves small blocks (up to MaxPoolSize bytes) from size-class
+// pools carved out of large chunks, and forwards larger requests to malloc.
+//
+// Every thread keeps a short free list per size class, so most Alloc/Free pairs
+// take no lock and never reach the system heap; blocks move between a thread and
+// the shared per-class lists in batches when its list runs empty or grows long.
+// Blocks carry a 16-byte header with their size class, preserving the 16-byte
+// alignment of malloc. Chunks are returned to the system on System::Destroy.
+//
+// Install it by passing PoolAllocator::InitSystemSingleton() to System::Init.
+
+class PoolAllocator : public Allocator_SingletonSupport<PoolAllocator>
+{
+public:
+    enum {
+        SizeClassCount = 12,
+        MaxPoolSize    = 1024
+    };
+
+    PoolAllocator();
+
+    virtual void*   Alloc(UPInt size);
+    virtual void*   Realloc(void* p, UPInt newSize);
+    virtual void    Free(void *p);
+
+    // Internal, declared here for the per-thread cache.
+    struct FreeBlock
+    {
+        FreeBlock* pNext;
+    };
+    struct ThreadCache
+    {
+        UPInt       Generation;
+        FreeBlock*  pFree[SizeClassCount];
+        UInt32      Count[SizeClassCount];
+    };
+
+    // Returns the blocks cached by the calling thread to the shared lists;
+    // called automatically when a thread exits.
+    void            FlushThreadCache();
+
+protected:
+    virtual void    onSystemShutdown();
+
+private:
+    struct SizeClassPool
+    {
+        Lock        PoolLock;
+        FreeBlock*  pFree;
+        UInt32      Count;
+    };
+
+    ThreadCache*    getThreadCache();
+    bool            refill(ThreadCache* cache, unsigned sizeClass);
+    void            release(ThreadCache* cache, unsigned sizeClass, UInt32 count);
+    FreeBlock*      carve(unsigned sizeClass, UInt32 count);
+
+    UPInt           Generation;
+    UByte           SizeClassIndex[(MaxPoolSize >> 4) + 1];
+    SizeClassPool   Pools[SizeClassCount];
+
+    // Chunks blocks are carved from, linked through their first word.
+    Lock            ChunkLock;
+    void*           pChunks;
+    UByte*          pChunkFree;
+    UPInt           ChunkFreeSize;
+
+    // Thread-specific key (a pthread key, or a fiber local storage index on
+    // Windows) whose destructor flushes a thread's cache at exit.
+    UPInt           CacheKey;
+};
+
+} // OVR
+
+#endif
@@ -356,6 +356,19 @@ public:
         if (src) src->AddRef();
         pObject = src;
     }
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    // Move construction takes over the reference held by src, so it needs no
+    // AddRef/Release pair.
+    OVR_FORCE_INLINE Ptr(Ptr<C> &&src) : pObject(src.pObject)
+    {
+        src.pObject = 0;
+    }
+    template<class R>
+    OVR_FORCE_INLINE Ptr(Ptr<R> &&src) : pObject(src.GetPtr())
+    {
+        src.NullWithoutRelease();
+    }
+#endif
     template<class R>
     OVR_FORCE_INLINE Ptr(Pickable<R> v) : pObject(v.GetPtr())
     {
@@ -396,6 +409,14 @@ public:
         return *this;
     }   
     
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    // Move assignment; same as Pick.
+    OVR_FORCE_INLINE const Ptr<C>& operator = (Ptr<C> &&src)
+    {
+        return Pick(src);
+    }
+#endif
+
     OVR_FORCE_INLINE const Ptr<C>& operator = (C *psrc)
     {
         if (psrc) psrc->AddRef();
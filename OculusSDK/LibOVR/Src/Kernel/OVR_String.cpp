@@ -40,6 +40,9 @@ namespace OVR {
 
 String::DataDesc String::NullData = {String_LengthIsSize, 1, {0} };
 
+// Reference count of the local DataDesc; large enough that Release never frees it.
+static const SInt32 String_LocalRefCount = 0x40000000;
+
 
 String::String()
 {
@@ -47,14 +50,19 @@ String::String()
     pData->AddRef();
 };
 
+// Constructors start out pointing at NullData without a reference, which
+// leaves LocalData free for AllocData to use.
+
 String::String(const char* pdata)
+    : pData(&NullData)
 {
     // Obtain length in bytes; it doesn't matter if _data is UTF8.
     UPInt size = pdata ? OVR_strlen(pdata) : 0; 
-    pData = AllocDataCopy1(size, 0, pdata, size);
+    SetData(AllocDataCopy1(size, 0, pdata, size));
 };
 
 String::String(const char* pdata1, const char* pdata2, const char* pdata3)
+    : pData(&NullData)
 {
     // Obtain length in bytes; it doesn't matter if _data is UTF8.
     UPInt size1 = pdata1 ? OVR_strlen(pdata1) : 0; 
@@ -64,31 +72,45 @@ String::String(const char* pdata1, const char* pdata2, const char* pdata3)
     DataDesc *pdataDesc = AllocDataCopy2(size1 + size2 + size3, 0,
                                          pdata1, size1, pdata2, size2);
     memcpy(pdataDesc->Data + size1 + size2, pdata3, size3);   
-    pData = pdataDesc;    
+    SetData(pdataDesc);
 }
 
 String::String(const char* pdata, UPInt size)
+    : pData(&NullData)
 {
     OVR_ASSERT((size == 0) || (pdata != 0));
-    pData = AllocDataCopy1(size, 0, pdata, size);
+    SetData(AllocDataCopy1(size, 0, pdata, size));
 };
 
 
 String::String(const InitStruct& src, UPInt size)
+    : pData(&NullData)
 {
-    pData = AllocData(size, 0);
+    SetData(AllocData(size, 0));
     src.InitString(GetData()->Data, size);
 }
 
 String::String(const String& src)
+    : pData(&NullData)
 {    
-    pData = src.GetData();
-    pData->AddRef();
+    DataDesc* psdata = src.GetData();
+    if (src.isLocal())
+    {
+        // Local strings are small; copy rather than share.
+        SetData(AllocDataCopy1(psdata->GetSize(), psdata->GetLengthFlag(),
+                               psdata->Data, psdata->GetSize()));
+    }
+    else
+    {
+        SetData(psdata);
+        psdata->AddRef();
+    }
 }
 
 String::String(const StringBuffer& src)
+    : pData(&NullData)
 {
-    pData = AllocDataCopy1(src.GetSize(), 0, src.ToCStr(), src.GetSize());
+    SetData(AllocDataCopy1(src.GetSize(), 0, src.ToCStr(), src.GetSize()));
 }
 
 String::String(const wchar_t* data)
@@ -112,13 +134,38 @@ String::DataDesc* String::AllocData(UPInt size, UPInt lengthIsSize)
         return pdesc;
     }
 
-    pdesc = (DataDesc*)OVR_ALLOC(sizeof(DataDesc)+ size);
+    if ((size < LocalCapacity) && !isLocal())
+    {
+        // LocalData isn't holding our current contents, so the new ones can go there.
+        pdesc = getLocalData();
+        pdesc->RefCount = String_LocalRefCount;
+    }
+    else
+    {
+        pdesc = (DataDesc*)OVR_ALLOC(sizeof(DataDesc)+ size);
+        pdesc->RefCount = 1;
+    }
     pdesc->Data[size] = 0;
-    pdesc->RefCount = 1;
     pdesc->Size     = size | lengthIsSize;  
     return pdesc;
 }
 
+// Appends in place when the string is local and the result still fits.
+bool String::appendLocal(const char* pdata, UPInt size, UPInt lengthIsSize)
+{
+    DataDesc* pdesc   = GetData();
+    UPInt     oldSize = pdesc->GetSize();
+
+    if (!isLocal() || (oldSize + size >= LocalCapacity))
+        return false;
+
+    // pdata may point into our own buffer, but never past oldSize.
+    memmove(pdesc->Data + oldSize, pdata, size);
+    pdesc->Data[oldSize + size] = 0;
+    pdesc->Size = (oldSize + size) | lengthIsSize;
+    return true;
+}
+
 
 String::DataDesc* String::AllocDataCopy1(UPInt size, UPInt lengthIsSize,
                                          const char* pdata, UPInt copySize)
@@ -253,6 +300,9 @@ void String::AppendString(const char* putf8str, SPInt utf8StrSz)
     if (utf8StrSz == -1)
         utf8StrSz = (SPInt)OVR_strlen(putf8str);
 
+    if (appendLocal(putf8str, (UPInt)utf8StrSz, 0))
+        return;
+
     DataDesc*   pdata = GetData();
     UPInt       oldSize = pdata->GetSize();
 
@@ -272,6 +322,16 @@ void    String::AssignString(const InitStruct& src, UPInt size)
 
 void    String::AssignString(const char* putf8str, UPInt size)
 {
+    if (isLocal() && (size > 0) && (size < LocalCapacity))
+    {
+        // Overwrite in place; putf8str may be part of our own contents.
+        DataDesc* plocal = getLocalData();
+        memmove(plocal->Data, putf8str, size);
+        plocal->Data[size] = 0;
+        plocal->Size = size;
+        return;
+    }
+
     DataDesc* poldData = GetData();
     SetData(AllocDataCopy1(size, 0, putf8str, size));
     poldData->Release();
@@ -299,6 +359,14 @@ void    String::operator = (const String& src)
     DataDesc*    psdata = src.GetData();
     DataDesc*    pdata = GetData();    
 
+    if (psdata == pdata)
+        return;
+    if (src.isLocal())
+    {
+        AssignString(psdata->Data, psdata->GetSize());
+        return;
+    }
+
     SetData(psdata);
     psdata->AddRef();
     pdata->Release();
@@ -320,6 +388,9 @@ void    String::operator += (const String& src)
                 srcSize  = psrcData->GetSize();
     UPInt       lflag    = pourData->GetLengthFlag() & psrcData->GetLengthFlag();
 
+    if (appendLocal(psrcData->Data, srcSize, lflag))
+        return;
+
     SetData(AllocDataCopy2(ourSize + srcSize, lflag,
                            pourData->Data, ourSize, psrcData->Data, srcSize));
     pourData->Release();
@@ -360,7 +431,7 @@ void    String::Remove(UPInt posAt, SPInt removeLength)
 
     SetData(AllocDataCopy2(oldSize - removeSize, pdata->GetLengthFlag(),
                            pdata->Data, bytePos,
-                           pData->Data + bytePos + removeSize, (oldSize - bytePos - removeSize)));
+                           pdata->Data + bytePos + removeSize, (oldSize - bytePos - removeSize)));
     pdata->Release();
 }
 
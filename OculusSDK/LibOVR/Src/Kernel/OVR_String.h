@@ -35,6 +35,7 @@ limitations under the License.
 #include "OVR_Atomic.h"
 #include "OVR_Std.h"
 #include "OVR_Alg.h"
+#include <stddef.h>
 
 namespace OVR {
 
@@ -48,7 +49,9 @@ class StringBuffer;
 // ***** String Class 
 
 // String is UTF8 based string class with copy-on-write implementation
-// for assignment.
+// for assignment. Strings shorter than LocalCapacity bytes are kept in a
+// buffer inside the String itself instead, so they never touch the heap;
+// those are copied rather than shared on assignment.
 
 class String
 {
@@ -107,10 +110,21 @@ protected:
         HT_Mask     = 3
     };
 
+    enum LocalConstants
+    {
+        // Size of the in-object buffer, which holds a DataDesc header and the chars.
+        LocalDataSize = 32
+    };
+
+    // pData is null (apart from the heap type bits) when the string is held
+    // in LocalData. Since the address of LocalData is computed rather than
+    // stored, String stays movable with memcpy, as Array requires.
     union {
         DataDesc* pData;
         UPInt     HeapTypeBits;
     };
+    UPInt   LocalData[LocalDataSize / sizeof(UPInt)];
+
     typedef union {
         DataDesc* pData;
         UPInt     HeapTypeBits;
@@ -118,18 +132,21 @@ protected:
 
     inline HeapType    GetHeapType() const { return (HeapType) (HeapTypeBits & HT_Mask); }
 
+    inline DataDesc*   getLocalData() const { return (DataDesc*)LocalData; }
+    inline bool        isLocal() const      { return (HeapTypeBits & ~(UPInt)HT_Mask) == 0; }
+
     inline DataDesc*   GetData() const
     {
         DataDescUnion u;
         u.pData    = pData;
         u.HeapTypeBits = (u.HeapTypeBits & ~(UPInt)HT_Mask);
-        return u.pData;
+        return u.pData ? u.pData : getLocalData();
     }
     
     inline void        SetData(DataDesc* pdesc)
     {
         HeapType ht = GetHeapType();
-        pData = pdesc;
+        pData = (pdesc == getLocalData()) ? 0 : pdesc;
         OVR_ASSERT((HeapTypeBits & HT_Mask) == 0);
         HeapTypeBits |= ht;        
     }
@@ -141,6 +158,7 @@ protected:
     DataDesc*   AllocDataCopy2(UPInt size, UPInt lengthIsSize,
                                const char* pdata1, UPInt copySize1,
                                const char* pdata2, UPInt copySize2);
+    bool        appendLocal(const char* pdata, UPInt size, UPInt lengthIsSize);
 
     // Special constructor to avoid data initalization when used in derived class.
     struct NoConstructor { };
@@ -162,6 +180,17 @@ public:
     String(const char* data1, const char* pdata2, const char* pdata3 = 0);
     String(const char* data, UPInt buflen);
     String(const String& src);
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    // Inline, so code built with rvalue references still links with a library
+    // built without them. Either form is taken over by copying the
+    // representation.
+    String(String&& src)
+    {
+        memcpy((void*)this, &src, sizeof(String));
+        src.pData = &NullData;
+        NullData.AddRef();
+    }
+#endif
     String(const StringBuffer& src);
     String(const InitStruct& src, UPInt size);
     explicit String(const wchar_t* data);      
@@ -175,6 +204,9 @@ public:
     // Declaration of NullString
     static DataDesc NullData;
 
+    // Strings with fewer bytes than this are stored without a heap allocation.
+    enum { LocalCapacity = LocalDataSize - offsetof(DataDesc, Data) };
+
 
     // *** General Functions
 
@@ -281,6 +313,17 @@ public:
     void        operator =  (const wchar_t* str);
     void        operator =  (const String& src);
     void        operator =  (const StringBuffer& src);
+#if defined(OVR_CPP_RVALUE_REFERENCES)
+    void        operator =  (String&& src)
+    {
+        if (&src == this)
+            return;
+        GetData()->Release();
+        memcpy((void*)this, &src, sizeof(String));
+        src.pData = &NullData;
+        NullData.AddRef();
+    }
+#endif
 
     // Addition
     void        operator += (const String& src);
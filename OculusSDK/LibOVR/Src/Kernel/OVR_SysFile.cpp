@@ -31,6 +31,7 @@ limitations under the License.
 #include <stdio.h>
 
 #include "OVR_SysFile.h"
+#include "OVR_MMapFile.h"
 
 namespace OVR {
 
@@ -96,6 +97,17 @@ SysFile::SysFile(const String& path, int flags, int mode) : DelegatedFile(0)
 // Will fail if file's already open
 bool SysFile::Open(const String& path, int flags, int mode)
 {
+    // Mapped files are already in memory, so they don't need buffering.
+    if ((flags & Open_Mapped) && !(flags & (Open_Write | Open_Truncate | Open_Create)))
+    {
+        Ptr<MMapFile> mappedFile = *new MMapFile(path);
+        if (mappedFile->IsValid())
+        {
+            pFile = mappedFile;
+            return 1;
+        }
+    }
+
     pFile = *FileFILEOpen(path, flags, mode);
     if ((!pFile) || (!pFile->IsValid()))
     {
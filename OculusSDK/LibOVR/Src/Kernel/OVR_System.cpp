@@ -26,6 +26,7 @@ limitations under the License.
 ************************************************************************************/
 
 #include "OVR_System.h"
+#include "OVR_AsyncLog.h"
 #include "OVR_Threads.h"
 #include "OVR_Timer.h"
 
@@ -55,6 +56,8 @@ void System::Destroy()
         // Wait for all threads to finish; this must be done so that memory
         // allocator and all destructors finalize correctly.
 #ifdef OVR_ENABLE_THREADS
+        // The asynchronous log's writer would otherwise keep this waiting.
+        AsyncLog::GetAsyncLog()->Stop();
         Thread::FinishAllThreads();
 #endif
 
@@ -334,6 +334,19 @@ public:
 #endif
 
     static int      GetOSPriority(ThreadPriority);
+
+    // *** Real-time scheduling; these act on a started thread and return
+    // false if the OS refuses, typically for lack of privileges.
+
+    // Moves the thread into the real-time FIFO class with the given priority
+    // (clamped to the OS range); 0 returns it to normal time-sharing.
+    bool            SetRealTimePriority(int priority);
+    // Pins the thread to a single hardware processor; -1 allows all of them.
+    // Fails for a processor outside [0, GetCPUCount()).
+    bool            SetAffinity(int processor);
+    // Locks the current and future pages of the process into RAM, so that
+    // time-critical threads never wait for paging.
+    static bool     LockMemory();
     // *** Sleep
 
     // Sleep secs seconds
@@ -46,6 +46,8 @@ using std::timespec;
 #else
 #include <unistd.h>
 #include <sys/time.h>
+#include <sys/mman.h>
+#include <sched.h>
 #include <errno.h>
 #endif
 
@@ -695,6 +697,85 @@ int Thread::GetOSPriority(ThreadPriority p)
 #endif
 }
 
+bool    Thread::SetRealTimePriority(int priority)
+{
+#ifdef OVR_OS_PS3
+    OVR_UNUSED(priority);
+    return 0;
+#else
+    sched_param sparam;
+    int         policy = SCHED_OTHER;
+    sparam.sched_priority = 0;
+
+    if (priority > 0)
+    {
+        policy = SCHED_FIFO;
+        sparam.sched_priority = Alg::Max(sched_get_priority_min(SCHED_FIFO),
+                                Alg::Min(priority, sched_get_priority_max(SCHED_FIFO)));
+    }
+
+    int result = pthread_setschedparam(ThreadHandle, policy, &sparam);
+    if (result)
+    {
+        OVR_DEBUG_LOG(("Thread::SetRealTimePriority failed - error %d", result));
+        return 0;
+    }
+    return 1;
+#endif
+}
+
+bool    Thread::SetAffinity(int processor)
+{
+#if defined(OVR_OS_LINUX)
+    if ((processor < -1) || (processor >= GetCPUCount()) || (processor >= CPU_SETSIZE))
+    {
+        OVR_DEBUG_LOG(("Thread::SetAffinity failed - no processor %d", processor));
+        return 0;
+    }
+
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+
+    if (processor < 0)
+    {
+        for (int i = 0; i < GetCPUCount(); i++)
+            CPU_SET(i, &cpus);
+    }
+    else
+    {
+        CPU_SET(processor, &cpus);
+    }
+
+    int result = pthread_setaffinity_np(ThreadHandle, sizeof(cpus), &cpus);
+    if (result)
+    {
+        OVR_DEBUG_LOG(("Thread::SetAffinity failed - error %d", result));
+        return 0;
+    }
+    Processor = processor;
+    return 1;
+#else
+    // Mac OS X only supports affinity hints between threads.
+    OVR_UNUSED(processor);
+    return 0;
+#endif
+}
+
+/* static */
+bool    Thread::LockMemory()
+{
+#ifdef OVR_OS_PS3
+    return 0;
+#else
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        OVR_DEBUG_LOG(("Thread::LockMemory failed - error %d", errno));
+        return 0;
+    }
+    return 1;
+#endif
+}
+
 bool    Thread::Start(ThreadState initialState)
 {
     if (initialState == NotRunning)
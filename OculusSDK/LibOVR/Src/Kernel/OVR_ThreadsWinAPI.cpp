@@ -804,13 +804,55 @@ int Thread::GetOSPriority(ThreadPriority p)
     return THREAD_PRIORITY_NORMAL;
 }
 
+bool Thread::SetRealTimePriority(int priority)
+{
+    // Windows has no separate FIFO class; time-critical is the closest match.
+    int osPriority = (priority > 0) ? THREAD_PRIORITY_TIME_CRITICAL : THREAD_PRIORITY_NORMAL;
+    if (!::SetThreadPriority(ThreadHandle, osPriority))
+    {
+        OVR_DEBUG_LOG(("Thread::SetRealTimePriority failed - error %d", ::GetLastError()));
+        return 0;
+    }
+    return 1;
+}
+
+bool Thread::SetAffinity(int processor)
+{
+    if ((processor < -1) || (processor >= GetCPUCount()) ||
+        (processor >= (int)(sizeof(DWORD_PTR) * 8)))
+    {
+        OVR_DEBUG_LOG(("Thread::SetAffinity failed - no processor %d", processor));
+        return 0;
+    }
+
+    DWORD_PTR processMask, systemMask;
+    if (!::GetProcessAffinityMask(::GetCurrentProcess(), &processMask, &systemMask))
+        return 0;
+
+    DWORD_PTR mask = (processor < 0) ? processMask : ((DWORD_PTR)1 << processor);
+    if (!::SetThreadAffinityMask(ThreadHandle, mask))
+    {
+        OVR_DEBUG_LOG(("Thread::SetAffinity failed - error %d", ::GetLastError()));
+        return 0;
+    }
+    Processor = processor;
+    return 1;
+}
+
+/* static */
+bool Thread::LockMemory()
+{
+    // Not supported; the working set can't be locked as a whole.
+    return 0;
+}
+
 // The actual first function called on thread start
 unsigned WINAPI Thread_Win32StartFn(void * phandle)
 {
     Thread *   pthread = (Thread*)phandle;
-    if (pthread->Processor != -1)
+    if ((pthread->Processor >= 0) && (pthread->Processor < (int)(sizeof(DWORD_PTR) * 8)))
     {
-        DWORD_PTR ret = SetThreadAffinityMask(GetCurrentThread(), (DWORD)pthread->Processor);
+        DWORD_PTR ret = SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << pthread->Processor);
         if (ret == 0)
             OVR_DEBUG_LOG(("Could not set hardware processor for the thread"));
     }
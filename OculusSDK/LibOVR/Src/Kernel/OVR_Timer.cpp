@@ -29,14 +29,22 @@ limitations under the License.
 
 #if defined (OVR_OS_WIN32)
 #include <windows.h>
-#elif defined(OVR_OS_ANDROID)
+#elif defined(OVR_OS_MAC)
+#include <mach/mach_time.h>
+#elif defined(OVR_OS_LINUX)
 #include <time.h>
-#include <android/log.h>
-
 #else
 #include <sys/time.h>
 #endif
 
+// The TSC can be selected on x86 Linux; elsewhere the default clock already
+// reads it when it is reliable.
+#if defined(OVR_OS_LINUX) && defined(OVR_CC_GNU) && (defined(OVR_CPU_X86) || defined(OVR_CPU_X86_64))
+#define OVR_TIMER_TSC
+#include <x86intrin.h>
+#include <cpuid.h>
+#endif
+
 namespace OVR {
 
 
@@ -49,9 +57,22 @@ double ovr_GetTimeInSeconds()
 }
 
 
+UInt32 Timer::GetTicksMs()
+{
+    return (UInt32)(GetProfileTicks() / 1000);
+}
+// The profile ticks implementation is just fine for a normal timer.
+UInt64 Timer::GetTicks()
+{
+    return GetProfileTicks();
+}
+
 UInt64 Timer::GetProfileTicks()
 {
-    return (GetRawTicks() * MksPerSecond) / GetRawFrequency();
+    // Split the conversion so that ticks * MksPerSecond can't overflow.
+    UInt64 ticks     = GetRawTicks();
+    UInt64 frequency = GetRawFrequency();
+    return (ticks / frequency) * MksPerSecond + ((ticks % frequency) * MksPerSecond) / frequency;
 }
 double Timer::GetProfileSeconds()
 {
@@ -59,129 +80,227 @@ double Timer::GetProfileSeconds()
     return TicksToSeconds(GetProfileTicks()-StartTime);
 }
 
-#ifndef OVR_OS_ANDROID
-
 double Timer::GetSeconds()
 {
     return (double)Timer::GetRawTicks() / (double) GetRawFrequency();
 }
-#endif
 
 
 //------------------------------------------------------------------------
-// *** Android Specific Timer
-
+// *** Win32 Specific Timer
 
-#if defined(OVR_OS_ANDROID)
+#if defined (OVR_OS_WIN32)
 
-// Returns global high-resolution application timer in seconds.
-double Timer::GetSeconds()
+UInt64 Timer::GetRawTicks()
 {
-    return double(Timer::GetRawTicks()) * 0.000000001;
+    LARGE_INTEGER li;
+    QueryPerformanceCounter(&li);
+    return li.QuadPart;
 }
 
-UInt64 Timer::GetRawTicks()
+UInt64 Timer::GetRawFrequency()
 {
-    // Choreographer vsync timestamp is based on.
-    struct timespec tp;
-    const int       status = clock_gettime(CLOCK_MONOTONIC, &tp);
-
-    if (status != 0)
+    static UInt64 perfFreq = 0;
+    if (perfFreq == 0)
     {
-        OVR_DEBUG_LOG(("clock_gettime status=%i", status ));
+        LARGE_INTEGER freq;
+        QueryPerformanceFrequency(&freq);
+        perfFreq = freq.QuadPart;
     }
-    const UInt64 result = (UInt64)tp.tv_sec * (UInt64)(1000 * 1000 * 1000) + UInt64(tp.tv_nsec);
-    return result;
+    return perfFreq;
 }
 
-UInt64 Timer::GetRawFrequency()
+bool Timer::SetClockSource(ClockSource source)
 {
-    return MksPerSecond * 1000;
+    return source == Clock_Default;
+}
+Timer::ClockSource Timer::GetClockSource()
+{
+    return Clock_Default;
 }
 
-#endif
+void Timer::initializeTimerSystem()
+{
+    // Timer reads don't depend on it, but it gives Sleep 1 ms granularity.
+    timeBeginPeriod(1);
+}
+void Timer::shutdownTimerSystem()
+{
+    timeEndPeriod(1);
+}
 
 
 //------------------------------------------------------------------------
-// *** Win32 Specific Timer
+// *** Mac Specific Timer
 
-#if defined (OVR_OS_WIN32)
+#elif defined(OVR_OS_MAC)
 
-CRITICAL_SECTION WinAPI_GetTimeCS;
-volatile UInt32  WinAPI_OldTime = 0;
-volatile UInt32  WinAPI_WrapCounter = 0;
+UInt64 Timer::GetRawTicks()
+{
+    return mach_absolute_time();
+}
 
+UInt64 Timer::GetRawFrequency()
+{
+    static UInt64 frequency = 0;
+    if (frequency == 0)
+    {
+        // Ticks are numer / denom nanoseconds long.
+        mach_timebase_info_data_t info;
+        mach_timebase_info(&info);
+        frequency = (UInt64)1000000000 * info.denom / info.numer;
+    }
+    return frequency;
+}
 
-UInt32 Timer::GetTicksMs()
+bool Timer::SetClockSource(ClockSource source)
+{
+    return source == Clock_Default;
+}
+Timer::ClockSource Timer::GetClockSource()
 {
-    return timeGetTime();
+    return Clock_Default;
 }
 
-UInt64 Timer::GetTicks()
+void Timer::initializeTimerSystem()
+{
+}
+void Timer::shutdownTimerSystem()
 {
-    DWORD  ticks = timeGetTime();
-    UInt64 result;
+}
 
-    // On Win32 QueryPerformanceFrequency is unreliable due to SMP and
-    // performance levels, so use this logic to detect wrapping and track
-    // high bits.
-    ::EnterCriticalSection(&WinAPI_GetTimeCS);
 
-    if (WinAPI_OldTime > ticks)
-        WinAPI_WrapCounter++;
-    WinAPI_OldTime = ticks;
+//------------------------------------------------------------------------
+// *** Linux and Android Specific Timer
 
-    result = (UInt64(WinAPI_WrapCounter) << 32) | ticks;
-    ::LeaveCriticalSection(&WinAPI_GetTimeCS);
+#elif defined(OVR_OS_LINUX)
 
-    return result * MksPerMs;
-}
+#if defined(OVR_OS_ANDROID) || !defined(CLOCK_MONOTONIC_RAW)
+// Choreographer vsync timestamp is based on.
+#define OVR_TIMER_DEFAULT_CLOCK CLOCK_MONOTONIC
+#else
+#define OVR_TIMER_DEFAULT_CLOCK CLOCK_MONOTONIC_RAW
+#endif
 
-UInt64 Timer::GetRawTicks()
+static Timer::ClockSource   Timer_ClockSource  = Timer::Clock_Default;
+static clockid_t            Timer_ClockId      = OVR_TIMER_DEFAULT_CLOCK;
+#ifdef OVR_TIMER_TSC
+// Nonzero while the TSC is the clock.
+static UInt64               Timer_TscFrequency = 0;
+#endif
+
+static UInt64 readClockNs(clockid_t clockId)
 {
-    LARGE_INTEGER li;
-    QueryPerformanceCounter(&li);
-    return li.QuadPart;
+    struct timespec tp;
+    if (clock_gettime(clockId, &tp) != 0)
+    {
+        // Kernels before 2.6.28 don't have CLOCK_MONOTONIC_RAW.
+        Timer_ClockId = clockId = CLOCK_MONOTONIC;
+        clock_gettime(clockId, &tp);
+    }
+    return (UInt64)tp.tv_sec * 1000000000 + (UInt64)tp.tv_nsec;
 }
 
-UInt64 Timer::GetRawFrequency()
+#ifdef OVR_TIMER_TSC
+// Reads the clock and the TSC at as nearly the same moment as it can,
+// keeping the tightest of a few tries so that preemption is left out.
+static void sampleTsc(clockid_t clockId, UInt64* clockNs, UInt64* tsc)
 {
-    static UInt64 perfFreq = 0;
-    if (perfFreq == 0)
+    UInt64 bestSpan = ~(UInt64)0;
+    for (int i = 0; i < 5; i++)
     {
-        LARGE_INTEGER freq;
-        QueryPerformanceFrequency(&freq);
-        perfFreq = freq.QuadPart;
+        UInt64 before = __rdtsc();
+        UInt64 ns     = readClockNs(clockId);
+        UInt64 after  = __rdtsc();
+        if (after - before < bestSpan)
+        {
+            bestSpan = after - before;
+            *clockNs = ns;
+            *tsc     = before + bestSpan / 2;
+        }
     }
-    return perfFreq;
 }
 
-void Timer::initializeTimerSystem()
+// Returns the TSC frequency measured against the clock, or 0 if the TSC
+// isn't invariant and so can't be used as a clock.
+static UInt64 measureTscFrequency(clockid_t clockId)
 {
-    timeBeginPeriod(1);
-    InitializeCriticalSection(&WinAPI_GetTimeCS);
-
+    // CPUID 0x80000007, EDX bit 8: the TSC runs at a constant rate in all
+    // P-, C- and T-states.
+    unsigned eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) || !(edx & (1 << 8)))
+        return 0;
+
+    UInt64 startNs, startTsc, endNs, endTsc;
+    sampleTsc(clockId, &startNs, &startTsc);
+    struct timespec delay = { 0, 50 * 1000000 };
+    nanosleep(&delay, 0);
+    sampleTsc(clockId, &endNs, &endTsc);
+
+    if (endNs <= startNs || endTsc <= startTsc)
+        return 0;
+    return (endTsc - startTsc) * 1000000000 / (endNs - startNs);
 }
-void Timer::shutdownTimerSystem()
+#endif
+
+UInt64 Timer::GetRawTicks()
 {
-    DeleteCriticalSection(&WinAPI_GetTimeCS);
-    timeEndPeriod(1);
+#ifdef OVR_TIMER_TSC
+    if (Timer_TscFrequency)
+        return __rdtsc();
+#endif
+    return readClockNs(Timer_ClockId);
 }
 
-#else   // !OVR_OS_WIN32
+UInt64 Timer::GetRawFrequency()
+{
+#ifdef OVR_TIMER_TSC
+    if (Timer_TscFrequency)
+        return Timer_TscFrequency;
+#endif
+    return 1000000000;
+}
 
+bool Timer::SetClockSource(ClockSource source)
+{
+    clockid_t clockId;
+    switch (source)
+    {
+    case Clock_Default:         clockId = OVR_TIMER_DEFAULT_CLOCK;  break;
+    case Clock_Monotonic:       clockId = CLOCK_MONOTONIC;          break;
+#ifdef CLOCK_MONOTONIC_RAW
+    case Clock_MonotonicRaw:    clockId = CLOCK_MONOTONIC_RAW;      break;
+#endif
+#ifdef OVR_TIMER_TSC
+    case Clock_TSC:
+        {
+            UInt64 frequency = measureTscFrequency(Timer_ClockId);
+            if (!frequency)
+                return false;
+            Timer_TscFrequency = frequency;
+            Timer_ClockSource  = source;
+            return true;
+        }
+#endif
+    default:
+        return false;
+    }
 
-//------------------------------------------------------------------------
-// *** Standard OS Timer     
+    struct timespec tp;
+    if (clock_gettime(clockId, &tp) != 0)
+        return false;
 
-UInt32 Timer::GetTicksMs()
-{
-    return (UInt32)(GetProfileTicks() / 1000);
+    Timer_ClockId      = clockId;
+    Timer_ClockSource  = source;
+#ifdef OVR_TIMER_TSC
+    Timer_TscFrequency = 0;
+#endif
+    return true;
 }
-// The profile ticks implementation is just fine for a normal timer.
-UInt64 Timer::GetTicks()
+
+Timer::ClockSource Timer::GetClockSource()
 {
-    return GetProfileTicks();
+    return Timer_ClockSource;
 }
 
 void Timer::initializeTimerSystem()
@@ -192,11 +311,13 @@ void Timer::shutdownTimerSystem()
 }
 
 
-#if !defined(OVR_OS_ANDROID)
+//------------------------------------------------------------------------
+// *** Standard OS Timer     
+
+#else
 
 UInt64  Timer::GetRawTicks()
 {
-    // TODO: prefer rdtsc when available?
 	UInt64 result;
 
     // Return microseconds.
@@ -215,11 +336,24 @@ UInt64 Timer::GetRawFrequency()
     return MksPerSecond;
 }
 
-#endif // !OVR_OS_ANDROID
+bool Timer::SetClockSource(ClockSource source)
+{
+    return source == Clock_Default;
+}
+Timer::ClockSource Timer::GetClockSource()
+{
+    return Clock_Default;
+}
+
+void Timer::initializeTimerSystem()
+{
+}
+void Timer::shutdownTimerSystem()
+{
+}
 
-#endif  // !OVR_OS_WIN32
+#endif
 
 
 
 } // OVR
-
@@ -37,6 +37,10 @@ namespace OVR {
 
 // Timer class defines a family of static functions used for application
 // timing and profiling.
+//
+// All of them read the same clock, so times from GetTicks, GetSeconds and the
+// profiling functions can be compared with one another, and with sensor sample
+// times, which are mapped onto it.
 
 class Timer
 {
@@ -47,6 +51,29 @@ public:
         MksPerSecond    = MsPerSecond * MksPerMs
     };
 
+    // Hardware clocks the timer can read.
+    enum ClockSource
+    {
+        // Best monotonic clock for the platform: QueryPerformanceCounter on Windows,
+        // mach_absolute_time on Mac, CLOCK_MONOTONIC on Android (which vsync
+        // timestamps are based on) and CLOCK_MONOTONIC_RAW on other Linux systems.
+        Clock_Default,
+        // CLOCK_MONOTONIC; NTP slews its rate.
+        Clock_Monotonic,
+        // CLOCK_MONOTONIC_RAW; the unadjusted hardware clock.
+        Clock_MonotonicRaw,
+        // The CPU time-stamp counter, read with rdtsc; the cheapest to query.
+        // Only x86 CPUs with an invariant TSC have one. Its frequency is
+        // measured against the default clock, which takes about 50 ms.
+        Clock_TSC
+    };
+
+    // Selects the clock the timer reads. Values from different clocks can't be
+    // compared, so this should be called before System::Init.
+    // Returns false if the source isn't available, leaving the clock unchanged.
+    static bool         SetClockSource(ClockSource source);
+    static ClockSource  GetClockSource();
+
 
     // ***** Timing APIs for Application    
     // These APIs should be used to guide animation and other program functions
@@ -58,8 +85,7 @@ public:
     static UInt32  OVR_STDCALL GetTicksMs();
 
     // GetTicks returns general-purpose high resolution application timer value,
-    // measured in microseconds (mks, or 1/1000000 of a second). The actual precision
-    // is system-specific and may be much lower, such as 1 ms.
+    // measured in microseconds (mks, or 1/1000000 of a second).
     static UInt64  OVR_STDCALL GetTicks();
 
     // Returns global high-resolution application timer in seconds.
@@ -67,10 +93,8 @@ public:
 
     
     // ***** Profiling APIs.
-    // These functions should be used for profiling, but may have system specific
-    // artifacts that make them less appropriate for general system use.
-    // On Win32, for example these rely on QueryPerformanceConter  may have
-    // problems with thread-core switching and power modes.
+    // These functions should be used for profiling; they read the same
+    // clock as the timing APIs above.
 
     // Return a hi-res timer value in mks (1/1000000 of a sec).
     // Generally you want to call this at the start and end of an
@@ -98,7 +122,7 @@ public:
     // Convert Raw or frequency-unit ticks to seconds based on specified frequency.
     static inline double RawTicksToSeconds(UInt64 rawTicks, UInt64 rawFrequency)
     {
-        return static_cast<double>(rawTicks) * rawFrequency;
+        return static_cast<double>(rawTicks) / static_cast<double>(rawFrequency);
     }
 
 private:
@@ -0,0 +1,272 @@
+/************************************************************************************
+
+Filename    :   OVR_TrackingAllocator.cpp
+Content     :   Allocator wrapper that records every live allocation for profiling
+                and leak reporting
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+************************************************************************************/
+
+#include "OVR_TrackingAllocator.h"
+#include "OVR_Threads.h"
+#include "OVR_Log.h"
+#include <string.h>
+
+#if defined(OVR_CC_MSVC)
+ #include <intrin.h>
+ #pragma intrinsic(_ReturnAddress)
+ #define OVR_CALLER_ADDRESS() _ReturnAddress()
+#elif defined(OVR_CC_GNU)
+ #define OVR_CALLER_ADDRESS() __builtin_return_address(0)
+#else
+ #define OVR_CALLER_ADDRESS() 0
+#endif
+
+namespace OVR {
+
+//------------------------------------------------------------------------
+// ***** TrackingAllocator
+
+enum
+{
+    // Enough room for the record, keeping the returned block 16-byte aligned.
+    TrackHeaderSize = 64,
+    // Blocks listed individually in the shutdown leak report.
+    MaxReportedLeaks = 32
+};
+
+static OVR_THREAD_LOCAL UInt32 ThreadSubsystem = AllocSubsystem_General;
+static OVR_THREAD_LOCAL UInt32 ThreadAllocCount = 0;
+
+static const char* SubsystemNames[AllocSubsystem_Count] =
+{
+    "General", "Render", "Sensor", "Loader"
+};
+
+TrackingAllocator* TrackingAllocator::pTracker = 0;
+
+
+TrackingAllocator::TrackingAllocator()
+    : pAlloc(0), Frame(0), FrameAllocCount(0), LastFrameAllocCount(0)
+{
+    OVR_COMPILER_ASSERT(sizeof(Record) <= TrackHeaderSize);
+
+    Live.pPrev = Live.pNext = &Live;
+    memset(Stats, 0, sizeof(Stats));
+}
+
+TrackingAllocator* TrackingAllocator::InitSystemSingleton(Allocator* palloc)
+{
+    TrackingAllocator* tracker = Allocator_SingletonSupport<TrackingAllocator>::InitSystemSingleton();
+    tracker->pAlloc = palloc;
+    pTracker = tracker;
+    return tracker;
+}
+
+AllocSubsystem TrackingAllocator::SetThreadSubsystem(AllocSubsystem subsystem)
+{
+    AllocSubsystem previous = (AllocSubsystem)ThreadSubsystem;
+    ThreadSubsystem = subsystem;
+    return previous;
+}
+
+UInt32 TrackingAllocator::GetThreadAllocCount()
+{
+    return ThreadAllocCount;
+}
+
+const char* TrackingAllocator::GetSubsystemName(AllocSubsystem subsystem)
+{
+    return (subsystem < AllocSubsystem_Count) ? SubsystemNames[subsystem] : "Unknown";
+}
+
+
+void* TrackingAllocator::Alloc(UPInt size)
+{
+    Record* record = (Record*)pAlloc->Alloc(size + TrackHeaderSize);
+    return track(record, size, 0, 0, OVR_CALLER_ADDRESS());
+}
+
+void* TrackingAllocator::AllocDebug(UPInt size, const char* file, unsigned line)
+{
+    Record* record = (Record*)pAlloc->AllocDebug(size + TrackHeaderSize, file, line);
+    return track(record, size, file, line, OVR_CALLER_ADDRESS());
+}
+
+void* TrackingAllocator::track(Record* record, UPInt size, const char* file,
+                               unsigned line, void* caller)
+{
+    if (!record)
+        return 0;
+
+    record->Size      = size;
+    record->pFile     = file;
+    record->Line      = line;
+    record->pCaller   = caller;
+#ifdef OVR_ENABLE_THREADS
+    record->pThread   = (void*)GetCurrentThreadId();
+#else
+    record->pThread   = 0;
+#endif
+    record->Subsystem = ThreadSubsystem;
+    ThreadAllocCount++;
+
+    Lock::Locker lock(&TrackLock);
+    record->Frame = Frame;
+    link(record);
+    Stats[record->Subsystem].TotalCount++;
+    FrameAllocCount++;
+    return (UByte*)record + TrackHeaderSize;
+}
+
+void* TrackingAllocator::Realloc(void* p, UPInt newSize)
+{
+    if (!p)
+        return track((Record*)pAlloc->Alloc(newSize + TrackHeaderSize),
+                     newSize, 0, 0, OVR_CALLER_ADDRESS());
+
+    Record* record = (Record*)((UByte*)p - TrackHeaderSize);
+
+    // The block may move, so it has to be out of the list while it does.
+    Lock::Locker lock(&TrackLock);
+    unlink(record);
+
+    Record* newRecord = (Record*)pAlloc->Realloc(record, newSize + TrackHeaderSize);
+    if (!newRecord)
+    {
+        link(record);
+        return 0;
+    }
+    newRecord->Size = newSize;
+    link(newRecord);
+    ThreadAllocCount++;
+    Stats[newRecord->Subsystem].TotalCount++;
+    FrameAllocCount++;
+    return (UByte*)newRecord + TrackHeaderSize;
+}
+
+void TrackingAllocator::Free(void *p)
+{
+    if (!p)
+        return;
+
+    Record* record = (Record*)((UByte*)p - TrackHeaderSize);
+    {
+        Lock::Locker lock(&TrackLock);
+        unlink(record);
+    }
+    pAlloc->Free(record);
+}
+
+// Both expect TrackLock to be held.
+void TrackingAllocator::link(Record* record)
+{
+    record->pPrev = Live.pPrev;
+    record->pNext = &Live;
+    Live.pPrev->pNext = record;
+    Live.pPrev = record;
+
+    Stats[record->Subsystem].LiveBytes += record->Size;
+    Stats[record->Subsystem].LiveCount++;
+}
+
+void TrackingAllocator::unlink(Record* record)
+{
+    record->pPrev->pNext = record->pNext;
+    record->pNext->pPrev = record->pPrev;
+
+    Stats[record->Subsystem].LiveBytes -= record->Size;
+    Stats[record->Subsystem].LiveCount--;
+}
+
+
+void TrackingAllocator::GetSubsystemStats(AllocSubsystem subsystem, SubsystemStats* stats)
+{
+    OVR_ASSERT(subsystem < AllocSubsystem_Count);
+    Lock::Locker lock(&TrackLock);
+    *stats = Stats[subsystem];
+}
+
+UInt32 TrackingAllocator::EndFrame()
+{
+    Lock::Locker lock(&TrackLock);
+    LastFrameAllocCount = FrameAllocCount;
+    FrameAllocCount = 0;
+    Frame++;
+    return LastFrameAllocCount;
+}
+
+void TrackingAllocator::LogStats()
+{
+    Lock::Locker lock(&TrackLock);
+    LogText("OVR::TrackingAllocator - live memory by subsystem:\n");
+    for (unsigned i = 0; i < AllocSubsystem_Count; i++)
+    {
+        LogText("  %-8s %10u bytes in %6u blocks, %8u allocations total\n",
+                SubsystemNames[i], (unsigned)Stats[i].LiveBytes,
+                (unsigned)Stats[i].LiveCount, (unsigned)Stats[i].TotalCount);
+    }
+    LogText("  %u allocations last frame\n", LastFrameAllocCount);
+}
+
+void TrackingAllocator::LogLiveAllocations(unsigned maxCount)
+{
+    Lock::Locker lock(&TrackLock);
+    unsigned count = 0;
+    for (Record* record = Live.pNext; record != &Live && count < maxCount;
+         record = record->pNext, count++)
+    {
+        if (record->pFile)
+            LogText("  %8u bytes  %s(%u)  thread %p  %s  frame %u\n",
+                    (unsigned)record->Size, record->pFile, record->Line, record->pThread,
+                    SubsystemNames[record->Subsystem], record->Frame);
+        else
+            LogText("  %8u bytes  caller %p  thread %p  %s  frame %u\n",
+                    (unsigned)record->Size, record->pCaller, record->pThread,
+                    SubsystemNames[record->Subsystem], record->Frame);
+    }
+}
+
+void TrackingAllocator::onSystemShutdown()
+{
+    UPInt leakCount = 0, leakBytes = 0;
+    for (unsigned i = 0; i < AllocSubsystem_Count; i++)
+    {
+        leakCount += Stats[i].LiveCount;
+        leakBytes += Stats[i].LiveBytes;
+    }
+
+    if (leakCount)
+    {
+        LogText("OVR::TrackingAllocator - %u blocks (%u bytes) not freed at shutdown.\n",
+                (unsigned)leakCount, (unsigned)leakBytes);
+        LogStats();
+        LogLiveAllocations(MaxReportedLeaks);
+    }
+
+    // Leaked blocks stay with the wrapped allocator, which goes down with us.
+    pTracker = 0;
+    if (pAlloc)
+        pAlloc->onSystemShutdown();
+    Allocator_SingletonSupport<TrackingAllocator>::onSystemShutdown();
+}
+
+} // OVR
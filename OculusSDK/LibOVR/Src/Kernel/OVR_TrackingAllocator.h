@@ -0,0 +1,156 @@
+/************************************************************************************
+
+PublicHeader:   OVR.h
+Filename    :   OVR_TrackingAllocator.h
+Content     :   Allocator wrapper that records every live allocation for profiling
+                and leak reporting
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+************************************************************************************/
+
+#ifndef OVR_TrackingAllocator_h
+#define OVR_TrackingAllocator_h
+
+#include "OVR_Allocator.h"
+#include "OVR_Atomic.h"
+
+namespace OVR {
+
+// Subsystem an allocation is charged to; set per thread with AllocSubsystemScope.
+enum AllocSubsystem
+{
+    AllocSubsystem_General,
+    AllocSubsystem_Render,
+    AllocSubsystem_Sensor,
+    AllocSubsystem_Loader,
+    AllocSubsystem_Count
+};
+
+
+//------------------------------------------------------------------------
+// ***** TrackingAllocator
+
+// TrackingAllocator wraps another Allocator and keeps a record of every live
+// block: its size, call site (file/line in debug builds, the return address
+// otherwise), allocating thread, subsystem and frame. From these it reports live
+// bytes per subsystem, the number of allocations made each frame, and at
+// System::Destroy a summary of the blocks that were never freed.
+//
+// Each block costs a header of up to 64 bytes and every Alloc/Free takes a
+// lock, so this is meant for profiling builds:
+//
+//   System::Init(log, TrackingAllocator::InitSystemSingleton(
+//                         DefaultAllocator::InitSystemSingleton()));
+
+class TrackingAllocator : public Allocator_SingletonSupport<TrackingAllocator>
+{
+public:
+    struct SubsystemStats
+    {
+        UPInt   LiveBytes;
+        UPInt   LiveCount;
+        UPInt   TotalCount;
+    };
+
+    TrackingAllocator();
+
+    // Creates the singleton wrapping palloc, which it takes over: its
+    // onSystemShutdown is called from ours.
+    static TrackingAllocator* InitSystemSingleton(Allocator* palloc);
+    // Returns the singleton if one is installed, null otherwise.
+    static TrackingAllocator* GetTracker() { return pTracker; }
+
+    virtual void*   Alloc(UPInt size);
+    virtual void*   AllocDebug(UPInt size, const char* file, unsigned line);
+    virtual void*   Realloc(void* p, UPInt newSize);
+    virtual void    Free(void *p);
+
+    // Charges allocations made by the calling thread to subsystem; returns the
+    // previous one.
+    static AllocSubsystem SetThreadSubsystem(AllocSubsystem subsystem);
+    static const char*    GetSubsystemName(AllocSubsystem subsystem);
+
+    void    GetSubsystemStats(AllocSubsystem subsystem, SubsystemStats* stats);
+
+    // Marks the end of a frame and returns the number of Alloc and Realloc
+    // calls made during it, on any thread.
+    UInt32  EndFrame();
+    UInt32  GetLastFrameAllocCount() const { return LastFrameAllocCount; }
+
+    // Returns the number of Alloc and Realloc calls the calling thread has
+    // made so far, so a thread can count its own allocations over a frame
+    // without those of the sensor and loader threads.
+    static UInt32 GetThreadAllocCount();
+
+    // Logs live bytes and counts per subsystem.
+    void    LogStats();
+    // Logs up to maxCount live blocks, oldest first.
+    void    LogLiveAllocations(unsigned maxCount);
+
+protected:
+    virtual void    onSystemShutdown();
+
+private:
+    struct Record
+    {
+        Record*     pPrev;
+        Record*     pNext;
+        UPInt       Size;
+        const char* pFile;
+        void*       pCaller;
+        void*       pThread;
+        UInt32      Line;
+        UInt32      Subsystem;
+        UInt32      Frame;
+    };
+
+    void*   track(Record* record, UPInt size, const char* file, unsigned line, void* caller);
+    void    link(Record* record);
+    void    unlink(Record* record);
+
+    Allocator*      pAlloc;
+    Lock            TrackLock;
+    Record          Live;       // Sentinel of the circular list of live blocks.
+    SubsystemStats  Stats[AllocSubsystem_Count];
+    UInt32          Frame;
+    UInt32          FrameAllocCount;
+    UInt32          LastFrameAllocCount;
+
+    static TrackingAllocator* pTracker;
+};
+
+
+// Charges allocations made by the current thread to a subsystem for the
+// lifetime of the scope.
+class AllocSubsystemScope
+{
+public:
+    AllocSubsystemScope(AllocSubsystem subsystem)
+        : Previous(TrackingAllocator::SetThreadSubsystem(subsystem)) { }
+    ~AllocSubsystemScope() { TrackingAllocator::SetThreadSubsystem(Previous); }
+
+private:
+    AllocSubsystem Previous;
+};
+
+} // OVR
+
+#endif
@@ -109,7 +109,7 @@ limitations under the License.
 #  define OVR_CPU_ALTIVEC
 #endif // __ALTIVEC__
 
-#if defined(__ARM_NEON__)
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
 #  define OVR_CPU_ARM_NEON
 #endif // __ARM_NEON__
 
@@ -287,6 +287,9 @@ namespace BaseTypes
 //
 //  OVR_BYTE_ORDER      - Defined to either OVR_LITTLE_ENDIAN or OVR_BIG_ENDIAN
 //  OVR_FORCE_INLINE    - Forces inline expansion of function
+//  OVR_THREAD_LOCAL    - Declares a thread-local variable of POD type
+//  OVR_CPP_RVALUE_REFERENCES  - Defined if rvalue references are supported
+//  OVR_CPP_VARIADIC_TEMPLATES - Defined if variadic templates are supported
 //  OVR_ASM             - Assembly language prefix
 //  OVR_STR             - Prefixes string with L"" if building unicode
 // 
@@ -309,6 +312,24 @@ namespace BaseTypes
 #  define OVR_FORCE_INLINE  inline
 #endif  // OVR_CC_MSVC
 
+// Thread-local storage for plain data - goes before variable declaration
+#if defined(OVR_CC_MSVC)
+#  define OVR_THREAD_LOCAL  __declspec(thread)
+#else
+#  define OVR_THREAD_LOCAL  __thread
+#endif
+
+// Rvalue references (move construction/assignment) and variadic templates, where
+// the compiler supports them; containers and smart pointers use these to avoid copies.
+#if (__cplusplus >= 201103L) || defined(__GXX_EXPERIMENTAL_CXX0X__) || \
+    (defined(OVR_CC_MSVC) && (OVR_CC_MSVC >= 1600))
+#  define OVR_CPP_RVALUE_REFERENCES
+#endif
+#if (__cplusplus >= 201103L) || defined(__GXX_EXPERIMENTAL_CXX0X__) || \
+    (defined(OVR_CC_MSVC) && (OVR_CC_MSVC >= 1800))
+#  define OVR_CPP_VARIADIC_TEMPLATES
+#endif
+
 
 #if defined(OVR_OS_WIN32)
     
@@ -214,6 +214,36 @@ protected:
     DeviceEnumerationArgs EnumArgs;
 };
 
+//-------------------------------------------------------------------------------------
+// ***** DeviceManagerOptions
+
+// Optional settings for DeviceManager::Create.
+struct DeviceManagerOptions
+{
+    // If set, HID devices are replaced by a single virtual device playing back
+    // reports recorded with CapturePath. Replay is paced by the recorded timestamps
+    // when ReplayRealTime is true, otherwise it runs as fast as reports are consumed.
+    const char* ReplayPath;
+    bool        ReplayRealTime;
+    // If set, reports of the first opened HID device are recorded into this file.
+    const char* CapturePath;
+
+    // Scheduling of the background thread that receives sensor reports, so
+    // that samples keep arriving on time when other threads load every core.
+    // A priority > 0 selects real-time FIFO scheduling (1-99 on Linux), and a
+    // processor >= 0 pins the thread to that CPU. LockMemory keeps the process
+    // resident so the thread never stalls on a page fault. Each may require
+    // privileges; failures are logged and the defaults kept.
+    int         ThreadRealTimePriority;
+    int         ThreadProcessor;
+    bool        LockMemory;
+
+    DeviceManagerOptions()
+        : ReplayPath(0), ReplayRealTime(true), CapturePath(0),
+          ThreadRealTimePriority(0), ThreadProcessor(-1), LockMemory(false) { }
+};
+
+
 //-------------------------------------------------------------------------------------
 // ***** DeviceManager
 
@@ -275,6 +305,7 @@ public:
 
     // Creates a new DeviceManager. Only one instance of DeviceManager should be created at a time.
     static   DeviceManager* Create();
+    static   DeviceManager* Create(const DeviceManagerOptions& options);
 
     // Static constant for this device type, used in template cast type checks.
     enum { EnumDeviceType = Device_Manager };
@@ -504,7 +535,8 @@ private:
 
 // SensorDevice is an interface to sensor data.
 // Install a MessageHandler of SensorDevice instance to receive MessageBodyFrame
-// notifications.
+// notifications. Handlers that support Message_BodyFrameBatch instead receive one
+// MessageBodyFrameBatch per sensor report.
 //
 // TBD: Add Polling API? More HID interfaces?
 
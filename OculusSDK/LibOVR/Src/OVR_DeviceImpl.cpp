@@ -32,6 +32,7 @@ limitations under the License.
 #include "OVR_DeviceImpl.h"
 #include "OVR_SensorImpl.h"
 #include "OVR_Profile.h"
+#include "OVR_HIDCapture.h"
 
 namespace OVR {
 
@@ -232,6 +233,44 @@ Lock* MessageHandler::GetHandlerLock() const
 }
 
 
+//-------------------------------------------------------------------------------------
+// ***** DeviceStatusQueue
+
+DeviceStatusQueue::DeviceStatusQueue()
+{
+}
+
+bool DeviceStatusQueue::Push(MessageType action, const DeviceHandle& handle)
+{
+    // The consumer polls, so there is nobody to wake.
+    UInt32 pos;
+    Entry* slot = Entries.Claim(&pos);
+    if (!slot)
+    {
+        LogError("OVR::DeviceStatusQueue - queue full, dropping device notification.\n");
+        return false;
+    }
+
+    slot->Action = action;
+    slot->Handle = handle;
+    Entries.Publish(pos);
+    return true;
+}
+
+bool DeviceStatusQueue::Pop(Entry* entry)
+{
+    Entry* slot = Entries.Peek();
+    if (!slot)
+        return false;
+
+    entry->Action = slot->Action;
+    entry->Handle = slot->Handle;
+    slot->Handle.Clear();
+    Entries.Pop();
+    return true;
+}
+
+
 //-------------------------------------------------------------------------------------
 // ***** DeviceBase
    
@@ -453,6 +492,38 @@ Void DeviceManagerImpl::ReleaseDevice_MgrThread(DeviceBase* device)
 
 
 
+void DeviceManagerImpl::ApplyOptions(const DeviceManagerOptions& options)
+{
+    if (options.ReplayPath)
+    {
+        Ptr<ReplayHIDDeviceManager> replay =
+            *new ReplayHIDDeviceManager(GetThreadQueue(), options.ReplayPath, options.ReplayRealTime);
+
+        // Keep the live devices if the capture can't be read.
+        if (replay->IsValid())
+        {
+            // The platform manager is registered with the manager thread for
+            // hotplug events, which must stop before it is released.
+            if (HidDeviceManager)
+                HidDeviceManager->Shutdown();
+            HidDeviceManager = replay;
+        }
+    }
+    else if (options.CapturePath && HidDeviceManager)
+    {
+        HidDeviceManager = *new CaptureHIDDeviceManager(HidDeviceManager, options.CapturePath);
+    }
+
+    Thread* thread = GetThread();
+    if (options.ThreadRealTimePriority > 0 && !thread->SetRealTimePriority(options.ThreadRealTimePriority))
+        LogError("OVR::DeviceManager - unable to set real-time priority %d.\n", options.ThreadRealTimePriority);
+    if (options.ThreadProcessor >= 0 && !thread->SetAffinity(options.ThreadProcessor))
+        LogError("OVR::DeviceManager - unable to pin thread to processor %d.\n", options.ThreadProcessor);
+    if (options.LockMemory && !Thread::LockMemory())
+        LogError("OVR::DeviceManager - unable to lock memory.\n");
+}
+
+
 Void DeviceManagerImpl::EnumerateAllFactoryDevices()
 {
     // 1. Mark matching devices as NOT enumerated.
@@ -29,6 +29,7 @@ limitations under the License.
 
 #include "OVR_Device.h"
 #include "Kernel/OVR_Atomic.h"
+#include "Kernel/OVR_List.h"
 #include "Kernel/OVR_Log.h"
 #include "Kernel/OVR_System.h"
 
@@ -372,6 +373,9 @@ public:
     // Returns the thread id of the DeviceManager.
     virtual ThreadId GetThreadId() const = 0;
 
+    // Returns the background device manager thread.
+    virtual Thread*  GetThread() const = 0;
+
     virtual DeviceEnumerator<> EnumerateDevicesEx(const DeviceEnumerationArgs& args);
 
 
@@ -415,6 +419,11 @@ public:
         return HidDeviceManager;
     }
 
+    // Applies DeviceManagerOptions once the platform manager is initialized;
+    // installs the HID capture or replay manager and sets up the scheduling
+    // of the manager thread if requested.
+    void ApplyOptions(const DeviceManagerOptions& options);
+
     // Adds device (DeviceCreateDesc*) into Devices. Returns NULL, 
     // if unsuccessful or device is already in the list.
     virtual Ptr<DeviceCreateDesc> AddDevice_NeedsLock(const DeviceCreateDesc& createDesc);
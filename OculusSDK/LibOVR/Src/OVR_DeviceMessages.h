@@ -34,6 +34,7 @@ limitations under the License.
 #include "Kernel/OVR_Math.h"
 #include "Kernel/OVR_Array.h"
 #include "Kernel/OVR_Color.h"
+#include "Kernel/OVR_MPSCRing.h"
 
 namespace OVR {
 
@@ -55,6 +56,7 @@ enum MessageType
     Message_DeviceRemoved           = OVR_MESSAGETYPE(Manager, 1),  // Existing device has been plugged/unplugged.
     // Sensor Messages
     Message_BodyFrame               = OVR_MESSAGETYPE(Sensor, 0),   // Emitted by sensor at regular intervals.
+    Message_BodyFrameBatch          = OVR_MESSAGETYPE(Sensor, 1),   // All BodyFrame samples of one sensor report.
     // Latency Tester Messages
     Message_LatencyTestSamples          = OVR_MESSAGETYPE(LatencyTester, 0),
     Message_LatencyTestColorDetected    = OVR_MESSAGETYPE(LatencyTester, 1),
@@ -93,7 +95,8 @@ class MessageBodyFrame : public Message
 {
 public:
     MessageBodyFrame(DeviceBase* dev)
-        : Message(Message_BodyFrame, dev), Temperature(0.0f), TimeDelta(0.0f)
+        : Message(Message_BodyFrame, dev), Temperature(0.0f), TimeDelta(0.0f),
+          AbsoluteTimeSeconds(0.0)
     {
     }
 
@@ -102,6 +105,49 @@ public:
     Vector3f MagneticField;  // Magnetic field strength in Gauss.
     float    Temperature;    // Temperature reading on sensor surface, in degrees Celsius.
     float    TimeDelta;      // Time passed since last Body Frame, in seconds.
+    // Timer::GetSeconds() time the sample was taken, mapped from the device clock.
+    double   AbsoluteTimeSeconds;
+};
+
+// Sensor BodyFrame samples decoded from a single tracker report, delivered with
+// one OnMessage call. Sensors send this instead of separate MessageBodyFrame
+// notifications to handlers that report support for Message_BodyFrameBatch.
+class MessageBodyFrameBatch : public Message
+{
+public:
+    // Up to three samples per report, plus one replicated sample filling in
+    // for reports that were dropped.
+    enum { MaxSamples = 4 };
+
+    struct Sample
+    {
+        Vector3f Acceleration;
+        Vector3f RotationRate;
+        Vector3f MagneticField;
+        float    Temperature;
+        float    TimeDelta;
+        double   AbsoluteTimeSeconds;
+    };
+
+    MessageBodyFrameBatch(DeviceBase* dev)
+        : Message(Message_BodyFrameBatch, dev), SampleCount(0)
+    {
+    }
+
+    // Copies sample i into a stand-alone BodyFrame message.
+    void GetFrame(unsigned i, MessageBodyFrame* frame) const
+    {
+        const Sample& s      = Samples[i];
+        frame->Acceleration  = s.Acceleration;
+        frame->RotationRate  = s.RotationRate;
+        frame->MagneticField = s.MagneticField;
+        frame->Temperature   = s.Temperature;
+        frame->TimeDelta     = s.TimeDelta;
+        frame->AbsoluteTimeSeconds = s.AbsoluteTimeSeconds;
+    }
+
+    Sample   Samples[MaxSamples]; // In the order they were measured.
+    unsigned SampleCount;
 };
 
 // Sent when we receive a device status changes (e.g.:
@@ -115,6 +161,38 @@ public:
 	DeviceHandle Handle;
 };
 
+// DeviceStatusQueue is a preallocated lock-free ring for handing device added/removed
+// notifications from the device manager thread to the application. Push may be
+// called from any number of threads, typically from MessageHandler::OnMessage;
+// Pop drains the queue on a single consumer thread, such as the main loop.
+// No lock is held while a popped DeviceHandle is released, so consumers don't need
+// to worry about the HandlerLock / DeviceLock ordering.
+class DeviceStatusQueue
+{
+public:
+    struct Entry
+    {
+        MessageType  Action;
+        DeviceHandle Handle;
+
+        Entry() : Action(Message_None) { }
+    };
+
+    DeviceStatusQueue();
+
+    // Adds a notification; returns false, dropping it, if the queue is full.
+    bool Push(MessageType action, const DeviceHandle& handle);
+    bool Push(const MessageDeviceStatus& status) { return Push(status.Type, status.Handle); }
+
+    // Removes the oldest notification into entry; returns false if there is none.
+    bool Pop(Entry* entry);
+
+private:
+    enum { Capacity = 32 };
+
+    MPSCRing<Entry, Capacity> Entries;
+};
+
 //-------------------------------------------------------------------------------------
 // ***** Latency Tester
 
@@ -0,0 +1,583 @@
+/************************************************************************************
+
+Filename    :   OVR_HIDCapture.cpp
+Content     :   HIDDeviceManager wrappers that record live HID reports to a file
+                and replay them later as a virtual device.
+Created     :   October 18, 2026
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*************************************************************************************/
+
+#include "OVR_HIDCapture.h"
+#include "OVR_ThreadCommandQueue.h"
+
+#include "Kernel/OVR_SysFile.h"
+#include "Kernel/OVR_Log.h"
+
+namespace OVR {
+
+//-------------------------------------------------------------------------------------
+// ***** Capture file helpers
+
+static void writeString(File* file, const String& str)
+{
+    file->WriteUInt16((UInt16)str.GetSize());
+    file->Write((const UByte*)str.ToCStr(), (int)str.GetSize());
+}
+
+static bool readString(File* file, String* str)
+{
+    UInt16 size = file->ReadUInt16();
+    char   buffer[256];
+    if (size >= sizeof(buffer) || file->Read((UByte*)buffer, size) != size)
+        return false;
+    buffer[size] = 0;
+    *str = buffer;
+    return true;
+}
+
+static void writeHeader(File* file, const HIDDeviceDesc& desc)
+{
+    file->WriteUInt32(HIDCapture_Magic);
+    file->WriteUInt32(HIDCapture_Version);
+    file->WriteUInt16(desc.VendorId);
+    file->WriteUInt16(desc.ProductId);
+    file->WriteUInt16(desc.VersionNumber);
+    file->WriteUInt16(desc.Usage);
+    file->WriteUInt16(desc.UsagePage);
+    writeString(file, desc.Manufacturer);
+    writeString(file, desc.Product);
+    writeString(file, desc.SerialNumber);
+}
+
+static bool readHeader(File* file, HIDDeviceDesc* desc)
+{
+    if (!file->IsValid() ||
+        file->ReadUInt32() != HIDCapture_Magic ||
+        file->ReadUInt32() != HIDCapture_Version)
+        return false;
+
+    desc->VendorId      = file->ReadUInt16();
+    desc->ProductId     = file->ReadUInt16();
+    desc->VersionNumber = file->ReadUInt16();
+    desc->Usage         = file->ReadUInt16();
+    desc->UsagePage     = file->ReadUInt16();
+    return readString(file, &desc->Manufacturer) &&
+           readString(file, &desc->Product) &&
+           readString(file, &desc->SerialNumber);
+}
+
+// Size of the fixed part of a record: type, time and length.
+static const int RecordHeaderSize = 1 + 8 + 2;
+
+struct CaptureRecord
+{
+    UByte   Type;
+    UInt64  TimeMks;
+    UInt32  Size;
+    UByte   Data[HIDCapture_MaxReportSize];
+};
+
+// Reads the next record; returns false at the end of the file or on a damaged record.
+static bool readRecord(File* file, SInt64 fileLength, CaptureRecord* record)
+{
+    if (file->LTell() + RecordHeaderSize > fileLength)
+        return false;
+
+    record->Type    = file->ReadUByte();
+    record->TimeMks = file->ReadUInt64();
+    record->Size    = file->ReadUInt16();
+
+    if (record->Size > HIDCapture_MaxReportSize)
+        return false;
+    return file->Read(record->Data, (int)record->Size) == (int)record->Size;
+}
+
+
+//-------------------------------------------------------------------------------------
+// ***** CaptureHIDDevice
+
+// Passes calls through to the real device, reporting what it reads to the capture
+// manager. Devices handed out by Open also stand in as the real device's handler.
+class CaptureHIDDevice : public HIDDevice, public HIDDevice::HIDHandler
+{
+    friend class CaptureHIDDeviceManager;
+public:
+    CaptureHIDDevice(CaptureHIDDeviceManager* manager, HIDDevice* device,
+                     const String& path, bool opened)
+        : pManager(manager), pDevice(device), DevicePath(path), Opened(opened), Captured(false)
+    {
+        if (Opened)
+            pDevice->SetHandler(this);
+    }
+
+    ~CaptureHIDDevice()
+    {
+        if (Opened)
+            pDevice->SetHandler(NULL);
+    }
+
+    virtual bool SetFeatureReport(UByte* data, UInt32 length)
+    {
+        return pDevice->SetFeatureReport(data, length);
+    }
+
+    virtual bool GetFeatureReport(UByte* data, UInt32 length)
+    {
+        if (!pDevice->GetFeatureReport(data, length))
+            return false;
+        pManager->record(this, HIDCapture_FeatureReport, data, length);
+        return true;
+    }
+
+    // HIDHandler implementation, forwarding to our own handler.
+    virtual void OnInputReport(UByte* pData, UInt32 length)
+    {
+        if (Captured)
+            pManager->record(this, HIDCapture_InputReport, pData, length);
+        if (Handler)
+            Handler->OnInputReport(pData, length);
+    }
+
+    virtual void OnInputReports(UByte* pData, UInt32 stride, const UInt32* lengths, UInt32 count)
+    {
+        if (Captured)
+        {
+            for (UInt32 i = 0; i < count; i++)
+                pManager->record(this, HIDCapture_InputReport, pData + i * stride, lengths[i]);
+        }
+        if (Handler)
+            Handler->OnInputReports(pData, stride, lengths, count);
+    }
+
+    virtual UInt64 OnTicks(UInt64 ticksMks)
+    {
+        if (Handler)
+            return Handler->OnTicks(ticksMks);
+        return HIDDevice::HIDHandler::OnTicks(ticksMks);
+    }
+
+    virtual void OnDeviceMessage(HIDDeviceMessageType messageType)
+    {
+        if (Handler)
+            Handler->OnDeviceMessage(messageType);
+    }
+
+private:
+    Ptr<CaptureHIDDeviceManager>    pManager;
+    Ptr<HIDDevice>                  pDevice;
+    String                          DevicePath;
+    bool                            Opened;
+    bool                            Captured;
+};
+
+// Remembers every enumerated device and wraps it so that feature reports read by
+// the factories during detection end up in the capture.
+class CaptureEnumerateVisitor : public HIDEnumerateVisitor
+{
+public:
+    CaptureEnumerateVisitor(CaptureHIDDeviceManager* manager, HIDEnumerateVisitor* visitor,
+                            Hash<String, CaptureHIDDeviceManager::PendingDevice, String::HashFunctor>* pending)
+        : pManager(manager), pVisitor(visitor), pPending(pending) { }
+
+    virtual bool MatchVendorProduct(UInt16 vendorId, UInt16 productId)
+    {
+        return pVisitor->MatchVendorProduct(vendorId, productId);
+    }
+
+    virtual void Visit(HIDDevice& device, const HIDDeviceDesc& desc)
+    {
+        if (!pPending->Get(desc.Path))
+        {
+            CaptureHIDDeviceManager::PendingDevice pending;
+            pending.Desc = desc;
+            pPending->Add(desc.Path, pending);
+        }
+
+        Ptr<CaptureHIDDevice> wrapper = *new CaptureHIDDevice(pManager, &device, desc.Path, false);
+        pVisitor->Visit(*wrapper, desc);
+    }
+
+private:
+    CaptureHIDDeviceManager*    pManager;
+    HIDEnumerateVisitor*        pVisitor;
+    Hash<String, CaptureHIDDeviceManager::PendingDevice, String::HashFunctor>* pPending;
+};
+
+
+//-------------------------------------------------------------------------------------
+// ***** CaptureHIDDeviceManager
+
+CaptureHIDDeviceManager::CaptureHIDDeviceManager(HIDDeviceManager* manager, const String& path)
+    : pManager(manager), Path(path), StartTicks(0), RecordCount(0)
+{
+}
+
+CaptureHIDDeviceManager::~CaptureHIDDeviceManager()
+{
+    if (pFile)
+    {
+        pFile->Close();
+        LogText("OVR::CaptureHIDDeviceManager - wrote %d records to '%s'.\n",
+                RecordCount, Path.ToCStr());
+    }
+}
+
+bool CaptureHIDDeviceManager::Enumerate(HIDEnumerateVisitor* enumVisitor)
+{
+    Lock::Locker scopeLock(&CaptureLock);
+    CaptureEnumerateVisitor visitor(this, enumVisitor, &Pending);
+    return pManager->Enumerate(&visitor);
+}
+
+HIDDevice* CaptureHIDDeviceManager::Open(const String& path)
+{
+    Ptr<HIDDevice> device = *pManager->Open(path);
+    if (!device)
+        return NULL;
+
+    CaptureHIDDevice* wrapper = new CaptureHIDDevice(this, device, path, true);
+
+    // Only the first device opened is captured; the file format holds one device.
+    Lock::Locker scopeLock(&CaptureLock);
+    if (!pFile)
+    {
+        const PendingDevice* pending = Pending.Get(path);
+        if (pending && beginCapture(*pending))
+            wrapper->Captured = true;
+    }
+    return wrapper;
+}
+
+bool CaptureHIDDeviceManager::beginCapture(const PendingDevice& device)
+{
+    Ptr<File> file = *new SysFile(Path, File::Open_Write | File::Open_Create |
+                                        File::Open_Truncate | File::Open_Buffered);
+    if (!file->IsValid())
+    {
+        LogError("OVR::CaptureHIDDeviceManager - unable to create '%s'.\n", Path.ToCStr());
+        return false;
+    }
+
+    pFile        = file;
+    CapturedPath = device.Desc.Path;
+    StartTicks   = Timer::GetTicks();
+    writeHeader(pFile, device.Desc);
+
+    for (UPInt i = 0; i < device.FeatureReports.GetSize(); i++)
+    {
+        const Array<UByte>& report = device.FeatureReports[i];
+        writeRecord(HIDCapture_FeatureReport, 0, &report[0], (UInt32)report.GetSize());
+    }
+
+    LogText("OVR::CaptureHIDDeviceManager - capturing '%s' to '%s'.\n",
+            device.Desc.Product.ToCStr(), Path.ToCStr());
+    return true;
+}
+
+void CaptureHIDDeviceManager::record(CaptureHIDDevice* device, HIDCaptureRecordType type,
+                                     const UByte* data, UInt32 length)
+{
+    if (length == 0 || length > HIDCapture_MaxReportSize)
+        return;
+
+    Lock::Locker scopeLock(&CaptureLock);
+
+    if (pFile && device->DevicePath == CapturedPath)
+    {
+        writeRecord(type, Timer::GetTicks() - StartTicks, data, length);
+    }
+    else if (type == HIDCapture_FeatureReport)
+    {
+        // Keep configuration read before the device is opened, so that the
+        // replayed device can answer the same queries.
+        PendingDevice* pending = Pending.Get(device->DevicePath);
+        if (pending)
+        {
+            Array<UByte> report;
+            report.Resize(length);
+            memcpy(&report[0], data, length);
+            pending->FeatureReports.PushBack(report);
+        }
+    }
+}
+
+void CaptureHIDDeviceManager::writeRecord(HIDCaptureRecordType type, UInt64 timeMks,
+                                          const UByte* data, UInt32 length)
+{
+    pFile->WriteUByte((UByte)type);
+    pFile->WriteUInt64(timeMks);
+    pFile->WriteUInt16((UInt16)length);
+    pFile->Write(data, (int)length);
+    RecordCount++;
+}
+
+
+//-------------------------------------------------------------------------------------
+// ***** ReplayHIDDevice
+
+class ReplayFeed;
+
+// Virtual device backed by ReplayHIDDeviceManager. Opened instances own a feed
+// thread that pushes the recorded input reports to the manager thread.
+class ReplayHIDDevice : public HIDDevice
+{
+public:
+    ReplayHIDDevice(ReplayHIDDeviceManager* manager)
+        : pManager(manager) { }
+    ~ReplayHIDDevice();
+
+    bool StartFeed();
+
+    virtual bool SetFeatureReport(UByte* data, UInt32 length)
+    {
+        return pManager->setFeatureReport(data, length);
+    }
+
+    virtual bool GetFeatureReport(UByte* data, UInt32 length)
+    {
+        return pManager->getFeatureReport(data, length);
+    }
+
+    // Called on the manager thread by the feed.
+    void DeliverInputReport(UByte* data, UInt32 length)
+    {
+        if (Handler)
+            Handler->OnInputReport(data, length);
+    }
+
+    void DeliverRemoved()
+    {
+        if (Handler)
+            Handler->OnDeviceMessage(HIDHandler::HIDDeviceMessage_DeviceRemoved);
+    }
+
+private:
+    Ptr<ReplayHIDDeviceManager> pManager;
+    Ptr<ReplayFeed>             pFeed;
+};
+
+// Input report copied into a queued command.
+struct ReplayReport
+{
+    UByte   Data[HIDCapture_MaxReportSize];
+    UInt32  Size;
+};
+
+// Reads input reports from the capture file and queues them for delivery on the
+// manager thread. Pushing blocks once the command queue is full, so in max-speed
+// mode the feed runs exactly as fast as the sensor processing consumes it.
+class ReplayFeed : public Thread
+{
+public:
+    ReplayFeed(ReplayHIDDeviceManager* manager, ReplayHIDDevice* device)
+        : pManager(manager), pDevice(device) { }
+
+    // Called when the device goes away; queued reports are dropped from then on.
+    void Detach()
+    {
+        Lock::Locker scopeLock(&DeviceLock);
+        pDevice = NULL;
+        SetExitFlag(true);
+    }
+
+    virtual int Run()
+    {
+        SetThreadName("OVR::ReplayFeed");
+
+        Ptr<File>       file = *new SysFile(pManager->Path);
+        SInt64          fileLength = file->LGetLength();
+        HIDDeviceDesc   desc;
+        if (!readHeader(file, &desc))
+            return 1;
+
+        ThreadCommandQueue* queue = pManager->pQueue;
+        UInt64              startTicks = Timer::GetTicks();
+        UInt32              reportCount = 0;
+        CaptureRecord       record;
+
+        while (!GetExitFlag() && readRecord(file, fileLength, &record))
+        {
+            if (record.Type != HIDCapture_InputReport)
+                continue;
+
+            if (pManager->RealTime)
+            {
+                UInt64 elapsedMks = Timer::GetTicks() - startTicks;
+                if (record.TimeMks > elapsedMks + 1000)
+                    MSleep((unsigned)((record.TimeMks - elapsedMks) / 1000));
+            }
+
+            ReplayReport report;
+            memcpy(report.Data, record.Data, record.Size);
+            report.Size = record.Size;
+
+            // Reference is released by deliver once the command has run.
+            AddRef();
+            if (!queue->PushCall(this, &ReplayFeed::deliver, report))
+            {
+                Release();
+                return 1;
+            }
+            reportCount++;
+        }
+
+        if (!GetExitFlag())
+        {
+            LogText("OVR::ReplayHIDDevice - replayed %d reports in %.3f s.\n",
+                    reportCount, Timer::TicksToSeconds(Timer::GetTicks() - startTicks));
+
+            AddRef();
+            if (!queue->PushCall(this, &ReplayFeed::finish))
+                Release();
+        }
+        return 0;
+    }
+
+private:
+    Void deliver(const ReplayReport& report)
+    {
+        {
+            Lock::Locker scopeLock(&DeviceLock);
+            if (pDevice)
+                pDevice->DeliverInputReport(const_cast<UByte*>(report.Data), report.Size);
+        }
+        Release();
+        return 0;
+    }
+
+    Void finish()
+    {
+        {
+            Lock::Locker scopeLock(&DeviceLock);
+            if (pDevice)
+                pDevice->DeliverRemoved();
+        }
+        Release();
+        return 0;
+    }
+
+    Ptr<ReplayHIDDeviceManager> pManager;
+    Lock                        DeviceLock;
+    ReplayHIDDevice*            pDevice;
+};
+
+ReplayHIDDevice::~ReplayHIDDevice()
+{
+    if (pFeed)
+        pFeed->Detach();
+}
+
+bool ReplayHIDDevice::StartFeed()
+{
+    pFeed = *new ReplayFeed(pManager, this);
+    return pFeed->Start();
+}
+
+
+//-------------------------------------------------------------------------------------
+// ***** ReplayHIDDeviceManager
+
+ReplayHIDDeviceManager::ReplayHIDDeviceManager(ThreadCommandQueue* queue,
+                                               const String& path, bool realTime)
+    : pQueue(queue), Path(path), RealTime(realTime), Valid(false)
+{
+    Ptr<File> file = *new SysFile(Path);
+    if (!readHeader(file, &Desc))
+    {
+        LogError("OVR::ReplayHIDDeviceManager - '%s' is not a HID capture.\n", Path.ToCStr());
+        return;
+    }
+    Desc.Path = String("replay:") + Path;
+
+    // Preload the recorded feature reports; the first one of each id is the
+    // configuration the device reported when it was detected.
+    SInt64          fileLength = file->LGetLength();
+    CaptureRecord   record;
+    while (readRecord(file, fileLength, &record))
+    {
+        if (record.Type != HIDCapture_FeatureReport || FeatureReports.Get(record.Data[0]))
+            continue;
+
+        Array<UByte> report;
+        report.Resize(record.Size);
+        memcpy(&report[0], record.Data, record.Size);
+        FeatureReports.Add(record.Data[0], report);
+    }
+
+    Valid = true;
+    LogText("OVR::ReplayHIDDeviceManager - replaying '%s' from '%s'.\n",
+            Desc.Product.ToCStr(), Path.ToCStr());
+}
+
+bool ReplayHIDDeviceManager::Enumerate(HIDEnumerateVisitor* enumVisitor)
+{
+    if (!Valid)
+        return false;
+
+    if (enumVisitor->MatchVendorProduct(Desc.VendorId, Desc.ProductId))
+    {
+        Ptr<ReplayHIDDevice> device = *new ReplayHIDDevice(this);
+        enumVisitor->Visit(*device, Desc);
+    }
+    return true;
+}
+
+HIDDevice* ReplayHIDDeviceManager::Open(const String& path)
+{
+    if (!Valid || path != Desc.Path)
+        return NULL;
+
+    ReplayHIDDevice* device = new ReplayHIDDevice(this);
+    if (!device->StartFeed())
+    {
+        device->Release();
+        return NULL;
+    }
+    return device;
+}
+
+bool ReplayHIDDeviceManager::getFeatureReport(UByte* data, UInt32 length)
+{
+    Lock::Locker scopeLock(&ReportLock);
+
+    const Array<UByte>* report = FeatureReports.Get(data[0]);
+    if (!report)
+        return false;
+
+    memcpy(data, &(*report)[0], Alg::Min((UInt32)report->GetSize(), length));
+    return true;
+}
+
+bool ReplayHIDDeviceManager::setFeatureReport(const UByte* data, UInt32 length)
+{
+    if (length == 0)
+        return false;
+
+    Lock::Locker scopeLock(&ReportLock);
+
+    // Keep what the client configured so that reading it back is consistent.
+    Array<UByte> report;
+    report.Resize(length);
+    memcpy(&report[0], data, length);
+    FeatureReports.Set(data[0], report);
+    return true;
+}
+
+} // namespace OVR
@@ -0,0 +1,144 @@
+/************************************************************************************
+
+Filename    :   OVR_HIDCapture.h
+Content     :   HIDDeviceManager wrappers that record live HID reports to a file
+                and replay them later as a virtual device.
+Created     :   October 18, 2026
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*************************************************************************************/
+
+#ifndef OVR_HIDCapture_h
+#define OVR_HIDCapture_h
+
+#include "OVR_HIDDevice.h"
+#include "Kernel/OVR_Array.h"
+#include "Kernel/OVR_Hash.h"
+#include "Kernel/OVR_File.h"
+#include "Kernel/OVR_Threads.h"
+
+namespace OVR {
+
+class ThreadCommandQueue;
+class CaptureHIDDevice;
+
+// A capture file holds the HIDDeviceDesc of a single device followed by the raw
+// reports it produced, each stamped with microseconds since capture start:
+//
+//   Header : UInt32 Magic, UInt32 Version, VendorId, ProductId, VersionNumber,
+//            Usage, UsagePage (UInt16 each), Manufacturer, Product, SerialNumber
+//            (UInt16 length + bytes each).
+//   Record : UByte Type, UInt64 TimeMks, UInt16 Length, Length bytes.
+//
+// Feature reports seen while the device was enumerated and opened are recorded
+// too, so that a replayed device answers the same configuration queries.
+
+enum HIDCaptureRecordType
+{
+    HIDCapture_InputReport   = 0,
+    HIDCapture_FeatureReport = 1
+};
+
+enum
+{
+    HIDCapture_Magic         = 0x4850564F, // "OVPH"
+    HIDCapture_Version       = 1,
+    HIDCapture_MaxReportSize = 64
+};
+
+
+//-------------------------------------------------------------------------------------
+// ***** CaptureHIDDeviceManager
+
+// Wraps the platform HIDDeviceManager, passing everything through while recording
+// the reports of the first device that gets opened into a capture file.
+class CaptureHIDDeviceManager : public HIDDeviceManager
+{
+    friend class CaptureHIDDevice;
+    friend class CaptureEnumerateVisitor;
+public:
+    CaptureHIDDeviceManager(HIDDeviceManager* manager, const String& path);
+    ~CaptureHIDDeviceManager();
+
+    virtual bool        Enumerate(HIDEnumerateVisitor* enumVisitor);
+    virtual HIDDevice*  Open(const String& path);
+
+private:
+    // Devices seen during enumeration, with the feature reports read from them
+    // before any of them was opened.
+    struct PendingDevice
+    {
+        HIDDeviceDesc           Desc;
+        Array<Array<UByte> >    FeatureReports;
+    };
+
+    void    record(CaptureHIDDevice* device, HIDCaptureRecordType type,
+                   const UByte* data, UInt32 length);
+    void    writeRecord(HIDCaptureRecordType type, UInt64 timeMks,
+                        const UByte* data, UInt32 length);
+    bool    beginCapture(const PendingDevice& device);
+
+    Ptr<HIDDeviceManager>           pManager;
+    String                          Path;
+    Lock                            CaptureLock;
+    Ptr<File>                       pFile;
+    String                          CapturedPath;
+    UInt64                          StartTicks;
+    UInt32                          RecordCount;
+    Hash<String, PendingDevice, String::HashFunctor> Pending;
+};
+
+
+//-------------------------------------------------------------------------------------
+// ***** ReplayHIDDeviceManager
+
+// Exposes a single virtual HID device that plays back a capture file. Input reports
+// are delivered on the device manager thread either at their recorded pace or as
+// fast as the consumer keeps up; feature reports are answered from the recorded
+// copies. Once the file is exhausted the device reports itself as removed.
+class ReplayHIDDeviceManager : public HIDDeviceManager
+{
+    friend class ReplayHIDDevice;
+    friend class ReplayFeed;
+public:
+    ReplayHIDDeviceManager(ThreadCommandQueue* queue, const String& path, bool realTime);
+
+    // Returns false if the capture file could not be opened or has a bad header.
+    bool                IsValid() const { return Valid; }
+
+    virtual bool        Enumerate(HIDEnumerateVisitor* enumVisitor);
+    virtual HIDDevice*  Open(const String& path);
+
+private:
+    bool    getFeatureReport(UByte* data, UInt32 length);
+    bool    setFeatureReport(const UByte* data, UInt32 length);
+
+    ThreadCommandQueue*             pQueue;
+    String                          Path;
+    bool                            RealTime;
+    bool                            Valid;
+    HIDDeviceDesc                   Desc;
+    Lock                            ReportLock;
+    // Latest feature report contents, keyed by report id (first byte).
+    Hash<UByte, Array<UByte> >      FeatureReports;
+};
+
+} // namespace OVR
+
+#endif
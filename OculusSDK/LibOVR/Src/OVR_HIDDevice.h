@@ -90,6 +90,10 @@ public:
     // Open a HID device with the specified path.
     virtual HIDDevice* Open(const String& path) = 0;
 
+    // Stops watching for devices being added or removed. Must be called before
+    // the last reference to a manager created by a DeviceManager is released.
+    virtual void Shutdown() { }
+
 protected:
     HIDDeviceManager()
     { }
@@ -129,6 +133,14 @@ public:
         virtual void OnInputReport(UByte* pData, UInt32 length)
         { OVR_UNUSED2(pData, length); }
 
+        // Called with several input reports read in one wakeup, stored 'stride'
+        // bytes apart. By default they are passed to OnInputReport one by one.
+        virtual void OnInputReports(UByte* pData, UInt32 stride, const UInt32* lengths, UInt32 count)
+        {
+            for (UInt32 i = 0; i < count; i++)
+                OnInputReport(pData + i * stride, lengths[i]);
+        }
+
         virtual UInt64 OnTicks(UInt64 ticksMks)
         { OVR_UNUSED1(ticksMks);  return Timer::MksPerSecond * 1000; ; }
 
@@ -62,784 +62,779 @@ limitations under the License.
 
 namespace OVR {
 
+// Parse the input text into an un-escaped cstring, and populate item.
+static const unsigned char firstByteMark[7] = { 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC };
 
-//-----------------------------------------------------------------------------
-// Create a new copy of a string
-static char* JSON_strdup(const char* str)
+// Helper to assign error sting and return 0.
+const char* AssignError(const char** perror, const char *errorMessage)
 {
-    UPInt len  = OVR_strlen(str) + 1;
-    char* copy = (char*)OVR_ALLOC(len);
-    if (!copy)
-        return 0;
-    memcpy(copy, str, len);
-    return copy;
+    if (perror)
+        *perror = errorMessage;
+    return 0;
+}
+
+// Parses a hex string up to the specified number of digits.
+// Returns the first character after the string.
+static const char* ParseHex(unsigned* val, unsigned digits, const char* str, const char* end)
+{
+    *val = 0;
+
+    for(unsigned digitCount = 0; (digitCount < digits) && (str < end); digitCount++, str++)
+    {
+        unsigned v = *str;
+
+        if ((v >= '0') && (v <= '9'))
+            v -= '0';
+        else if ((v >= 'a') && (v <= 'f'))
+            v = 10 + v - 'a';
+        else if ((v >= 'A') && (v <= 'F'))
+            v = 10 + v - 'A';
+        else
+            break;
+
+        *val = *val * 16 + v;
+    }
+
+    return str;
 }
 
 
 //-----------------------------------------------------------------------------
-// Render the number from the given item into a string.
-static char* PrintNumber(double d)
+// ***** JSONReader
+
+JSONReader::TextBuffer::~TextBuffer()
 {
-	char *str;
-	//double d=item->valuedouble;
-    int valueint = (int)d;
-	if (fabs(((double)valueint)-d)<=DBL_EPSILON && d<=INT_MAX && d>=INT_MIN)
-	{
-		str=(char*)OVR_ALLOC(21);	// 2^64+1 can be represented in 21 chars.
-		if (str)
-            OVR_sprintf(str, 21, "%d", valueint);
-	}
-	else
-	{
-		str=(char*)OVR_ALLOC(64);	// This is a nice tradeoff.
-		if (str)
-		{
-			if (fabs(floor(d)-d)<=DBL_EPSILON && fabs(d)<1.0e60)
-                OVR_sprintf(str, 64, "%.0f", d);
-			else if (fabs(d)<1.0e-6 || fabs(d)>1.0e9)
-                OVR_sprintf(str, 64, "%e", d);
-			else
-                OVR_sprintf(str, 64, "%f", d);
-		}
-	}
-	return str;
+    if (pData != Local)
+        OVR_FREE(pData);
 }
 
-// Parse the input text into an un-escaped cstring, and populate item.
-static const unsigned char firstByteMark[7] = { 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC };
+// Makes room for size characters and a terminating null.
+char* JSONReader::TextBuffer::Reserve(UPInt size)
+{
+    if (size >= Capacity)
+    {
+        UPInt capacity = Capacity;
+        while (size >= capacity)
+            capacity *= 2;
 
-// Helper to assign error sting and return 0.
-const char* AssignError(const char** perror, const char *errorMessage)
+        char* data = (char*)OVR_ALLOC(capacity);
+        if (!data)
+            return 0;
+        if (pData != Local)
+            OVR_FREE(pData);
+        pData    = data;
+        Capacity = capacity;
+    }
+    return pData;
+}
+
+void JSONReader::TextBuffer::Assign(const char* data, UPInt size)
 {
-    if (perror)
-        *perror = errorMessage;
-    return 0;
+    if (!Reserve(size))
+        size = 0;
+    memcpy(pData, data, size);
+    pData[size] = 0;
+    Size        = size;
 }
 
-//-----------------------------------------------------------------------------
-// ***** JSON Node class
 
-JSON::JSON(JSONItemType itemType)
-    : Type(itemType), dValue(0.0)
+JSONReader::JSONReader(const char* data, UPInt size)
+    : pCur(data), pEnd(data ? data + size : data), Token(JSONToken_None), State(State_Value),
+      Number(0.0), pError(0), Depth(0)
 {
+    memset(ObjectBits, 0, sizeof(ObjectBits));
 }
 
-JSON::~JSON()
+JSONToken JSONReader::Next()
 {
-    JSON* child = Children.GetFirst();
-    while (!Children.IsNull(child))
+    if ((Token == JSONToken_Error) || (State == State_Done))
+        return Token;
+
+    skipSpace();
+
+    switch (State)
     {
-        child->RemoveNode();
-        child->Release();
-        child = Children.GetFirst();
+    case State_Value:
+        return readValue();
+
+    case State_FirstMember:
+        if (cur() == '}')
+        {
+            pCur++;
+            return endContainer(JSONToken_EndObject);
+        }
+        return readName();
+
+    case State_FirstElement:
+        if (cur() == ']')
+        {
+            pCur++;
+            return endContainer(JSONToken_EndArray);
+        }
+        return readValue();
+
+    case State_AfterName:
+        if (cur() != ':')
+            return fail("Syntax Error: Missing colon");
+        pCur++;
+        skipSpace();
+        return readValue();
+
+    case State_AfterValue:
+        if (Depth == 0)
+        {
+            // Anything after the top-level value is ignored.
+            State = State_Done;
+            return Token = JSONToken_End;
+        }
+        if (cur() == ',')
+        {
+            pCur++;
+            skipSpace();
+            return inObject() ? readName() : readValue();
+        }
+        if (inObject())
+        {
+            if (cur() != '}')
+                return fail("Syntax Error: Missing closing brace");
+            pCur++;
+            return endContainer(JSONToken_EndObject);
+        }
+        if (cur() != ']')
+            return fail("Syntax Error: Missing ending bracket");
+        pCur++;
+        return endContainer(JSONToken_EndArray);
+
+    case State_Done:
+        break;
     }
+    return Token;
 }
 
-//-----------------------------------------------------------------------------
-// Parse the input text to generate a number, and populate the result into item
-// Returns the text position after the parsed number
-const char* JSON::parseNumber(const char *num)
+JSONToken JSONReader::SkipValue()
 {
-    const char* num_start = num;
+    if ((Token == JSONToken_BeginObject) || (Token == JSONToken_BeginArray))
+    {
+        int depth = Depth - 1;
+        while ((Next() != JSONToken_Error) && (Depth > depth))
+        { }
+    }
+    return Token;
+}
+
+JSONToken JSONReader::readValue()
+{
+    const UPInt remaining = pEnd - pCur;
+
+    switch (cur())
+    {
+    case '{':
+        pCur++;
+        return beginContainer(true);
+    case '[':
+        pCur++;
+        return beginContainer(false);
+
+    case '\"':
+        if (!readString(&ValueText))
+            return Token;
+        Number = 0.0;
+        State  = State_AfterValue;
+        return Token = JSONToken_String;
+
+    case '-': case '0': case '1': case '2': case '3':
+    case '4': case '5': case '6': case '7': case '8': case '9':
+        return readNumber();
+
+    case 'n':
+        if ((remaining < 4) || strncmp(pCur, "null", 4))
+            break;
+        pCur  += 4;
+        ValueText.Assign("", 0);
+        Number = 0.0;
+        State  = State_AfterValue;
+        return Token = JSONToken_Null;
+
+    case 't':
+        if ((remaining < 4) || strncmp(pCur, "true", 4))
+            break;
+        pCur  += 4;
+        ValueText.Assign("true", 4);
+        Number = 1.0;
+        State  = State_AfterValue;
+        return Token = JSONToken_Bool;
+
+    case 'f':
+        if ((remaining < 5) || strncmp(pCur, "false", 5))
+            break;
+        pCur  += 5;
+        ValueText.Assign("false", 5);
+        Number = 0.0;
+        State  = State_AfterValue;
+        return Token = JSONToken_Bool;
+    }
+
+    return fail("Syntax Error: Invalid syntax");
+}
+
+JSONToken JSONReader::readName()
+{
+    if (cur() != '\"')
+        return fail("Syntax Error: Missing quote");
+    if (!readString(&NameText))
+        return Token;
+    State = State_AfterName;
+    return Token = JSONToken_Name;
+}
+
+// Parse the input text to generate a number; the text is kept as written.
+JSONToken JSONReader::readNumber()
+{
+    const char* start = pCur;
     double      n=0, sign=1, scale=0;
     int         subscale     = 0,
                 signsubscale = 1;
 
-	// Could use sscanf for this?
-	if (*num=='-') 
-        sign=-1,num++;	// Has sign?
-	if (*num=='0')
-        num++;			// is zero
-	
-    if (*num>='1' && *num<='9')	
+    if (cur()=='-')
+        sign=-1, pCur++;    // Has sign?
+    if (cur()=='0')
+        pCur++;             // is zero
+
+    if (cur()>='1' && cur()<='9')
     {
         do
-        {   
-            n=(n*10.0)+(*num++ -'0');
+        {
+            n=(n*10.0)+(*pCur++ -'0');
         }
-        while (*num>='0' && *num<='9');	// Number?
+        while (cur()>='0' && cur()<='9');  // Number?
     }
 
-	if (*num=='.' && num[1]>='0' && num[1]<='9')
+    if (cur()=='.' && (pCur + 1 < pEnd) && pCur[1]>='0' && pCur[1]<='9')
     {
-        num++;
+        pCur++;
         do
         {
-            n=(n*10.0)+(*num++ -'0');
+            n=(n*10.0)+(*pCur++ -'0');
             scale--;
         }
-        while (*num>='0' && *num<='9');  // Fractional part?
+        while (cur()>='0' && cur()<='9');  // Fractional part?
     }
 
-	if (*num=='e' || *num=='E')		// Exponent?
-	{
-        num++;
-        if (*num=='+')
-            num++;
-        else if (*num=='-')
+    if (cur()=='e' || cur()=='E')  // Exponent?
+    {
+        pCur++;
+        if (cur()=='+')
+            pCur++;
+        else if (cur()=='-')
         {
             signsubscale=-1;
-            num++;		// With sign?
+            pCur++;     // With sign?
         }
 
-		while (*num>='0' && *num<='9')
-            subscale=(subscale*10)+(*num++ - '0');	// Number?
-	}
+        while (cur()>='0' && cur()<='9')
+            subscale=(subscale*10)+(*pCur++ - '0');    // Number?
+    }
 
     // Number = +/- number.fraction * 10^+/- exponent
-	n = sign*n*pow(10.0,(scale+subscale*signsubscale));
-
-    // Assign parsed value.
-	Type   = JSON_Number;
-    dValue = n;
-    Value.AssignString(num_start, num - num_start);
-    
-	return num;
+    Number = sign*n*pow(10.0,(scale+subscale*signsubscale));
+    ValueText.Assign(start, pCur - start);
+    State  = State_AfterValue;
+    return Token = JSONToken_Number;
 }
 
-// Parses a hex string up to the specified number of digits.
-// Returns the first character after the string.
-const char* ParseHex(unsigned* val, unsigned digits, const char* str)
+// Reads the quoted string at pCur into text, decoding escapes.
+bool JSONReader::readString(TextBuffer* text)
 {
-    *val = 0;
+    OVR_ASSERT(cur() == '\"');
+    const char* start = ++pCur;
+    const char* ptr   = start;
+    bool        escaped = false;
 
-    for(unsigned digitCount = 0; digitCount < digits; digitCount++, str++)
+    // Find the closing quote; the decoded text is never longer than the source.
+    while ((ptr < pEnd) && (*ptr != '\"'))
     {
-        unsigned v = *str;
-
-        if ((v >= '0') && (v <= '9'))
-            v -= '0';
-        else if ((v >= 'a') && (v <= 'f'))
-            v = 10 + v - 'a';
-        else if ((v >= 'A') && (v <= 'F'))
-            v = 10 + v - 'A';
-        else
-            break;
-
-        *val = *val * 16 + v;
+        if (*ptr++ == '\\')
+        {
+            escaped = true;
+            ptr++;
+        }
+    }
+    if (ptr >= pEnd)
+    {
+        fail("Syntax Error: Missing closing quote");
+        return false;
     }
 
-    return str;
-}
+    const char* end = ptr;
+    pCur = end + 1;
 
-//-----------------------------------------------------------------------------
-// Parses the input text into a string item and returns the text position after
-// the parsed string
-const char* JSON::parseString(const char* str, const char** perror)
-{
-	const char* ptr = str+1;
-    const char* p;
-    char*       ptr2;
-    char*       out;
-    int         len=0;
-    unsigned    uc, uc2;
-	
-    if (*str!='\"')
+    if (!escaped)
     {
-        return AssignError(perror, "Syntax Error: Missing quote");
+        text->Assign(start, end - start);
+        return true;
     }
-	
-	while (*ptr!='\"' && *ptr && ++len)
-    {   
-        if (*ptr++ == '\\') ptr++;	// Skip escaped quotes.
+
+    char* out = text->Reserve(end - start);
+    if (!out)
+    {
+        fail("Error: Failed to allocate memory");
+        return false;
     }
-	
-    // This is how long we need for the string, roughly.
-	out=(char*)OVR_ALLOC(len+1);
-	if (!out)
-        return 0;
-	
-	ptr = str+1;
-    ptr2= out;
 
-	while (*ptr!='\"' && *ptr)
-	{
-		if (*ptr!='\\')
+    char* ptr2 = out;
+    unsigned uc, uc2;
+    int      len;
+    const char* p;
+
+    ptr = start;
+    while (ptr < end)
+    {
+        if (*ptr!='\\')
         {
             *ptr2++ = *ptr++;
+            continue;
         }
-		else
-		{
-			ptr++;
-			switch (*ptr)
-			{
-				case 'b': *ptr2++ = '\b';	break;
-				case 'f': *ptr2++ = '\f';	break;
-				case 'n': *ptr2++ = '\n';	break;
-				case 'r': *ptr2++ = '\r';	break;
-				case 't': *ptr2++ = '\t';	break;
-
-                // Transcode utf16 to utf8.
-                case 'u':
-
-                    // Get the unicode char.
-                    p = ParseHex(&uc, 4, ptr + 1);
+
+        ptr++;
+        switch (*ptr)
+        {
+            case 'b': *ptr2++ = '\b';   break;
+            case 'f': *ptr2++ = '\f';   break;
+            case 'n': *ptr2++ = '\n';   break;
+            case 'r': *ptr2++ = '\r';   break;
+            case 't': *ptr2++ = '\t';   break;
+
+            // Transcode utf16 to utf8.
+            case 'u':
+
+                // Get the unicode char.
+                p = ParseHex(&uc, 4, ptr + 1, end);
+                if (ptr != p)
+                    ptr = p - 1;
+
+                if ((uc>=0xDC00 && uc<=0xDFFF) || uc==0)
+                    break;  // Check for invalid.
+
+                // UTF16 surrogate pairs.
+                if (uc>=0xD800 && uc<=0xDBFF)
+                {
+                    if ((ptr + 2 >= end) || ptr[1]!='\\' || ptr[2]!='u')
+                        break;  // Missing second-half of surrogate.
+
+                    p = ParseHex(&uc2, 4, ptr + 3, end);
                     if (ptr != p)
                         ptr = p - 1;
 
-					if ((uc>=0xDC00 && uc<=0xDFFF) || uc==0)
-                        break;	// Check for invalid.
-
-                    // UTF16 surrogate pairs.
-					if (uc>=0xD800 && uc<=0xDBFF)
-					{
-						if (ptr[1]!='\\' || ptr[2]!='u')
-                            break;	// Missing second-half of surrogate.
-
-                        p= ParseHex(&uc2, 4, ptr + 3);
-                        if (ptr != p)
-                            ptr = p - 1;
-                        
-						if (uc2<0xDC00 || uc2>0xDFFF)
-                            break;	// Invalid second-half of surrogate.
-
-						uc = 0x10000 + (((uc&0x3FF)<<10) | (uc2&0x3FF));
-					}
-
-					len=4;
-                    
-                    if (uc<0x80)
-                        len=1;
-                    else if (uc<0x800)
-                        len=2;
-                    else if (uc<0x10000)
-                        len=3;
-                    
-                    ptr2+=len;
-					
-					switch (len)
-                    {
-						case 4: *--ptr2 =((uc | 0x80) & 0xBF); uc >>= 6;
-						case 3: *--ptr2 =((uc | 0x80) & 0xBF); uc >>= 6;
-						case 2: *--ptr2 =((uc | 0x80) & 0xBF); uc >>= 6;
-						case 1: *--ptr2 = (char)(uc | firstByteMark[len]);
-					}
-					ptr2+=len;
-					break;
-
-                default:
-                    *ptr2++ = *ptr;
-                    break;
-			}
-			ptr++;
-		}
-	}
-
-	*ptr2 = 0;
-	if (*ptr=='\"')
+                    if (uc2<0xDC00 || uc2>0xDFFF)
+                        break;  // Invalid second-half of surrogate.
+
+                    uc = 0x10000 + (((uc&0x3FF)<<10) | (uc2&0x3FF));
+                }
+
+                len=4;
+
+                if (uc<0x80)
+                    len=1;
+                else if (uc<0x800)
+                    len=2;
+                else if (uc<0x10000)
+                    len=3;
+
+                ptr2+=len;
+
+                switch (len)
+                {
+                    case 4: *--ptr2 =((uc | 0x80) & 0xBF); uc >>= 6;
+                    case 3: *--ptr2 =((uc | 0x80) & 0xBF); uc >>= 6;
+                    case 2: *--ptr2 =((uc | 0x80) & 0xBF); uc >>= 6;
+                    case 1: *--ptr2 = (char)(uc | firstByteMark[len]);
+                }
+                ptr2+=len;
+                break;
+
+            default:
+                *ptr2++ = *ptr;
+                break;
+        }
         ptr++;
-	
-    // Make a copy of the string 
-    Value=out;
-    OVR_FREE(out);
-	Type=JSON_String;
+    }
 
-	return ptr;
+    *ptr2      = 0;
+    text->Size = ptr2 - out;
+    return true;
 }
 
-//-----------------------------------------------------------------------------
-// Render the string provided to an escaped version that can be printed.
-char* PrintString(const char* str)
+JSONToken JSONReader::beginContainer(bool object)
 {
-	const char *ptr;
-    char *ptr2,*out;
-    int len=0;
-    unsigned char token;
-	
-	if (!str)
-        return JSON_strdup("");
-	ptr=str;
-    
-    token=*ptr;
-    while (token && ++len)\
-    {
-        if (strchr("\"\\\b\f\n\r\t",token))
-            len++;
-        else if (token<32) 
-            len+=5;
-        ptr++;
-        token=*ptr;
-    }
-	
-	int buff_size = len+3;
-    out=(char*)OVR_ALLOC(buff_size);
-	if (!out)
-        return 0;
+    if (Depth == MaxDepth)
+        return fail("Syntax Error: Nesting too deep");
 
-	ptr2 = out;
-    ptr  = str;
-	*ptr2++ = '\"';
-
-	while (*ptr)
-	{
-		if ((unsigned char)*ptr>31 && *ptr!='\"' && *ptr!='\\') 
-            *ptr2++=*ptr++;
-		else
-		{
-			*ptr2++='\\';
-			switch (token=*ptr++)
-			{
-				case '\\':	*ptr2++='\\';	break;
-				case '\"':	*ptr2++='\"';	break;
-				case '\b':	*ptr2++='b';	break;
-				case '\f':	*ptr2++='f';	break;
-				case '\n':	*ptr2++='n';	break;
-				case '\r':	*ptr2++='r';	break;
-				case '\t':	*ptr2++='t';	break;
-				default: 
-                    OVR_sprintf(ptr2, buff_size - (ptr2-out), "u%04x",token);
-                    ptr2+=5;
-                    break;	// Escape and print.
-			}
-		}
-	}
-	*ptr2++='\"';
-    *ptr2++=0;
-	return out;
+    UInt32 bit = 1u << (Depth & 31);
+    if (object)
+        ObjectBits[Depth >> 5] |= bit;
+    else
+        ObjectBits[Depth >> 5] &= ~bit;
+    Depth++;
+
+    State = object ? State_FirstMember : State_FirstElement;
+    return Token = object ? JSONToken_BeginObject : JSONToken_BeginArray;
 }
 
-//-----------------------------------------------------------------------------
-// Utility to jump whitespace and cr/lf
-static const char* skip(const char* in)
+JSONToken JSONReader::endContainer(JSONToken token)
 {
-    while (in && *in && (unsigned char)*in<=' ') 
-        in++; 
-    return in;
+    Depth--;
+    State = State_AfterValue;
+    return Token = token;
 }
 
-//-----------------------------------------------------------------------------
-// Parses the supplied buffer of JSON text and returns a JSON object tree
-// The returned object must be Released after use
-JSON* JSON::Parse(const char* buff, const char** perror)
+JSONToken JSONReader::fail(const char* error)
 {
-    const char* end = 0;
-	JSON*       json = new JSON();
-	
-	if (!json)
-    {
-        AssignError(perror, "Error: Failed to allocate memory");
-        return 0;
-    }
- 
-	end = json->parseValue(skip(buff), perror);
-	if (!end)
-    {
-        json->Release();
-        return NULL;
-    }	// parse failure. ep is set.
+    pError = error;
+    return Token = JSONToken_Error;
+}
 
-    return json;
+// Utility to jump whitespace and cr/lf
+void JSONReader::skipSpace()
+{
+    while ((pCur < pEnd) && (unsigned char)*pCur<=' ')
+        pCur++;
 }
 
+
 //-----------------------------------------------------------------------------
-// Parser core - when encountering text, process appropriately.
-const char* JSON::parseValue(const char* buff, const char** perror)
+// ***** JSONWriter
+
+JSONWriter::JSONWriter(bool formatted)
+    : Formatted(formatted), FirstItem(true), Depth(0)
 {
-    if (perror)
-        *perror = 0;
+    memset(ObjectBits, 0, sizeof(ObjectBits));
+    Text.Reserve(4096);
+    Text.PushBack(0);
+}
 
-	if (!buff)
-        return NULL;	// Fail on null.
+void JSONWriter::BeginObject(const char* name)
+{
+    beginContainer(name, true);
+}
 
-	if (!strncmp(buff,"null",4))
-    {
-        Type = JSON_Null;
-        return buff+4;
-    }
-	if (!strncmp(buff,"false",5))
-    { 
-        Type   = JSON_Bool;
-        Value  = "false";
-        dValue = 0;
-        return buff+5;
-    }
-	if (!strncmp(buff,"true",4))
-    {
-        Type   = JSON_Bool;
-        Value  = "true";
-        dValue = 1;
-        return buff+4;
-    }
-	if (*buff=='\"')
-    {
-        return parseString(buff, perror);
-    }
-	if (*buff=='-' || (*buff>='0' && *buff<='9'))
-    { 
-        return parseNumber(buff);
-    }
-	if (*buff=='[')
-    { 
-        return parseArray(buff, perror);
-    }
-	if (*buff=='{')
+void JSONWriter::EndObject()
+{
+    OVR_ASSERT((Depth > 0) && inObject());
+    Depth--;
+    if (Formatted)
     {
-        return parseObject(buff, perror);
+        // Empty objects have always closed one level further out.
+        append('\n');
+        appendIndent(FirstItem ? Depth - 1 : Depth);
     }
+    append('}');
+    FirstItem = false;
+}
 
-    return AssignError(perror, "Syntax Error: Invalid syntax");
+void JSONWriter::BeginArray(const char* name)
+{
+    beginContainer(name, false);
 }
 
+void JSONWriter::EndArray()
+{
+    OVR_ASSERT((Depth > 0) && !inObject());
+    Depth--;
+    append(']');
+    FirstItem = false;
+}
 
-//-----------------------------------------------------------------------------
-// Render a value to text. 
-char* JSON::PrintValue(int depth, bool fmt)
+void JSONWriter::WriteNull(const char* name)
 {
-	char *out=0;
+    beginValue(name);
+    append("null", 4);
+}
 
-    switch (Type)
-	{
-        case JSON_Null:	    out = JSON_strdup("null");	break;
-        case JSON_Bool:
-            if (dValue == 0)
-                out = JSON_strdup("false");
-            else
-                out = JSON_strdup("true");
-            break;
-        case JSON_Number:	out = PrintNumber(dValue); break;
-        case JSON_String:	out = PrintString(Value); break;
-        case JSON_Array:	out = PrintArray(depth, fmt); break;
-        case JSON_Object:	out = PrintObject(depth, fmt); break;
-        case JSON_None: OVR_ASSERT_LOG(false, ("Bad JSON type.")); break;
-	}
-	return out;
+void JSONWriter::WriteBool(const char* name, bool value)
+{
+    beginValue(name);
+    if (value)
+        append("true", 4);
+    else
+        append("false", 5);
 }
 
-//-----------------------------------------------------------------------------
-// Build an array object from input text and returns the text position after
-// the parsed array
-const char* JSON::parseArray(const char* buff, const char** perror)
+// Render the number into the text.
+void JSONWriter::WriteNumber(const char* name, double d)
 {
-	JSON *child;
-	if (*buff!='[')
-    {
-        return AssignError(perror, "Syntax Error: Missing opening bracket");
-    }
+    beginValue(name);
+
+    char buffer[64];
+    int  valueint = (int)d;
+    if (fabs(((double)valueint)-d)<=DBL_EPSILON && d<=INT_MAX && d>=INT_MIN)
+        OVR_sprintf(buffer, sizeof(buffer), "%d", valueint);
+    else if (fabs(floor(d)-d)<=DBL_EPSILON && fabs(d)<1.0e60)
+        OVR_sprintf(buffer, sizeof(buffer), "%.0f", d);
+    else if (fabs(d)<1.0e-6 || fabs(d)>1.0e9)
+        OVR_sprintf(buffer, sizeof(buffer), "%e", d);
+    else
+        OVR_sprintf(buffer, sizeof(buffer), "%f", d);
+    append(buffer);
+}
 
-	Type=JSON_Array;
-	buff=skip(buff+1);
-	
-    if (*buff==']')
-        return buff+1;	// empty array.
-
-    child = new JSON();
-	if (!child)
-        return 0;		 // memory fail
-    Children.PushBack(child);
-	
-    buff=skip(child->parseValue(skip(buff), perror));	// skip any spacing, get the buff. 
-	if (!buff)
-        return 0;
+void JSONWriter::WriteString(const char* name, const char* value)
+{
+    beginValue(name);
+    appendString(value);
+}
 
-	while (*buff==',')
-	{
-		JSON *new_item = new JSON();
-		if (!new_item)
-            return AssignError(perror, "Error: Failed to allocate memory");
-		
-        Children.PushBack(new_item);
+bool JSONWriter::Save(const char* path) const
+{
+    SysFile f;
+    if (!f.Open(path, File::Open_Write | File::Open_Create | File::Open_Truncate, File::Mode_Write))
+        return false;
 
-		buff=skip(new_item->parseValue(skip(buff+1), perror));
-		if (!buff)
-            return AssignError(perror, "Error: Failed to allocate memory");
-	}
+    int size  = (int)GetSize();
+    int bytes = f.Write((const UByte*)ToCStr(), size);
+    f.Close();
+    return (bytes == size);
+}
 
-	if (*buff==']')
-        return buff+1;	// end of array
+// Separates the value from the previous one, and writes its name if it is an
+// object member.
+void JSONWriter::beginValue(const char* name)
+{
+    if (Depth == 0)
+        return;
 
-    return AssignError(perror, "Syntax Error: Missing ending bracket");
+    if (inObject())
+    {
+        if (!FirstItem)
+            append(',');
+        if (Formatted)
+        {
+            append('\n');
+            appendIndent(Depth);
+        }
+        appendString(name);
+        append(':');
+        if (Formatted)
+            append('\t');
+    }
+    else if (!FirstItem)
+    {
+        if (Formatted)
+            append(", ", 2);
+        else
+            append(',');
+    }
+    FirstItem = false;
 }
 
-//-----------------------------------------------------------------------------
-// Render an array to text.  The returned text must be freed
-char* JSON::PrintArray(int depth, bool fmt)
+void JSONWriter::beginContainer(const char* name, bool object)
 {
-	char **entries;
-	char * out = 0,*ptr,*ret;
-    SPInt  len = 5;
-	
-    bool fail = false;
-	
-	// How many entries in the array? 
-    int numentries = GetItemCount();
-	if (!numentries)
-	{
-		out=(char*)OVR_ALLOC(3);
-		if (out)
-            OVR_strcpy(out, 3, "[]");
-		return out;
-	}
-	// Allocate an array to hold the values for each
-	entries=(char**)OVR_ALLOC(numentries*sizeof(char*));
-	if (!entries)
-        return 0;
-	memset(entries,0,numentries*sizeof(char*));
+    OVR_ASSERT(Depth < MaxDepth);
+    beginValue(name);
+    append(object ? '{' : '[');
 
-	//// Retrieve all the results:
-    JSON* child = Children.GetFirst();
-    for (int i=0; i<numentries; i++)
-	{
-		//JSON* child = Children[i];
-        ret=child->PrintValue(depth+1, fmt);
-		entries[i]=ret;
-		if (ret)
-            len+=OVR_strlen(ret)+2+(fmt?1:0);
-        else
-        {
-            fail = true;
+    UInt32 bit = 1u << (Depth & 31);
+    if (object)
+        ObjectBits[Depth >> 5] |= bit;
+    else
+        ObjectBits[Depth >> 5] &= ~bit;
+    Depth++;
+    FirstItem = true;
+}
+
+// Render the string provided to an escaped version that can be printed.
+void JSONWriter::appendString(const char* str)
+{
+    append('\"');
+
+    const char* ptr = str ? str : "";
+    while (*ptr)
+    {
+        // Copy runs of characters that need no escaping at once.
+        const char* run = ptr;
+        while ((unsigned char)*ptr>31 && *ptr!='\"' && *ptr!='\\')
+            ptr++;
+        if (ptr != run)
+            append(run, ptr - run);
+        if (!*ptr)
             break;
-        }
-        child = Children.GetNext(child);
-	}
-	
-	// If we didn't fail, try to malloc the output string 
-	if (!fail)
-        out=(char*)OVR_ALLOC(len);
-	// If that fails, we fail. 
-	if (!out)
-        fail = true;
-
-	// Handle failure.
-	if (fail)
-	{
-		for (int i=0; i<numentries; i++) 
-        {
-            if (entries[i])
-                OVR_FREE(entries[i]);
-        }
-		OVR_FREE(entries);
-		return 0;
-	}
-	
-	// Compose the output array.
-	*out='[';
-	ptr=out+1;
-    *ptr=0;
-	for (int i=0; i<numentries; i++)
-	{
-		OVR_strcpy(ptr, len - (ptr-out), entries[i]);
-        ptr+=OVR_strlen(entries[i]);
-		if (i!=numentries-1)
+
+        char escape[8];
+        escape[0] = '\\';
+        switch (unsigned char token = *ptr++)
         {
-            *ptr++=',';
-            if (fmt)
-                *ptr++=' ';
-            *ptr=0;
+            case '\\':  escape[1]='\\'; escape[2]=0; break;
+            case '\"':  escape[1]='\"'; escape[2]=0; break;
+            case '\b':  escape[1]='b';  escape[2]=0; break;
+            case '\f':  escape[1]='f';  escape[2]=0; break;
+            case '\n':  escape[1]='n';  escape[2]=0; break;
+            case '\r':  escape[1]='r';  escape[2]=0; break;
+            case '\t':  escape[1]='t';  escape[2]=0; break;
+            default:
+                OVR_sprintf(escape + 1, sizeof(escape) - 1, "u%04x", token);
+                break;
         }
-		OVR_FREE(entries[i]);
-	}
-	OVR_FREE(entries);
-	*ptr++=']';
-    *ptr++=0;
-	return out;	
+        append(escape);
+    }
+
+    append('\"');
+}
+
+void JSONWriter::append(const char* data, UPInt size)
+{
+    // Text always ends in a null, which the new data replaces.
+    UPInt pos = Text.GetSize() - 1;
+    Text.Resize(pos + size + 1);
+    memcpy(&Text[pos], data, size);
+    Text[pos + size] = 0;
+}
+
+void JSONWriter::appendIndent(int depth)
+{
+    for (int i = 0; i < depth; i++)
+        append('\t');
 }
 
+
 //-----------------------------------------------------------------------------
-// Build an object from the supplied text and returns the text position after
-// the parsed object
-const char* JSON::parseObject(const char* buff, const char** perror)
+// ***** JSON Node class
+
+JSON::JSON(JSONItemType itemType)
+    : Type(itemType), dValue(0.0)
 {
-	if (*buff!='{')
-    {
-        return AssignError(perror, "Syntax Error: Missing opening brace");
-    }
-	
-	Type=JSON_Object;
-	buff=skip(buff+1);
-	if (*buff=='}')
-        return buff+1;	// empty array.
-	
-    JSON* child = new JSON();
-    Children.PushBack(child);
-
-	buff=skip(child->parseString(skip(buff), perror));
-	if (!buff) 
-        return 0;
-	child->Name = child->Value;
-    child->Value.Clear();
-	
-    if (*buff!=':')
+}
+
+JSON::~JSON()
+{
+    JSON* child = Children.GetFirst();
+    while (!Children.IsNull(child))
     {
-        return AssignError(perror, "Syntax Error: Missing colon");
+        child->RemoveNode();
+        child->Release();
+        child = Children.GetFirst();
     }
-
-	buff=skip(child->parseValue(skip(buff+1), perror));	// skip any spacing, get the value.
-	if (!buff)
-        return 0;
-	
-	while (*buff==',')
-	{
-        child = new JSON();
-		if (!child)
-            return 0; // memory fail
-		
-        Children.PushBack(child);
-
-		buff=skip(child->parseString(skip(buff+1), perror));
-		if (!buff)
-            return 0;
-		
-        child->Name=child->Value;
-        child->Value.Clear();
-		
-        if (*buff!=':')
-        {
-            return AssignError(perror, "Syntax Error: Missing colon");
-        }	// fail!
-		
-        // Skip any spacing, get the value.
-        buff=skip(child->parseValue(skip(buff+1), perror));
-		if (!buff)
-            return 0;
-	}
-	
-	if (*buff=='}')
-        return buff+1;	// end of array 
-	
-    return AssignError(perror, "Syntax Error: Missing closing brace");
 }
 
 //-----------------------------------------------------------------------------
-// Render an object to text.  The returned string must be freed
-char* JSON::PrintObject(int depth, bool fmt)
+// Parses the supplied buffer of JSON text and returns a JSON object tree
+// The returned object must be Released after use
+JSON* JSON::Parse(const char* buff, const char** perror)
 {
-	char** entries = 0, **names = 0;
-	char*  out = 0;
-    char*  ptr, *ret, *str;
-    SPInt  len = 7, i = 0, j;
-    bool   fail = false;
-	
-    // Count the number of entries.
-    int numentries = GetItemCount();
-    
-	// Explicitly handle empty object case
-	if (numentries == 0)
-	{
-		out=(char*)OVR_ALLOC(fmt?depth+3:3);
-		if (!out)
-            return 0;
-		ptr=out;
-        *ptr++='{';
-		
-        if (fmt)
-        {
-            *ptr++='\n';
-            for (i=0;i<depth-1;i++)
-                *ptr++='\t';
-        }
-		*ptr++='}';
-        *ptr++=0;
-		return out;
-	}
-	// Allocate space for the names and the objects
-	entries=(char**)OVR_ALLOC(numentries*sizeof(char*));
-	if (!entries)
-        return 0;
-	names=(char**)OVR_ALLOC(numentries*sizeof(char*));
-	
-    if (!names)
+    return Parse(buff, buff ? OVR_strlen(buff) : 0, perror);
+}
+
+JSON* JSON::Parse(const char* buff, UPInt size, const char** perror)
+{
+    if (perror)
+        *perror = 0;
+    if (!buff)
+        return NULL;    // Fail on null.
+
+    JSON* json = new JSON();
+    if (!json)
     {
-        OVR_FREE(entries);
+        AssignError(perror, "Error: Failed to allocate memory");
         return 0;
     }
-	memset(entries,0,sizeof(char*)*numentries);
-	memset(names,0,sizeof(char*)*numentries);
 
-	// Collect all the results into our arrays:
-    depth++;
-    if (fmt)
-        len+=depth;
+    JSONReader reader(buff, size);
+    reader.Next();
+    if (!json->readValue(reader))
+    {
+        AssignError(perror, reader.GetError());
+        json->Release();
+        return NULL;
+    }   // parse failure.
 
-    JSON* child = Children.GetFirst();
-    while (!Children.IsNull(child))
-	{
-		names[i]     = str = PrintString(child->Name);
-		entries[i++] = ret = child->PrintValue(depth, fmt);
+    return json;
+}
 
-		if (str && ret)
-        {
-            len += OVR_strlen(ret)+OVR_strlen(str)+2+(fmt?2+depth:0);
-        }
-        else
+//-----------------------------------------------------------------------------
+// Parser core - builds the item from the reader's current token.
+bool JSON::readValue(JSONReader& reader)
+{
+    switch (reader.GetToken())
+    {
+    case JSONToken_Null:
+        Type = JSON_Null;
+        return true;
+
+    case JSONToken_Bool:
+    case JSONToken_Number:
+        Type   = (reader.GetToken() == JSONToken_Bool) ? JSON_Bool : JSON_Number;
+        Value.AssignString(reader.GetString(), reader.GetStringSize());
+        dValue = reader.GetNumber();
+        return true;
+
+    case JSONToken_String:
+        Type = JSON_String;
+        Value.AssignString(reader.GetString(), reader.GetStringSize());
+        return true;
+
+    case JSONToken_BeginArray:
+        Type = JSON_Array;
+        while (reader.Next() != JSONToken_EndArray)
         {
-            fail = true;
-            break;
+            JSON* child = new JSON();
+            if (!child)
+                return false;   // memory fail
+            Children.PushBack(child);
+
+            if (!child->readValue(reader))
+                return false;
         }
-		
-        child = Children.GetNext(child);
-	}
-	
-	// Try to allocate the output string
-	if (!fail)
-        out=(char*)OVR_ALLOC(len);
-	if (!out)
-        fail=true;
-
-	// Handle failure
-	if (fail)
-	{
-		for (i=0;i<numentries;i++)
-        {
-            if (names[i])
-                OVR_FREE(names[i]);
-            
-            if (entries[i])
-                OVR_FREE(entries[i]);}
-		
-        OVR_FREE(names);
-        OVR_FREE(entries);
-		return 0;
-	}
-	
-	// Compose the output:
-	*out = '{';
-    ptr  = out+1;
-    if (fmt)
-        *ptr++='\n';
-    *ptr = 0;
-	
-    for (i=0; i<numentries; i++)
-	{
-		if (fmt)
+        return true;
+
+    case JSONToken_BeginObject:
+        Type = JSON_Object;
+        while (reader.Next() == JSONToken_Name)
         {
-            for (j=0; j<depth; j++)
-                *ptr++ = '\t';
+            JSON* child = new JSON();
+            if (!child)
+                return false;   // memory fail
+            Children.PushBack(child);
+
+            child->Name.AssignString(reader.GetName(), reader.GetNameSize());
+            reader.Next();
+            if (!child->readValue(reader))
+                return false;
         }
-		OVR_strcpy(ptr, len - (ptr-out), names[i]);
-        ptr   += OVR_strlen(names[i]);
-		*ptr++ =':';
-        
-        if (fmt)
-            *ptr++='\t';
-		
-        OVR_strcpy(ptr, len - (ptr-out), entries[i]);
-        ptr+=OVR_strlen(entries[i]);
-		
-        if (i!=numentries-1)
-            *ptr++ = ',';
-		
-        if (fmt)
-            *ptr++ = '\n';
-        *ptr = 0;
-		
-        OVR_FREE(names[i]);
-        OVR_FREE(entries[i]);
-	}
-	
-	OVR_FREE(names);
-    OVR_FREE(entries);
-	
-    if (fmt)
-    {
-        for (i=0;i<depth-1;i++)
-            *ptr++='\t';
+        return (reader.GetToken() == JSONToken_EndObject);
+
+    default:
+        return false;
     }
-	*ptr++='}';
-    *ptr++=0;
-	
-    return out;	
 }
 
+//-----------------------------------------------------------------------------
+// Render a value, and its children, to the writer.
+void JSON::Write(JSONWriter& writer) const
+{
+    switch (Type)
+    {
+        case JSON_Null:     writer.WriteNull(Name); break;
+        case JSON_Bool:     writer.WriteBool(Name, dValue != 0); break;
+        case JSON_Number:   writer.WriteNumber(Name, dValue); break;
+        case JSON_String:   writer.WriteString(Name, Value); break;
+
+        case JSON_Array:
+        case JSON_Object:
+            if (Type == JSON_Array)
+                writer.BeginArray(Name);
+            else
+                writer.BeginObject(Name);
+
+            for(const JSON* child = Children.GetFirst(); !Children.IsNull(child); child = child->pNext)
+                child->Write(writer);
+
+            if (Type == JSON_Array)
+                writer.EndArray();
+            else
+                writer.EndObject();
+            break;
+
+        case JSON_None: OVR_ASSERT_LOG(false, ("Bad JSON type.")); break;
+    }
+}
 
 
 // Returns the number of child items in the object
@@ -1003,7 +998,7 @@ const char* JSON::GetArrayString(int index)
     if (Type == JSON_Array)
     {
         JSON* number = GetItemByIndex(index);
-        return number ? number->Value : 0;
+        return number ? number->Value.ToCStr() : 0;
     }
     else
     {
@@ -1034,7 +1029,7 @@ JSON* JSON::Load(const char* path, const char** perror)
         return NULL;
     }
 
-    JSON* json = JSON::Parse((char*)buff, perror);
+    JSON* json = JSON::Parse((char*)buff, len, perror);
     OVR_FREE(buff);
     return json;
 }
@@ -1043,25 +1038,9 @@ JSON* JSON::Load(const char* path, const char** perror)
 // Serializes the JSON object and writes to the give file path
 bool JSON::Save(const char* path)
 {
-    SysFile f;
-    if (!f.Open(path, File::Open_Write | File::Open_Create | File::Open_Truncate, File::Mode_Write))
-        return false;
-
-    char* text = PrintValue(0, true);
-    if (text)
-    {
-        SPInt len   = OVR_strlen(text);
-        OVR_ASSERT(len < (SPInt)(int)len);
-
-        int   bytes = f.Write((UByte*)text, (int)len);
-        f.Close();
-        OVR_FREE(text);
-        return (bytes == len);
-    }
-    else
-    {
-        return false;
-    }
+    JSONWriter writer(true);
+    Write(writer);
+    return writer.Save(path);
 }
 
 }
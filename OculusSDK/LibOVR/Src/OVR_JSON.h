@@ -32,6 +32,7 @@ limitations under the License.
 #include "Kernel/OVR_RefCount.h"
 #include "Kernel/OVR_String.h"
 #include "Kernel/OVR_List.h"
+#include "Kernel/OVR_Array.h"
 
 namespace OVR {  
 
@@ -49,6 +50,188 @@ enum JSONItemType
 };
 
 
+//-----------------------------------------------------------------------------
+// ***** JSONReader
+
+// JSONToken identifies what JSONReader::Next has just read.
+enum JSONToken
+{
+    JSONToken_None,
+    JSONToken_BeginObject,
+    JSONToken_EndObject,
+    JSONToken_BeginArray,
+    JSONToken_EndArray,
+    JSONToken_Name,         // Name of an object member; its value follows.
+    JSONToken_String,
+    JSONToken_Number,
+    JSONToken_Bool,
+    JSONToken_Null,
+    JSONToken_End,          // The top-level value is complete.
+    JSONToken_Error
+};
+
+// JSONReader is a pull parser that reads JSON text one token at a time,
+// without building a tree. It doesn't modify or copy the input, which needn't
+// be null-terminated, and only allocates for names or strings that don't fit
+// its internal buffers. Reading objects looks like:
+//
+//   JSONReader reader(text, size);
+//   if (reader.Next() == JSONToken_BeginObject)
+//   {
+//       while (reader.Next() == JSONToken_Name)
+//       {
+//           reader.Next();
+//           Use(reader.GetName(), reader.GetString());
+//           reader.SkipValue();  // Skips nested objects and arrays.
+//       }
+//   }
+//   if (reader.GetToken() == JSONToken_Error)
+//       Report(reader.GetError());
+
+class JSONReader
+{
+public:
+    enum { MaxDepth = 256 };
+
+    JSONReader(const char* data, UPInt size);
+
+    // Reads the next token. Errors and the end of the top-level value are
+    // sticky: Next keeps returning them.
+    JSONToken   Next();
+    JSONToken   GetToken() const        { return Token; }
+
+    // If the current token begins an object or array, reads up to and including
+    // the token that ends it. Returns the current token afterwards.
+    JSONToken   SkipValue();
+
+    // Name of the most recently read object member.
+    const char* GetName() const         { return NameText.pData; }
+    UPInt       GetNameSize() const     { return NameText.Size; }
+
+    // Text of the current scalar: the decoded string, the number as written,
+    // "true" or "false", or empty for null and for other tokens. Null-terminated,
+    // and valid until the next call to Next.
+    const char* GetString() const       { return isScalar() ? ValueText.pData : ""; }
+    UPInt       GetStringSize() const   { return isScalar() ? ValueText.Size : 0; }
+    // Value of the current number, or 1 or 0 for booleans; 0 otherwise.
+    double      GetNumber() const       { return isScalar() ? Number : 0.0; }
+
+    // Description of the syntax error, when GetToken returns JSONToken_Error.
+    const char* GetError() const        { return pError; }
+    // Number of objects and arrays currently open.
+    int         GetDepth() const        { return Depth; }
+
+private:
+    // Decoded text, kept in a local buffer unless it outgrows it.
+    struct TextBuffer
+    {
+        char*   pData;
+        UPInt   Size;
+        UPInt   Capacity;
+        char    Local[128];
+
+        TextBuffer() : pData(Local), Size(0), Capacity(sizeof(Local)) { Local[0] = 0; }
+        ~TextBuffer();
+
+        char*   Reserve(UPInt size);
+        void    Assign(const char* data, UPInt size);
+    };
+
+    enum ParseState
+    {
+        State_Value,        // Before the top-level value.
+        State_FirstMember,  // After '{'.
+        State_FirstElement, // After '['.
+        State_AfterName,
+        State_AfterValue,
+        State_Done
+    };
+
+    bool        isScalar() const        { return (Token >= JSONToken_String) && (Token <= JSONToken_Null); }
+    bool        inObject() const        { return (ObjectBits[(Depth - 1) >> 5] & (1u << ((Depth - 1) & 31))) != 0; }
+
+    JSONToken   readValue();
+    JSONToken   readName();
+    JSONToken   readNumber();
+    bool        readString(TextBuffer* text);
+    JSONToken   beginContainer(bool object);
+    JSONToken   endContainer(JSONToken token);
+    JSONToken   fail(const char* error);
+    void        skipSpace();
+    char        cur() const             { return (pCur < pEnd) ? *pCur : 0; }
+
+    // Not copyable; the text buffers may point into themselves.
+    JSONReader(const JSONReader&);
+    void operator = (const JSONReader&);
+
+    const char* pCur;
+    const char* pEnd;
+    JSONToken   Token;
+    ParseState  State;
+    TextBuffer  NameText;
+    TextBuffer  ValueText;
+    double      Number;
+    const char* pError;
+    int         Depth;
+    UInt32      ObjectBits[MaxDepth / 32];  // Whether each open level is an object.
+};
+
+
+//-----------------------------------------------------------------------------
+// ***** JSONWriter
+
+// JSONWriter appends JSON text to a single growing buffer as values are
+// written, with the same layout JSON::Save has always produced. Member names
+// are used inside objects and ignored elsewhere.
+//
+//   JSONWriter writer;
+//   writer.BeginObject();
+//   writer.WriteNumber("Version", 1);
+//   writer.EndObject();
+//   writer.Save(path);
+
+class JSONWriter
+{
+public:
+    enum { MaxDepth = 256 };
+
+    JSONWriter(bool formatted = true);
+
+    void        BeginObject(const char* name = 0);
+    void        EndObject();
+    void        BeginArray(const char* name = 0);
+    void        EndArray();
+
+    void        WriteNull(const char* name);
+    void        WriteBool(const char* name, bool value);
+    void        WriteNumber(const char* name, double value);
+    void        WriteString(const char* name, const char* value);
+
+    const char* ToCStr() const          { return &Text[0]; }
+    UPInt       GetSize() const         { return Text.GetSize() - 1; }
+
+    // Writes the text to a file, replacing it.
+    bool        Save(const char* path) const;
+
+private:
+    bool        inObject() const        { return (ObjectBits[(Depth - 1) >> 5] & (1u << ((Depth - 1) & 31))) != 0; }
+
+    void        beginValue(const char* name);
+    void        beginContainer(const char* name, bool object);
+    void        appendString(const char* str);
+    void        append(const char* data, UPInt size);
+    void        append(const char* str)     { append(str, OVR_strlen(str)); }
+    void        append(char c)              { append(&c, 1); }
+    void        appendIndent(int depth);
+
+    ArrayPOD<char>  Text;
+    bool            Formatted;
+    bool            FirstItem;  // Nothing has been written in the current object or array.
+    int             Depth;
+    UInt32          ObjectBits[MaxDepth / 32];
+};
+
+
 //-----------------------------------------------------------------------------
 // ***** JSON
 
@@ -82,6 +265,8 @@ public:
     // Creates a new JSON object from parsing string.
     // Returns null pointer and fills in *perror in case of parse error.
     static JSON*    Parse(const char* buff, const char** perror = 0);
+    // Parses size bytes of text, which needn't be null-terminated.
+    static JSON*    Parse(const char* buff, UPInt size, const char** perror = 0);
 
     // Loads and parses a JSON object from a file.
     // Returns 0 and assigns perror with error message on fail.
@@ -90,6 +275,10 @@ public:
     // Saves a JSON object to a file.
     bool            Save(const char* path);
 
+    // Writes this item and its children, as a member named Name when the writer
+    // is inside an object.
+    void            Write(JSONWriter& writer) const;
+
 
     // *** Object Member Access
 
@@ -136,16 +325,8 @@ protected:
 
     static JSON*    createHelper(JSONItemType itemType, double dval, const char* strVal = 0);
 
-    // JSON Parsing helper functions.
-    const char*     parseValue(const char *buff, const char** perror);
-    const char*     parseNumber(const char *num);
-    const char*     parseArray(const char* value, const char** perror);
-    const char*     parseObject(const char* value, const char** perror);
-    const char*     parseString(const char* str, const char** perror);
-
-    char*           PrintValue(int depth, bool fmt);
-    char*           PrintObject(int depth, bool fmt);
-    char*           PrintArray(int depth, bool fmt);
+    // Builds this item, and its children, from the reader's current token.
+    bool            readValue(JSONReader& reader);
 };
 
 
@@ -26,6 +26,9 @@ limitations under the License.
 
 #include "OVR_Linux_DeviceManager.h"
 
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
 // Sensor & HMD Factories
 #include "OVR_LatencyTestImpl.h"
 #include "OVR_SensorImpl.h"
@@ -35,6 +38,7 @@ limitations under the License.
 #include "Kernel/OVR_Timer.h"
 #include "Kernel/OVR_Std.h"
 #include "Kernel/OVR_Log.h"
+#include "Kernel/OVR_TrackingAllocator.h"
 
 namespace OVR { namespace Linux {
 
@@ -103,6 +107,11 @@ ThreadId DeviceManager::GetThreadId() const
     return pThread->GetThreadId();
 }
 
+Thread* DeviceManager::GetThread() const
+{
+    return pThread;
+}
+
 bool DeviceManager::GetDeviceInfo(DeviceInfo* info) const
 {
     if ((info->InfoClassType != Device_Manager) &&
@@ -130,48 +139,60 @@ DeviceEnumerator<> DeviceManager::EnumerateDevicesEx(const DeviceEnumerationArgs
 // ***** DeviceManager Thread 
 
 DeviceManagerThread::DeviceManagerThread()
-    : Thread(ThreadStackSize)
+    : Thread(ThreadStackSize), pTicksServicing(0)
 {
-    int result = pipe(CommandFd);
-    OVR_ASSERT(!result);
-
-    AddSelectFd(NULL, CommandFd[0]);
+    EpollFd        = epoll_create1(EPOLL_CLOEXEC);
+    CommandEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    TimerFd        = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    OVR_ASSERT(EpollFd >= 0 && CommandEventFd >= 0 && TimerFd >= 0);
+
+    // Both are drained completely on every wakeup, so edge triggering is safe.
+    struct epoll_event ev;
+    ev.events  = EPOLLIN | EPOLLET;
+    ev.data.fd = CommandEventFd;
+    epoll_ctl(EpollFd, EPOLL_CTL_ADD, CommandEventFd, &ev);
+    ev.data.fd = TimerFd;
+    epoll_ctl(EpollFd, EPOLL_CTL_ADD, TimerFd, &ev);
 }
 
 DeviceManagerThread::~DeviceManagerThread()
 {
-    if (CommandFd[0])
-    {
-        RemoveSelectFd(NULL, CommandFd[0]);
-        close(CommandFd[0]);
-        close(CommandFd[1]);
-    }
+    if (EpollFd >= 0)
+        close(EpollFd);
+    if (CommandEventFd >= 0)
+        close(CommandEventFd);
+    if (TimerFd >= 0)
+        close(TimerFd);
 }
 
-bool DeviceManagerThread::AddSelectFd(Notifier* notify, int fd)
+void DeviceManagerThread::OnPushNonEmpty()
 {
-    struct pollfd pfd;
-    pfd.fd = fd;
-    pfd.events = POLLIN|POLLHUP|POLLERR;
-    pfd.revents = 0;
+    UInt64 one = 1;
+    write(CommandEventFd, &one, sizeof(one));
+}
 
-    FdNotifiers.PushBack(notify);
-    PollFds.PushBack(pfd);
+bool DeviceManagerThread::AddSelectFd(Notifier* notify, int fd, bool edgeTriggered)
+{
+    struct epoll_event ev;
+    ev.events  = edgeTriggered ? (EPOLLIN | EPOLLET) : EPOLLIN;
+    ev.data.fd = fd;
+    if (epoll_ctl(EpollFd, EPOLL_CTL_ADD, fd, &ev) != 0)
+        return false;
 
-    OVR_ASSERT(FdNotifiers.GetSize() == PollFds.GetSize());
+    SelectFd entry = { fd, notify };
+    SelectFds.PushBack(entry);
     return true;
 }
 
 bool DeviceManagerThread::RemoveSelectFd(Notifier* notify, int fd)
 {
-    // [0] is reserved for thread commands with notify of null, but we still
-    // can use this function to remove it.
-    for (UPInt i = 0; i < FdNotifiers.GetSize(); i++)
+    for (UPInt i = 0; i < SelectFds.GetSize(); i++)
     {
-        if ((FdNotifiers[i] == notify) && (PollFds[i].fd == fd))
+        if ((SelectFds[i].pNotifier == notify) && (SelectFds[i].Fd == fd))
         {
-            FdNotifiers.RemoveAt(i);
-            PollFds.RemoveAt(i);
+            // May already be gone from the set after a hang-up.
+            epoll_ctl(EpollFd, EPOLL_CTL_DEL, fd, NULL);
+            SelectFds.RemoveAt(i);
             return true;
         }
     }
@@ -186,79 +207,78 @@ int DeviceManagerThread::Run()
 
     SetThreadName("OVR::DeviceManagerThread");
     LogText("OVR::DeviceManagerThread - running (ThreadId=%p).\n", GetThreadId());
+    TrackingAllocator::SetThreadSubsystem(AllocSubsystem_Sensor);
     
     // Signal to the parent thread that initialization has finished.
     StartupEvent.SetEvent();
 
+    enum { MaxEvents = 16 };
+    struct epoll_event events[MaxEvents];
+    SInt64             armedMks = -1;
+
     while(!IsExiting())
     {
         // PopCommand will reset event on empty queue.
         if (PopCommand(&command))
         {
             command.Execute();
+            continue;
         }
-        else
+
+        // Only the timer heap is consulted here; the timerfd is reprogrammed
+        // when the earliest deadline changes.
+        SInt64 waitMks = serviceTicks(Timer::GetTicks());
+        if (waitMks != armedMks)
+        {
+            armTimer(waitMks);
+            armedMks = waitMks;
+        }
+
+        int n = epoll_wait(EpollFd, events, MaxEvents, -1);
+
+        for (int e = 0; e < n; e++)
         {
-            bool commands = 0;
-            do
+            int fd = events[e].data.fd;
+
+            if (fd == CommandEventFd)
+            {
+                UInt64 count;
+                read(CommandEventFd, &count, sizeof(count));
+                continue;
+            }
+            if (fd == TimerFd)
+            {
+                UInt64 expirations;
+                read(TimerFd, &expirations, sizeof(expirations));
+                // A fired timer needs re-arming even if the next wait is the same.
+                armedMks = -1;
+                continue;
+            }
+
+            // Look the notifier up again; an earlier callback in this batch
+            // may have removed it.
+            UPInt i;
+            for (i = 0; i < SelectFds.GetSize(); i++)
+            {
+                if (SelectFds[i].Fd == fd)
+                    break;
+            }
+            if (i == SelectFds.GetSize())
+                continue;
+
+            if (events[e].events & EPOLLERR)
             {
-                int waitMs = -1;
-
-                // If devices have time-dependent logic registered, get the longest wait
-                // allowed based on current ticks.
-                if (!TicksNotifiers.IsEmpty())
-                {
-                    UInt64 ticksMks = Timer::GetTicks();
-                    int  waitAllowed;
-
-                    for (UPInt j = 0; j < TicksNotifiers.GetSize(); j++)
-                    {
-                        waitAllowed = (int)(TicksNotifiers[j]->OnTicks(ticksMks) / Timer::MksPerMs);
-                        if (waitAllowed < waitMs)
-                            waitMs = waitAllowed;
-                    }
-                }
-
-                // wait until there is data available on one of the devices or the timeout expires
-                int n = poll(&PollFds[0], PollFds.GetSize(), waitMs);
-
-                if (n > 0)
-                {
-                    // Iterate backwards through the list so the ordering will not be
-                    // affected if the called object gets removed during the callback
-                    // Also, the HID data streams are located toward the back of the list
-                    // and servicing them first will allow a disconnect to be handled
-                    // and cleaned directly at the device first instead of the general HID monitor
-                    for (int i=PollFds.GetSize()-1; i>=0; i--)
-                    {
-                        if (PollFds[i].revents & POLLERR)
-                        {
-                            OVR_DEBUG_LOG(("poll: error on [%d]: %d", i, PollFds[i].fd));
-                        }
-                        else if (PollFds[i].revents & POLLIN)
-                        {
-                            if (FdNotifiers[i])
-                                FdNotifiers[i]->OnEvent(i, PollFds[i].fd);
-                            else if (i == 0) // command
-                            {
-                                char dummy[128];
-                                read(PollFds[i].fd, dummy, 128);
-                                commands = 1;
-                            }
-                        }
-
-                        if (PollFds[i].revents & POLLHUP)
-                            PollFds[i].events = 0;
-
-                        if (PollFds[i].revents != 0)
-                        {
-                            n--;
-                            if (n == 0)
-                                break;
-                        }
-                    }
-                }
-            } while (PollFds.GetSize() > 0 && !commands);
+                OVR_DEBUG_LOG(("epoll: error on [%d]: %d", (int)i, fd));
+            }
+            else if (events[e].events & EPOLLIN)
+            {
+                if (SelectFds[i].pNotifier)
+                    SelectFds[i].pNotifier->OnEvent((int)i, fd);
+            }
+
+            // Stop waiting on a hung-up fd; its owner removes it later.
+            if (events[e].events & EPOLLHUP)
+                epoll_ctl(EpollFd, EPOLL_CTL_DEL, fd, NULL);
         }
     }
 
@@ -266,25 +286,126 @@ int DeviceManagerThread::Run()
     return 0;
 }
 
+SInt64 DeviceManagerThread::serviceTicks(UInt64 ticksMks)
+{
+    while (!TicksHeap.IsEmpty() && TicksHeap[0].DeadlineMks <= ticksMks)
+    {
+        TicksEntry entry = TicksHeap[0];
+        removeTicksAt(0);
+
+        pTicksServicing = entry.pNotifier;
+        UInt64 waitMks  = entry.pNotifier->OnTicks(ticksMks);
+
+        // Re-queue unless the notifier removed itself during the call.
+        if (pTicksServicing)
+        {
+            entry.DeadlineMks = ticksMks + waitMks;
+            pushTicks(entry);
+        }
+        pTicksServicing = 0;
+    }
+
+    if (TicksHeap.IsEmpty())
+        return -1;
+    return (SInt64)(TicksHeap[0].DeadlineMks - ticksMks);
+}
+
+void DeviceManagerThread::armTimer(SInt64 waitMks)
+{
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+
+    if (waitMks >= 0)
+    {
+        // A zero value would disarm the timer, so fire at least 1us later.
+        if (waitMks == 0)
+            waitMks = 1;
+        spec.it_value.tv_sec  = (time_t)(waitMks / Timer::MksPerSecond);
+        spec.it_value.tv_nsec = (long)(waitMks % Timer::MksPerSecond) * 1000;
+    }
+    timerfd_settime(TimerFd, 0, &spec, NULL);
+}
+
 bool DeviceManagerThread::AddTicksNotifier(Notifier* notify)
 {
-     TicksNotifiers.PushBack(notify);
-     return true;
+    // Due immediately; the first OnTicks call returns the real interval.
+    TicksEntry entry = { Timer::GetTicks(), notify };
+    pushTicks(entry);
+    return true;
 }
 
 bool DeviceManagerThread::RemoveTicksNotifier(Notifier* notify)
 {
-    for (UPInt i = 0; i < TicksNotifiers.GetSize(); i++)
+    if (pTicksServicing == notify)
+    {
+        pTicksServicing = 0;
+        return true;
+    }
+
+    for (UPInt i = 0; i < TicksHeap.GetSize(); i++)
     {
-        if (TicksNotifiers[i] == notify)
+        if (TicksHeap[i].pNotifier == notify)
         {
-            TicksNotifiers.RemoveAt(i);
+            removeTicksAt(i);
             return true;
         }
     }
     return false;
 }
 
+void DeviceManagerThread::pushTicks(const TicksEntry& entry)
+{
+    TicksHeap.PushBack(entry);
+    siftUp(TicksHeap.GetSize() - 1);
+}
+
+void DeviceManagerThread::removeTicksAt(UPInt i)
+{
+    UPInt last = TicksHeap.GetSize() - 1;
+    if (i != last)
+    {
+        TicksHeap[i] = TicksHeap[last];
+        TicksHeap.PopBack();
+        siftDown(i);
+        siftUp(i);
+    }
+    else
+    {
+        TicksHeap.PopBack();
+    }
+}
+
+void DeviceManagerThread::siftUp(UPInt i)
+{
+    while (i > 0)
+    {
+        UPInt parent = (i - 1) / 2;
+        if (TicksHeap[parent].DeadlineMks <= TicksHeap[i].DeadlineMks)
+            break;
+        Alg::Swap(TicksHeap[parent], TicksHeap[i]);
+        i = parent;
+    }
+}
+
+void DeviceManagerThread::siftDown(UPInt i)
+{
+    UPInt size = TicksHeap.GetSize();
+    for (;;)
+    {
+        UPInt smallest = i;
+        UPInt left     = 2 * i + 1;
+        UPInt right    = left + 1;
+        if (left < size && TicksHeap[left].DeadlineMks < TicksHeap[smallest].DeadlineMks)
+            smallest = left;
+        if (right < size && TicksHeap[right].DeadlineMks < TicksHeap[smallest].DeadlineMks)
+            smallest = right;
+        if (smallest == i)
+            break;
+        Alg::Swap(TicksHeap[smallest], TicksHeap[i]);
+        i = smallest;
+    }
+}
+
 } // namespace Linux
 
 
@@ -294,6 +415,11 @@ bool DeviceManagerThread::RemoveTicksNotifier(Notifier* notify)
 
 // Creates a new DeviceManager and initializes OVR.
 DeviceManager* DeviceManager::Create()
+{
+    return Create(DeviceManagerOptions());
+}
+
+DeviceManager* DeviceManager::Create(const DeviceManagerOptions& options)
 {
     if (!System::IsInitialized())
     {
@@ -308,7 +434,9 @@ DeviceManager* DeviceManager::Create()
     if (manager)
     {
         if (manager->Initialize(0))
-        {            
+        {
+            manager->ApplyOptions(options);
+
             manager->AddFactory(&LatencyTestDeviceFactory::Instance);
             manager->AddFactory(&SensorDeviceFactory::Instance);
             manager->AddFactory(&Linux::HMDDeviceFactory::Instance);
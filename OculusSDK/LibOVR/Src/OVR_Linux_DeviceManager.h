@@ -30,7 +30,7 @@ limitations under the License.
 #include "OVR_DeviceImpl.h"
 
 #include <unistd.h>
-#include <sys/poll.h>
+#include <sys/epoll.h>
 
 
 namespace OVR { namespace Linux {
@@ -52,6 +52,7 @@ public:
 
     virtual ThreadCommandQueue* GetThreadQueue();
     virtual ThreadId GetThreadId() const;
+    virtual Thread*  GetThread() const;
 
     virtual DeviceEnumerator<> EnumerateDevicesEx(const DeviceEnumerationArgs& args);    
 
@@ -74,8 +75,8 @@ public:
     virtual int Run();
 
     // ThreadCommandQueue notifications for CommandEvent handling.
-    virtual void OnPushNonEmpty_Locked() { write(CommandFd[1], this, 1); }
-    virtual void OnPopEmpty_Locked()     { }
+    virtual void OnPushNonEmpty();
+    virtual void OnPopEmpty()     { }
 
     class Notifier
     {
@@ -93,8 +94,9 @@ public:
         }
     };
 
-    // Add I/O notifier
-    bool AddSelectFd(Notifier* notify, int fd);
+    // Add I/O notifier. Edge-triggered notifiers must read their fd until it
+    // would block on every OnEvent.
+    bool AddSelectFd(Notifier* notify, int fd, bool edgeTriggered = false);
     bool RemoveSelectFd(Notifier* notify, int fd);
 
     // Add notifier that will be called at regular intervals.
@@ -103,18 +105,46 @@ public:
 
 private:
     
-    bool threadInitialized() { return CommandFd[0] != 0; }
+    bool threadInitialized() { return EpollFd >= 0; }
 
-    // pipe used to signal commands
-    int CommandFd[2];
+    // Calls OnTicks on every notifier that is due and returns the time until
+    // the earliest next one, in microseconds, or -1 if none are registered.
+    SInt64 serviceTicks(UInt64 ticksMks);
 
-    Array<struct pollfd>    PollFds;
-    Array<Notifier*>        FdNotifiers;
+    // Reprograms TimerFd to fire in waitMks, or disarms it if waitMks < 0.
+    void   armTimer(SInt64 waitMks);
+
+    // Binary min-heap of tick notifiers ordered by their next deadline.
+    struct TicksEntry
+    {
+        UInt64      DeadlineMks;
+        Notifier*   pNotifier;
+    };
+    void   pushTicks(const TicksEntry& entry);
+    void   removeTicksAt(UPInt i);
+    void   siftUp(UPInt i);
+    void   siftDown(UPInt i);
+
+    struct SelectFd
+    {
+        int         Fd;
+        Notifier*   pNotifier;
+    };
+
+    // epoll instance waiting on the command eventfd, the tick timerfd and
+    // all notifier fds.
+    int                     EpollFd;
+    int                     CommandEventFd;
+    int                     TimerFd;
+
+    Array<SelectFd>         SelectFds;
 
     Event                   StartupEvent;
 
     // Ticks notifiers - used for time-dependent events such as keep-alive.
-    Array<Notifier*>        TicksNotifiers;
+    Array<TicksEntry>       TicksHeap;
+    // Notifier whose OnTicks is executing; cleared if it is removed meanwhile.
+    Notifier*               pTicksServicing;
 };
 
 }} // namespace Linux::OVR
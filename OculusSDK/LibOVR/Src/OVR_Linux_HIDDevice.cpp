@@ -114,12 +114,13 @@ bool HIDDeviceManager::Initialize()
 //-----------------------------------------------------------------------------
 void HIDDeviceManager::Shutdown()
 {
-    OVR_ASSERT_LOG((UdevInstance), ("Should have called 'Initialize' before 'Shutdown'."));
+    if (!UdevInstance)
+        return;
 
     if (HIDMonitor)
     {
+        // The monitor owns its fd, and closes it when released.
         DevManager->pThread->RemoveSelectFd(this, HIDMonHandle);
-        close(HIDMonHandle);
         HIDMonHandle = -1;
 
         udev_monitor_unref(HIDMonitor);
@@ -127,7 +128,8 @@ void HIDDeviceManager::Shutdown()
     }
 
     udev_unref(UdevInstance);  // release the library
-    
+    UdevInstance = NULL;
+
     LogText("OVR::Linux::HIDDeviceManager - shutting down.\n");
 }
 
@@ -559,7 +561,7 @@ bool HIDDevice::openDevice(const char* device_path)
     }
 
     // Now open the device
-    DeviceHandle = open(device_path, O_RDWR);
+    DeviceHandle = open(device_path, O_RDWR | O_NONBLOCK);
     if (DeviceHandle < 0)
     {
         OVR_DEBUG_LOG(("Failed 'CreateHIDFile' while opening device, error = 0x%X.", errno));
@@ -578,7 +580,7 @@ bool HIDDevice::openDevice(const char* device_path)
     }
 
     // Add the device to the polling list
-    if (!HIDManager->DevManager->pThread->AddSelectFd(this, DeviceHandle))
+    if (!HIDManager->DevManager->pThread->AddSelectFd(this, DeviceHandle, true))
     {
         OVR_ASSERT_LOG(false, ("Failed to initialize polling for HIDDevice."));
 
@@ -671,18 +673,40 @@ UInt64 HIDDevice::OnTicks(UInt64 ticksMks)
 void HIDDevice::OnEvent(int i, int fd)
 {
     // We have data to read from the device
-    int bytes = read(fd, ReadBuffer, ReadBufferSize);
-    if (bytes >= 0)
+    // hidraw returns one report per read; keep reading until the
+    // non-blocking handle runs dry, since the fd is edge-triggered.
+    for (;;)
     {
+        UInt32 count = 0;
+        int    error = 0;
+
+        while (count < ReadRingSize)
+        {
+            int bytes = read(fd, ReadRing[count], ReadBufferSize);
+            if (bytes > 0)
+                ReadLengths[count++] = (UInt32)bytes;
+            else if (bytes < 0 && errno == EINTR)
+                continue;
+            else
+            {
+                error = (bytes < 0 && errno != EAGAIN) ? errno : 0;
+                break;
+            }
+        }
+
 // TODO: I need to handle partial messages and package reconstruction
-        if (Handler)
+        if (count && Handler)
         {
-            Handler->OnInputReport(ReadBuffer, bytes);
+            Handler->OnInputReports(ReadRing[0], ReadBufferSize, ReadLengths, count);
         }
-    }
-    else
-    {   // Close the device on read error.
-        closeDeviceOnIOError();
+
+        if (error)
+        {   // Close the device on read error.
+            closeDeviceOnIOError();
+            return;
+        }
+        if (count < ReadRingSize)
+            break;
     }
 }
 
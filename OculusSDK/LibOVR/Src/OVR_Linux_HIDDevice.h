@@ -77,8 +77,11 @@ private:
     int                     DeviceHandle;     // file handle to the device
     HIDDeviceDesc           DevDesc;
     
-    enum { ReadBufferSize = 96 };
-    UByte                   ReadBuffer[ReadBufferSize];
+    // Reports drained in one wakeup are read straight into this ring and
+    // handed to the handler from there.
+    enum { ReadBufferSize = 96, ReadRingSize = 16 };
+    UByte                   ReadRing[ReadRingSize][ReadBufferSize];
+    UInt32                  ReadLengths[ReadRingSize];
 
     UInt16                  InputReportBufferLength;
     UInt16                  OutputReportBufferLength;
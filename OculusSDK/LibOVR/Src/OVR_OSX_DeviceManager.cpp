@@ -35,6 +35,7 @@ limitations under the License.
 #include "Kernel/OVR_Timer.h"
 #include "Kernel/OVR_Std.h"
 #include "Kernel/OVR_Log.h"
+#include "Kernel/OVR_TrackingAllocator.h"
 
 #include <IOKit/hid/IOHIDManager.h>
 #include <IOKit/hid/IOHIDKeys.h>
@@ -113,6 +114,11 @@ ThreadId DeviceManager::GetThreadId() const
     return pThread->GetThreadId();
 }
 
+Thread* DeviceManager::GetThread() const
+{
+    return pThread;
+}
+
 bool DeviceManager::GetDeviceInfo(DeviceInfo* info) const
 {
     if ((info->InfoClassType != Device_Manager) &&
@@ -171,6 +177,7 @@ int DeviceManagerThread::Run()
 
     SetThreadName("OVR::DeviceManagerThread");
     LogText("OVR::DeviceManagerThread - running (ThreadId=0x%p).\n", GetThreadId());
+    TrackingAllocator::SetThreadSubsystem(AllocSubsystem_Sensor);
 
     // Store out the run loop ref.
     RunLoop = CFRunLoopGetCurrent();
@@ -326,6 +333,11 @@ void DeviceManagerThread::Shutdown()
 
 // Creates a new DeviceManager and initializes OVR.
 DeviceManager* DeviceManager::Create()
+{
+    return Create(DeviceManagerOptions());
+}
+
+DeviceManager* DeviceManager::Create(const DeviceManagerOptions& options)
 {
 
     if (!System::IsInitialized())
@@ -342,6 +354,8 @@ DeviceManager* DeviceManager::Create()
     {
         if (manager->Initialize(0))
         {
+            manager->ApplyOptions(options);
+
             manager->AddFactory(&LatencyTestDeviceFactory::Instance);
             manager->AddFactory(&SensorDeviceFactory::Instance);
             manager->AddFactory(&OSX::HMDDeviceFactory::Instance);
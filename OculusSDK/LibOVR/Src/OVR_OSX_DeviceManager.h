@@ -55,6 +55,7 @@ public:
 
     virtual ThreadCommandQueue* GetThreadQueue();
     virtual ThreadId GetThreadId() const;
+    virtual Thread*  GetThread() const;
     
     virtual DeviceEnumerator<> EnumerateDevicesEx(const DeviceEnumerationArgs& args);
 
@@ -83,13 +84,13 @@ public:
     virtual int Run();
 
     // ThreadCommandQueue notifications for CommandEvent handling.
-    virtual void OnPushNonEmpty_Locked()
+    virtual void OnPushNonEmpty()
     {
         CFRunLoopSourceSignal(CommandQueueSource);
         CFRunLoopWakeUp(RunLoop);
     }
     
-    virtual void OnPopEmpty_Locked()     {}
+    virtual void OnPopEmpty()     {}
 
 
     // Notifier used for different updates (EVENT or regular timing or messages).
@@ -101,8 +101,14 @@ bool HIDDeviceManager::Initialize()
 
 void HIDDeviceManager::Shutdown()
 {
-    OVR_ASSERT_LOG(HIDManager, ("Should have called 'Initialize' before 'Shutdown'."));
+    if (!HIDManager)
+        return;
+
+    // Stop the device matching callback before the manager goes away.
+    IOHIDManagerUnscheduleFromRunLoop(HIDManager, getRunLoop(), kCFRunLoopDefaultMode);
+    IOHIDManagerRegisterDeviceMatchingCallback(HIDManager, NULL, NULL);
     CFRelease(HIDManager);
+    HIDManager = NULL;
     
     LogText("OVR::OSX::HIDDeviceManager - shutting down.\n");
 }
@@ -134,6 +134,23 @@ String GetProfilePath(bool create_dir)
     return path;
 }
 
+// Reads the whole file into text; returns false if it can't be read or is empty.
+static bool readFileText(const char* path, Array<char>* text)
+{
+    SysFile f;
+    if (!f.Open(path, File::Open_Read, File::Mode_Read))
+        return false;
+
+    int len = f.GetLength();
+    if (len <= 0)
+        return false;
+
+    text->Resize(len);
+    int bytes = f.Read((UByte*)&(*text)[0], len);
+    f.Close();
+    return (bytes == len);
+}
+
 //-----------------------------------------------------------------------------
 // ***** ProfileManager
 
@@ -207,85 +224,106 @@ void ProfileManager::LoadCache(ProfileType device)
 
     String path = GetProfilePath(false);
 
-    Ptr<JSON> root = *JSON::Load(path);
-    if (!root || root->GetItemCount() < 3)
+    // The profiles are read straight from the file text; no JSON tree is built.
+    Array<char> text;
+    if (!readFileText(path, &text))
         return;
 
-    // First read the file type and version to make sure this is a valid file
-    JSON* item0 = root->GetFirstItem();
-    JSON* item1 = root->GetNextItem(item0);
-    JSON* item2 = root->GetNextItem(item1);
+    JSONReader reader(&text[0], text.GetSize());
+    if (reader.Next() != JSONToken_BeginObject)
+        return;
 
-    if (item0->Name == "Oculus Profile Version")
+    // First read the file type and version to make sure this is a valid file
+    if (reader.Next() != JSONToken_Name)
+        return;
+    if (OVR_strcmp(reader.GetName(), "Oculus Profile Version") == 0)
     {
-        int major = atoi(item0->Value.ToCStr());
+        reader.Next();
+        int major = atoi(reader.GetString());
         if (major > MAX_PROFILE_MAJOR_VERSION)
             return;   // don't parse the file on unsupported major version number
+        reader.SkipValue();
     }
     else
     {
         return;
     }
 
-    DefaultProfile = item1->Value;
+    if (reader.Next() != JSONToken_Name)
+        return;
+    reader.Next();
+    DefaultProfile = reader.GetString();
+    reader.SkipValue();
 
     // Read the number of profiles
-    int   profileCount = (int)item2->dValue;
-    JSON* profileItem  = item2;
+    if (reader.Next() != JSONToken_Name)
+        return;
+    reader.Next();
+    int profileCount = (int)reader.GetNumber();
+    reader.SkipValue();
 
-    for (int p=0; p<profileCount; p++)
+    for (int p=0; (p<profileCount) && (reader.Next() == JSONToken_Name); p++)
     {
-        profileItem = root->GetNextItem(profileItem);
-        if (profileItem == NULL)
-            break;
+        if (OVR_strcmp(reader.GetName(), "Profile") != 0)
+        {
+            reader.Next();
+            reader.SkipValue();
+            continue;
+        }
 
-        if (profileItem->Name == "Profile")
+        // Read the required Name field
+        if ((reader.Next() != JSONToken_BeginObject) ||
+            (reader.Next() != JSONToken_Name) || (OVR_strcmp(reader.GetName(), "Name") != 0))
         {
-            // Read the required Name field
-            const char* profileName;
-            JSON* item = profileItem->GetFirstItem();
-        
-            if (item && (item->Name == "Name"))
-            {   
-                profileName = item->Value;
-            }
-            else
-            {
-                return;   // invalid field
-            }
+            return;   // invalid field
+        }
+        reader.Next();
 
-            const char*   deviceName  = 0;
-            bool          deviceFound = false;
-            Ptr<Profile>  profile     = *CreateProfileObject(profileName, device, &deviceName);
+        const char*   deviceName  = 0;
+        bool          deviceFound = false;
+        Ptr<Profile>  profile     = *CreateProfileObject(reader.GetString(), device, &deviceName);
+        reader.SkipValue();
 
-            // Read the base profile fields.
-            if (profile)
+        // Read the base profile fields.
+        while (reader.Next() == JSONToken_Name)
+        {
+            if (reader.Next() != JSONToken_BeginObject)
             {
-                while (item = profileItem->GetNextItem(item), item)
-                {
-                    if (item->Type != JSON_Object)
-                    {
-                        profile->ParseProperty(item->Name, item->Value);
-                    }
-                    else
-                    {   // Search for the matching device to get device specific fields
-                        if (!deviceFound && deviceName && OVR_strcmp(item->Name, deviceName) == 0)
-                        {
-                            deviceFound = true;
+                if (profile)
+                    profile->ParseProperty(reader.GetName(), reader.GetString());
+                reader.SkipValue();
+            }
+            else if (profile && !deviceFound && deviceName && OVR_strcmp(reader.GetName(), deviceName) == 0)
+            {   // Read the device specific fields from the matching device
+                deviceFound = true;
 
-                            for (JSON* deviceItem = item->GetFirstItem(); deviceItem;
-                                 deviceItem = item->GetNextItem(deviceItem))
-                            {
-                                profile->ParseProperty(deviceItem->Name, deviceItem->Value);
-                            }
-                        }
-                    }
+                while (reader.Next() == JSONToken_Name)
+                {
+                    reader.Next();
+                    profile->ParseProperty(reader.GetName(), reader.GetString());
+                    reader.SkipValue();
                 }
             }
-
-            // Add the new profile
-            ProfileCache.PushBack(profile);
+            else
+            {
+                reader.SkipValue();
+            }
         }
+
+        // Add the new profile
+        ProfileCache.PushBack(profile);
+    }
+
+    // The rest of the file must still be valid.
+    while (reader.Next() == JSONToken_Name)
+    {
+        reader.Next();
+        reader.SkipValue();
+    }
+    if (reader.GetToken() == JSONToken_Error)
+    {
+        ProfileCache.Clear();
+        return;
     }
 
     CacheDevice = device;
@@ -325,11 +363,12 @@ void ProfileManager::SaveCache()
         }
     }
     
-    // Create a new json root
-    Ptr<JSON> root = *JSON::CreateObject();
-    root->AddNumberItem("Oculus Profile Version", PROFILE_VERSION);
-    root->AddStringItem("CurrentProfile", DefaultProfile);
-    root->AddNumberItem("ProfileCount", (double) ProfileCache.GetSize());
+    // The new file is written as it is generated.
+    JSONWriter writer;
+    writer.BeginObject();
+    writer.WriteNumber("Oculus Profile Version", PROFILE_VERSION);
+    writer.WriteString("CurrentProfile", DefaultProfile);
+    writer.WriteNumber("ProfileCount", (double) ProfileCache.GetSize());
 
     // Generate a JSON subtree for each profile
     for (unsigned int i=0; i<ProfileCache.GetSize(); i++)
@@ -337,9 +376,8 @@ void ProfileManager::SaveCache()
         Profile* profile = ProfileCache[i];
 
         // Write the base profile information
-        JSON* json_profile = JSON::CreateObject();
-        json_profile->Name = "Profile";
-        json_profile->AddStringItem("Name", profile->Name);
+        writer.BeginObject("Profile");
+        writer.WriteString("Name", profile->Name);
         const char* gender;
         switch (profile->GetGender())
         {
@@ -347,9 +385,9 @@ void ProfileManager::SaveCache()
             case Profile::Gender_Female: gender = "Female"; break;
             default: gender = "Unspecified";
         }
-        json_profile->AddStringItem("Gender", gender);
-        json_profile->AddNumberItem("PlayerHeight", profile->PlayerHeight);
-        json_profile->AddNumberItem("IPD", profile->IPD);
+        writer.WriteString("Gender", gender);
+        writer.WriteNumber("PlayerHeight", profile->PlayerHeight);
+        writer.WriteNumber("IPD", profile->IPD);
 
         const char* device_name = NULL;
         // Create a device-specific subtree for the cached device
@@ -358,8 +396,7 @@ void ProfileManager::SaveCache()
             device_name = "RiftDK1";
             
             RiftDK1Profile* rift = (RiftDK1Profile*)profile;
-            JSON* json_rift = JSON::CreateObject();
-            json_profile->AddItem(device_name, json_rift);
+            writer.BeginObject(device_name);
 
             const char* eyecup = "A";
             switch (rift->EyeCups)
@@ -368,19 +405,19 @@ void ProfileManager::SaveCache()
                 case EyeCup_B: eyecup = "B"; break;
                 case EyeCup_C: eyecup = "C"; break;
             }
-            json_rift->AddStringItem("EyeCup", eyecup);
-            json_rift->AddNumberItem("LL", rift->LL);
-            json_rift->AddNumberItem("LR", rift->LR);
-            json_rift->AddNumberItem("RL", rift->RL);
-            json_rift->AddNumberItem("RR", rift->RR);
+            writer.WriteString("EyeCup", eyecup);
+            writer.WriteNumber("LL", rift->LL);
+            writer.WriteNumber("LR", rift->LR);
+            writer.WriteNumber("RL", rift->RL);
+            writer.WriteNumber("RR", rift->RR);
+            writer.EndObject();
         }
         else if (profile->Type == Profile_RiftDKHD)
         {
             device_name = "RiftDKHD";
             
             RiftDKHDProfile* rift = (RiftDKHDProfile*)profile;
-            JSON* json_rift = JSON::CreateObject();
-            json_profile->AddItem(device_name, json_rift);
+            writer.BeginObject(device_name);
 
             const char* eyecup = "A";
             switch (rift->EyeCups)
@@ -389,17 +426,18 @@ void ProfileManager::SaveCache()
                 case EyeCup_B: eyecup = "B"; break;
                 case EyeCup_C: eyecup = "C"; break;
             }
-            json_rift->AddStringItem("EyeCup", eyecup);
-            //json_rift->AddNumberItem("LL", rift->LL);
-            //json_rift->AddNumberItem("LR", rift->LR);
-            //json_rift->AddNumberItem("RL", rift->RL);
-            //json_rift->AddNumberItem("RR", rift->RR);
+            writer.WriteString("EyeCup", eyecup);
+            //writer.WriteNumber("LL", rift->LL);
+            //writer.WriteNumber("LR", rift->LR);
+            //writer.WriteNumber("RL", rift->RL);
+            //writer.WriteNumber("RR", rift->RR);
+            writer.EndObject();
         }
 
         // There may be multiple devices stored per user, but only a single
         // device is represented by this root.  We don't want to overwrite
         // the other devices so we need to examine the older root 
-        // and merge previous devices into new json root
+        // and copy previous devices into the new file
         if (oldroot)
         {
             JSON* old_profile = oldroot->GetFirstItem();
@@ -409,26 +447,16 @@ void ProfileManager::SaveCache()
                 {
                     JSON* profile_name = old_profile->GetItemByName("Name");
                     if (profile_name && OVR_strcmp(profile->Name, profile_name->Value) == 0)
-                    {   // Now that we found the user in the older root, add all the 
-                        // object children to the new root - except for the one for the
+                    {   // Now that we found the user in the older root, write all the 
+                        // object children to the new file - except for the one for the
                         // current device
-                        JSON* old_item = old_profile->GetFirstItem();
-                        while (old_item)
+                        for (JSON* old_item = old_profile->GetFirstItem(); old_item;
+                             old_item = old_profile->GetNextItem(old_item))
                         {
                             if (old_item->Type == JSON_Object 
                                 && (device_name == NULL || OVR_strcmp(old_item->Name, device_name) != 0))
                             {
-                                JSON* old_device = old_item;
-                                old_item = old_profile->GetNextItem(old_item);
-
-                                // remove the node from the older root to avoid multiple reference
-                                old_device->RemoveNode();
-                                // add the node pointer to the new root
-                                json_profile->AddItem(old_device->Name, old_device);
-                            }
-                            else
-                            {
-                                old_item = old_profile->GetNextItem(old_item);
+                                old_item->Write(writer);
                             }
                         }
 
@@ -440,12 +468,13 @@ void ProfileManager::SaveCache()
             }
         }
 
-        // Add the completed user profile to the new root
-        root->AddItem("Profile", json_profile);
+        // Complete the user profile
+        writer.EndObject();
     }
+    writer.EndObject();
 
     // Save the profile to disk
-    root->Save(path);
+    writer.Save(path);
 }
 
 // Returns the number of stored profiles for this device type
@@ -27,6 +27,7 @@ limitations under the License.
 #include "OVR_SensorFusion.h"
 #include "Kernel/OVR_Log.h"
 #include "Kernel/OVR_System.h"
+#include "Kernel/OVR_Timer.h"
 #include "OVR_JSON.h"
 #include "OVR_Profile.h"
 
@@ -42,6 +43,7 @@ SensorFusion::SensorFusion(SensorDevice* sensor)
     Handler(getThis()), pDelegate(0),
     Gain(0.05f), EnableGravity(true), 
     EnablePrediction(true), PredictionDT(0.03f), PredictionTimeIncrement(0.001f),
+    Predictor(Predictor_ConstantVelocity), LastSampleTime(0),
     FRawMag(10), FAngV(20), 
     GyroOffset(), TiltAngleFilter(1000),
     EnableYawCorrection(false), MagCalibrated(false), MagNumReferences(0), MagRefIdx(-1), MagRefScore(0),
@@ -137,11 +139,32 @@ void SensorFusion::handleMessage(const MessageBodyFrame& msg)
     if (msg.Type != Message_BodyFrame || !IsMotionTrackingEnabled())
         return;
 
-    // Put the sensor readings into convenient local variables
-    Vector3f gyro  = msg.RotationRate; 
-    Vector3f accel = msg.Acceleration;
-    Vector3f mag   = msg.MagneticField;
+    updateOrientation(msg.RotationRate, msg.Acceleration, msg.MagneticField, msg.TimeDelta);
+    // Messages that don't come from a sensor have no time of their own.
+    LastSampleTime = msg.AbsoluteTimeSeconds ? msg.AbsoluteTimeSeconds : Timer::GetSeconds();
+}
 
+void SensorFusion::handleMessage(const MessageBodyFrameBatch& msg)
+{
+    if (msg.Type != Message_BodyFrameBatch || !IsMotionTrackingEnabled())
+        return;
+
+    // Samples depend on the orientation left by the previous one, so they are
+    // integrated in order; the checks and dispatch are paid once per report.
+    for (unsigned i = 0; i < msg.SampleCount; i++)
+    {
+        const MessageBodyFrameBatch::Sample& s = msg.Samples[i];
+        updateOrientation(s.RotationRate, s.Acceleration, s.MagneticField, s.TimeDelta);
+    }
+    if (msg.SampleCount)
+        LastSampleTime = msg.Samples[msg.SampleCount - 1].AbsoluteTimeSeconds;
+    if (LastSampleTime == 0)
+        LastSampleTime = Timer::GetSeconds();
+}
+
+void SensorFusion::updateOrientation(const Vector3f& gyro, const Vector3f& accel,
+                                     const Vector3f& mag, float deltaT)
+{
     // Insert current sensor data into filter history
     FRawMag.AddElement(mag);
     FAngV.AddElement(gyro);
@@ -150,7 +173,7 @@ void SensorFusion::handleMessage(const MessageBodyFrame& msg)
     Vector3f calMag = MagCalibrated ? GetCalibratedMagValue(FRawMag.Mean()) : FRawMag.Mean();
 
     // Set variables accessible through the class API
-    DeltaT = msg.TimeDelta;
+    DeltaT = deltaT;
     AngV   = gyro;
     A      = accel;
     RawMag = mag;  
@@ -277,40 +300,71 @@ void SensorFusion::handleMessage(const MessageBodyFrame& msg)
         Q.Normalize();
 }
 
-//  A predictive filter based on extrapolating the smoothed, current angular velocity
 Quatf SensorFusion::GetPredictedOrientation(float pdt)
 {		
     Lock::Locker lockScope(Handler.GetHandlerLock());
-    Quatf        qP = Q;
-    
-    if (EnablePrediction)
+    return predict(pdt);
+}
+
+Quatf SensorFusion::GetPredictedOrientationAt(double displayTime)
+{
+    // Don't extrapolate past anything a frame could plausibly wait for.
+    const float maxPdt = 0.1f;
+
+    Lock::Locker lockScope(Handler.GetHandlerLock());
+    if (LastSampleTime == 0)
+        return Q;
+
+    float pdt = (float)(displayTime - LastSampleTime);
+    return predict(Alg::Max(0.0f, Alg::Min(pdt, maxPdt)));
+}
+
+Quatf SensorFusion::predict(float pdt) const
+{
+    Quatf qP = Q;
+    if (!EnablePrediction)
+        return qP;
+
+    if (Predictor == Predictor_ConstantAcceleration)
     {
-        // This method assumes a constant angular velocity
-        Vector3f angVelF  = FAngV.SavitzkyGolaySmooth8();
-        float    angVelFL = angVelF.Length();
-
-        // Force back to raw measurement
-        angVelF  = AngV;
-        angVelFL = AngV.Length();
-
-        // Dynamic prediction interval: Based on angular velocity to reduce vibration
-        const float minPdt   = 0.001f;
-        const float slopePdt = 0.1f;
-        float       newpdt   = pdt;
-        float       tpdt     = minPdt + slopePdt * angVelFL;
-        if (tpdt < pdt)
-            newpdt = tpdt;
-        //LogText("PredictonDTs: %d\n",(int)(newpdt / PredictionTimeIncrement + 0.5f));
-
-        if (angVelFL > 0.001f)
-        {
-            Vector3f    rotAxisP      = angVelF / angVelFL;  
-            float       halfRotAngleP = angVelFL * newpdt * 0.5f;
-            float       sinaHRAP      = sin(halfRotAngleP);
-            Quatf       deltaQP(rotAxisP.x*sinaHRAP, rotAxisP.y*sinaHRAP,
-                                rotAxisP.z*sinaHRAP, cos(halfRotAngleP));
-            qP = Q * deltaQP;
-        }
+        // Integrate w(t) = w0 + a*t over the interval; the rotation vector
+        // w0*t + a*t^2/2 ignores coning, which is negligible at these spans.
+        Vector3f angVel    = FAngV.SavitzkyGolaySmooth8();
+        Vector3f angAccel  = FAngV.SavitzkyGolayDerivative12() / DeltaT;
+        Vector3f rotVec    = angVel * pdt + angAccel * (0.5f * pdt * pdt);
+        float    angle     = rotVec.Length();
+
+        if (angle > 0.0f)
+            qP = Q * Quatf(rotVec / angle, angle);
+        return qP;
+    }
+
+    //  A predictive filter based on extrapolating the smoothed, current angular velocity
+    // This method assumes a constant angular velocity
+    Vector3f angVelF  = FAngV.SavitzkyGolaySmooth8();
+    float    angVelFL = angVelF.Length();
+
+    // Force back to raw measurement
+    angVelF  = AngV;
+    angVelFL = AngV.Length();
+
+    // Dynamic prediction interval: Based on angular velocity to reduce vibration
+    const float minPdt   = 0.001f;
+    const float slopePdt = 0.1f;
+    float       newpdt   = pdt;
+    float       tpdt     = minPdt + slopePdt * angVelFL;
+    if (tpdt < pdt)
+        newpdt = tpdt;
+    //LogText("PredictonDTs: %d\n",(int)(newpdt / PredictionTimeIncrement + 0.5f));
+
+    if (angVelFL > 0.001f)
+    {
+        Vector3f    rotAxisP      = angVelF / angVelFL;  
+        float       halfRotAngleP = angVelFL * newpdt * 0.5f;
+        float       sinaHRAP      = sin(halfRotAngleP);
+        Quatf       deltaQP(rotAxisP.x*sinaHRAP, rotAxisP.y*sinaHRAP,
+                            rotAxisP.z*sinaHRAP, cos(halfRotAngleP));
+        qP = Q * deltaQP;
     }
     return qP;
 }    
@@ -331,13 +385,33 @@ void SensorFusion::BodyFrameHandler::OnMessage(const Message& msg)
 {
     if (msg.Type == Message_BodyFrame)
         pFusion->handleMessage(static_cast<const MessageBodyFrame&>(msg));
-    if (pFusion->pDelegate)
-        pFusion->pDelegate->OnMessage(msg);
+    else if (msg.Type == Message_BodyFrameBatch)
+        pFusion->handleMessage(static_cast<const MessageBodyFrameBatch&>(msg));
+
+    MessageHandler* delegate = pFusion->pDelegate;
+    if (!delegate)
+        return;
+
+    // Unpack batches for delegates that only expect individual frames.
+    if (msg.Type == Message_BodyFrameBatch && !delegate->SupportsMessageType(Message_BodyFrameBatch))
+    {
+        const MessageBodyFrameBatch& batch = static_cast<const MessageBodyFrameBatch&>(msg);
+        MessageBodyFrame             frame(batch.pDevice);
+        for (unsigned i = 0; i < batch.SampleCount; i++)
+        {
+            batch.GetFrame(i, &frame);
+            delegate->OnMessage(frame);
+        }
+    }
+    else
+    {
+        delegate->OnMessage(msg);
+    }
 }
 
 bool SensorFusion::BodyFrameHandler::SupportsMessageType(MessageType type) const
 {
-    return (type == Message_BodyFrame);
+    return (type == Message_BodyFrame) || (type == Message_BodyFrameBatch);
 }
 
 // Writes the current calibration for a particular device to a device profile file
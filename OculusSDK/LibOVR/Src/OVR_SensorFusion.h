@@ -45,7 +45,8 @@ namespace OVR {
 // rotation matrix or Euler angles.
 //
 // The class can operate in two ways:
-//  - By user manually passing MessageBodyFrame messages to the OnMessage() function. 
+//  - By user manually passing MessageBodyFrame or MessageBodyFrameBatch messages
+//    to the OnMessage() function.
 //  - By attaching SensorFusion to a SensorDevice, in which case it will
 //    automatically handle notifications from that device.
 
@@ -83,6 +84,10 @@ public:
     // Get predicted orientaion in the near future; predictDt is lookahead amount in seconds.
     Quatf       GetPredictedOrientation(float predictDt);
     Quatf       GetPredictedOrientation()   { return GetPredictedOrientation(PredictionDT); }
+    // Get predicted orientation at an absolute time on the Timer::GetSeconds() clock,
+    // typically when the frame being rendered is expected to reach the display.
+    // The lookahead is measured from when the last sensor sample was taken.
+    Quatf       GetPredictedOrientationAt(double displayTime);
 
     // Obtain the last absolute acceleration reading, in m/s^2.
     Vector3f    GetAcceleration() const     { return lockedGet(&A); }
@@ -118,6 +123,19 @@ public:
     void		SetPredictionEnabled(bool enable = true)    { EnablePrediction = enable; }    
     bool		IsPredictionEnabled()                       { return EnablePrediction; }
 
+    // Model used to extrapolate orientation.
+    enum PredictorType
+    {
+        // Constant angular velocity, with the lookahead shortened at low speed
+        // to reduce vibration.
+        Predictor_ConstantVelocity,
+        // Smoothed angular velocity plus angular acceleration estimated from
+        // the gyro history; tracks the start and end of head turns better.
+        Predictor_ConstantAcceleration
+    };
+    void        SetPredictor(PredictorType predictor)       { Predictor = predictor; }
+    PredictorType GetPredictor() const                      { return Predictor; }
+
 
     // *** Accelerometer/Gravity Correction Control
 
@@ -180,6 +198,11 @@ public:
         OVR_ASSERT(!IsAttachedToSensor());
         handleMessage(msg);
     }
+    void        OnMessage(const MessageBodyFrameBatch& msg)
+    {
+        OVR_ASSERT(!IsAttachedToSensor());
+        handleMessage(msg);
+    }
 
     void        SetDelegateMessageHandler(MessageHandler* handler)
     { pDelegate = handler; }
@@ -200,6 +223,12 @@ private:
 
     // Internal handler for messages; bypasses error checking.
     void        handleMessage(const MessageBodyFrame& msg);
+    void        handleMessage(const MessageBodyFrameBatch& msg);
+    // Extrapolates Q by pdt seconds; called within the handler lock.
+    Quatf       predict(float pdt) const;
+    // Integrates a single sample into the orientation estimate.
+    void        updateOrientation(const Vector3f& gyro, const Vector3f& accel,
+                                  const Vector3f& mag, float deltaT);
 
     // Set the magnetometer's reference orientation for use in yaw correction
     // The supplied mag is an uncalibrated value
@@ -237,6 +266,9 @@ private:
     bool              EnablePrediction;
     float             PredictionDT;
 	float             PredictionTimeIncrement;
+    PredictorType     Predictor;
+    // Timer::GetSeconds() time the last integrated sample was taken; 0 before any.
+    double            LastSampleTime;
 
     SensorFilter      FRawMag;
     SensorFilter      FAngV;
@@ -526,6 +526,7 @@ SensorDeviceImpl::SensorDeviceImpl(SensorDeviceCreateDesc* createDesc)
     SequenceValid  = false;
     LastSampleCount= 0;
     LastTimestamp   = 0;
+    FullTimestamp   = 0;
 
     OldCommandId = 0;
 }
@@ -615,6 +616,16 @@ void SensorDeviceImpl::OnInputReport(UByte* pData, UInt32 length)
     }
 }
 
+void SensorDeviceImpl::OnInputReports(UByte* pData, UInt32 stride, const UInt32* lengths, UInt32 count)
+{
+    // Hold the handler lock across the burst so that it is taken once and
+    // readers see the state after all drained reports.
+    Lock::Locker scopeLock(HandlerRef.GetLock());
+
+    for (UInt32 i = 0; i < count; i++)
+        OnInputReport(pData + i * stride, lengths[i]);
+}
+
 UInt64 SensorDeviceImpl::OnTicks(UInt64 ticksMks)
 {
 
@@ -828,35 +839,33 @@ void SensorDeviceImpl::onTrackerMessage(TrackerMessage* message)
         return;
     
     const float     timeUnit   = (1.0f / 1000.f);
+    const double    receivedTime = Timer::GetSeconds();
     TrackerSensors& s = message->Sensors;
     
 
     // Call OnMessage() within a lock to avoid conflicts with handlers.
     Lock::Locker scopeLock(HandlerRef.GetLock());
 
+    MessageHandler*       handler = HandlerRef.GetHandler();
+    MessageBodyFrameBatch batch(this);
 
     if (SequenceValid)
     {
-        unsigned timestampDelta;
-
-        if (s.Timestamp < LastTimestamp)
-            timestampDelta = ((((int)s.Timestamp) + 0x10000) - (int)LastTimestamp);
-        else
-            timestampDelta = (s.Timestamp - LastTimestamp);
+        // Timestamps count milliseconds, wrapping at 16 bits.
+        unsigned timestampDelta = (UInt16)(s.Timestamp - LastTimestamp);
+        FullTimestamp += timestampDelta;
 
         // If we missed a small number of samples, replicate the last sample.
         if ((timestampDelta > LastSampleCount) && (timestampDelta <= 254))
         {
-            if (HandlerRef.GetHandler())
+            if (handler)
             {
-                MessageBodyFrame sensors(this);
-                sensors.TimeDelta     = (timestampDelta - LastSampleCount) * timeUnit;
-                sensors.Acceleration  = LastAcceleration;
-                sensors.RotationRate  = LastRotationRate;
-                sensors.MagneticField = LastMagneticField;
-                sensors.Temperature   = LastTemperature;
-
-                HandlerRef.GetHandler()->OnMessage(sensors);
+                MessageBodyFrameBatch::Sample& fill = batch.Samples[batch.SampleCount++];
+                fill.TimeDelta     = (timestampDelta - LastSampleCount) * timeUnit;
+                fill.Acceleration  = LastAcceleration;
+                fill.RotationRate  = LastRotationRate;
+                fill.MagneticField = LastMagneticField;
+                fill.Temperature   = LastTemperature;
             }
         }
     }
@@ -866,44 +875,78 @@ void SensorDeviceImpl::onTrackerMessage(TrackerMessage* message)
         LastRotationRate = Vector3f(0);
         LastMagneticField= Vector3f(0);
         LastTemperature  = 0;
+        FullTimestamp    = s.Timestamp;
+        TimeFilter.Reset();
         SequenceValid    = true;
     }
 
     LastSampleCount = s.SampleCount;
     LastTimestamp   = s.Timestamp;
 
+    // Timestamp is that of the report's first sample. The last sample is mapped
+    // onto host time, and the others are placed before it on the device clock.
+    UInt64 lastTick       = FullTimestamp + (s.SampleCount ? s.SampleCount - 1 : 0);
+    double lastSampleTime = TimeFilter.SampleToSystemTime(lastTick * 0.001, receivedTime);
+
     bool convertHMDToSensor = (Coordinates == Coord_Sensor) && (HWCoordinates == Coord_HMD);
 
-    if (HandlerRef.GetHandler())
+    if (handler)
     {
-        MessageBodyFrame sensors(this);                
-        UByte            iterations = s.SampleCount;
+        UByte    iterations = s.SampleCount;
+        float    timeDelta;
+        Vector3f magneticField = MagFromBodyFrameUpdate(s, convertHMDToSensor);
+        float    temperature   = s.Temperature * 0.01f;
 
         if (s.SampleCount > 3)
         {
-            iterations        = 3;
-            sensors.TimeDelta = (s.SampleCount - 2) * timeUnit;
+            iterations = 3;
+            timeDelta  = (s.SampleCount - 2) * timeUnit;
         }
         else
         {
-            sensors.TimeDelta = timeUnit;
+            timeDelta  = timeUnit;
         }
 
         for (UByte i = 0; i < iterations; i++)
-        {            
-            sensors.Acceleration = AccelFromBodyFrameUpdate(s, i, convertHMDToSensor);
-            sensors.RotationRate = EulerFromBodyFrameUpdate(s, i, convertHMDToSensor);
-            sensors.MagneticField= MagFromBodyFrameUpdate(s, convertHMDToSensor);
-            sensors.Temperature  = s.Temperature * 0.01f;
-            HandlerRef.GetHandler()->OnMessage(sensors);
+        {
+            MessageBodyFrameBatch::Sample& sample = batch.Samples[batch.SampleCount++];
+            sample.Acceleration = AccelFromBodyFrameUpdate(s, i, convertHMDToSensor);
+            sample.RotationRate = EulerFromBodyFrameUpdate(s, i, convertHMDToSensor);
+            sample.MagneticField= magneticField;
+            sample.Temperature  = temperature;
+            sample.TimeDelta    = timeDelta;
+            sample.AbsoluteTimeSeconds = lastSampleTime - (iterations - 1 - i) * 0.001;
             // TimeDelta for the last two sample is always fixed.
-            sensors.TimeDelta = timeUnit;
+            timeDelta = timeUnit;
         }
 
-        LastAcceleration = sensors.Acceleration;
-        LastRotationRate = sensors.RotationRate;
-        LastMagneticField= sensors.MagneticField;
-        LastTemperature  = sensors.Temperature;
+        // A replicated sample stands in for those missed just before this report.
+        if (batch.SampleCount > iterations)
+            batch.Samples[0].AbsoluteTimeSeconds = lastSampleTime - Alg::Max(1, (int)s.SampleCount) * 0.001;
+
+        // Handlers that understand batches get the whole report in one call.
+        if (handler->SupportsMessageType(Message_BodyFrameBatch))
+        {
+            handler->OnMessage(batch);
+        }
+        else
+        {
+            MessageBodyFrame sensors(this);
+            for (unsigned i = 0; i < batch.SampleCount; i++)
+            {
+                batch.GetFrame(i, &sensors);
+                handler->OnMessage(sensors);
+            }
+        }
+
+        if (batch.SampleCount)
+        {
+            const MessageBodyFrameBatch::Sample& last = batch.Samples[batch.SampleCount - 1];
+            LastAcceleration = last.Acceleration;
+            LastRotationRate = last.RotationRate;
+            LastMagneticField= last.MagneticField;
+            LastTemperature  = last.Temperature;
+        }
     }
     else
     {
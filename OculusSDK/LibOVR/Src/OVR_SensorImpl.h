@@ -28,6 +28,7 @@ limitations under the License.
 #define OVR_SensorImpl_h
 
 #include "OVR_HIDDeviceImpl.h"
+#include "OVR_SensorTimeFilter.h"
 
 namespace OVR {
     
@@ -190,6 +191,7 @@ public:
 
     // HIDDevice::Notifier interface.
     virtual void OnInputReport(UByte* pData, UInt32 length);
+    virtual void OnInputReports(UByte* pData, UInt32 stride, const UInt32* lengths, UInt32 count);
     virtual UInt64 OnTicks(UInt64 ticksMks);
 
     // HMD-Mounted sensor has a different coordinate frame.
@@ -245,8 +247,12 @@ protected:
     UInt64      NextKeepAliveTicks;
 
     bool        SequenceValid;
-    SInt16      LastTimestamp;
+    UInt16      LastTimestamp;
     UByte       LastSampleCount;
+    // Device timestamp of the last report unwrapped to 64 bits, in ms ticks,
+    // and the mapping of those ticks onto host time.
+    UInt64      FullTimestamp;
+    SensorTimeFilter TimeFilter;
     float       LastTemperature;
     Vector3f    LastAcceleration;
     Vector3f    LastRotationRate;
@@ -0,0 +1,158 @@
+/************************************************************************************
+
+Filename    :   OVR_SensorTimeFilter.cpp
+Content     :   Maps sensor timestamps onto the host clock
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*************************************************************************************/
+
+#include "OVR_SensorTimeFilter.h"
+#include "Kernel/OVR_Alg.h"
+
+namespace OVR {
+
+// Device time covered by each window of the history, in seconds.
+static const double SensorTime_WindowSeconds   = 1.0;
+// A sample arriving this long before the mapping says it was taken means the
+// device clock has restarted.
+static const double SensorTime_MaxMappingError = 0.25;
+// Crystal oscillators are good to tens of ppm; larger slopes come from noise.
+static const double SensorTime_MaxDrift        = 1e-3;
+
+
+SensorTimeFilter::SensorTimeFilter()
+{
+    Reset();
+}
+
+void SensorTimeFilter::Reset()
+{
+    Valid          = false;
+    BaseDeviceTime = 0;
+    LastDeviceTime = 0;
+    Offset         = 0;
+    Drift          = 0;
+    CurrentWindow  = 0;
+    WindowsFilled  = 0;
+    WindowStart    = 0;
+}
+
+double SensorTimeFilter::SampleToSystemTime(double deviceTime, double receivedTime)
+{
+    double offset = receivedTime - deviceTime;
+
+    if (Valid && ((deviceTime < LastDeviceTime) ||
+                  (receivedTime < mapTime(deviceTime) - SensorTime_MaxMappingError)))
+    {
+        Reset();
+    }
+
+    if (!Valid)
+    {
+        Valid          = true;
+        BaseDeviceTime = deviceTime;
+        Offset         = offset;
+        startWindow(deviceTime, offset);
+    }
+    else
+    {
+        Window& window = Windows[CurrentWindow];
+        if (offset < window.MinOffset)
+        {
+            window.MinOffset  = offset;
+            window.DeviceTime = deviceTime;
+        }
+
+        if (deviceTime - WindowStart >= SensorTime_WindowSeconds)
+        {
+            WindowsFilled = Alg::Min(WindowsFilled + 1, (int)WindowCount);
+            fit();
+            CurrentWindow = (CurrentWindow + 1) % WindowCount;
+            startWindow(deviceTime, offset);
+        }
+    }
+    LastDeviceTime = deviceTime;
+
+    // A sample can't arrive before it was taken, so one that arrives sooner
+    // than the line allows lowers it at once.
+    double systemTime = mapTime(deviceTime);
+    if (systemTime > receivedTime)
+    {
+        Offset    -= systemTime - receivedTime;
+        systemTime = receivedTime;
+    }
+    return systemTime;
+}
+
+void SensorTimeFilter::startWindow(double deviceTime, double offset)
+{
+    Window& window    = Windows[CurrentWindow];
+    window.DeviceTime = deviceTime;
+    window.MinOffset  = offset;
+    WindowStart       = deviceTime;
+}
+
+void SensorTimeFilter::fit()
+{
+    int    count = WindowsFilled;
+    double drift = Drift;
+
+    // Least-squares slope through the window minima; with a short history the
+    // previous estimate is kept.
+    if (count >= MinFitWindows)
+    {
+        double meanX = 0, meanY = 0;
+        for (int i = 0; i < count; i++)
+        {
+            const Window& w = Windows[(CurrentWindow + WindowCount - i) % WindowCount];
+            meanX += w.DeviceTime - BaseDeviceTime;
+            meanY += w.MinOffset;
+        }
+        meanX /= count;
+        meanY /= count;
+
+        double sxx = 0, sxy = 0;
+        for (int i = 0; i < count; i++)
+        {
+            const Window& w  = Windows[(CurrentWindow + WindowCount - i) % WindowCount];
+            double        dx = w.DeviceTime - BaseDeviceTime - meanX;
+            sxx += dx * dx;
+            sxy += dx * (w.MinOffset - meanY);
+        }
+        if (sxx > 0)
+            drift = Alg::Clamp(sxy / sxx, -SensorTime_MaxDrift, SensorTime_MaxDrift);
+    }
+
+    // Lower the line onto the lowest minimum, so that it runs under all of them.
+    double offset = 0;
+    for (int i = 0; i < count; i++)
+    {
+        const Window& w = Windows[(CurrentWindow + WindowCount - i) % WindowCount];
+        double        o = w.MinOffset - drift * (w.DeviceTime - BaseDeviceTime);
+        if ((i == 0) || (o < offset))
+            offset = o;
+    }
+
+    Offset = offset;
+    Drift  = drift;
+}
+
+} // namespace OVR
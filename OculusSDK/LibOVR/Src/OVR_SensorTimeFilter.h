@@ -0,0 +1,103 @@
+/************************************************************************************
+
+Filename    :   OVR_SensorTimeFilter.h
+Content     :   Maps sensor timestamps onto the host clock
+Created     :   October 18, 2026
+Notes       :
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*************************************************************************************/
+
+#ifndef OVR_SensorTimeFilter_h
+#define OVR_SensorTimeFilter_h
+
+#include "Kernel/OVR_Types.h"
+
+namespace OVR {
+
+//-------------------------------------------------------------------------------------
+// ***** SensorTimeFilter
+
+// SensorTimeFilter converts device timestamps into Timer::GetSeconds() time,
+// so that samples can be related to frame and display times.
+//
+// A sample reaches the host some variable time after it was taken, so the
+// difference between arrival and device time is smallest for the samples that
+// were delayed least. The filter keeps the smallest difference seen in each
+// window of device time, and fits a line under the recent minima. The line's
+// slope is the drift of the device clock against the host clock. The times it
+// returns are when each sample would have arrived with the least delay seen,
+// which is as close as the host can tell to when it was taken.
+
+class SensorTimeFilter
+{
+public:
+    SensorTimeFilter();
+
+    // Forgets what has been learned; the next sample starts a new mapping.
+    // Should be called when the device's timestamps restart.
+    void    Reset();
+
+    // Returns the host time of a sample taken at deviceTime (in seconds on the
+    // device clock, unwrapped) that arrived at receivedTime (Timer::GetSeconds()).
+    // Samples should be passed in the order they were taken.
+    double  SampleToSystemTime(double deviceTime, double receivedTime);
+
+    // Rate of the host clock relative to the device clock, minus one; for
+    // example, 50e-6 means the device clock runs 50 ppm slow. 0 until enough
+    // of the history has been collected to estimate it.
+    double  GetDrift() const        { return Drift; }
+
+private:
+    enum
+    {
+        WindowCount     = 16,
+        MinFitWindows   = 4
+    };
+
+    struct Window
+    {
+        double  DeviceTime;     // Of the sample that arrived soonest.
+        double  MinOffset;      // Its arrival time minus its device time.
+    };
+
+    void    startWindow(double deviceTime, double offset);
+    // Refits Offset and Drift to the completed windows.
+    void    fit();
+
+    double  mapTime(double deviceTime) const
+    {
+        return deviceTime + Offset + Drift * (deviceTime - BaseDeviceTime);
+    }
+
+    bool    Valid;
+    double  BaseDeviceTime;
+    double  LastDeviceTime;
+    double  Offset;
+    double  Drift;
+
+    Window  Windows[WindowCount];
+    int     CurrentWindow;
+    int     WindowsFilled;      // Completed windows in the history.
+    double  WindowStart;
+};
+
+} // namespace OVR
+
+#endif // OVR_SensorTimeFilter_h
@@ -25,121 +25,11 @@ limitations under the License.
 ************************************************************************************/
 
 #include "OVR_ThreadCommandQueue.h"
+#include "Kernel/OVR_MPSCRing.h"
 
 namespace OVR {
 
 
-//------------------------------------------------------------------------
-// ***** CircularBuffer
-
-// CircularBuffer is a FIFO buffer implemented in a single block of memory,
-// which allows writing and reading variable-size data chucks. Write fails
-// if buffer is full.
-
-class CircularBuffer
-{
-    enum {
-        AlignSize = 16,
-        AlignMask = AlignSize - 1
-    };
-
-    UByte*  pBuffer;
-    UPInt   Size;
-    UPInt   Tail;   // Byte offset of next item to be popped.
-    UPInt   Head;   // Byte offset of where next push will take place.
-    UPInt   End;    // When Head < Tail, this is used instead of Size.    
-
-    inline UPInt roundUpSize(UPInt size)
-    { return (size + AlignMask) & ~(UPInt)AlignMask; }
-
-public:
-
-    CircularBuffer(UPInt size)
-        : Size(size), Tail(0), Head(0), End(0)
-    {
-        pBuffer = (UByte*)OVR_ALLOC_ALIGNED(roundUpSize(size), AlignSize);
-    }
-    ~CircularBuffer()
-    {
-        // For ThreadCommands, we must consume everything before shutdown.
-        OVR_ASSERT(IsEmpty());
-        OVR_FREE_ALIGNED(pBuffer);
-    }
-
-    bool    IsEmpty() const { return (Head == Tail); }
-
-    // Allocates a state block of specified size and advances pointers,
-    // returning 0 if buffer is full.
-    UByte*  Write(UPInt size);
-
-    // Returns a pointer to next available data block; 0 if none available.
-    UByte*  ReadBegin()
-    { return (Head != Tail) ? (pBuffer + Tail) : 0; }
-    // Consumes data of specified size; this must match size passed to Write.
-    void    ReadEnd(UPInt size);
-};
-
-
-// Allocates a state block of specified size and advances pointers,
-// returning 0 if buffer is full.
-UByte* CircularBuffer::Write(UPInt size)
-{
-    UByte* p = 0;
-
-    size = roundUpSize(size);
-    // Since this is circular buffer, always allow at least one item.
-    OVR_ASSERT(size < Size/2);
-
-    if (Head >= Tail)
-    {
-        OVR_ASSERT(End == 0);
-        
-        if (size <= (Size - Head))
-        {
-            p    = pBuffer + Head;
-            Head += size;
-        }
-        else if (size < Tail)
-        {
-            p    = pBuffer;
-            End  = Head;
-            Head = size;
-            OVR_ASSERT(Head != Tail);
-        }
-    }
-    else
-    {
-        OVR_ASSERT(End != 0);
-
-        if ((Tail - Head) > size)
-        {
-            p    = pBuffer + Head;
-            Head += size;
-            OVR_ASSERT(Head != Tail);
-        }
-    }
-
-    return p;
-}
-
-void CircularBuffer::ReadEnd(UPInt size)
-{
-    OVR_ASSERT(Head != Tail);
-    size = roundUpSize(size);
-    
-    Tail += size;        
-    if (Tail == End)
-    {
-        Tail = End = 0;
-    }
-    else if (Tail == Head)
-    {        
-        OVR_ASSERT(End == 0);
-        Tail = Head = 0;
-    }
-}
-
-
 //-------------------------------------------------------------------------------------
 // ***** ThreadCommand
 
@@ -170,6 +60,10 @@ void ThreadCommand::PopBuffer::Execute()
 }
 
 //-------------------------------------------------------------------------------------
+// ***** ThreadCommandQueueImpl
+
+// Commands are kept in an MPSCRing of fixed size slots, so pushing never takes a
+// lock or allocates.
 
 class ThreadCommandQueueImpl : public NewOverrideBase
 {
@@ -178,11 +72,7 @@ class ThreadCommandQueueImpl : public NewOverrideBase
     
 public:
 
-    ThreadCommandQueueImpl(ThreadCommandQueue* queue)
-        : pQueue(queue), CommandBuffer(2048),
-          ExitEnqueued(false), ExitProcessed(false)
-    {
-    }
+    ThreadCommandQueueImpl(ThreadCommandQueue* queue);
     ~ThreadCommandQueueImpl();
 
 
@@ -200,109 +90,84 @@ public:
 
         virtual void Execute() const
         {
-            Lock::Locker lock(&pImpl->QueueLock);
             pImpl->ExitProcessed = true;
         }
         virtual ThreadCommand* CopyConstruct(void* p) const 
         { return Construct<ExitCommand>(p, *this); }
     };
 
+private:
+    enum { SlotCount = 64 };
 
-    NotifyEvent* AllocNotifyEvent_NTS()
-    {
-        NotifyEvent* p = AvailableEvents.GetFirst();
-
-        if (!AvailableEvents.IsNull(p))
-            p->RemoveNode();        
-        else
-            p = new NotifyEvent;
-        return p;
-    }
-
-    void         FreeNotifyEvent_NTS(NotifyEvent* p)
+    union CommandSlot
     {
-        AvailableEvents.PushBack(p);
-    }
+        UByte   Data[ThreadCommand::MaxCommandSize];
+        UPInt   Align;
+    };
 
-    void        FreeNotifyEvents_NTS()
-    {
-        while(!AvailableEvents.IsEmpty())
-        {
-            NotifyEvent* p = AvailableEvents.GetFirst();
-            p->RemoveNode();
-            delete p;
-        }
-    }
+    bool    push(const ThreadCommand& command, NotifyEvent* completeEvent);
 
     ThreadCommandQueue* pQueue;
-    Lock                QueueLock;
-    volatile bool       ExitEnqueued;
+    AtomicInt<SInt32>   ExitEnqueued;
     volatile bool       ExitProcessed;
-    List<NotifyEvent>   AvailableEvents;
-    List<NotifyEvent>   BlockedProducers;
-    CircularBuffer      CommandBuffer;
+    // Pushes are bracketed with BeginPush/EndPush around the ExitEnqueued check.
+    MPSCRing<CommandSlot, SlotCount> Commands;
 };
 
 
+ThreadCommandQueueImpl::ThreadCommandQueueImpl(ThreadCommandQueue* queue)
+    : pQueue(queue), ExitEnqueued(0), ExitProcessed(false)
+{
+}
 
 ThreadCommandQueueImpl::~ThreadCommandQueueImpl()
 {
-    Lock::Locker lock(&QueueLock);
-    OVR_ASSERT(BlockedProducers.IsEmpty());
-    FreeNotifyEvents_NTS();
+    // For ThreadCommands, we must consume everything before shutdown.
+    OVR_ASSERT(!Commands.Peek());
 }
 
 bool ThreadCommandQueueImpl::PushCommand(const ThreadCommand& command)
 {
-    ThreadCommand::NotifyEvent* completeEvent = 0;
-    ThreadCommand::NotifyEvent* queueAvailableEvent = 0;
-
-    // Repeat  writing command into buffer until it is available.    
-    do {
-
-        { // Lock Scope
-            Lock::Locker lock(&QueueLock);
+    if (!command.NeedsWait())
+        return push(command, 0);
 
-            if (queueAvailableEvent)
-            {
-                FreeNotifyEvent_NTS(queueAvailableEvent);
-                queueAvailableEvent = 0;
-            }
-
-            // Don't allow any commands after PushExitCommand() is called.
-            if (ExitEnqueued && !command.ExitFlag)
-                return false;
+    // The waiting producer owns the completion event, so nothing is allocated.
+    NotifyEvent completeEvent;
+    if (!push(command, &completeEvent))
+        return false;
+    completeEvent.Wait();
+    return true;
+}
 
+bool ThreadCommandQueueImpl::push(const ThreadCommand& command, NotifyEvent* completeEvent)
+{
+    OVR_ASSERT(command.GetSize() <= ThreadCommand::MaxCommandSize);
 
-            bool   bufferWasEmpty = CommandBuffer.IsEmpty();
-            UByte* buffer = CommandBuffer.Write(command.GetSize());
-            if  (buffer)
-            {
-                ThreadCommand* c = command.CopyConstruct(buffer);
-                if (c->NeedsWait())
-                    completeEvent = c->pEvent = AllocNotifyEvent_NTS();
-                // Signal-waker consumer when we add data to buffer.
-                if (bufferWasEmpty)
-                    pQueue->OnPushNonEmpty_Locked();
-                break;
-            }
+    Commands.BeginPush();
 
-            queueAvailableEvent = AllocNotifyEvent_NTS();
-            BlockedProducers.PushBack(queueAvailableEvent);
-        } // Lock Scope
+    // Don't allow any commands after PushExitCommand() is called.
+    if (ExitEnqueued && !command.ExitFlag)
+    {
+        Commands.EndPush();
+        return false;
+    }
 
-        queueAvailableEvent->Wait();
+    // A full ring means the consumer is a whole ring of commands behind. This is
+    // rare enough that backing off beats tracking blocked producers.
+    UInt32       pos;
+    CommandSlot* slot;
+    while ((slot = Commands.Claim(&pos)) == 0)
+        Thread::MSleep(1);
 
-    } while(1);
+    ThreadCommand* c = command.CopyConstruct(slot->Data);
+    c->pEvent = completeEvent;
+    bool wake = Commands.Publish(pos);
 
-    // Command was enqueued, wait if necessary.
-    if (completeEvent)
-    {
-        completeEvent->Wait();
-        Lock::Locker lock(&QueueLock);
-        FreeNotifyEvent_NTS(completeEvent);
-    }
+    Commands.EndPush();
 
+    // Signal-wake consumer if it ran out of commands.
+    if (wake)
+        pQueue->OnPushNonEmpty();
     return true;
 }
 
@@ -310,26 +175,21 @@ bool ThreadCommandQueueImpl::PushCommand(const ThreadCommand& command)
 // Pops the next command from the thread queue, if any is available.
 bool ThreadCommandQueueImpl::PopCommand(ThreadCommand::PopBuffer* popBuffer)
 {    
-    Lock::Locker lock(&QueueLock);
+    CommandSlot* slot = Commands.Peek();
 
-    UByte* buffer = CommandBuffer.ReadBegin();
-    if (!buffer)
+    if (!slot)
     {
-        // Notify thread while in lock scope, enabling initialization of wait.
-        pQueue->OnPopEmpty_Locked();
-        return false;
+        // Let the thread reset its wait state before asking producers for a
+        // wakeup, then look once more.
+        pQueue->OnPopEmpty();
+        Commands.RequestWake();
+        slot = Commands.Peek();
+        if (!slot)
+            return false;
     }
 
-    popBuffer->InitFromBuffer(buffer);
-    CommandBuffer.ReadEnd(popBuffer->GetSize());
-
-    if (!BlockedProducers.IsEmpty())
-    {
-        ThreadCommand::NotifyEvent* queueAvailableEvent = BlockedProducers.GetFirst();
-        queueAvailableEvent->RemoveNode();
-        queueAvailableEvent->PulseEvent();
-        // Event is freed later by waiter.
-    }    
+    popBuffer->InitFromBuffer(slot->Data);
+    Commands.Pop();
     return true;
 }
 
@@ -362,12 +222,12 @@ void ThreadCommandQueue::PushExitCommand(bool wait)
     //  - Second, the actual exit call is processed on the consumer thread, flushing
     //    any prior commands.
     //    IsExiting() only returns true after exit has flushed.
-    {
-        Lock::Locker lock(&pImpl->QueueLock);
-        if (pImpl->ExitEnqueued)
-            return;
-        pImpl->ExitEnqueued = true;
-    }
+    if (!pImpl->ExitEnqueued.CompareAndSet_Sync(0, 1))
+        return;
+
+    // Pushes that got past the ExitEnqueued check must be published ahead of
+    // the exit command, so that nothing is left behind it in the ring.
+    pImpl->Commands.WaitForPushes();
 
     PushCommand(ThreadCommandQueueImpl::ExitCommand(pImpl, wait));
 }
@@ -29,7 +29,6 @@ limitations under the License.
 #define OVR_ThreadCommandQueue_h
 
 #include "Kernel/OVR_Types.h"
-#include "Kernel/OVR_List.h"
 #include "Kernel/OVR_Atomic.h"
 #include "Kernel/OVR_Threads.h"
 
@@ -47,9 +46,13 @@ class ThreadCommand
 {
 public:    
 
+    // Largest command that fits in a queue slot or PopBuffer.
+    enum { MaxCommandSize = 256 };
+
     // NotifyEvent is used by ThreadCommandQueue::PushCallAndWait to notify the
-    // calling (producer)  thread when command is completed or queue slot is available.
-    class NotifyEvent : public ListNode<NotifyEvent>, public NewOverrideBase
+    // calling (producer) thread when command is completed. It lives on the
+    // producer's stack for the duration of the call.
+    class NotifyEvent : public NewOverrideBase
     {
         Event E;
     public:   
@@ -63,7 +66,7 @@ public:
     // by ThreadCommandQueue::PopCommand. 
     class PopBuffer
     {
-        enum { MaxSize = 256 };
+        enum { MaxSize = MaxCommandSize };
 
         UPInt Size;
         union {            
@@ -247,9 +250,11 @@ public:
 
 
     // These two virtual functions serve as notifications for derived
-    // thread waiting.    
-    virtual void OnPushNonEmpty_Locked() { }
-    virtual void OnPopEmpty_Locked()     { }
+    // thread waiting. The queue is lock-free, so they may be called concurrently:
+    // OnPopEmpty on the consumer thread before it waits, OnPushNonEmpty on a
+    // producer thread after a command is published while the consumer was idle.
+    virtual void OnPushNonEmpty() { }
+    virtual void OnPopEmpty()     { }
 
 
     // *** PushCall with no result
@@ -36,6 +36,7 @@ limitations under the License.
 #include "Kernel/OVR_Timer.h"
 #include "Kernel/OVR_Std.h"
 #include "Kernel/OVR_Log.h"
+#include "Kernel/OVR_TrackingAllocator.h"
 
 DWORD Debug_WaitedObjectCount = 0;
 
@@ -130,6 +131,11 @@ ThreadId DeviceManager::GetThreadId() const
 {
     return pThread->GetThreadId();
 }
+
+Thread* DeviceManager::GetThread() const
+{
+    return pThread;
+}
     
 bool DeviceManager::GetHIDDeviceDesc(const String& path, HIDDeviceDesc* pdevDesc) const
 {
@@ -174,6 +180,7 @@ int DeviceManagerThread::Run()
 
     SetThreadName("OVR::DeviceManagerThread");
     LogText("OVR::DeviceManagerThread - running (ThreadId=0x%X).\n", GetThreadId());
+    TrackingAllocator::SetThreadSubsystem(AllocSubsystem_Sensor);
   
 	if (!pStatusObject->Initialize())
 	{
@@ -397,6 +404,11 @@ void DeviceManagerThread::DetachDeviceManager()
 
 // Creates a new DeviceManager and initializes OVR.
 DeviceManager* DeviceManager::Create()
+{
+    return Create(DeviceManagerOptions());
+}
+
+DeviceManager* DeviceManager::Create(const DeviceManagerOptions& options)
 {
 
     if (!System::IsInitialized())
@@ -412,7 +424,9 @@ DeviceManager* DeviceManager::Create()
     if (manager)
     {
         if (manager->Initialize(0))
-        {            
+        {
+            manager->ApplyOptions(options);
+
             manager->AddFactory(&SensorDeviceFactory::Instance);
             manager->AddFactory(&LatencyTestDeviceFactory::Instance);
             manager->AddFactory(&Win32::HMDDeviceFactory::Instance);
@@ -52,6 +52,7 @@ public:
 
     virtual ThreadCommandQueue* GetThreadQueue();
     virtual ThreadId GetThreadId() const;
+    virtual Thread*  GetThread() const;
 
     virtual DeviceEnumerator<> EnumerateDevicesEx(const DeviceEnumerationArgs& args);    
 
@@ -78,8 +79,8 @@ public:
     virtual int Run();
 
     // ThreadCommandQueue notifications for CommandEvent handling.
-    virtual void OnPushNonEmpty_Locked() { ::SetEvent(hCommandEvent); }
-    virtual void OnPopEmpty_Locked()     { ::ResetEvent(hCommandEvent); }
+    virtual void OnPushNonEmpty() { ::SetEvent(hCommandEvent); }
+    virtual void OnPopEmpty()     { ::ResetEvent(hCommandEvent); }
 
 
     // Notifier used for different updates (EVENT or regular timing or messages).
@@ -0,0 +1,270 @@
+/************************************************************************************
+
+Filename    :   AllocatorBench.cpp
+Content     :   Speed benchmark of PoolAllocator against the malloc-based
+                DefaultAllocator
+Created     :   October 18, 2026
+Notes       :   Usage: AllocatorBench
+
+                Each allocator in turn is installed with System::Init and runs
+                the same workloads, shaped like the tree's own heap use. Times
+                are the median of several runs, in nanoseconds per allocation
+                including its matching free, except for the growth workload,
+                which is timed per appended element.
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*************************************************************************************/
+
+#include "OVR.h"
+#include "Kernel/OVR_PoolAllocator.h"
+#include "Kernel/OVR_MPSCRing.h"
+#include "Kernel/OVR_Timer.h"
+
+#include <stdio.h>
+
+using namespace OVR;
+
+// Allocations timed per workload run.
+static const UPInt OpsPerRun = 2000000;
+static const int   RunCount  = 5;
+
+// Deterministic pseudo-random numbers, so both allocators see the same sizes.
+struct Random
+{
+    UInt32 State;
+    Random(UInt32 seed) : State(seed) { }
+    UInt32 Next()
+    {
+        State = State * 1664525 + 1013904223;
+        return State >> 8;
+    }
+};
+
+// Small-block sizes roughly as the tree requests them: mostly strings, list
+// and hash nodes and messages under 128 bytes, some array storage above.
+static UPInt RandomSize(Random& r)
+{
+    UInt32 pick = r.Next() % 100;
+    if (pick < 50)
+        return 8 + r.Next() % 56;
+    if (pick < 85)
+        return 64 + r.Next() % 64;
+    return 128 + r.Next() % 384;
+}
+
+
+//-------------------------------------------------------------------------------------
+// ***** Workloads
+
+// Each returns the time taken in microseconds for OpsPerRun operations.
+
+// Allocate and immediately free, as with temporaries.
+static UInt64 RunPairs(Random& r)
+{
+    UInt64 start = Timer::GetProfileTicks();
+    for (UPInt i = 0; i < OpsPerRun; i++)
+    {
+        void* p = OVR_ALLOC(RandomSize(r));
+        *(UByte*)p = 0;
+        OVR_FREE(p);
+    }
+    return Timer::GetProfileTicks() - start;
+}
+
+// Allocate a few thousand blocks and free them in random order, as a scene
+// load or a rebuilt cache does.
+static UInt64 RunBatches(Random& r)
+{
+    enum { BatchSize = 4096 };
+    void* blocks[BatchSize];
+
+    UInt64 start = Timer::GetProfileTicks();
+    for (UPInt done = 0; done < OpsPerRun; done += BatchSize)
+    {
+        for (UPInt i = 0; i < BatchSize; i++)
+            blocks[i] = OVR_ALLOC(RandomSize(r));
+        for (UPInt i = BatchSize; i > 1; i--)
+            Alg::Swap(blocks[i - 1], blocks[r.Next() % i]);
+        for (UPInt i = 0; i < BatchSize; i++)
+            OVR_FREE(blocks[i]);
+    }
+    return Timer::GetProfileTicks() - start;
+}
+
+// Build strings and arrays by appending, which goes through Realloc. An
+// operation is one character and one element appended.
+static UInt64 RunGrowth(Random& r)
+{
+    UPInt ops = 0;
+    UInt64 start = Timer::GetProfileTicks();
+    while (ops < OpsPerRun)
+    {
+        String     s;
+        Array<int> a;
+        UPInt      length = 4 + r.Next() % 60;
+        for (UPInt i = 0; i < length; i++)
+        {
+            s.AppendChar('a' + (i & 15));
+            a.PushBack((int)i);
+        }
+        ops += length;
+    }
+    return Timer::GetProfileTicks() - start;
+}
+
+// Blocks allocated on one thread and freed on another, as with device
+// messages and queued commands.
+struct HandoffRing : public NewOverrideBase
+{
+    MPSCRing<void*, 1024> Ring;
+};
+
+static int consumeHandoffs(Thread*, void* h)
+{
+    HandoffRing* ring = (HandoffRing*)h;
+    for (UPInt freed = 0; freed < OpsPerRun; )
+    {
+        void** value = ring->Ring.Peek();
+        if (!value)
+        {
+            Thread::MSleep(0);
+            continue;
+        }
+        OVR_FREE(*value);
+        ring->Ring.Pop();
+        freed++;
+    }
+    return 0;
+}
+
+static UInt64 RunHandoff(Random& r)
+{
+    HandoffRing* ring = new HandoffRing;
+    Ptr<Thread> consumer = *new Thread(consumeHandoffs, ring);
+
+    UInt64 start = Timer::GetProfileTicks();
+    consumer->Start();
+    for (UPInt i = 0; i < OpsPerRun; i++)
+    {
+        void*  p = OVR_ALLOC(RandomSize(r));
+        UInt32 pos;
+        void** value;
+        while ((value = ring->Ring.Claim(&pos)) == 0)
+            Thread::MSleep(0);
+        *value = p;
+        ring->Ring.Publish(pos);
+    }
+    while (!consumer->IsFinished())
+        Thread::MSleep(0);
+    UInt64 time = Timer::GetProfileTicks() - start;
+
+    delete ring;
+    return time;
+}
+
+// RunPairs on four threads at once; the time is the slowest thread's.
+struct PairsThread : public Thread
+{
+    UInt32 Seed;
+    UInt64 Time;
+    PairsThread(UInt32 seed) : Seed(seed), Time(0) { }
+    virtual int Run()
+    {
+        Random r(Seed);
+        Time = RunPairs(r);
+        return 0;
+    }
+};
+
+static UInt64 RunThreadedPairs(Random& r)
+{
+    enum { ThreadCount = 4 };
+    Ptr<PairsThread> threads[ThreadCount];
+    for (int i = 0; i < ThreadCount; i++)
+    {
+        threads[i] = *new PairsThread(r.Next());
+        threads[i]->Start();
+    }
+    UInt64 slowest = 0;
+    for (int i = 0; i < ThreadCount; i++)
+    {
+        while (!threads[i]->IsFinished())
+            Thread::MSleep(1);
+        slowest = Alg::Max(slowest, threads[i]->Time);
+    }
+    return slowest;
+}
+
+
+//-------------------------------------------------------------------------------------
+// ***** Timing
+
+typedef UInt64 (*Workload)(Random& r);
+
+struct WorkloadInfo
+{
+    const char* Name;
+    Workload    Run;
+};
+
+static const WorkloadInfo Workloads[] =
+{
+    { "alloc/free pairs",        RunPairs },
+    { "batches, random frees",   RunBatches },
+    { "String/Array appends",    RunGrowth },
+    { "free on other thread",    RunHandoff },
+    { "pairs on 4 threads",      RunThreadedPairs }
+};
+enum { WorkloadCount = sizeof(Workloads) / sizeof(Workloads[0]) };
+
+// Median ns per operation of each workload with allocator installed.
+static void TimeAllocator(Allocator* allocator, double* results)
+{
+    System::Init(Log::ConfigureDefaultLog(LogMask_None), allocator);
+
+    for (int w = 0; w < WorkloadCount; w++)
+    {
+        double runs[RunCount];
+        Random r(12345);
+        // One untimed run, so chunks and caches are warm as in a running app.
+        Workloads[w].Run(r);
+        for (int i = 0; i < RunCount; i++)
+            runs[i] = Workloads[w].Run(r) * 1000.0 / (double)OpsPerRun;
+        Alg::ArrayAdaptor<double> sorted(runs, RunCount);
+        Alg::QuickSort(sorted);
+        results[w] = runs[RunCount / 2];
+    }
+
+    System::Destroy();
+}
+
+
+int main()
+{
+    double before[WorkloadCount], after[WorkloadCount];
+    TimeAllocator(DefaultAllocator::InitSystemSingleton(), before);
+    TimeAllocator(PoolAllocator::InitSystemSingleton(), after);
+
+    printf("%d CPUs\n", Thread::GetCPUCount());
+    printf("%-24s %10s %10s %8s\n", "ns per operation", "malloc", "pool", "speedup");
+    for (int w = 0; w < WorkloadCount; w++)
+        printf("%-24s %10.1f %10.1f %7.2fx\n", Workloads[w].Name,
+               before[w], after[w], before[w] / after[w]);
+    return 0;
+}
@@ -0,0 +1,354 @@
+/************************************************************************************
+
+Filename    :   FlatHashBench.cpp
+Content     :   Speed benchmark of FlatHash against Hash on the tree's own tables
+Created     :   October 18, 2026
+Notes       :   Usage: FlatHashBench
+
+                Each table below copies the key, value and hash functor of one
+                Hash or HashSet in the tree, and is filled to the size that table
+                reaches in use, then to 16 times that. For each it times building
+                the table, looking up keys that are in it, and looking up keys
+                that aren't, with Hash and with FlatHash, in nanoseconds per key.
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*************************************************************************************/
+
+#include "OVR.h"
+#include "Kernel/OVR_FlatHash.h"
+#include "Kernel/OVR_Timer.h"
+
+#include <stdio.h>
+
+using namespace OVR;
+
+// Keys timed per measurement; tables are rebuilt or re-probed until reached.
+static const UPInt KeysPerRun = 4000000;
+
+static volatile UPInt Sink;
+
+// Deterministic pseudo-random numbers, so every run probes the same order.
+static UInt32 RandomState = 12345;
+static UInt32 Random()
+{
+    RandomState = RandomState * 1664525 + 1013904223;
+    return RandomState >> 8;
+}
+
+template<class K>
+static void Shuffle(Array<K>& keys)
+{
+    for (UPInt i = keys.GetSize(); i > 1; i--)
+        Alg::Swap(keys[i - 1], keys[Random() % i]);
+}
+
+
+//-------------------------------------------------------------------------------------
+// ***** Key sources
+
+// Each source makes the i'th distinct key of its table, shaped like the keys the
+// real table holds. Objects that keys point to are allocated like the real ones.
+
+// Container::SortByFill groups: Hash<const void*, UPInt>, keyed by ShaderFill.
+struct FillKeys
+{
+    typedef const void* Key;
+    typedef UPInt       Value;
+    typedef FixedSizeHash<const void*> HashF;
+
+    Array<void*> Objects;
+    ~FillKeys()
+    {
+        for (UPInt i = 0; i < Objects.GetSize(); i++)
+            OVR_FREE(Objects[i]);
+    }
+    Key Make(UPInt)
+    {
+        Objects.PushBack(OVR_ALLOC(96));
+        return Objects.Back();
+    }
+};
+
+// XmlSceneLoader::Materials: Hash<Material, Ptr<ShaderFill>, Material::HashFunctor>.
+struct MaterialKeys
+{
+    struct Key
+    {
+        int   VertexShader;
+        int   FragmentShader;
+        void* Textures[2];
+
+        bool operator==(const Key& b) const
+        {
+            return VertexShader == b.VertexShader && FragmentShader == b.FragmentShader &&
+                   Textures[0] == b.Textures[0] && Textures[1] == b.Textures[1];
+        }
+    };
+    struct HashF
+    {
+        UPInt operator()(const Key& m) const
+        {
+            return String::BernsteinHashFunction(&m, sizeof(Key));
+        }
+    };
+    typedef void* Value;
+
+    Array<void*> Textures;
+    ~MaterialKeys()
+    {
+        for (UPInt i = 0; i < Textures.GetSize(); i++)
+            OVR_FREE(Textures[i]);
+    }
+    Key Make(UPInt)
+    {
+        // A diffuse texture and, for most models, a lightmap.
+        Textures.PushBack(OVR_ALLOC(64));
+        Key k;
+        memset(&k, 0, sizeof(k));
+        k.VertexShader   = 0;
+        k.FragmentShader = (Random() & 3) ? 8 : 2;
+        k.Textures[0]    = Textures.Back();
+        k.Textures[1]    = (k.FragmentShader == 8) ? Textures[Random() % Textures.GetSize()] : 0;
+        return k;
+    }
+};
+
+// GL RenderDevice::Programs: Hash<ProgramKey, Ptr<Program>, ProgramKey::HashFunctor>.
+struct ProgramKeys
+{
+    struct Key
+    {
+        const void* VS;
+        const void* FS;
+
+        bool operator==(const Key& b) const { return VS == b.VS && FS == b.FS; }
+    };
+    struct HashF
+    {
+        UPInt operator()(const Key& k) const
+        {
+            return ((UPInt) k.VS >> 4) * 31 + ((UPInt) k.FS >> 4);
+        }
+    };
+    typedef void* Value;
+
+    // One object per builtin shader, as the device creates them.
+    Array<void*> Shaders;
+    ProgramKeys()
+    {
+        for (int i = 0; i < 16; i++)
+            Shaders.PushBack(OVR_ALLOC(48));
+    }
+    ~ProgramKeys()
+    {
+        for (UPInt i = 0; i < Shaders.GetSize(); i++)
+            OVR_FREE(Shaders[i]);
+    }
+    Key Make(UPInt i)
+    {
+        Key k = { Shaders[i % 5], Shaders[5 + (i / 5) % 11] };
+        if (i >= 55)
+        {
+            // Past the builtin pairs, as with user shaders.
+            Shaders.PushBack(OVR_ALLOC(48));
+            k.FS = Shaders.Back();
+        }
+        return k;
+    }
+};
+
+// CaptureHIDDeviceManager::Pending: Hash<String, PendingDevice, String::HashFunctor>.
+struct DevicePathKeys
+{
+    typedef String              Key;
+    typedef Array<Array<UByte> > Value;
+    typedef String::HashFunctor HashF;
+
+    Key Make(UPInt i)
+    {
+        char path[64];
+        OVR_sprintf(path, sizeof(path), "/dev/hidraw%u", (unsigned)i);
+        return String(path);
+    }
+};
+
+// ThreadList::ThreadSet: HashSet<Thread*, ThreadHashOp>.
+struct ThreadKeys
+{
+    typedef Thread* Key;
+    struct HashF
+    {
+        size_t operator()(const Thread* ptr) const
+        {
+            return (((size_t)ptr) >> 6) ^ (size_t)ptr;
+        }
+    };
+
+    Array<void*> Objects;
+    ~ThreadKeys()
+    {
+        for (UPInt i = 0; i < Objects.GetSize(); i++)
+            OVR_FREE(Objects[i]);
+    }
+    Key Make(UPInt)
+    {
+        Objects.PushBack(OVR_ALLOC(sizeof(Thread)));
+        return (Thread*)Objects.Back();
+    }
+};
+
+// CaptureHIDDevice::FeatureReports: Hash<UByte, Array<UByte> >.
+struct ReportIdKeys
+{
+    typedef UByte         Key;
+    typedef Array<UByte>  Value;
+    typedef FixedSizeHash<UByte> HashF;
+
+    Key Make(UPInt i) { return (UByte)i; }
+};
+
+
+//-------------------------------------------------------------------------------------
+// ***** Timing
+
+struct Times
+{
+    double Build, Hit, Miss;
+};
+
+// Hash and FlatHash tables share Add and Get(key); HashSet and FlatHashSet take
+// the value as the key, so adding goes through a helper.
+template<class T, class K, class V>
+static void addKey(T& table, const K& key, const V*) { table.Add(key, V()); }
+template<class T, class K>
+static void addKey(T& table, const K& key, const void*) { table.Add(key); }
+
+template<class T, class K, class V>
+static Times TimeTable(const Array<K>& keys, const Array<K>& missing, const V* valueTag)
+{
+    Times  t;
+    UPInt  n    = keys.GetSize();
+    UPInt  runs = KeysPerRun / n + 1;
+    UPInt  found = 0;
+
+    UInt64 start = Timer::GetProfileTicks();
+    for (UPInt r = 0; r < runs; r++)
+    {
+        T table;
+        for (UPInt i = 0; i < n; i++)
+            addKey(table, keys[i], valueTag);
+        found += table.GetSize();
+    }
+    t.Build = (Timer::GetProfileTicks() - start) * 1000.0 / (double)(runs * n);
+
+    T table;
+    for (UPInt i = 0; i < n; i++)
+        addKey(table, keys[i], valueTag);
+
+    Array<K> order(keys);
+    Shuffle(order);
+
+    start = Timer::GetProfileTicks();
+    for (UPInt r = 0; r < runs; r++)
+    {
+        for (UPInt i = 0; i < n; i++)
+            found += (table.Get(order[i]) != 0);
+    }
+    t.Hit = (Timer::GetProfileTicks() - start) * 1000.0 / (double)(runs * n);
+
+    start = Timer::GetProfileTicks();
+    for (UPInt r = 0; r < runs; r++)
+    {
+        for (UPInt i = 0; i < n; i++)
+            found += (table.Get(missing[i]) != 0);
+    }
+    t.Miss = (Timer::GetProfileTicks() - start) * 1000.0 / (double)(runs * n);
+
+    Sink = found;
+    return t;
+}
+
+static void PrintRow(const char* name, UPInt size, const Times& hash, const Times& flat)
+{
+    printf("%-22s %6u   %6.1f %6.1f %5.2fx   %6.1f %6.1f %5.2fx   %6.1f %6.1f %5.2fx\n",
+           name, (unsigned)size,
+           hash.Build, flat.Build, hash.Build / flat.Build,
+           hash.Hit,   flat.Hit,   hash.Hit / flat.Hit,
+           hash.Miss,  flat.Miss,  hash.Miss / flat.Miss);
+}
+
+// Times a Hash<Key, Value> table against FlatHash<Key, Value>.
+template<class Source>
+static void BenchMap(const char* name, UPInt size)
+{
+    typedef typename Source::Key   K;
+    typedef typename Source::Value V;
+    typedef typename Source::HashF H;
+
+    Source   source;
+    Array<K> keys, missing;
+    for (UPInt i = 0; i < size * 2; i++)
+        ((i & 1) ? missing : keys).PushBack(source.Make(i));
+
+    Times hash = TimeTable<Hash<K, V, H>, K, V>(keys, missing, (const V*)0);
+    Times flat = TimeTable<FlatHash<K, V, H>, K, V>(keys, missing, (const V*)0);
+    PrintRow(name, size, hash, flat);
+}
+
+// Times a HashSet<Key> table against FlatHashSet<Key>.
+template<class Source>
+static void BenchSet(const char* name, UPInt size)
+{
+    typedef typename Source::Key   K;
+    typedef typename Source::HashF H;
+
+    Source   source;
+    Array<K> keys, missing;
+    for (UPInt i = 0; i < size * 2; i++)
+        ((i & 1) ? missing : keys).PushBack(source.Make(i));
+
+    Times hash = TimeTable<HashSet<K, H>, K, void>(keys, missing, (const void*)0);
+    Times flat = TimeTable<FlatHashSet<K, H>, K, void>(keys, missing, (const void*)0);
+    PrintRow(name, size, hash, flat);
+}
+
+
+int main()
+{
+    System::Init(Log::ConfigureDefaultLog(LogMask_None));
+
+    printf("%-22s %6s   %-22s   %-22s   %-22s\n", "ns per key", "size",
+           "build Hash/Flat/speedup", "hit Hash/Flat/speedup", "miss Hash/Flat/speedup");
+
+    // Sizes are those each table reaches with the Tuscany scene and one
+    // tracker, then 16 times that.
+    for (UPInt scale = 1; scale <= 16; scale *= 16)
+    {
+        BenchMap<FillKeys>      ("SortByFill groups",   48 * scale);
+        BenchMap<MaterialKeys>  ("XmlScene Materials",  40 * scale);
+        BenchMap<ProgramKeys>   ("GL Programs",         12 * scale);
+        BenchMap<DevicePathKeys>("HIDCapture Pending",   2 * scale);
+        BenchSet<ThreadKeys>    ("ThreadList ThreadSet", 4 * scale);
+        BenchMap<ReportIdKeys>  ("HIDCapture Reports",   8 * scale);
+        printf("\n");
+    }
+
+    System::Destroy();
+    return 0;
+}
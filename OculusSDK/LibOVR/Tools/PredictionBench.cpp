@@ -0,0 +1,431 @@
+/************************************************************************************
+
+Filename    :   PredictionBench.cpp
+Content     :   Accuracy benchmark for the SensorFusion orientation predictors
+Created     :   October 18, 2026
+Notes       :   Usage: PredictionBench [capture file...]
+
+                Runs synthetic head motion, then every capture file given (recorded
+                with DeviceManagerOptions::CapturePath, e.g. Hackulus -capture),
+                through SensorFusion. At each sample it predicts ahead with each
+                predictor, and reports the angle between each prediction and the
+                orientation SensorFusion reaches when that time comes. Scoring
+                against the fusion's own later estimate isolates prediction error
+                from fusion error, and works the same for recorded motion, whose
+                true orientation is unknown.
+
+Copyright   :   Copyright 2013 Oculus VR, Inc. All Rights reserved.
+
+Licensed under the Oculus VR SDK License Version 2.0 (the "License");
+you may not use the Oculus VR SDK except in compliance with the License,
+which is provided at the time of installation or download, or which
+otherwise accompanies this software in either electronic or hard copy form.
+
+You may obtain a copy of the License at
+
+http://www.oculusvr.com/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, the Oculus VR SDK
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*************************************************************************************/
+
+#include "OVR.h"
+#include "Kernel/OVR_Threads.h"
+
+#include <stdio.h>
+#include <math.h>
+
+using namespace OVR;
+
+// Lookaheads scored, in seconds.
+static const float Lookaheads[] = { 0.010f, 0.020f, 0.040f, 0.060f };
+enum { LookaheadCount = sizeof(Lookaheads) / sizeof(Lookaheads[0]) };
+
+// Predictions made before the fusion has settled aren't scored.
+static const double SettleSeconds = 1.0;
+
+// No prediction is scored too, as the error that prediction has to beat.
+enum BenchPredictor
+{
+    Bench_None,
+    Bench_ConstantVelocity,
+    Bench_ConstantAcceleration,
+    Bench_PredictorCount
+};
+
+static const char* PredictorNames[Bench_PredictorCount] =
+{
+    "none", "const velocity", "const accel"
+};
+
+
+//-------------------------------------------------------------------------------------
+// ***** PredictionScorer
+
+// Feeds one stream of samples to a SensorFusion and accumulates the error of
+// every predictor at every lookahead.
+class PredictionScorer
+{
+public:
+    PredictionScorer() : SampleTime(0), SampleCount(0)
+    {
+        Fusion.SetPrediction(0.0f, true);
+        for (int k = 0; k < LookaheadCount; k++)
+            Queues[k].Head = Queues[k].Tail = 0;
+        memset(Stats, 0, sizeof(Stats));
+    }
+
+    void    AddSample(const MessageBodyFrame& frame);
+    int     GetSampleCount() const { return SampleCount; }
+    void    Report(const char* name) const;
+
+private:
+    struct Pending
+    {
+        double  Target;
+        Quatf   Predicted[Bench_PredictorCount];
+    };
+
+    // Predictions waiting for their target time; targets arrive in order.
+    struct PendingQueue
+    {
+        enum { Size = 1024 };
+        Pending Items[Size];
+        int     Head, Tail;
+    };
+
+    struct ErrorStats
+    {
+        int     Count;
+        double  Sum;
+        double  SumSq;
+        double  Max;
+    };
+
+    void    score(int lookahead, const Pending& p, const Quatf& actual);
+
+    SensorFusion    Fusion;
+    double          SampleTime;
+    int             SampleCount;
+    Quatf           LastQ;
+    PendingQueue    Queues[LookaheadCount];
+    ErrorStats      Stats[Bench_PredictorCount][LookaheadCount];
+};
+
+// Angle of the rotation between two orientations, in degrees.
+static double AngleBetween(const Quatf& a, const Quatf& b)
+{
+    double dot = fabs((double)a.x * b.x + (double)a.y * b.y + (double)a.z * b.z + (double)a.w * b.w);
+    return 2.0 * acos(dot < 1.0 ? dot : 1.0) * (180.0 / Math<double>::Pi);
+}
+
+// Normalized linear interpolation; accurate enough over one sample interval.
+static Quatf Nlerp(const Quatf& a, const Quatf& b, float t)
+{
+    float sign = (a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w) < 0 ? -1.0f : 1.0f;
+    Quatf q(a.x + (sign * b.x - a.x) * t, a.y + (sign * b.y - a.y) * t,
+            a.z + (sign * b.z - a.z) * t, a.w + (sign * b.w - a.w) * t);
+    return q.Normalized();
+}
+
+void PredictionScorer::AddSample(const MessageBodyFrame& frame)
+{
+    double lastTime = SampleTime;
+    SampleTime += frame.TimeDelta;
+    Fusion.OnMessage(frame);
+    Quatf q = Fusion.GetOrientation();
+
+    for (int k = 0; k < LookaheadCount; k++)
+    {
+        PendingQueue& queue = Queues[k];
+
+        // Score predictions whose target falls between the last sample and this one.
+        while (queue.Head != queue.Tail && queue.Items[queue.Head].Target <= SampleTime)
+        {
+            const Pending& p = queue.Items[queue.Head];
+            double span  = SampleTime - lastTime;
+            float  t     = (span > 0) ? (float)((p.Target - lastTime) / span) : 1.0f;
+            score(k, p, Nlerp(LastQ, q, Alg::Max(0.0f, t)));
+            queue.Head = (queue.Head + 1) % PendingQueue::Size;
+        }
+
+        int next = (queue.Tail + 1) % PendingQueue::Size;
+        if ((SampleTime < SettleSeconds) || (next == queue.Head))
+            continue;
+        Pending& p = queue.Items[queue.Tail];
+        p.Target = SampleTime + Lookaheads[k];
+        p.Predicted[Bench_None] = q;
+        Fusion.SetPredictor(SensorFusion::Predictor_ConstantVelocity);
+        p.Predicted[Bench_ConstantVelocity] = Fusion.GetPredictedOrientation(Lookaheads[k]);
+        Fusion.SetPredictor(SensorFusion::Predictor_ConstantAcceleration);
+        p.Predicted[Bench_ConstantAcceleration] = Fusion.GetPredictedOrientation(Lookaheads[k]);
+        queue.Tail = next;
+    }
+
+    LastQ = q;
+    SampleCount++;
+}
+
+void PredictionScorer::score(int lookahead, const Pending& p, const Quatf& actual)
+{
+    for (int i = 0; i < Bench_PredictorCount; i++)
+    {
+        double      error = AngleBetween(p.Predicted[i], actual);
+        ErrorStats& s     = Stats[i][lookahead];
+        s.Count++;
+        s.Sum   += error;
+        s.SumSq += error * error;
+        if (error > s.Max)
+            s.Max = error;
+    }
+}
+
+void PredictionScorer::Report(const char* name) const
+{
+    printf("%s (%d samples, %.1f s)\n", name, SampleCount, SampleTime);
+    printf("  %-16s", "error, degrees");
+    for (int k = 0; k < LookaheadCount; k++)
+        printf("  %6.0f ms mean/rms/max ", Lookaheads[k] * 1000.0f);
+    printf("\n");
+
+    for (int i = 0; i < Bench_PredictorCount; i++)
+    {
+        printf("  %-16s", PredictorNames[i]);
+        for (int k = 0; k < LookaheadCount; k++)
+        {
+            const ErrorStats& s = Stats[i][k];
+            if (s.Count == 0)
+            {
+                printf("  %24s", "-");
+                continue;
+            }
+            printf("  %6.3f / %6.3f / %6.2f", s.Sum / s.Count, sqrt(s.SumSq / s.Count), s.Max);
+        }
+        printf("\n");
+    }
+    printf("\n");
+}
+
+
+//-------------------------------------------------------------------------------------
+// ***** Synthetic motion
+
+// Body angular velocity, in rad/s, of a head motion at time t.
+typedef Vector3f (*AngularVelocityFunc)(double t);
+
+static const double Pi = Math<double>::Pi;
+
+// Turning at a steady 90 degrees per second.
+static Vector3f SteadyTurn(double)
+{
+    return Vector3f(0, (float)(Pi / 2), 0);
+}
+
+// Shaking the head, +-30 degrees at 1.5 Hz.
+static Vector3f HeadShake(double t)
+{
+    const double amplitude = Pi / 6, freq = 1.5;
+    return Vector3f(0, (float)(amplitude * 2 * Pi * freq * cos(2 * Pi * freq * t)), 0);
+}
+
+// Nodding, +-20 degrees at 1 Hz.
+static Vector3f Nod(double t)
+{
+    const double amplitude = Pi / 9, freq = 1.0;
+    return Vector3f((float)(amplitude * 2 * Pi * freq * cos(2 * Pi * freq * t)), 0, 0);
+}
+
+// 90-degree minimum-jerk turns lasting 0.4 s, alternating direction, with a
+// 0.6 s pause after each; the starts and stops are the hard part to predict.
+static Vector3f QuickTurns(double t)
+{
+    const double angle = Pi / 2, duration = 0.4, period = 1.0;
+    int    turn = (int)(t / period);
+    double tau  = (t - turn * period) / duration;
+    if (tau >= 1.0)
+        return Vector3f(0, 0, 0);
+    double speed = angle / duration * 30 * tau * tau * (1 - tau) * (1 - tau);
+    return Vector3f(0, (float)((turn & 1) ? -speed : speed), 0);
+}
+
+// Looking around: unrelated sinusoids on every axis.
+static Vector3f Wander(double t)
+{
+    return Vector3f((float)(0.6 * sin(2 * Pi * 0.37 * t) + 0.3 * sin(2 * Pi * 1.3 * t + 1.0)),
+                    (float)(1.2 * sin(2 * Pi * 0.23 * t) + 0.5 * sin(2 * Pi * 0.9 * t + 2.0)),
+                    (float)(0.3 * sin(2 * Pi * 0.51 * t + 0.5)));
+}
+
+struct MotionProfile
+{
+    const char*         Name;
+    AngularVelocityFunc AngularVelocity;
+};
+
+static const MotionProfile Profiles[] =
+{
+    { "steady turn", SteadyTurn },
+    { "head shake",  HeadShake  },
+    { "nod",         Nod        },
+    { "quick turns", QuickTurns },
+    { "wander",      Wander     }
+};
+
+// Deterministic Gaussian noise, so runs can be compared.
+class NoiseSource
+{
+public:
+    NoiseSource() : State(12345) { }
+
+    float Gaussian(float sigma)
+    {
+        double u1 = (next() + 1.0) / 4294967297.0;
+        double u2 = next() / 4294967296.0;
+        return (float)(sigma * sqrt(-2.0 * log(u1)) * cos(2 * Pi * u2));
+    }
+
+private:
+    UInt32 next()
+    {
+        State = State * 1664525u + 1013904223u;
+        return State;
+    }
+    UInt32 State;
+};
+
+// Samples the profile like the tracker does, at 1 kHz with gyro and accelerometer
+// noise, and scores the predictions over it.
+static void RunProfile(const MotionProfile& profile, double seconds)
+{
+    const float sampleDt   = 0.001f;
+    const float gyroNoise  = 0.005f;    // rad/s
+    const float accelNoise = 0.02f;     // m/s^2
+
+    PredictionScorer scorer;
+    NoiseSource      noise;
+    MessageBodyFrame frame(0);
+    Quatf            truth;
+    int              samples = (int)(seconds / sampleDt);
+
+    for (int i = 0; i < samples; i++)
+    {
+        double   t     = i * (double)sampleDt;
+        Vector3f omega = profile.AngularVelocity(t);
+        float    angle = omega.Length() * sampleDt;
+        if (angle > 0)
+            truth = (truth * Quatf(omega / omega.Length(), angle)).Normalized();
+
+        Vector3f gravity = truth.Inverted().Rotate(Vector3f(0, 9.81f, 0));
+        frame.RotationRate = omega + Vector3f(noise.Gaussian(gyroNoise), noise.Gaussian(gyroNoise),
+                                              noise.Gaussian(gyroNoise));
+        frame.Acceleration = gravity + Vector3f(noise.Gaussian(accelNoise), noise.Gaussian(accelNoise),
+                                                noise.Gaussian(accelNoise));
+        frame.TimeDelta           = sampleDt;
+        frame.AbsoluteTimeSeconds = t;
+        scorer.AddSample(frame);
+    }
+
+    scorer.Report(profile.Name);
+}
+
+
+//-------------------------------------------------------------------------------------
+// ***** Recorded motion
+
+// Passes every sample of the replayed sensor to the scorer, on the device
+// manager thread.
+class CaptureHandler : public MessageHandler
+{
+public:
+    CaptureHandler(PredictionScorer* scorer) : pScorer(scorer) { }
+    ~CaptureHandler() { RemoveHandlerFromDevices(); }
+
+    virtual void OnMessage(const Message& msg)
+    {
+        if (msg.Type == Message_BodyFrame)
+        {
+            pScorer->AddSample(static_cast<const MessageBodyFrame&>(msg));
+        }
+        else if (msg.Type == Message_BodyFrameBatch)
+        {
+            const MessageBodyFrameBatch& batch = static_cast<const MessageBodyFrameBatch&>(msg);
+            MessageBodyFrame             frame(batch.pDevice);
+            for (unsigned i = 0; i < batch.SampleCount; i++)
+            {
+                batch.GetFrame(i, &frame);
+                pScorer->AddSample(frame);
+            }
+        }
+    }
+
+private:
+    PredictionScorer* pScorer;
+};
+
+static bool RunCapture(const char* path)
+{
+    DeviceManagerOptions options;
+    options.ReplayPath     = path;
+    options.ReplayRealTime = false;
+
+    Ptr<DeviceManager> manager = *DeviceManager::Create(options);
+    if (!manager)
+        return false;
+    Ptr<SensorDevice> sensor = *manager->EnumerateDevices<SensorDevice>().CreateDevice();
+    if (!sensor)
+    {
+        printf("%s: no sensor in capture\n\n", path);
+        return false;
+    }
+
+    PredictionScorer* scorer = new PredictionScorer;
+    {
+        CaptureHandler handler(scorer);
+        sensor->SetMessageHandler(&handler);
+
+        // Replay runs as fast as the samples are consumed; it has finished once
+        // they stop coming.
+        int lastCount = -1;
+        for (int idle = 0; idle < 10; idle++)
+        {
+            Thread::MSleep(100);
+            Lock::Locker lock(handler.GetHandlerLock());
+            if (scorer->GetSampleCount() != lastCount)
+            {
+                lastCount = scorer->GetSampleCount();
+                idle = 0;
+            }
+        }
+    }
+
+    bool played = (scorer->GetSampleCount() > 0);
+    if (played)
+        scorer->Report(path);
+    else
+        printf("%s: no samples replayed\n\n", path);
+    delete scorer;
+    return played;
+}
+
+
+int main(int argc, char** argv)
+{
+    System::Init(Log::ConfigureDefaultLog(LogMask_None));
+
+    for (unsigned i = 0; i < sizeof(Profiles) / sizeof(Profiles[0]); i++)
+        RunProfile(Profiles[i], 20.0);
+
+    int failures = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!RunCapture(argv[i]))
+            failures++;
+    }
+
+    System::Destroy();
+    return failures ? 1 : 0;
+}